@@ -0,0 +1,54 @@
+# Copyright (c) 2023 The STE||AR-Group
+#
+# SPDX-License-Identifier: BSL-1.0
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+find_package(PkgConfig QUIET)
+pkg_check_modules(PC_LZ4 QUIET liblz4)
+
+find_path(
+  LZ4_INCLUDE_DIR lz4.h
+  HINTS ${LZ4_ROOT}
+        ENV
+        LZ4_ROOT
+        ${PC_LZ4_MINIMAL_INCLUDEDIR}
+        ${PC_LZ4_MINIMAL_INCLUDE_DIRS}
+        ${PC_LZ4_INCLUDEDIR}
+        ${PC_LZ4_INCLUDE_DIRS}
+  PATH_SUFFIXES include
+)
+
+find_library(
+  LZ4_LIBRARY
+  NAMES lz4 liblz4
+  HINTS ${LZ4_ROOT}
+        ENV
+        LZ4_ROOT
+        ${PC_LZ4_MINIMAL_LIBDIR}
+        ${PC_LZ4_MINIMAL_LIBRARY_DIRS}
+        ${PC_LZ4_LIBDIR}
+        ${PC_LZ4_LIBRARY_DIRS}
+  PATH_SUFFIXES lib lib64
+)
+
+set(LZ4_LIBRARIES ${LZ4_LIBRARY})
+set(LZ4_INCLUDE_DIRS ${LZ4_INCLUDE_DIR})
+
+find_package_handle_standard_args(
+  LZ4 DEFAULT_MSG LZ4_LIBRARY LZ4_INCLUDE_DIR
+)
+
+get_property(
+  _type
+  CACHE LZ4_ROOT
+  PROPERTY TYPE
+)
+if(_type)
+  set_property(CACHE LZ4_ROOT PROPERTY ADVANCED 1)
+  if("x${_type}" STREQUAL "xUNINITIALIZED")
+    set_property(CACHE LZ4_ROOT PROPERTY TYPE PATH)
+  endif()
+endif()
+
+mark_as_advanced(LZ4_ROOT LZ4_LIBRARY LZ4_INCLUDE_DIR)
@@ -72,6 +72,12 @@ namespace hpx { namespace server {
 
         explicit partitioned_vector(size_type partition_size);
 
+        /// Constructor which creates a partitioned_vector_partition using the
+        /// given allocator (for instance an allocator placing the partition
+        /// onto a given NUMA domain).
+        partitioned_vector(
+            size_type partition_size, allocator_type const& alloc);
+
         /// Constructor which create and initialize partitioned_vector_partition
         /// with all elements as \a val.
         ///
@@ -46,6 +46,14 @@ namespace hpx { namespace server {
     {
     }
 
+    template <typename T, typename Data>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
+    partitioned_vector<T, Data>::partitioned_vector(
+        size_type partition_size, allocator_type const& alloc)
+      : partitioned_vector_partition_(partition_size, alloc)
+    {
+    }
+
     template <typename T, typename Data>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
     partitioned_vector<T, Data>::partitioned_vector(
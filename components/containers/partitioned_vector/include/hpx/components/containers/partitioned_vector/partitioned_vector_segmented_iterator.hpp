@@ -18,9 +18,12 @@
 #include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_base/launch_policy.hpp>
+#include <hpx/compute_local/host/block_executor.hpp>
+#include <hpx/compute_local/host/target.hpp>
 #include <hpx/iterator_support/iterator_adaptor.hpp>
 #include <hpx/iterator_support/iterator_facade.hpp>
 #include <hpx/naming_base/id_type.hpp>
+#include <hpx/type_support/detected.hpp>
 
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_component_decl.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_fwd.hpp>
@@ -82,6 +85,12 @@ namespace hpx { namespace segmented {
                 local_index, data_);
         }
 
+        std::shared_ptr<server::partitioned_vector<T, Data>> const& get_data()
+            const noexcept
+        {
+            return data_;
+        }
+
     private:
         std::shared_ptr<server::partitioned_vector<T, Data>> data_;
     };
@@ -132,6 +141,12 @@ namespace hpx { namespace segmented {
                 local_index, data_);
         }
 
+        std::shared_ptr<server::partitioned_vector<T, Data>> const& get_data()
+            const noexcept
+        {
+            return data_;
+        }
+
     private:
         std::shared_ptr<server::partitioned_vector<T, Data>> data_;
     };
@@ -1170,6 +1185,54 @@ namespace hpx { namespace traits {
         }
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+        template <typename Allocator>
+        using allocator_target_t =
+            decltype(std::declval<Allocator const&>().target());
+
+        // Partitions allocated by host allocators which are bound to a set
+        // of targets (NUMA domains, see hpx::compute::host::target_layout)
+        // should be processed on exactly those targets.
+        template <typename T, typename Data>
+        struct partitioned_vector_local_execution_traits
+        {
+            using target_type =
+                std::decay_t<hpx::util::detected_t<allocator_target_t,
+                    typename Data::allocator_type>>;
+
+            template <typename ExPolicy, typename Iter>
+            static decltype(auto) bind(ExPolicy&& policy, Iter const& it)
+            {
+                if constexpr (std::is_same_v<target_type,
+                                  std::vector<hpx::compute::host::target>>)
+                {
+                    HPX_ASSERT(it.get_data());
+                    return policy.on(hpx::compute::host::block_executor<>(
+                        it.get_data()->get_data().get_allocator().target()));
+                }
+                else
+                {
+                    return HPX_FORWARD(ExPolicy, policy);
+                }
+            }
+        };
+    }    // namespace detail
+
+    template <typename T, typename Data, typename BaseIter>
+    struct segmented_local_execution_traits<
+        segmented::local_raw_vector_iterator<T, Data, BaseIter>>
+      : detail::partitioned_vector_local_execution_traits<T, Data>
+    {
+    };
+
+    template <typename T, typename Data, typename BaseIter>
+    struct segmented_local_execution_traits<
+        segmented::const_local_raw_vector_iterator<T, Data, BaseIter>>
+      : detail::partitioned_vector_local_execution_traits<T, Data>
+    {
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T, typename Data>
     struct is_value_proxy<
@@ -14,13 +14,17 @@
 #include <hpx/components/client_base.hpp>
 #include <hpx/components/iostreams/manipulators.hpp>
 #include <hpx/components/iostreams/server/output_stream.hpp>
+#include <hpx/components/iostreams/write_functions.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
 #include <hpx/modules/async_distributed.hpp>
+#include <hpx/modules/threading.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <boost/iostreams/stream.hpp>
 
 #include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <ios>
 #include <iterator>
@@ -153,9 +157,17 @@ namespace hpx { namespace iostreams {
             release_ostream(get_outstream_name(tag), id);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Output flushed asynchronously is sent to the console only once at
+        // least batch_size bytes have been collected or the flush interval
+        // has passed.
+        std::size_t get_batch_size();
+        std::chrono::milliseconds get_flush_interval();
+
         ///////////////////////////////////////////////////////////////////////
         void register_ostreams();
         void unregister_ostreams();
+        void flush_ostreams();
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -184,6 +196,154 @@ namespace hpx { namespace iostreams {
         using detail::buffer::mtx_;
         std::atomic<std::uint64_t> generational_count_;
 
+        // batching of asynchronously flushed output, protected by mtx_
+        std::size_t batch_size_;
+        std::chrono::milliseconds flush_interval_;
+        bool flush_scheduled_;
+
+        // set once the batched output was flushed before shutdown, all
+        // output is written synchronously from then on, protected by mtx_
+        bool shutting_down_;
+
+        // the local standard stream, output is written to it once this
+        // stream has been released
+        std::ostream* local_strm_;
+
+        // Send the buffered data to the console, the lock is released before
+        // the action is invoked. The sequence number is drawn while holding
+        // the lock to make sure the console writes the buffers in the order
+        // they were filled.
+        template <typename Lock>
+        void send_async_locked(Lock& l)
+        {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+            // Create the next buffer, returns the previous buffer
+            buffer next = this->detail::buffer::init_locked();
+            std::uint64_t const count = generational_count_++;
+
+            // Unlock the mutex before we cleanup.
+            l.unlock();
+
+            // since mtx_ is recursive and apply will do an AGAS lookup,
+            // we need to ignore the lock here in case we are called
+            // recursively
+            hpx::util::ignore_while_checking il(&l);
+            HPX_UNUSED(il);
+
+            // Perform the write operation, then destroy the old buffer and
+            // stream.
+            typedef server::output_stream::write_async_action action_type;
+            hpx::post<action_type>(
+                this->get_id(), hpx::get_locality_id(), count, next);
+#else
+            HPX_ASSERT(false);
+            HPX_UNUSED(l);
+#endif
+        }
+
+        // Send the buffered data to the console and wait for it to be
+        // written, the lock is released before the action is invoked. Even
+        // an empty buffer is sent to flush the data buffered server-side.
+        // Once the stream has been released, the data is written to the
+        // local standard stream instead.
+        template <typename Lock>
+        void send_sync_locked(Lock& l)
+        {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+            // Create the next buffer, returns the previous buffer
+            buffer next = this->detail::buffer::init_locked();
+
+            if (!this->valid() && local_strm_ != nullptr)
+            {
+                l.unlock();
+
+                std::vector<char> data;
+                next.append_to(data);
+                std_ostream_write_function(data, *local_strm_);
+                return;
+            }
+
+            std::uint64_t const count = generational_count_++;
+
+            // Unlock the mutex before we cleanup.
+            l.unlock();
+
+            // Perform the write operation, then destroy the old buffer and
+            // stream.
+            typedef server::output_stream::write_sync_action action_type;
+            hpx::async<action_type>(
+                this->get_id(), hpx::get_locality_id(), count, next)
+                .get();
+#else
+            HPX_ASSERT(false);
+            HPX_UNUSED(l);
+#endif
+        }
+
+        // Send the buffered data if enough of it has been collected,
+        // otherwise make sure it will be sent after the flush interval.
+        // Output produced after the batched output was flushed during
+        // shutdown is written synchronously.
+        template <typename Lock>
+        void batch_async_locked(Lock& l)
+        {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+            if (this->detail::buffer::empty_locked())
+            {
+                return;
+            }
+
+            if (shutting_down_)
+            {
+                send_sync_locked(l);
+            }
+            else if (this->detail::buffer::size_locked() >= batch_size_ ||
+                flush_interval_.count() == 0)
+            {
+                send_async_locked(l);
+            }
+            else if (!flush_scheduled_)
+            {
+                flush_scheduled_ = true;
+                l.unlock();
+
+                hpx::post([this]() { deferred_flush(); });
+            }
+#else
+            HPX_ASSERT(false);
+            HPX_UNUSED(l);
+#endif
+        }
+
+        void deferred_flush()
+        {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+            hpx::this_thread::sleep_for(flush_interval_);
+
+            std::unique_lock<mutex_type> l(*mtx_);
+            flush_scheduled_ = false;
+
+            if (this->detail::buffer::empty_locked())
+            {
+                return;
+            }
+
+            // the batched output might have been flushed or the stream
+            // might have been released in the meantime, nothing would
+            // send the data after that
+            if (shutting_down_ || !this->valid())
+            {
+                send_sync_locked(l);
+            }
+            else
+            {
+                send_async_locked(l);
+            }
+#else
+            HPX_ASSERT(false);
+#endif
+        }
+
         // Performs a lazy streaming operation.
         template <typename T>
         ostream& streaming_operator_lazy(T const& subject)
@@ -202,21 +362,8 @@ namespace hpx { namespace iostreams {
             *static_cast<stream_base_type*>(this) << subject;
 
             // If the buffer isn't empty, send it asynchronously to the
-            // destination.
-            if (!this->detail::buffer::empty_locked())
-            {
-                // Create the next buffer, returns the previous buffer
-                buffer next = this->detail::buffer::init_locked();
-
-                // Unlock the mutex before we cleanup.
-                l.unlock();
-
-                // Perform the write operation, then destroy the old buffer and
-                // stream.
-                typedef server::output_stream::write_async_action action_type;
-                hpx::post<action_type>(this->get_id(), hpx::get_locality_id(),
-                    generational_count_++, next);
-            }
+            // destination, possibly batched with subsequent output.
+            batch_async_locked(l);
 #else
             HPX_ASSERT(false);
             HPX_UNUSED(subject);
@@ -234,21 +381,7 @@ namespace hpx { namespace iostreams {
             // apply the subject to the local stream
             *static_cast<stream_base_type*>(this) << subject;
 
-            // Send even empty buffer to flush the data buffered server-side.
-
-            // Create the next buffer, returns the previous buffer
-            buffer next = this->detail::buffer::init_locked();
-
-            // Unlock the mutex before we cleanup.
-            l.unlock();
-
-            // Perform the write operation, then destroy the old buffer and
-            // stream.
-            typedef server::output_stream::write_sync_action action_type;
-            hpx::async<action_type>(this->get_id(), hpx::get_locality_id(),
-                generational_count_++, next)
-                .get();
-
+            send_sync_locked(l);
 #else
             HPX_ASSERT(false);
             HPX_UNUSED(subject);
@@ -264,26 +397,7 @@ namespace hpx { namespace iostreams {
         {
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
             std::unique_lock<mutex_type> l(*mtx_);
-            if (!this->detail::buffer::empty_locked())
-            {
-                // Create the next buffer, returns the previous buffer
-                buffer next = this->detail::buffer::init_locked();
-
-                // Unlock the mutex before we cleanup.
-                l.unlock();
-
-                // since mtx_ is recursive and apply will do an AGAS lookup,
-                // we need to ignore the lock here in case we are called
-                // recursively
-                hpx::util::ignore_while_checking il(&l);
-                HPX_UNUSED(il);
-
-                // Perform the write operation, then destroy the old buffer and
-                // stream.
-                typedef server::output_stream::write_async_action action_type;
-                hpx::post<action_type>(this->get_id(), hpx::get_locality_id(),
-                    generational_count_++, next);
-            }
+            batch_async_locked(l);
             return true;
 #else
             HPX_ASSERT(false);
@@ -294,12 +408,33 @@ namespace hpx { namespace iostreams {
         ///////////////////////////////////////////////////////////////////////
         friend void detail::register_ostreams();
         friend void detail::unregister_ostreams();
+        friend void detail::flush_ostreams();
 
         // late initialization during runtime system startup
         template <typename Tag>
         void initialize(Tag tag)
         {
             *static_cast<base_type*>(this) = detail::create_ostream(tag);
+
+            std::lock_guard<mutex_type> l(*mtx_);
+            batch_size_ = detail::get_batch_size();
+            flush_interval_ = detail::get_flush_interval();
+            shutting_down_ = false;
+            local_strm_ = &detail::get_outstream(tag);
+        }
+
+        // write all output still collected for batching, called before the
+        // runtime system shuts down
+        void flush_batched()
+        {
+            std::unique_lock<mutex_type> l(*mtx_);
+            shutting_down_ = true;
+            if (generational_count_ != 0 ||
+                !this->detail::buffer::empty_locked())
+            {
+                streaming_operator_sync(
+                    hpx::iostreams::flush_type(), l);    // unlocks
+            }
         }
 
         // reset this object during runtime system shutdown
@@ -309,6 +444,7 @@ namespace hpx { namespace iostreams {
             std::unique_lock<mutex_type> l(*mtx_, std::try_to_lock);
             if (l)
             {
+                shutting_down_ = true;
                 streaming_operator_sync(
                     hpx::iostreams::flush_type(), l);    // unlocks
             }
@@ -324,6 +460,11 @@ namespace hpx { namespace iostreams {
           , buffer()
           , stream_base_type(*this)
           , generational_count_(0)
+          , batch_size_(0)
+          , flush_interval_(0)
+          , flush_scheduled_(false)
+          , shutting_down_(false)
+          , local_strm_(nullptr)
         {
         }
 
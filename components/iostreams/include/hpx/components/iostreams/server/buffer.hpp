@@ -13,6 +13,7 @@
 #include <hpx/components/iostreams/export_definitions.hpp>
 #include <hpx/components/iostreams/write_functions.hpp>
 
+#include <cstddef>
 #include <iosfwd>
 #include <memory>
 #include <mutex>
@@ -75,6 +76,11 @@ namespace hpx { namespace iostreams { namespace detail {
             return !data_.get() || data_->empty();
         }
 
+        std::size_t size_locked() const
+        {
+            return data_.get() ? data_->size() : 0;
+        }
+
         buffer init()
         {
             std::lock_guard<mutex_type> l(*mtx_);
@@ -112,6 +118,21 @@ namespace hpx { namespace iostreams { namespace detail {
             }
         }
 
+        // Append the contents of this buffer to the given data, used to write
+        // several buffers at once.
+        void append_to(std::vector<char>& data)
+        {
+            std::unique_lock<mutex_type> l(*mtx_);
+            if (data_.get())
+            {
+                std::shared_ptr<std::vector<char>> d(data_);
+                data_.reset();
+                l.unlock();
+
+                data.insert(data.end(), d->begin(), d->end());
+            }
+        }
+
     private:
         std::shared_ptr<std::vector<char>> data_;
 
@@ -8,6 +8,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/functional/function.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 
 #include <hpx/components/iostreams/server/buffer.hpp>
@@ -16,57 +17,111 @@
 #include <map>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 namespace hpx { namespace iostreams { namespace detail {
     struct order_output
     {
-        typedef std::map<std::uint64_t, buffer> output_data_type;
+        // invoked once the corresponding output has been written
+        typedef hpx::function<void()> written_function_type;
+
+        struct pending_output
+        {
+            buffer data_;
+            written_function_type written_;
+        };
+
+        typedef std::map<std::uint64_t, pending_output> output_data_type;
         typedef std::pair<std::uint64_t, output_data_type> data_type;
         typedef std::map<std::uint32_t, data_type> output_data_map_type;
 
+        // Write the output in the order it was generated on the given
+        // locality. All consecutive pending outputs are written at once
+        // using a single invocation of the write function.
         template <typename F, typename Mutex>
         void output(std::uint32_t locality_id, std::uint64_t count,
-            detail::buffer const& buf_in, F const& write_f, Mutex& mtx)
+            detail::buffer const& buf_in, F const& write_f, Mutex& mtx,
+            written_function_type written = written_function_type())
         {
-            detail::buffer in(buf_in);
             std::unique_lock<Mutex> l(mtx);
             data_type& data = output_data_map_[locality_id];    //-V108
 
-            if (count == data.first)
+            if (count != data.first)
             {
-                // this is the next expected output line
+                // wait for the preceding output to arrive
+                HPX_ASSERT(count > data.first);
+                data.second.emplace(
+                    count, pending_output{buf_in, HPX_MOVE(written)});
+                return;
+            }
+
+            // this is the next expected output
+            std::vector<pending_output> ready;
+            ready.push_back(pending_output{buf_in, HPX_MOVE(written)});
+
+            while (!ready.empty())
+            {
+                // collect all consecutive pending outputs
+                auto next = data.second.find(count + ready.size());
+                while (next != data.second.end())
                 {
-                    // output the line as requested
+                    ready.push_back(HPX_MOVE(next->second));
+                    data.second.erase(next);
+                    next = data.second.find(count + ready.size());
+                }
+
+                {
+                    // output all of them as requested, data.first is updated
+                    // only afterwards to keep concurrent outputs of the same
+                    // locality from overtaking these
                     unlock_guard<std::unique_lock<Mutex>> ul(l);
-                    in.write(write_f, mtx);
+                    write(ready, write_f, mtx);
                 }
-                ++data.first;
 
-                // print all consecutive pending buffers
-                output_data_type::iterator next = data.second.find(++count);
-                while (next != data.second.end())
+                count += ready.size();
+                data.first = count;
+                ready.clear();
+
+                // more output might have arrived in the meantime
+                next = data.second.find(count);
+                if (next != data.second.end())
                 {
-                    buffer next_in = (*next).second;
-                    {
-                        // output the next line
-                        unlock_guard<std::unique_lock<Mutex>> ul(l);
-                        next_in.write(write_f, mtx);
-                    }
+                    ready.push_back(HPX_MOVE(next->second));
                     data.second.erase(next);
-
-                    // find next entry in map
-                    ++data.first;
-                    next = data.second.find(++count);
                 }
             }
+        }
+
+    private:
+        template <typename F, typename Mutex>
+        static void write(
+            std::vector<pending_output>& ready, F const& write_f, Mutex& mtx)
+        {
+            if (ready.size() == 1)
+            {
+                ready.front().data_.write(write_f, mtx);
+            }
             else
             {
-                HPX_ASSERT(count > data.first);
-                data.second.insert(output_data_type::value_type(count, in));
+                std::vector<char> data;
+                for (pending_output& p : ready)
+                {
+                    p.data_.append_to(data);
+                }
+
+                std::lock_guard<Mutex> ll(mtx);
+                write_f(data);
+            }
+
+            for (pending_output& p : ready)
+            {
+                if (p.written_)
+                {
+                    p.written_();
+                }
             }
         }
 
-    private:
         output_data_map_type output_data_map_;
     };
 }}}    // namespace hpx::iostreams::detail
@@ -52,6 +52,17 @@ namespace hpx { namespace iostreams { namespace detail
         hpx::cout.initialize(iostreams::detail::cout_tag());
         hpx::cerr.initialize(iostreams::detail::cerr_tag());
         hpx::consolestream.initialize(iostreams::detail::consolestream_tag());
+
+        // make sure batched output reaches the console before any of the
+        // shutdown functions are executed
+        hpx::register_pre_shutdown_function(&flush_ostreams);
+    }
+
+    void flush_ostreams()
+    {
+        hpx::cout.flush_batched();
+        hpx::cerr.flush_batched();
+        hpx::consolestream.flush_batched();
     }
 
     void unregister_ostreams()
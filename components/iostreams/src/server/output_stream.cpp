@@ -74,12 +74,14 @@ namespace hpx { namespace iostreams { namespace server {
         std::uint64_t count, detail::buffer const& in,
         threads::thread_id_ref_type caller)
     {
-        // Perform the IO operation.
-        pending_output_.output(locality_id, count, in, write_f, mtx_);
-
-        // Wake up caller.
-        threads::set_thread_state(
-            caller.noref(), threads::thread_schedule_state::pending);
+        // Perform the IO operation, wake up the caller only once the output
+        // was actually written, which might happen only after all preceding
+        // output of the same locality has arrived.
+        pending_output_.output(locality_id, count, in, write_f, mtx_,
+            [caller = HPX_MOVE(caller)]() {
+                threads::set_thread_state(
+                    caller.noref(), threads::thread_schedule_state::pending);
+            });
     }
 
     void output_stream::write_sync(std::uint32_t locality_id,
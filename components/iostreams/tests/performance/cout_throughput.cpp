@@ -0,0 +1,101 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the throughput of output sent to the console from all localities
+// and verify that the output of each locality is written in order.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void print_lines(std::size_t num_lines)
+{
+    std::uint32_t const here = hpx::get_locality_id();
+    for (std::size_t i = 0; i != num_lines; ++i)
+    {
+        hpx::consolestream << here << " " << i << std::endl;
+    }
+
+    // wait for all of the output to be written
+    hpx::consolestream << hpx::iostreams::flush_type();
+}
+HPX_PLAIN_ACTION(print_lines, print_lines_action)
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const num_lines = vm["lines"].as<std::size_t>();
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    hpx::chrono::high_resolution_timer t;
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(localities.size());
+    for (hpx::id_type const& l : localities)
+    {
+        futures.push_back(hpx::async(print_lines_action(), l, num_lines));
+    }
+    hpx::wait_all(futures);
+
+    double const elapsed = t.elapsed();
+
+    // every locality has to have produced its lines in order
+    std::map<std::uint32_t, std::size_t> next_line;
+    std::size_t total = 0;
+
+    std::istringstream strm(hpx::get_consolestream().str());
+    std::uint32_t locality_id = 0;
+    std::size_t line = 0;
+    while (strm >> locality_id >> line)
+    {
+        HPX_TEST_EQ(line, next_line[locality_id]);
+        next_line[locality_id] = line + 1;
+        ++total;
+    }
+
+    HPX_TEST_EQ(next_line.size(), localities.size());
+    HPX_TEST_EQ(total, num_lines * localities.size());
+
+    hpx::util::format_to(std::cout,
+        "localities: {}, lines: {}, time: {} [s], throughput: {} [lines/s]\n",
+        localities.size(), total, elapsed, total / elapsed)
+        << std::flush;
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("lines",
+        hpx::program_options::value<std::size_t>()->default_value(10000),
+        "number of lines to print on each locality");
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
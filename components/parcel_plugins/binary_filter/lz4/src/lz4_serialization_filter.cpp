@@ -0,0 +1,128 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+#include <hpx/modules/errors.hpp>
+
+#include <hpx/binary_filter/lz4_serialization_filter.hpp>
+#include <hpx/plugin_factories/binary_filter_factory.hpp>
+#include <hpx/plugin_factories/plugin_registry.hpp>
+
+#include <cstddef>
+#include <cstring>
+
+#include <lz4.h>
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE();
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::lz4_serialization_filter,
+    lz4_serialization_filter);
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    void lz4_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t lz4_serialization_filter::init_data(
+        void const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        if (size > std::size_t(LZ4_MAX_INPUT_SIZE) ||
+            buffer_size > std::size_t(LZ4_MAX_INPUT_SIZE))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "lz4_serialization_filter::init_data",
+                "archive data is too large to be decompressed");
+            return 0;
+        }
+
+        buffer_.resize(buffer_size);
+        int const decompressed =
+            LZ4_decompress_safe(static_cast<char const*>(buffer),
+                buffer_.data(), static_cast<int>(size),
+                static_cast<int>(buffer_size));
+
+        if (decompressed < 0 ||
+            static_cast<std::size_t>(decompressed) != buffer_size)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "lz4_serialization_filter::init_data",
+                "decompression failure, archive data is corrupted");
+            return 0;
+        }
+
+        current_ = 0;
+        return buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void lz4_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_ + dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "lz4_serialization_filter::load",
+                "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void lz4_serialization_filter::save(void const* src, std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        buffer_.insert(buffer_.end(), src_begin, src_begin + src_count);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool lz4_serialization_filter::flush(
+        void* dst, std::size_t dst_count, std::size_t& written)
+    {
+        if (buffer_.size() > std::size_t(LZ4_MAX_INPUT_SIZE))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "lz4_serialization_filter::flush",
+                "archive data is too large to be compressed");
+            return false;
+        }
+
+        // make sure we have enough memory
+        int const src_size = static_cast<int>(buffer_.size());
+        std::size_t const needed =
+            static_cast<std::size_t>(LZ4_compressBound(src_size));
+        if (needed > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        // compress everything in one go
+        int const compressed_length = LZ4_compress_default(buffer_.data(),
+            static_cast<char*>(dst), src_size, static_cast<int>(needed));
+
+        if (compressed_length <= 0 && src_size != 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "lz4_serialization_filter::flush",
+                "compression failure, flushing did not reach end of data");
+            return false;
+        }
+
+        written = static_cast<std::size_t>(compressed_length);
+        return true;
+    }
+}    // namespace hpx::plugins::compression
+
+#endif
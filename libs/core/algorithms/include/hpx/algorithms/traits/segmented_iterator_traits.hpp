@@ -75,4 +75,20 @@ namespace hpx { namespace traits {
       : segmented_local_iterator_traits<Iterator>::is_segmented_local_iterator
     {
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // traits allowing to run the part of a segmented algorithm operating on a
+    // local segment on an execution policy bound to the memory of that
+    // segment (e.g. to the executors of the NUMA domain it was placed on), by
+    // default the given execution policy is used as is
+    template <typename LocalRawIterator, typename Enable = void>
+    struct segmented_local_execution_traits
+    {
+        template <typename ExPolicy>
+        static constexpr ExPolicy&& bind(
+            ExPolicy&& policy, LocalRawIterator const&) noexcept
+        {
+            return HPX_FORWARD(ExPolicy, policy);
+        }
+    };
 }}    // namespace hpx::traits
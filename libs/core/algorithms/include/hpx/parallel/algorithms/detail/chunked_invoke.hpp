@@ -0,0 +1,115 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/iterator_support/counting_iterator.hpp>
+#include <hpx/pack_traversal/unwrap.hpp>
+#include <hpx/parallel/util/foreach_partitioner.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Helpers for algorithms which run several parallel phases on index
+    // ranges, one after the other, from within a single task (e.g. merge,
+    // inplace_merge, and the hash based algorithms). All phases are run
+    // synchronously using the partitioners, task policies are mapped to
+    // their non-task counterparts as the algorithm as a whole already runs
+    // asynchronously.
+
+    // Splits [0, count) into chunks as determined by the executor parameters
+    // of the given policy and invokes f(begin, end) for all of them. Returns
+    // once all chunks have been processed.
+    template <typename ExPolicy, typename F>
+    void chunked_invoke(ExPolicy const& policy, std::size_t count, F&& f)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        if constexpr (!hpx::is_parallel_execution_policy_v<ExPolicy>)
+        {
+            f(std::size_t(0), count);
+        }
+        else
+        {
+            auto p = hpx::execution::experimental::to_non_task(policy);
+            util::foreach_partitioner<decltype(p)>::call(p,
+                hpx::util::counting_iterator<std::size_t>(0), count,
+                [&f](auto, std::size_t size, std::size_t begin) {
+                    f(begin, begin + size);
+                },
+                [](auto&& last) { return last; });
+        }
+    }
+
+    // Like chunked_invoke, f(begin, end) returns a result for every chunk.
+    // Returns the results in the order of the chunks.
+    template <typename R, typename ExPolicy, typename F>
+    std::vector<R> chunked_invoke_collect(
+        ExPolicy const& policy, std::size_t count, F&& f)
+    {
+        if (count == 0)
+        {
+            return {};
+        }
+
+        if constexpr (!hpx::is_parallel_execution_policy_v<ExPolicy>)
+        {
+            std::vector<R> results;
+            results.push_back(f(std::size_t(0), count));
+            return results;
+        }
+        else
+        {
+            auto p = hpx::execution::experimental::to_non_task(policy);
+            return util::partitioner<decltype(p), std::vector<R>, R>::call(p,
+                hpx::util::counting_iterator<std::size_t>(0), count,
+                [&f](auto part_begin, std::size_t size) -> R {
+                    std::size_t const begin = *part_begin;
+                    return f(begin, begin + size);
+                },
+                hpx::unwrapping(
+                    [](std::vector<R>&& results) { return HPX_MOVE(results); }));
+        }
+    }
+
+    // Invokes f(i) for all i in [0, count), each of those invocations runs
+    // as a separate task. This is used for a (small) number of independent
+    // partitions whose count was already derived from the policy.
+    template <typename ExPolicy, typename F>
+    void invoke_each(ExPolicy const& policy, std::size_t count, F&& f)
+    {
+        auto body = [&f](std::size_t begin, std::size_t end) {
+            for (/**/; begin != end; ++begin)
+            {
+                f(begin);
+            }
+        };
+
+        if constexpr (!hpx::is_parallel_execution_policy_v<ExPolicy>)
+        {
+            body(std::size_t(0), count);
+        }
+        else
+        {
+            chunked_invoke(
+                policy.with(hpx::execution::static_chunk_size(1)), count, body);
+        }
+    }
+
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,252 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution/executors/execution_information.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/chunked_invoke.hpp>
+#include <hpx/timing/steady_clock.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Infrastructure for the hash based algorithms operating on unsorted
+    // ranges (unordered_unique_copy, unordered_set_union, etc.).
+    //
+    // The elements are radix-partitioned by the upper bits of their (mixed)
+    // hash values: every chunk of the input counts its elements per
+    // partition, the counts are turned into offsets and every chunk scatters
+    // the indices of its elements into their partitions. All equivalent
+    // elements end up in the same partition, which allows each partition to
+    // be processed independently using a local hash table, without any
+    // synchronization between the partitions.
+
+    // Finalizer of MurmurHash3, makes sure all bits of the hash values
+    // supplied by the user contribute to the partition index.
+    constexpr std::uint64_t hash_partition_mix(std::uint64_t h) noexcept
+    {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    struct hash_partitions
+    {
+        // number of partitions, always a power of two
+        std::size_t num_partitions = 1;
+        std::size_t shift = 0;
+
+        // mixed hash value of every element
+        std::vector<std::uint64_t> hashes;
+
+        // partition p consists of indices[offsets[p], offsets[p + 1]), the
+        // indices of every partition are sorted in ascending order
+        std::vector<std::size_t> offsets;
+        std::vector<std::size_t> indices;
+
+        std::size_t partition_of(std::size_t i) const noexcept
+        {
+            return num_partitions == 1 ?
+                0 :
+                static_cast<std::size_t>(hashes[i] >> shift);
+        }
+
+        std::size_t* begin(std::size_t part) noexcept
+        {
+            return indices.data() + offsets[part];
+        }
+
+        std::size_t size(std::size_t part) const noexcept
+        {
+            return offsets[part + 1] - offsets[part];
+        }
+    };
+
+    // Hash function for the local hash tables, those store element indices
+    // and reuse the hash values calculated during partitioning.
+    struct hash_partition_index_hash
+    {
+        std::uint64_t const* hashes;
+
+        std::size_t operator()(std::size_t i) const noexcept
+        {
+            return static_cast<std::size_t>(hashes[i]);
+        }
+    };
+
+    // Returns the number of partitions the input of the given size should be
+    // split into, always a power of two. Sequenced execution and small inputs
+    // use a single partition.
+    template <typename ExPolicy>
+    std::size_t get_hash_partition_count(
+        ExPolicy const& policy, std::size_t count)
+    {
+        if constexpr (!hpx::is_parallel_execution_policy_v<ExPolicy>)
+        {
+            HPX_UNUSED(policy);
+            HPX_UNUSED(count);
+            return 1;
+        }
+        else
+        {
+            constexpr std::size_t threshold = 16384;
+            if (count <= threshold)
+            {
+                return 1;
+            }
+
+            std::size_t const cores = execution::processing_units_count(
+                policy.parameters(), policy.executor(),
+                hpx::chrono::null_duration, count);
+            if (cores <= 1)
+            {
+                return 1;
+            }
+
+            // use a couple of partitions per processing unit to even out
+            // skewed distributions of the hash values
+            std::size_t num_partitions = 1;
+            while (num_partitions < 4 * cores)
+            {
+                num_partitions *= 2;
+            }
+            return num_partitions;
+        }
+    }
+
+    // The number of elements of a chunk of the input falling into each of
+    // the partitions.
+    struct hash_partition_chunk
+    {
+        std::size_t begin = 0;
+        std::size_t end = 0;
+        std::vector<std::size_t> counts;
+    };
+
+    // Radix-partitions the elements [0, count) using the hash values
+    // returned by get_hash(i).
+    template <typename ExPolicy, typename GetHash>
+    hash_partitions partition_by_hash(
+        ExPolicy& policy, std::size_t count, GetHash const& get_hash)
+    {
+        hash_partitions parts;
+
+        std::size_t const num_partitions =
+            get_hash_partition_count(policy, count);
+        if (num_partitions > 1)
+        {
+            std::size_t bits = 0;
+            while ((std::size_t(1) << bits) < num_partitions)
+            {
+                ++bits;
+            }
+            parts.num_partitions = num_partitions;
+            parts.shift = 64 - bits;
+        }
+
+        // calculate the hash values and count the elements of every chunk
+        // falling into each of the partitions, the chunks are determined by
+        // the executor parameters of the policy
+        parts.hashes.resize(count);
+
+        auto count_chunk = [&](std::size_t begin, std::size_t end) {
+            hash_partition_chunk chunk{
+                begin, end, std::vector<std::size_t>(num_partitions, 0)};
+            for (std::size_t i = begin; i != end; ++i)
+            {
+                parts.hashes[i] = hash_partition_mix(
+                    static_cast<std::uint64_t>(get_hash(i)));
+                ++chunk.counts[parts.partition_of(i)];
+            }
+            return chunk;
+        };
+
+        std::vector<hash_partition_chunk> chunks;
+        if (num_partitions == 1)
+        {
+            if (count != 0)
+            {
+                chunks.push_back(count_chunk(0, count));
+            }
+        }
+        else
+        {
+            chunks = chunked_invoke_collect<hash_partition_chunk>(
+                policy, count, count_chunk);
+        }
+
+        // turn the counts into the positions at which each chunk starts
+        // writing into each partition, the elements of a partition are
+        // ordered by chunk which keeps them in input order
+        parts.offsets.resize(num_partitions + 1);
+
+        std::size_t offset = 0;
+        for (std::size_t part = 0; part != num_partitions; ++part)
+        {
+            parts.offsets[part] = offset;
+            for (hash_partition_chunk& chunk : chunks)
+            {
+                std::size_t& n = chunk.counts[part];
+                std::size_t const chunk_count = n;
+                n = offset;
+                offset += chunk_count;
+            }
+        }
+        parts.offsets[num_partitions] = offset;
+        HPX_ASSERT(offset == count);
+
+        // scatter the element indices into their partitions
+        parts.indices.resize(count);
+
+        invoke_each(policy, chunks.size(), [&](std::size_t c) {
+            hash_partition_chunk& chunk = chunks[c];
+            std::size_t* positions = chunk.counts.data();
+            for (std::size_t i = chunk.begin; i != chunk.end; ++i)
+            {
+                parts.indices[positions[parts.partition_of(i)]++] = i;
+            }
+        });
+
+        return parts;
+    }
+
+    // Invokes f(part, pos) for all partitions, where pos is the overall
+    // position of the first of the sizes[part] results produced by that
+    // partition. Returns the overall number of results.
+    template <typename ExPolicy, typename F>
+    std::size_t hash_partition_gather(
+        ExPolicy& policy, std::vector<std::size_t> const& sizes, F const& f)
+    {
+        std::vector<std::size_t> positions(sizes.size());
+
+        std::size_t total = 0;
+        for (std::size_t part = 0; part != sizes.size(); ++part)
+        {
+            positions[part] = total;
+            total += sizes[part];
+        }
+
+        invoke_each(policy, sizes.size(),
+            [&](std::size_t part) { f(part, positions[part]); });
+
+        return total;
+    }
+
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
@@ -0,0 +1,74 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Merge-path partitioning (Odeh et al., "Merge Path - Parallel Merging
+    // Made Simple"): the merge of two sorted sequences a and b is a
+    // monotonic path through the len1 x len2 grid of comparisons. The
+    // point at which this path crosses the diagonal i + j == diag is found
+    // by a binary search along that diagonal, independently of all other
+    // diagonals. Splitting the output into equally sized parts this way
+    // gives perfectly balanced partitions which can be merged concurrently.
+    //
+    // Returns the number of elements of the first sequence which end up in
+    // the first diag elements of the (stable) merge of both sequences, i.e.
+    // merging a[0, i) and b[0, diag - i) produces exactly those elements.
+    template <typename Iter1, typename Iter2, typename Comp, typename Proj1,
+        typename Proj2>
+    std::size_t merge_path_search(Iter1 first1, std::size_t len1,
+        Iter2 first2, std::size_t len2, std::size_t diag, Comp&& comp,
+        Proj1&& proj1, Proj2&& proj2)
+    {
+        HPX_ASSERT(diag <= len1 + len2);
+
+        std::size_t lo = diag > len2 ? diag - len2 : 0;
+        std::size_t hi = diag < len1 ? diag : len1;
+
+        while (lo < hi)
+        {
+            std::size_t const mid = lo + (hi - lo) / 2;
+
+            // equivalent elements of the first sequence precede those of
+            // the second one
+            if (HPX_INVOKE(comp,
+                    HPX_INVOKE(proj2, *std::next(first2, diag - mid - 1)),
+                    HPX_INVOKE(proj1, *std::next(first1, mid))))
+            {
+                hi = mid;
+            }
+            else
+            {
+                lo = mid + 1;
+            }
+        }
+        return lo;
+    }
+
+    // Returns the start of the given partition of the output of merging two
+    // sequences of the given sizes if that output is divided into
+    // num_partitions partitions of (almost) equal size.
+    constexpr std::size_t merge_path_diagonal(std::size_t total,
+        std::size_t partition, std::size_t num_partitions) noexcept
+    {
+        return (total / num_partitions) * partition +
+            (std::min)(total % num_partitions, partition);
+    }
+
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
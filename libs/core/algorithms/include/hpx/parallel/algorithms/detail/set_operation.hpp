@@ -13,12 +13,12 @@
 #include <hpx/execution/executors/execution_information.hpp>
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/merge_path.hpp>
 #include <hpx/parallel/algorithms/detail/upper_lower_bound.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/clear_container.hpp>
 #include <hpx/parallel/util/foreach_partitioner.hpp>
 #include <hpx/parallel/util/partitioner.hpp>
-#include <hpx/type_support/unused.hpp>
 
 #if !defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
 #include <boost/shared_array.hpp>
@@ -28,6 +28,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -110,9 +111,7 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
 
         std::size_t cores = execution::processing_units_count(
             policy.parameters(), policy.executor(), hpx::chrono::null_duration,
-            (std::min)(len1, len2));
-
-        std::size_t step = (len1 + cores - 1) / cores;
+            len1 + len2);
 
 #if defined(HPX_HAVE_CXX17_SHARED_PTR_ARRAY)
         std::shared_ptr<buffer_type[]> buffer(
@@ -124,91 +123,70 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
         boost::shared_array<set_chunk_data> chunks(new set_chunk_data[cores]);
 #endif
 
-        // first step, is applied to all partitions
-        auto f1 = [=](set_chunk_data* curr_chunk,
-                      std::size_t part_size) mutable -> void {
-            HPX_ASSERT(part_size == 1);
-            HPX_UNUSED(part_size);
-
-            // find start in sequence 1
-            std::size_t start1 = (curr_chunk - chunks.get()) * step;
-            std::size_t end1 = (std::min)(start1 + step, std::size_t(len1));
-
-            if (start1 >= end1)
+        // Find the start of the given partition in both sequences. The
+        // partitions are of equal size on the merge path of both sequences,
+        // their boundaries are moved to the beginning of the run of
+        // equivalent elements they fall into. This keeps all equivalent
+        // elements in the same partition.
+        auto split = [=](std::size_t part) mutable
+            -> std::pair<std::size_t, std::size_t> {
+            std::size_t const total = len1 + len2;
+            std::size_t const diag = merge_path_diagonal(total, part, cores);
+            if (diag == 0)
             {
-                return;
-            }
-
-            bool first_partition = (start1 == 0);
-            bool last_partition = (end1 == std::size_t(len1));
-
-            auto start_value = HPX_INVOKE(proj1, first1[start1]);
-            auto end_value = HPX_INVOKE(proj1, first1[end1]);
-
-            // all but the last chunk require special handling
-            if (!last_partition)
-            {
-                // this chunk will be handled by the next one if all
-                // elements of this partition are equal
-                if (!HPX_INVOKE(f, start_value, end_value))
-                {
-                    return;
-                }
-
-                // move backwards to find earliest element which is equal to
-                // the last element of the current chunk
-                if (end1 != 0)
-                {
-                    auto end_value1 = HPX_INVOKE(proj1, first1[end1 - 1]);
-
-                    while (!HPX_INVOKE(f, end_value1, end_value) && --end1 != 0)
-                    {
-                        end_value = HPX_MOVE(end_value1);
-                        end_value1 = HPX_INVOKE(proj1, first1[end1 - 1]);
-                    }
-                }
+                return {0, 0};
             }
-
-            // move backwards to find earliest element which is equal to
-            // the first element of the current chunk
-            if (start1 != 0)
+            if (diag == total)
             {
-                auto start_value1 = HPX_INVOKE(proj1, first1[start1 - 1]);
-
-                while (
-                    !HPX_INVOKE(f, start_value1, start_value) && --start1 != 0)
-                {
-                    start_value = HPX_MOVE(start_value1);
-                    start_value1 = HPX_INVOKE(proj1, first1[start1 - 1]);
-                }
+                return {len1, len2};
             }
 
-            // find start and end in sequence 2
-            std::size_t start2 = 0;
-            if (!first_partition)
+            std::size_t const mid1 = merge_path_search(
+                first1, len1, first2, len2, diag, f, proj1, proj2);
+            std::size_t const mid2 = diag - mid1;
+
+            auto bounds = [&](auto const& value) {
+                return std::make_pair(
+                    std::size_t(detail::lower_bound(first1,
+                                    std::next(first1, mid1), value, f, proj1) -
+                        first1),
+                    std::size_t(detail::lower_bound(first2,
+                                    std::next(first2, mid2), value, f, proj2) -
+                        first2));
+            };
+
+            // the next element on the merge path starts the partition
+            if (mid2 == std::size_t(len2) ||
+                (mid1 != std::size_t(len1) &&
+                    !HPX_INVOKE(f, HPX_INVOKE(proj2, *std::next(first2, mid2)),
+                        HPX_INVOKE(proj1, *std::next(first1, mid1)))))
             {
-                start2 = detail::lower_bound(
-                             first2, first2 + len2, start_value, f, proj2) -
-                    first2;
+                return bounds(HPX_INVOKE(proj1, *std::next(first1, mid1)));
             }
+            return bounds(HPX_INVOKE(proj2, *std::next(first2, mid2)));
+        };
 
-            std::size_t end2 = len2;
-            if (!last_partition)
+        // first step, is applied to all partitions
+        auto f1 = [=](set_chunk_data* curr_chunk,
+                      std::size_t part_size) mutable -> void {
+            for (/**/; part_size != 0; --part_size, ++curr_chunk)
             {
-                end2 = detail::lower_bound(first2 + start2, first2 + len2,
-                           end_value, f, proj2) -
-                    first2;
+                std::size_t const part = curr_chunk - chunks.get();
+
+                auto const start = split(part);
+                auto const end = split(part + 1);
+
+                // perform requested set-operation into the proper place of
+                // the intermediate buffer
+                curr_chunk->start = combiner(start.first, start.second);
+                auto buffer_dest = buffer.get() + curr_chunk->start;
+                auto op_result = setop(first1 + start.first,
+                    first1 + end.first, first2 + start.second,
+                    first2 + end.second, buffer_dest, f);
+                curr_chunk->first1 = op_result.in1 - first1;
+                curr_chunk->first2 = op_result.in2 - first2;
+                curr_chunk->len = op_result.out - buffer_dest;
             }
-
-            // perform requested set-operation into the proper place of the
-            // intermediate buffer
-            curr_chunk->start = combiner(start1, start2);
-            auto buffer_dest = buffer.get() + curr_chunk->start;
-            auto op_result = setop(first1 + start1, first1 + end1,
-                first2 + start2, first2 + end2, buffer_dest, f);
-            curr_chunk->first1 = op_result.in1 - first1;
-            curr_chunk->first2 = op_result.in2 - first2;
-            curr_chunk->len = op_result.out - buffer_dest;
         };
 
         // second step, is executed after all partitions are done running
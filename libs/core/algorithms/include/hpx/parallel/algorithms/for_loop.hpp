@@ -751,6 +751,7 @@ namespace hpx { namespace experimental {
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/for_loop_induction.hpp>
 #include <hpx/parallel/algorithms/for_loop_reduction.hpp>
+#include <hpx/parallel/algorithms/for_loop_tiling.hpp>
 #include <hpx/parallel/util/adapt_sharing_mode.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/loop.hpp>
@@ -1421,6 +1422,89 @@ namespace hpx::parallel {
                 first, size, stride, hpx::get<sizeof...(Args) - 1>(t),
                 hpx::get<Is>(t)...);
         }
+
+        // Return whether the executor parameters (or the executor) of the
+        // given policy determine the chunk sizes themselves. The default
+        // parameters of an executor do so only if a chunk size was given
+        // explicitly.
+        template <typename ExPolicy>
+        bool has_chunking_parameters(
+            ExPolicy const& policy, std::size_t cores, std::size_t count)
+        {
+            using parameters_type = typename ExPolicy::executor_parameters_type;
+            using executor_type = typename ExPolicy::executor_type;
+
+            if constexpr (std::is_same_v<parameters_type,
+                              hpx::traits::executor_parameters_type_t<
+                                  executor_type>>)
+            {
+                return execution::get_chunk_size(policy.parameters(),
+                           policy.executor(), hpx::chrono::null_duration,
+                           cores, count) != 0;
+            }
+            else
+            {
+                return execution::detail::has_get_chunk_size_v<
+                           parameters_type> ||
+                    execution::detail::has_maximal_number_of_chunks_v<
+                        parameters_type> ||
+                    execution::detail::has_get_chunk_size_v<executor_type>;
+            }
+        }
+
+        // iterate over the tiles of an N-dimensional index space
+        template <typename ExPolicy, std::size_t N, typename F>
+        decltype(auto) for_loop_tiled(ExPolicy&& policy,
+            hpx::experimental::md_range<N> const& range,
+            hpx::experimental::tiling<N> const& t, F&& f)
+        {
+            if constexpr (hpx::is_parallel_execution_policy_v<
+                              std::decay_t<ExPolicy>>)
+            {
+                std::size_t const cores =
+                    (std::max)(execution::processing_units_count(
+                                   policy.parameters(), policy.executor(),
+                                   hpx::chrono::null_duration, range.size()),
+                        std::size_t(1));
+
+                tiled_iterations<N, std::decay_t<F>> tiles(
+                    HPX_FORWARD(F, f), range, get_tile_sizes(range, t, cores));
+                std::size_t const num_tiles = tiles.size();
+
+                if (has_chunking_parameters(policy, cores, num_tiles))
+                {
+                    // respect the chunking requested by the user
+                    return for_loop_algo().call(HPX_FORWARD(ExPolicy, policy),
+                        std::size_t(0), num_tiles, HPX_MOVE(tiles));
+                }
+                else
+                {
+                    // Assign one contiguous block of tiles to each core. The
+                    // executors place the chunks onto the worker threads in
+                    // order, thus repeated invocations for the same index
+                    // space will process each tile on the same worker thread
+                    // (unless the tile is stolen), keeping its data in that
+                    // core's caches.
+                    std::size_t const chunk_size =
+                        (num_tiles + cores - 1) / cores;
+
+                    return for_loop_algo().call(
+                        policy.with(
+                            hpx::execution::experimental::static_chunk_size(
+                                (std::max)(chunk_size, std::size_t(1)))),
+                        std::size_t(0), num_tiles, HPX_MOVE(tiles));
+                }
+            }
+            else
+            {
+                tiled_iterations<N, std::decay_t<F>> tiles(
+                    HPX_FORWARD(F, f), range, get_tile_sizes(range, t, 1));
+                std::size_t const num_tiles = tiles.size();
+
+                return for_loop_algo().call(HPX_FORWARD(ExPolicy, policy),
+                    std::size_t(0), num_tiles, HPX_MOVE(tiles));
+            }
+        }
         /// \endcond
     }}    // namespace v2::detail
 }    // namespace hpx::parallel
@@ -1469,6 +1553,58 @@ namespace hpx::experimental {
                 first, last, make_index_pack_t<sizeof...(Args) - 1>(),
                 HPX_FORWARD(Args, args)...);
         }
+
+        // Invoke f(i_0, ..., i_N-1) for each point of the given N-dimensional
+        // index space. The index space is traversed tile by tile, the tile
+        // sizes are derived from the cache sizes of the system.
+        // clang-format off
+        template <typename ExPolicy, std::size_t N, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy>
+            )>
+        // clang-format on
+        friend decltype(auto) tag_fallback_invoke(hpx::experimental::for_loop_t,
+            ExPolicy&& policy, hpx::experimental::md_range<N> const& range,
+            F&& f)
+        {
+            return hpx::parallel::v2::detail::for_loop_tiled(
+                HPX_FORWARD(ExPolicy, policy), range,
+                hpx::experimental::tiling<N>{}, HPX_FORWARD(F, f));
+        }
+
+        // Invoke f(i_0, ..., i_N-1) for each point of the given N-dimensional
+        // index space, traversing the index space tile by tile as described
+        // by the given tiling.
+        // clang-format off
+        template <typename ExPolicy, std::size_t N, typename F,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy>
+            )>
+        // clang-format on
+        friend decltype(auto) tag_fallback_invoke(hpx::experimental::for_loop_t,
+            ExPolicy&& policy, hpx::experimental::md_range<N> const& range,
+            hpx::experimental::tiling<N> const& t, F&& f)
+        {
+            return hpx::parallel::v2::detail::for_loop_tiled(
+                HPX_FORWARD(ExPolicy, policy), range, t, HPX_FORWARD(F, f));
+        }
+
+        template <std::size_t N, typename F>
+        friend void tag_fallback_invoke(hpx::experimental::for_loop_t,
+            hpx::experimental::md_range<N> const& range, F&& f)
+        {
+            hpx::parallel::v2::detail::for_loop_tiled(hpx::execution::seq,
+                range, hpx::experimental::tiling<N>{}, HPX_FORWARD(F, f));
+        }
+
+        template <std::size_t N, typename F>
+        friend void tag_fallback_invoke(hpx::experimental::for_loop_t,
+            hpx::experimental::md_range<N> const& range,
+            hpx::experimental::tiling<N> const& t, F&& f)
+        {
+            hpx::parallel::v2::detail::for_loop_tiled(
+                hpx::execution::seq, range, t, HPX_FORWARD(F, f));
+        }
     } for_loop{};
 
     ///////////////////////////////////////////////////////////////////////////
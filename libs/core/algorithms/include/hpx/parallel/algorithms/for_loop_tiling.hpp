@@ -0,0 +1,317 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/for_loop_tiling.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/functional/detail/invoke.hpp>
+#include <hpx/type_support/pack.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::experimental {
+
+    /// An N-dimensional index space for use with the tiled overloads of
+    /// \a for_loop. Dimension \a d covers the half-open interval
+    /// [first()[d], last()[d]), the last dimension is assumed to be the one
+    /// that is contiguous in memory (row-major order).
+    template <std::size_t N>
+    class md_range
+    {
+        static_assert(N != 0, "md_range requires at least one dimension");
+
+    public:
+        using index_type = std::array<std::size_t, N>;
+
+        /// Create the index space [0, last) in each dimension.
+        constexpr explicit md_range(index_type const& last) noexcept
+          : first_()
+          , last_(last)
+        {
+        }
+
+        constexpr md_range(
+            index_type const& first, index_type const& last) noexcept
+          : first_(first)
+          , last_(last)
+        {
+        }
+
+        constexpr index_type const& first() const noexcept
+        {
+            return first_;
+        }
+
+        constexpr index_type const& last() const noexcept
+        {
+            return last_;
+        }
+
+        /// Returns the number of indices in dimension \a d.
+        constexpr std::size_t extent(std::size_t d) const noexcept
+        {
+            HPX_ASSERT(d < N);
+            return last_[d] > first_[d] ? last_[d] - first_[d] : 0;
+        }
+
+        /// Returns the overall number of points in the index space.
+        constexpr std::size_t size() const noexcept
+        {
+            std::size_t result = 1;
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                result *= extent(d);
+            }
+            return result;
+        }
+
+    private:
+        index_type first_;
+        index_type last_;
+    };
+
+    template <std::size_t N>
+    md_range(std::array<std::size_t, N> const&) -> md_range<N>;
+
+    template <std::size_t N>
+    md_range(std::array<std::size_t, N> const&,
+        std::array<std::size_t, N> const&) -> md_range<N>;
+
+    /// Describes how the index space of a tiled \a for_loop is split into
+    /// tiles. Dimensions with a tile size of zero are sized automatically
+    /// such that the data touched by one tile (\a bytes_per_point bytes for
+    /// each point of the index space) fits into half of the share of the
+    /// cache of the given level a single processing unit (worker thread) can
+    /// use.
+    template <std::size_t N>
+    struct tiling
+    {
+        /// The tile size for each of the dimensions, zero lets the algorithm
+        /// choose the tile size.
+        std::array<std::size_t, N> tile_sizes = {};
+
+        /// The number of bytes the loop body touches for each point of the
+        /// index space.
+        std::size_t bytes_per_point = sizeof(double);
+
+        /// The cache level the tiles should fit into.
+        int cache_level = 2;
+    };
+}    // namespace hpx::experimental
+
+namespace hpx::parallel {
+
+    inline namespace v2 { namespace detail {
+
+        /// \cond NOINTERNAL
+
+        // Return the share of the cache of the given level that is available
+        // to a single processing unit (zero if unknown). The value is queried
+        // from the topology only once.
+        HPX_CORE_EXPORT std::size_t get_tiling_cache_size(int level);
+
+        template <std::size_t N>
+        constexpr std::size_t count_tiles(
+            hpx::experimental::md_range<N> const& range,
+            std::array<std::size_t, N> const& tile_sizes) noexcept
+        {
+            std::size_t result = 1;
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                result *= (range.extent(d) + tile_sizes[d] - 1) / tile_sizes[d];
+            }
+            return result;
+        }
+
+        // Determine the tile size for all dimensions which were not given
+        // explicitly. The innermost dimensions are sized first (rounded to
+        // full cache lines for the contiguous one), the remaining budget of
+        // points is distributed over the outer dimensions. Outer dimensions
+        // are split further if there would be less tiles than cores.
+        template <std::size_t N>
+        std::array<std::size_t, N> get_tile_sizes(
+            hpx::experimental::md_range<N> const& range,
+            hpx::experimental::tiling<N> const& t, std::size_t cores)
+        {
+            std::size_t const bytes_per_point =
+                (std::max)(t.bytes_per_point, std::size_t(1));
+
+            std::size_t cache_size = get_tiling_cache_size(t.cache_level);
+            if (cache_size == 0)
+            {
+                cache_size = 256 * 1024;
+            }
+
+            // use half of the cache for the points of one tile, leaving room
+            // for other data touched by the loop body
+            std::size_t budget =
+                (std::max)(cache_size / 2 / bytes_per_point, std::size_t(1));
+
+            std::array<std::size_t, N> tile_sizes = {};
+            std::size_t num_auto = 0;
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                std::size_t const extent =
+                    (std::max)(range.extent(d), std::size_t(1));
+                if (t.tile_sizes[d] != 0)
+                {
+                    tile_sizes[d] = (std::min)(t.tile_sizes[d], extent);
+                    budget = (std::max)(
+                        budget / tile_sizes[d], std::size_t(1));
+                }
+                else
+                {
+                    ++num_auto;
+                }
+            }
+
+            std::size_t const line_points = (std::max)(
+                threads::get_cache_line_size() / bytes_per_point,
+                std::size_t(1));
+
+            for (std::size_t i = 0; i != N && num_auto != 0; ++i)
+            {
+                std::size_t const d = N - 1 - i;
+                if (t.tile_sizes[d] != 0)
+                {
+                    continue;
+                }
+
+                std::size_t side = static_cast<std::size_t>(
+                    std::pow(static_cast<double>(budget),
+                        1.0 / static_cast<double>(num_auto)) +
+                    0.5);
+                side = (std::max)(side, std::size_t(1));
+                if (d == N - 1)
+                {
+                    side = ((side + line_points - 1) / line_points) *
+                        line_points;
+                }
+
+                tile_sizes[d] = (std::min)(
+                    side, (std::max)(range.extent(d), std::size_t(1)));
+                budget = (std::max)(budget / tile_sizes[d], std::size_t(1));
+                --num_auto;
+            }
+
+            // make sure that all cores get work
+            for (std::size_t d = 0;
+                 d != N && count_tiles(range, tile_sizes) < cores; ++d)
+            {
+                if (t.tile_sizes[d] != 0)
+                {
+                    continue;
+                }
+
+                while (tile_sizes[d] > 1 &&
+                    count_tiles(range, tile_sizes) < cores)
+                {
+                    tile_sizes[d] = (tile_sizes[d] + 1) / 2;
+                }
+            }
+
+            return tile_sizes;
+        }
+
+        // The function object executed for each tile. Tiles are numbered in
+        // row-major order, the points of each tile are visited in row-major
+        // order as well.
+        template <std::size_t N, typename F>
+        struct tiled_iterations
+        {
+            using index_type = std::array<std::size_t, N>;
+
+            F f_;
+            index_type first_;
+            index_type last_;
+            index_type tile_sizes_;
+            index_type num_tiles_;
+
+            template <typename F_>
+            tiled_iterations(F_&& f,
+                hpx::experimental::md_range<N> const& range,
+                index_type const& tile_sizes)
+              : f_(HPX_FORWARD(F_, f))
+              , first_(range.first())
+              , last_(range.last())
+              , tile_sizes_(tile_sizes)
+            {
+                for (std::size_t d = 0; d != N; ++d)
+                {
+                    num_tiles_[d] = (range.extent(d) + tile_sizes_[d] - 1) /
+                        tile_sizes_[d];
+                }
+            }
+
+            constexpr std::size_t size() const noexcept
+            {
+                std::size_t result = 1;
+                for (std::size_t d = 0; d != N; ++d)
+                {
+                    result *= num_tiles_[d];
+                }
+                return result;
+            }
+
+            void operator()(std::size_t tile)
+            {
+                index_type lo;
+                index_type hi;
+                for (std::size_t i = 0; i != N; ++i)
+                {
+                    std::size_t const d = N - 1 - i;
+                    std::size_t const t = tile % num_tiles_[d];
+                    tile /= num_tiles_[d];
+
+                    lo[d] = first_[d] + t * tile_sizes_[d];
+                    hi[d] = (std::min)(lo[d] + tile_sizes_[d], last_[d]);
+                }
+
+                index_type idx = lo;
+                invoke_tile<0>(lo, hi, idx);
+            }
+
+        private:
+            template <std::size_t D>
+            HPX_FORCEINLINE void invoke_tile(
+                index_type const& lo, index_type const& hi, index_type& idx)
+            {
+                if constexpr (D == N - 1)
+                {
+                    for (idx[D] = lo[D]; idx[D] != hi[D]; ++idx[D])
+                    {
+                        invoke_point(idx, hpx::util::make_index_pack_t<N>());
+                    }
+                }
+                else
+                {
+                    for (idx[D] = lo[D]; idx[D] != hi[D]; ++idx[D])
+                    {
+                        invoke_tile<D + 1>(lo, hi, idx);
+                    }
+                }
+            }
+
+            template <std::size_t... Is>
+            HPX_FORCEINLINE void invoke_point(
+                index_type const& idx, hpx::util::index_pack<Is...>)
+            {
+                HPX_INVOKE(f_, idx[Is]...);
+            }
+        };
+
+        /// \endcond
+    }}    // namespace v2::detail
+}    // namespace hpx::parallel
@@ -290,7 +290,9 @@ namespace hpx {
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/copy.hpp>
 #include <hpx/parallel/algorithms/detail/advance_to_sentinel.hpp>
+#include <hpx/parallel/algorithms/detail/chunked_invoke.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/merge_path.hpp>
 #include <hpx/parallel/algorithms/detail/rotate.hpp>
 #include <hpx/parallel/algorithms/detail/upper_lower_bound.hpp>
 #include <hpx/parallel/util/compare_projected.hpp>
@@ -305,6 +307,7 @@ namespace hpx {
 #include <iterator>
 #include <list>
 #include <memory>
+#include <new>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -387,94 +390,48 @@ namespace hpx { namespace parallel { inline namespace v1 {
         };
 
         ///////////////////////////////////////////////////////////////////////
-        template <typename ExPolicy, typename Iter1, typename Sent1,
-            typename Iter2, typename Sent2, typename Iter3, typename Comp,
-            typename Proj1, typename Proj2, typename BinarySearchHelper>
-        void parallel_merge_helper(ExPolicy policy, Iter1 first1, Sent1 last1,
-            Iter2 first2, Sent2 last2, Iter3 dest, Comp&& comp, Proj1&& proj1,
-            Proj2&& proj2, bool range_reversal, BinarySearchHelper)
+        // Invokes f(begin, end) for the chunks of the output of merging a
+        // given overall number of elements, the chunks are determined by the
+        // executor parameters of the policy. Small outputs are processed
+        // sequentially.
+        template <typename ExPolicy, typename F>
+        void merge_path_invoke(ExPolicy& policy, std::size_t total, F&& f)
         {
             constexpr std::size_t threshold = 65536;
-
-            std::size_t size1 = detail::distance(first1, last1);
-            std::size_t size2 = detail::distance(first2, last2);
-
-            // Perform sequential merge if data size is smaller than threshold.
-            if (size1 + size2 <= threshold)
-            {
-                if (range_reversal)
-                {
-                    sequential_merge(first2, last2, first1, last1, dest,
-                        HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj2, proj2),
-                        HPX_FORWARD(Proj1, proj1));
-                }
-                else
-                {
-                    sequential_merge(first1, last1, first2, last2, dest,
-                        HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj1, proj1),
-                        HPX_FORWARD(Proj2, proj2));
-                }
-                return;
-            }
-
-            // Let size1 is bigger than size2 always.
-            if (size1 < size2)
+            if (total <= threshold)
             {
-                // For stability of algorithm, must switch binary search methods
-                // when swapping size1 and size2.
-                parallel_merge_helper(policy, first2, last2, first1, last1,
-                    dest, HPX_FORWARD(Comp, comp), HPX_FORWARD(Proj2, proj2),
-                    HPX_FORWARD(Proj1, proj1), !range_reversal,
-                    typename BinarySearchHelper::another_type());
+                f(std::size_t(0), total);
                 return;
             }
 
-            HPX_ASSERT(size1 >= size2);
-            HPX_ASSERT(size1 >= 1ul);
-
-            Iter1 mid1 = first1 + size1 / 2;
-            Iter2 boundary2 = BinarySearchHelper::call(
-                first2, last2, HPX_INVOKE(proj1, *mid1), comp, proj2);
-            Iter3 target = dest + (mid1 - first1) + (boundary2 - first2);
-
-            *target = *mid1;
+            chunked_invoke(policy, total, HPX_FORWARD(F, f));
+        }
 
-            hpx::future<void> fut =
-                execution::async_execute(policy.executor(), [&]() -> void {
-                    // Process left side ranges.
-                    parallel_merge_helper(policy, first1, mid1, first2,
-                        boundary2, dest, comp, proj1, proj2, range_reversal,
-                        BinarySearchHelper());
+        ///////////////////////////////////////////////////////////////////////
+        // Merges both sequences using merge-path partitioning: the output is
+        // divided into partitions of equal size, the corresponding parts of
+        // the input sequences are found independently for each of them.
+        template <typename ExPolicy, typename Iter1, typename Iter2,
+            typename Iter3, typename Comp, typename Proj1, typename Proj2>
+        void parallel_merge_helper(ExPolicy& policy, Iter1 first1,
+            std::size_t len1, Iter2 first2, std::size_t len2, Iter3 dest,
+            Comp& comp, Proj1& proj1, Proj2& proj2)
+        {
+            std::size_t const total = len1 + len2;
+
+            merge_path_invoke(
+                policy, total, [&](std::size_t diag1, std::size_t diag2) {
+                    std::size_t const mid1 = merge_path_search(first1, len1,
+                        first2, len2, diag1, comp, proj1, proj2);
+                    std::size_t const mid2 = merge_path_search(first1, len1,
+                        first2, len2, diag2, comp, proj1, proj2);
+
+                    sequential_merge(std::next(first1, mid1),
+                        std::next(first1, mid2),
+                        std::next(first2, diag1 - mid1),
+                        std::next(first2, diag2 - mid2),
+                        std::next(dest, diag1), comp, proj1, proj2);
                 });
-
-            try
-            {
-                // Process right side ranges.
-                parallel_merge_helper(policy, mid1 + 1, last1, boundary2, last2,
-                    target + 1, HPX_FORWARD(Comp, comp),
-                    HPX_FORWARD(Proj1, proj1), HPX_FORWARD(Proj2, proj2),
-                    range_reversal, BinarySearchHelper());
-            }
-            catch (...)
-            {
-                fut.wait();
-
-                std::vector<hpx::future<void>> futures;
-                futures.reserve(2);
-                futures.emplace_back(HPX_MOVE(fut));
-                futures.emplace_back(hpx::make_exceptional_future<void>(
-                    std::current_exception()));
-
-                std::list<std::exception_ptr> errors;
-                util::detail::handle_local_exceptions<ExPolicy>::call(
-                    futures, errors);
-
-                // Not reachable.
-                HPX_ASSERT(false);
-                return;
-            }
-
-            fut.get();
         }
 
         template <typename ExPolicy, typename Iter1, typename Sent1,
@@ -494,12 +451,12 @@ namespace hpx { namespace parallel { inline namespace v1 {
                               Proj2, proj2)]() mutable -> result_type {
                 try
                 {
-                    parallel_merge_helper(HPX_MOVE(policy), first1, last1,
-                        first2, last2, dest, HPX_MOVE(comp), HPX_MOVE(proj1),
-                        HPX_MOVE(proj2), false, lower_bound_helper());
-
                     auto len1 = detail::distance(first1, last1);
                     auto len2 = detail::distance(first2, last2);
+
+                    parallel_merge_helper(policy, first1, len1, first2, len2,
+                        dest, comp, proj1, proj2);
+
                     return {std::next(first1, len1), std::next(first2, len2),
                         std::next(dest, len1 + len2)};
                 }
@@ -589,6 +546,118 @@ namespace hpx { namespace parallel { inline namespace v1 {
             return last;
         }
 
+        // The temporary buffer used by the parallel inplace_merge is bounded
+        // to this size (in bytes). Larger ranges are first divided into
+        // independent sub-ranges by rotating blocks of elements.
+        inline constexpr std::size_t inplace_merge_buffer_size =
+            std::size_t(256) * 1024 * 1024;
+
+        // Moves all elements into a temporary buffer and merges them back
+        // using merge-path partitioning. Returns false if no buffer could be
+        // used for the given range.
+        template <typename ExPolicy, typename Iter, typename Comp,
+            typename Proj>
+        bool parallel_buffered_inplace_merge(ExPolicy& policy, Iter first,
+            Iter middle, Iter last, Comp& comp, Proj& proj)
+        {
+            using value_type = typename std::iterator_traits<Iter>::value_type;
+
+            // moving the elements into the buffer and back must not fail
+            // halfway, the buffer holds the only copy of some of them
+            if constexpr (!std::is_nothrow_move_constructible_v<value_type> ||
+                !std::is_nothrow_move_assignable_v<value_type>)
+            {
+                return false;
+            }
+            else
+            {
+                std::size_t const len1 = middle - first;
+                std::size_t const len2 = last - middle;
+                std::size_t const total = len1 + len2;
+
+                if (total > inplace_merge_buffer_size / sizeof(value_type))
+                {
+                    return false;
+                }
+
+                struct buffer_guard
+                {
+                    ~buffer_guard()
+                    {
+                        std::destroy_n(data, size);
+                        ::operator delete(data);
+                    }
+
+                    value_type* data;
+                    std::size_t size;
+                };
+
+                buffer_guard buffer{static_cast<value_type*>(::operator new(
+                                        total * sizeof(value_type),
+                                        std::nothrow)),
+                    0};
+                if (buffer.data == nullptr)
+                {
+                    return false;
+                }
+
+                // move all elements into the buffer
+                merge_path_invoke(
+                    policy, total, [&](std::size_t begin, std::size_t end) {
+                        std::uninitialized_move(first + begin, first + end,
+                            buffer.data + begin);
+                    });
+                buffer.size = total;
+
+                // merge both halves back into the original range
+                value_type* const first1 = buffer.data;
+                value_type* const first2 = buffer.data + len1;
+
+                merge_path_invoke(
+                    policy, total, [&](std::size_t diag1, std::size_t diag2) {
+                        std::size_t const mid1 = merge_path_search(first1,
+                            len1, first2, len2, diag1, comp, proj, proj);
+                        std::size_t const mid2 = merge_path_search(first1,
+                            len1, first2, len2, diag2, comp, proj, proj);
+
+                        value_type* part_first1 = first1 + mid1;
+                        value_type* const part_last1 = first1 + mid2;
+                        value_type* part_first2 = first2 + (diag1 - mid1);
+                        value_type* const part_last2 = first2 + (diag2 - mid2);
+
+                        Iter dest = first + diag1;
+                        while (part_first1 != part_last1 &&
+                            part_first2 != part_last2)
+                        {
+                            if (HPX_INVOKE(comp, HPX_INVOKE(proj, *part_first2),
+                                    HPX_INVOKE(proj, *part_first1)))
+                            {
+                                *dest++ = HPX_MOVE(*part_first2++);
+                            }
+                            else
+                            {
+                                *dest++ = HPX_MOVE(*part_first1++);
+                            }
+                        }
+
+                        dest = std::move(part_first1, part_last1, dest);
+                        std::move(part_first2, part_last2, dest);
+                    });
+
+                // release the moved-from elements concurrently as well
+                if constexpr (!std::is_trivially_destructible_v<value_type>)
+                {
+                    merge_path_invoke(policy, total,
+                        [&](std::size_t begin, std::size_t end) {
+                            std::destroy(
+                                buffer.data + begin, buffer.data + end);
+                        });
+                    buffer.size = 0;
+                }
+                return true;
+            }
+        }
+
         template <typename ExPolicy, typename Iter, typename Sent,
             typename Comp, typename Proj>
         void parallel_inplace_merge_helper(ExPolicy&& policy, Iter first,
@@ -609,6 +678,14 @@ namespace hpx { namespace parallel { inline namespace v1 {
                 return;
             }
 
+            // Merge through a temporary buffer if the range is small enough,
+            // otherwise divide it into two independent ranges first.
+            if (parallel_buffered_inplace_merge(policy, first, middle,
+                    std::next(middle, right_size), comp, proj))
+            {
+                return;
+            }
+
             if (left_size >= right_size)
             {
                 // Means that always 'pivot' < 'middle'.
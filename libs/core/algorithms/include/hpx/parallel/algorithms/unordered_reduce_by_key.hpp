@@ -0,0 +1,390 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/unordered_reduce_by_key.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    /// Reduces the values supplied for each distinct key (group-by). Unlike
+    /// \a reduce_by_key, which combines runs of equal consecutive keys
+    /// only, equivalent keys do not have to be adjacent in
+    /// [key_first, key_last). The algorithm produces a single key/value pair
+    /// for each group of equivalent keys, the key being the first key of the
+    /// group (in input order) and the value being the reduction of all
+    /// values of the group using \a func, applied in input order. The number
+    /// of keys supplied must match the number of values.
+    ///
+    /// \note   Complexity: Performs O(\a key_last - \a key_first)
+    ///         applications of the hash function \a hash and of the
+    ///         reduction function \a func and on average
+    ///         O(\a key_last - \a key_first) applications of the predicate
+    ///         \a pred.
+    ///
+    /// The key/value pairs are radix-partitioned by the hash values of the
+    /// keys, each partition is then reduced independently using a local
+    /// hash table. The relative order of the produced key/value pairs is
+    /// unspecified when invoked with a parallel execution policy. Otherwise,
+    /// the keys are produced in the order of their first occurrence.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandIter1   The type of the key iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam RandIter2   The type of the value iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter1    The type of the iterator representing the
+    ///                     destination key range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination value range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Hash        The type of the function/function object to use
+    ///                     for hashing the keys (deduced). Defaults to
+    ///                     std::hash of the value type of \a RandIter1.
+    /// \tparam Pred        The type of the function/function object to use
+    ///                     for comparing the keys for equality (deduced).
+    ///                     Defaults to std::equal_to<>.
+    /// \tparam Func        The type of the function/function object to use
+    ///                     (deduced). Defaults to std::plus of the value type
+    ///                     of \a RandIter2.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param key_first    Refers to the beginning of the sequence of key
+    ///                     elements the algorithm will be applied to.
+    /// \param key_last     Refers to the end of the sequence of key elements
+    ///                     the algorithm will be applied to.
+    /// \param values_first Refers to the beginning of the sequence of value
+    ///                     elements the algorithm will be applied to.
+    /// \param keys_output  Refers to the start output location for the keys
+    ///                     produced by the algorithm.
+    /// \param values_output Refers to the start output location for the
+    ///                     values produced by the algorithm.
+    /// \param hash         Specifies the function (or function object) which
+    ///                     calculates the hash value of a key. Equivalent
+    ///                     keys have to produce the same hash value.
+    /// \param pred         Specifies the function (or function object) which
+    ///                     will be invoked for pairs of keys with the same
+    ///                     hash value to decide whether they are equivalent.
+    /// \param func         Specifies the function (or function object) which
+    ///                     will be invoked to combine the values of
+    ///                     equivalent keys. The signature of this function
+    ///                     should be equivalent to:
+    ///                     \code
+    ///                     Ret fun(const Type1 &a, const Type1 &b);
+    ///                     \endcode \n
+    ///                     The signature does not need to have const&.
+    ///                     The types \a Type1 \a Ret must be such that an
+    ///                     object of type \a RandIter2 can be dereferenced
+    ///                     and then implicitly converted to any of those
+    ///                     types.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a unordered_reduce_by_key algorithm returns a
+    ///           \a hpx::future<in_out_result<FwdIter1, FwdIter2>> if the
+    ///           execution policy is of type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns
+    ///           \a in_out_result<FwdIter1, FwdIter2> otherwise. The result
+    ///           refers to the end of both output ranges.
+    ///
+    template <typename ExPolicy, typename RandIter1, typename RandIter2,
+        typename FwdIter1, typename FwdIter2,
+        typename Hash = std::hash<
+            typename std::iterator_traits<RandIter1>::value_type>,
+        typename Pred = std::equal_to<>,
+        typename Func = std::plus<
+            typename std::iterator_traits<RandIter2>::value_type>>
+    typename util::detail::algorithm_result<ExPolicy,
+        util::in_out_result<FwdIter1, FwdIter2>>::type
+    unordered_reduce_by_key(ExPolicy&& policy, RandIter1 key_first,
+        RandIter1 key_last, RandIter2 values_first, FwdIter1 keys_output,
+        FwdIter2 values_output, Hash&& hash = Hash(), Pred&& pred = Pred(),
+        Func&& func = Func());
+
+    /// Equivalent to the overload above invoked with
+    /// \a hpx::execution::seq.
+    template <typename RandIter1, typename RandIter2, typename FwdIter1,
+        typename FwdIter2,
+        typename Hash = std::hash<
+            typename std::iterator_traits<RandIter1>::value_type>,
+        typename Pred = std::equal_to<>,
+        typename Func = std::plus<
+            typename std::iterator_traits<RandIter2>::value_type>>
+    util::in_out_result<FwdIter1, FwdIter2> unordered_reduce_by_key(
+        RandIter1 key_first, RandIter1 key_last, RandIter2 values_first,
+        FwdIter1 keys_output, FwdIter2 values_output, Hash&& hash = Hash(),
+        Pred&& pred = Pred(), Func&& func = Func());
+
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/hash_partition.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+#include <hpx/parallel/util/result_types.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // unordered_reduce_by_key
+    template <typename ExPolicy, typename RandIter1, typename RandIter2,
+        typename FwdIter1, typename FwdIter2, typename Hash, typename Pred,
+        typename Func>
+    util::in_out_result<FwdIter1, FwdIter2> unordered_reduce_by_key_impl(
+        ExPolicy& policy, RandIter1 key_first, RandIter1 key_last,
+        RandIter2 values_first, FwdIter1 keys_output, FwdIter2 values_output,
+        Hash& hash, Pred& pred, Func& func)
+    {
+        using value_type = typename std::iterator_traits<RandIter2>::value_type;
+
+        std::size_t const count = detail::distance(key_first, key_last);
+
+        hash_partitions parts =
+            partition_by_hash(policy, count, [&](std::size_t i) {
+                return HPX_INVOKE(hash, *std::next(key_first, i));
+            });
+
+        // reduce every partition, the results of a partition refer to the
+        // first key of each group
+        std::vector<std::vector<std::pair<std::size_t, value_type>>> results(
+            parts.num_partitions);
+
+        invoke_each(policy, parts.num_partitions, [&](std::size_t part) {
+            auto equal = [&](std::size_t lhs, std::size_t rhs) -> bool {
+                return HPX_INVOKE(pred, *std::next(key_first, lhs),
+                    *std::next(key_first, rhs));
+            };
+
+            std::size_t const* indices = parts.begin(part);
+            std::size_t const size = parts.size(part);
+
+            // maps the first key of each group to its result
+            std::unordered_map<std::size_t, std::size_t,
+                hash_partition_index_hash, decltype(equal)>
+                groups(size, hash_partition_index_hash{parts.hashes.data()},
+                    equal);
+
+            auto& result = results[part];
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                std::size_t const index = indices[i];
+                auto const p = groups.emplace(index, result.size());
+                if (p.second)
+                {
+                    result.emplace_back(
+                        index, *std::next(values_first, index));
+                }
+                else
+                {
+                    value_type& value = result[p.first->second].second;
+                    value = HPX_INVOKE(
+                        func, value, *std::next(values_first, index));
+                }
+            }
+        });
+
+        std::vector<std::size_t> sizes(parts.num_partitions);
+        for (std::size_t part = 0; part != parts.num_partitions; ++part)
+        {
+            sizes[part] = results[part].size();
+        }
+
+        std::size_t const total = hash_partition_gather(
+            policy, sizes, [&](std::size_t part, std::size_t pos) {
+                FwdIter1 keys_out = std::next(keys_output, pos);
+                FwdIter2 values_out = std::next(values_output, pos);
+                for (auto& r : results[part])
+                {
+                    *keys_out++ = *std::next(key_first, r.first);
+                    *values_out++ = HPX_MOVE(r.second);
+                }
+            });
+
+        return util::in_out_result<FwdIter1, FwdIter2>{
+            std::next(keys_output, total), std::next(values_output, total)};
+    }
+
+    template <typename FwdIter1, typename FwdIter2>
+    struct unordered_reduce_by_key
+      : public detail::algorithm<unordered_reduce_by_key<FwdIter1, FwdIter2>,
+            util::in_out_result<FwdIter1, FwdIter2>>
+    {
+        unordered_reduce_by_key()
+          : unordered_reduce_by_key::algorithm("unordered_reduce_by_key")
+        {
+        }
+
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename Hash, typename Pred, typename Func>
+        static util::in_out_result<FwdIter1, FwdIter2> sequential(
+            ExPolicy&& policy, RandIter1 key_first, RandIter1 key_last,
+            RandIter2 values_first, FwdIter1 keys_output,
+            FwdIter2 values_output, Hash&& hash, Pred&& pred, Func&& func)
+        {
+            return unordered_reduce_by_key_impl(policy, key_first, key_last,
+                values_first, keys_output, values_output, hash, pred, func);
+        }
+
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename Hash, typename Pred, typename Func>
+        static typename util::detail::algorithm_result<ExPolicy,
+            util::in_out_result<FwdIter1, FwdIter2>>::type
+        parallel(ExPolicy&& policy, RandIter1 key_first, RandIter1 key_last,
+            RandIter2 values_first, FwdIter1 keys_output,
+            FwdIter2 values_output, Hash&& hash, Pred&& pred, Func&& func)
+        {
+            using result = util::detail::algorithm_result<ExPolicy,
+                util::in_out_result<FwdIter1, FwdIter2>>;
+
+            if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+            {
+                return result::get(execution::async_execute(policy.executor(),
+                    [policy, key_first, key_last, values_first, keys_output,
+                        values_output, hash = HPX_FORWARD(Hash, hash),
+                        pred = HPX_FORWARD(Pred, pred),
+                        func = HPX_FORWARD(Func, func)]() mutable {
+                        return unordered_reduce_by_key_impl(policy, key_first,
+                            key_last, values_first, keys_output, values_output,
+                            hash, pred, func);
+                    }));
+            }
+            else
+            {
+                return result::get(unordered_reduce_by_key_impl(policy,
+                    key_first, key_last, values_first, keys_output,
+                    values_output, hash, pred, func));
+            }
+        }
+    };
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
+
+namespace hpx { namespace experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::unordered_reduce_by_key
+    inline constexpr struct unordered_reduce_by_key_t final
+      : hpx::detail::tag_parallel_algorithm<unordered_reduce_by_key_t>
+    {
+        // clang-format off
+        template <typename RandIter1, typename RandIter2, typename FwdIter1,
+            typename FwdIter2,
+            typename Hash = std::hash<
+                typename std::iterator_traits<RandIter1>::value_type>,
+            typename Pred = std::equal_to<>,
+            typename Func = std::plus<
+                typename std::iterator_traits<RandIter2>::value_type>,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator_v<RandIter1> &&
+                hpx::traits::is_iterator_v<RandIter2> &&
+                hpx::traits::is_iterator_v<FwdIter1> &&
+                hpx::traits::is_iterator_v<FwdIter2>
+            )>
+        // clang-format on
+        friend hpx::parallel::util::in_out_result<FwdIter1, FwdIter2>
+        tag_fallback_invoke(unordered_reduce_by_key_t, RandIter1 key_first,
+            RandIter1 key_last, RandIter2 values_first, FwdIter1 keys_output,
+            FwdIter2 values_output, Hash&& hash = Hash(),
+            Pred&& pred = Pred(), Func&& func = Func())
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandIter1>,
+                "Requires at least random access iterator.");
+            static_assert(hpx::traits::is_random_access_iterator_v<RandIter2>,
+                "Requires at least random access iterator.");
+            static_assert(hpx::traits::is_forward_iterator_v<FwdIter1> &&
+                    hpx::traits::is_forward_iterator_v<FwdIter2>,
+                "Requires at least forward iterator.");
+
+            return hpx::parallel::v1::detail::unordered_reduce_by_key<
+                FwdIter1, FwdIter2>()
+                .call(hpx::execution::seq, key_first, key_last, values_first,
+                    keys_output, values_output, HPX_FORWARD(Hash, hash),
+                    HPX_FORWARD(Pred, pred), HPX_FORWARD(Func, func));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename FwdIter1, typename FwdIter2,
+            typename Hash = std::hash<
+                typename std::iterator_traits<RandIter1>::value_type>,
+            typename Pred = std::equal_to<>,
+            typename Func = std::plus<
+                typename std::iterator_traits<RandIter2>::value_type>,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_iterator_v<RandIter1> &&
+                hpx::traits::is_iterator_v<RandIter2> &&
+                hpx::traits::is_iterator_v<FwdIter1> &&
+                hpx::traits::is_iterator_v<FwdIter2>
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy,
+            hpx::parallel::util::in_out_result<FwdIter1, FwdIter2>>::type
+        tag_fallback_invoke(unordered_reduce_by_key_t, ExPolicy&& policy,
+            RandIter1 key_first, RandIter1 key_last, RandIter2 values_first,
+            FwdIter1 keys_output, FwdIter2 values_output, Hash&& hash = Hash(),
+            Pred&& pred = Pred(), Func&& func = Func())
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandIter1>,
+                "Requires at least random access iterator.");
+            static_assert(hpx::traits::is_random_access_iterator_v<RandIter2>,
+                "Requires at least random access iterator.");
+            static_assert(hpx::traits::is_forward_iterator_v<FwdIter1> &&
+                    hpx::traits::is_forward_iterator_v<FwdIter2>,
+                "Requires at least forward iterator.");
+
+            return hpx::parallel::v1::detail::unordered_reduce_by_key<
+                FwdIter1, FwdIter2>()
+                .call(HPX_FORWARD(ExPolicy, policy), key_first, key_last,
+                    values_first, keys_output, values_output,
+                    HPX_FORWARD(Hash, hash), HPX_FORWARD(Pred, pred),
+                    HPX_FORWARD(Func, func));
+        }
+    } unordered_reduce_by_key{};
+}}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
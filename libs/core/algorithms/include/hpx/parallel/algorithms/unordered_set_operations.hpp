@@ -0,0 +1,624 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/unordered_set_operations.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    /// Copies the elements which are contained in at least one of the
+    /// ranges [first1, last1) and [first2, last2) to the range beginning at
+    /// \a dest. Unlike \a hpx::set_union, the input ranges do not have to
+    /// be sorted and the algorithm has set semantics: every element is
+    /// copied only once, regardless of how often it (or an equivalent
+    /// element) occurs in either of the ranges. Elements of the first range
+    /// are preferred over equivalent elements of the second range.
+    ///
+    /// \note   Complexity: Performs O(N1 + N2) applications of the hash
+    ///         function \a hash and on average O(N1 + N2) applications of the
+    ///         predicate \a pred, where N1 is the length of the first input
+    ///         sequence and N2 is the length of the second input sequence.
+    ///
+    /// The elements of both ranges are radix-partitioned by their hash
+    /// values, each partition is then processed independently using a
+    /// local hash table. The relative order of the copied elements is
+    /// unspecified.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandIter1   The type of the source iterators used for the
+    ///                     first range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam RandIter2   The type of the source iterators used for the
+    ///                     second range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Hash        The type of the function/function object to use
+    ///                     for hashing the elements (deduced). Defaults to
+    ///                     std::hash of the value type of \a RandIter1.
+    /// \tparam Pred        The type of the function/function object to use
+    ///                     for comparing the elements for equality
+    ///                     (deduced). Defaults to std::equal_to<>.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first1       Refers to the beginning of the sequence of elements
+    ///                     of the first range the algorithm will be applied to.
+    /// \param last1        Refers to the end of the sequence of elements of
+    ///                     the first range the algorithm will be applied to.
+    /// \param first2       Refers to the beginning of the sequence of elements
+    ///                     of the second range the algorithm will be applied
+    ///                     to.
+    /// \param last2        Refers to the end of the sequence of elements of
+    ///                     the second range the algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param hash         Specifies the function (or function object) which
+    ///                     calculates the hash value of an element of either
+    ///                     range. Equivalent elements have to produce the same
+    ///                     hash value.
+    /// \param pred         Specifies the function (or function object) which
+    ///                     will be invoked for pairs of elements with the
+    ///                     same hash value to decide whether they are
+    ///                     equivalent.
+    ///
+    /// The assignments in the parallel \a unordered_set_union algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a unordered_set_union algorithm
+    /// invoked with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a unordered_set_union algorithm returns a
+    ///           \a hpx::future<FwdIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a FwdIter otherwise.
+    ///           The \a unordered_set_union algorithm returns the output
+    ///           iterator to the element in the destination range, one past
+    ///           the last element copied.
+    ///
+    template <typename ExPolicy, typename RandIter1, typename RandIter2,
+        typename FwdIter,
+        typename Hash = std::hash<
+            typename std::iterator_traits<RandIter1>::value_type>,
+        typename Pred = std::equal_to<>>
+    typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+    unordered_set_union(ExPolicy&& policy, RandIter1 first1,
+        RandIter1 last1, RandIter2 first2, RandIter2 last2, FwdIter dest,
+        Hash&& hash = Hash(), Pred&& pred = Pred());
+
+    /// Copies the elements of the range [first1, last1) which are
+    /// equivalent to at least one element of the range [first2, last2) to
+    /// the range beginning at \a dest. Unlike \a hpx::set_intersection, the
+    /// input ranges do not have to be sorted and the algorithm has set
+    /// semantics: equivalent elements of the first range are copied only
+    /// once.
+    ///
+    /// \note   Complexity: Performs O(N1 + N2) applications of the hash
+    ///         function \a hash and on average O(N1 + N2) applications of the
+    ///         predicate \a pred, where N1 is the length of the first input
+    ///         sequence and N2 is the length of the second input sequence.
+    ///
+    /// The relative order of the copied elements is unspecified. The
+    /// parameters and the execution of the assignments are the same as for
+    /// \a unordered_set_union.
+    ///
+    /// \returns  The \a unordered_set_intersection algorithm returns a
+    ///           \a hpx::future<FwdIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a FwdIter otherwise.
+    ///           The \a unordered_set_intersection algorithm returns the
+    ///           output iterator to the element in the destination range,
+    ///           one past the last element copied.
+    ///
+    template <typename ExPolicy, typename RandIter1, typename RandIter2,
+        typename FwdIter,
+        typename Hash = std::hash<
+            typename std::iterator_traits<RandIter1>::value_type>,
+        typename Pred = std::equal_to<>>
+    typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+    unordered_set_intersection(ExPolicy&& policy, RandIter1 first1,
+        RandIter1 last1, RandIter2 first2, RandIter2 last2, FwdIter dest,
+        Hash&& hash = Hash(), Pred&& pred = Pred());
+
+    /// Copies the elements of the range [first1, last1) which are not
+    /// equivalent to any element of the range [first2, last2) to the range
+    /// beginning at \a dest. Unlike \a hpx::set_difference, the input
+    /// ranges do not have to be sorted and the algorithm has set semantics:
+    /// equivalent elements of the first range are copied only once.
+    ///
+    /// \note   Complexity: Performs O(N1 + N2) applications of the hash
+    ///         function \a hash and on average O(N1 + N2) applications of the
+    ///         predicate \a pred, where N1 is the length of the first input
+    ///         sequence and N2 is the length of the second input sequence.
+    ///
+    /// The relative order of the copied elements is unspecified. The
+    /// parameters and the execution of the assignments are the same as for
+    /// \a unordered_set_union.
+    ///
+    /// \returns  The \a unordered_set_difference algorithm returns a
+    ///           \a hpx::future<FwdIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a FwdIter otherwise.
+    ///           The \a unordered_set_difference algorithm returns the
+    ///           output iterator to the element in the destination range,
+    ///           one past the last element copied.
+    ///
+    template <typename ExPolicy, typename RandIter1, typename RandIter2,
+        typename FwdIter,
+        typename Hash = std::hash<
+            typename std::iterator_traits<RandIter1>::value_type>,
+        typename Pred = std::equal_to<>>
+    typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+    unordered_set_difference(ExPolicy&& policy, RandIter1 first1,
+        RandIter1 last1, RandIter2 first2, RandIter2 last2, FwdIter dest,
+        Hash&& hash = Hash(), Pred&& pred = Pred());
+
+    /// Equivalent to the overloads above invoked with
+    /// \a hpx::execution::seq.
+    template <typename RandIter1, typename RandIter2, typename FwdIter,
+        typename Hash = std::hash<
+            typename std::iterator_traits<RandIter1>::value_type>,
+        typename Pred = std::equal_to<>>
+    FwdIter unordered_set_union(RandIter1 first1, RandIter1 last1,
+        RandIter2 first2, RandIter2 last2, FwdIter dest,
+        Hash&& hash = Hash(), Pred&& pred = Pred());
+
+    /// Equivalent to the overloads above invoked with
+    /// \a hpx::execution::seq.
+    template <typename RandIter1, typename RandIter2, typename FwdIter,
+        typename Hash = std::hash<
+            typename std::iterator_traits<RandIter1>::value_type>,
+        typename Pred = std::equal_to<>>
+    FwdIter unordered_set_intersection(RandIter1 first1, RandIter1 last1,
+        RandIter2 first2, RandIter2 last2, FwdIter dest,
+        Hash&& hash = Hash(), Pred&& pred = Pred());
+
+    /// Equivalent to the overloads above invoked with
+    /// \a hpx::execution::seq.
+    template <typename RandIter1, typename RandIter2, typename FwdIter,
+        typename Hash = std::hash<
+            typename std::iterator_traits<RandIter1>::value_type>,
+        typename Pred = std::equal_to<>>
+    FwdIter unordered_set_difference(RandIter1 first1, RandIter1 last1,
+        RandIter2 first2, RandIter2 last2, FwdIter dest,
+        Hash&& hash = Hash(), Pred&& pred = Pred());
+
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/hash_partition.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The elements of both ranges are partitioned together, indices below
+    // len1 refer to the first range, all others to the second range. As the
+    // indices of each partition are sorted, the indices referring to the
+    // first range precede those referring to the second one.
+    //
+    // Op::call(table, indices, size, split, len1) processes the indices of
+    // a single partition, split being the number of indices referring to
+    // the first range. It moves the indices of the elements to copy to the
+    // front of the partition and returns their number.
+    template <typename ExPolicy, typename RandIter1, typename RandIter2,
+        typename FwdIter, typename Hash, typename Pred, typename Op>
+    FwdIter unordered_set_operation_impl(ExPolicy& policy, RandIter1 first1,
+        RandIter1 last1, RandIter2 first2, RandIter2 last2, FwdIter dest,
+        Hash& hash, Pred& pred, Op op)
+    {
+        std::size_t const len1 = detail::distance(first1, last1);
+        std::size_t const len2 = detail::distance(first2, last2);
+
+        hash_partitions parts =
+            partition_by_hash(policy, len1 + len2, [&](std::size_t i) {
+                if (i < len1)
+                {
+                    return static_cast<std::size_t>(
+                        HPX_INVOKE(hash, *std::next(first1, i)));
+                }
+                return static_cast<std::size_t>(
+                    HPX_INVOKE(hash, *std::next(first2, i - len1)));
+            });
+
+        std::vector<std::size_t> sizes(parts.num_partitions);
+
+        invoke_each(policy, parts.num_partitions, [&](std::size_t part) {
+            auto equal = [&](std::size_t lhs, std::size_t rhs) -> bool {
+                if (lhs < len1)
+                {
+                    if (rhs < len1)
+                    {
+                        return HPX_INVOKE(pred, *std::next(first1, lhs),
+                            *std::next(first1, rhs));
+                    }
+                    return HPX_INVOKE(pred, *std::next(first1, lhs),
+                        *std::next(first2, rhs - len1));
+                }
+                if (rhs < len1)
+                {
+                    return HPX_INVOKE(pred, *std::next(first2, lhs - len1),
+                        *std::next(first1, rhs));
+                }
+                return HPX_INVOKE(pred, *std::next(first2, lhs - len1),
+                    *std::next(first2, rhs - len1));
+            };
+
+            std::size_t* indices = parts.begin(part);
+            std::size_t const size = parts.size(part);
+            std::size_t const split = static_cast<std::size_t>(
+                std::lower_bound(indices, indices + size, len1) - indices);
+
+            std::unordered_set<std::size_t, hash_partition_index_hash,
+                decltype(equal)>
+                table(size, hash_partition_index_hash{parts.hashes.data()},
+                    equal);
+
+            sizes[part] = op.call(table, indices, size, split, len1);
+        });
+
+        std::size_t const total = hash_partition_gather(
+            policy, sizes, [&](std::size_t part, std::size_t pos) {
+                std::size_t const* indices = parts.begin(part);
+                FwdIter out = std::next(dest, pos);
+                for (std::size_t i = 0; i != sizes[part]; ++i, ++out)
+                {
+                    if (indices[i] < len1)
+                    {
+                        *out = *std::next(first1, indices[i]);
+                    }
+                    else
+                    {
+                        *out = *std::next(first2, indices[i] - len1);
+                    }
+                }
+            });
+
+        return std::next(dest, total);
+    }
+
+    struct unordered_set_union_op
+    {
+        static constexpr char const* name = "unordered_set_union";
+
+        // all distinct elements of both ranges
+        template <typename Table>
+        static std::size_t call(Table& table, std::size_t* indices,
+            std::size_t size, std::size_t, std::size_t)
+        {
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                if (table.insert(indices[i]).second)
+                {
+                    indices[kept++] = indices[i];
+                }
+            }
+            return kept;
+        }
+    };
+
+    struct unordered_set_intersection_op
+    {
+        static constexpr char const* name = "unordered_set_intersection";
+
+        // all distinct elements of the first range which are contained in
+        // the second range
+        template <typename Table>
+        static std::size_t call(Table& table, std::size_t* indices,
+            std::size_t size, std::size_t split, std::size_t len1)
+        {
+            table.insert(indices + split, indices + size);
+
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i != split; ++i)
+            {
+                // the matching element of the second range is removed, which
+                // keeps equivalent elements from being copied again
+                auto it = table.find(indices[i]);
+                if (it != table.end() && *it >= len1)
+                {
+                    table.erase(it);
+                    indices[kept++] = indices[i];
+                }
+            }
+            return kept;
+        }
+    };
+
+    struct unordered_set_difference_op
+    {
+        static constexpr char const* name = "unordered_set_difference";
+
+        // all distinct elements of the first range which are not contained
+        // in the second range
+        template <typename Table>
+        static std::size_t call(Table& table, std::size_t* indices,
+            std::size_t size, std::size_t split, std::size_t)
+        {
+            table.insert(indices + split, indices + size);
+
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i != split; ++i)
+            {
+                if (table.insert(indices[i]).second)
+                {
+                    indices[kept++] = indices[i];
+                }
+            }
+            return kept;
+        }
+    };
+
+    template <typename FwdIter, typename Op>
+    struct unordered_set_operation
+      : public detail::algorithm<unordered_set_operation<FwdIter, Op>,
+            FwdIter>
+    {
+        unordered_set_operation()
+          : unordered_set_operation::algorithm(Op::name)
+        {
+        }
+
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename Hash, typename Pred>
+        static FwdIter sequential(ExPolicy&& policy, RandIter1 first1,
+            RandIter1 last1, RandIter2 first2, RandIter2 last2, FwdIter dest,
+            Hash&& hash, Pred&& pred)
+        {
+            return unordered_set_operation_impl(policy, first1, last1, first2,
+                last2, dest, hash, pred, Op());
+        }
+
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename Hash, typename Pred>
+        static typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        parallel(ExPolicy&& policy, RandIter1 first1, RandIter1 last1,
+            RandIter2 first2, RandIter2 last2, FwdIter dest, Hash&& hash,
+            Pred&& pred)
+        {
+            using result = util::detail::algorithm_result<ExPolicy, FwdIter>;
+
+            if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+            {
+                return result::get(execution::async_execute(policy.executor(),
+                    [policy, first1, last1, first2, last2, dest,
+                        hash = HPX_FORWARD(Hash, hash),
+                        pred = HPX_FORWARD(Pred, pred)]() mutable {
+                        return unordered_set_operation_impl(policy, first1,
+                            last1, first2, last2, dest, hash, pred, Op());
+                    }));
+            }
+            else
+            {
+                return result::get(unordered_set_operation_impl(policy,
+                    first1, last1, first2, last2, dest, hash, pred, Op()));
+            }
+        }
+    };
+
+    template <typename Op, typename ExPolicy, typename RandIter1,
+        typename RandIter2, typename FwdIter, typename Hash, typename Pred>
+    decltype(auto) unordered_set_operation_call(ExPolicy&& policy,
+        RandIter1 first1, RandIter1 last1, RandIter2 first2, RandIter2 last2,
+        FwdIter dest, Hash&& hash, Pred&& pred)
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<RandIter1>,
+            "Requires at least random access iterator.");
+        static_assert(hpx::traits::is_random_access_iterator_v<RandIter2>,
+            "Requires at least random access iterator.");
+        static_assert(hpx::traits::is_forward_iterator_v<FwdIter>,
+            "Requires at least forward iterator.");
+
+        return unordered_set_operation<FwdIter, Op>().call(
+            HPX_FORWARD(ExPolicy, policy), first1, last1, first2, last2, dest,
+            HPX_FORWARD(Hash, hash), HPX_FORWARD(Pred, pred));
+    }
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
+
+namespace hpx { namespace experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::unordered_set_union
+    inline constexpr struct unordered_set_union_t final
+      : hpx::detail::tag_parallel_algorithm<unordered_set_union_t>
+    {
+        // clang-format off
+        template <typename RandIter1, typename RandIter2, typename FwdIter,
+            typename Hash = std::hash<
+                typename std::iterator_traits<RandIter1>::value_type>,
+            typename Pred = std::equal_to<>,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator_v<RandIter1> &&
+                hpx::traits::is_iterator_v<RandIter2> &&
+                hpx::traits::is_iterator_v<FwdIter>
+            )>
+        // clang-format on
+        friend FwdIter tag_fallback_invoke(unordered_set_union_t,
+            RandIter1 first1, RandIter1 last1, RandIter2 first2,
+            RandIter2 last2, FwdIter dest, Hash&& hash = Hash(),
+            Pred&& pred = Pred())
+        {
+            return hpx::parallel::v1::detail::unordered_set_operation_call<
+                hpx::parallel::v1::detail::unordered_set_union_op>(
+                hpx::execution::seq, first1, last1, first2, last2, dest,
+                HPX_FORWARD(Hash, hash), HPX_FORWARD(Pred, pred));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename FwdIter,
+            typename Hash = std::hash<
+                typename std::iterator_traits<RandIter1>::value_type>,
+            typename Pred = std::equal_to<>,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_iterator_v<RandIter1> &&
+                hpx::traits::is_iterator_v<RandIter2> &&
+                hpx::traits::is_iterator_v<FwdIter>
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy,
+            FwdIter>::type
+        tag_fallback_invoke(unordered_set_union_t, ExPolicy&& policy,
+            RandIter1 first1, RandIter1 last1, RandIter2 first2,
+            RandIter2 last2, FwdIter dest, Hash&& hash = Hash(),
+            Pred&& pred = Pred())
+        {
+            return hpx::parallel::v1::detail::unordered_set_operation_call<
+                hpx::parallel::v1::detail::unordered_set_union_op>(
+                HPX_FORWARD(ExPolicy, policy), first1, last1, first2, last2,
+                dest, HPX_FORWARD(Hash, hash), HPX_FORWARD(Pred, pred));
+        }
+    } unordered_set_union{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::unordered_set_intersection
+    inline constexpr struct unordered_set_intersection_t final
+      : hpx::detail::tag_parallel_algorithm<unordered_set_intersection_t>
+    {
+        // clang-format off
+        template <typename RandIter1, typename RandIter2, typename FwdIter,
+            typename Hash = std::hash<
+                typename std::iterator_traits<RandIter1>::value_type>,
+            typename Pred = std::equal_to<>,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator_v<RandIter1> &&
+                hpx::traits::is_iterator_v<RandIter2> &&
+                hpx::traits::is_iterator_v<FwdIter>
+            )>
+        // clang-format on
+        friend FwdIter tag_fallback_invoke(unordered_set_intersection_t,
+            RandIter1 first1, RandIter1 last1, RandIter2 first2,
+            RandIter2 last2, FwdIter dest, Hash&& hash = Hash(),
+            Pred&& pred = Pred())
+        {
+            return hpx::parallel::v1::detail::unordered_set_operation_call<
+                hpx::parallel::v1::detail::unordered_set_intersection_op>(
+                hpx::execution::seq, first1, last1, first2, last2, dest,
+                HPX_FORWARD(Hash, hash), HPX_FORWARD(Pred, pred));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename FwdIter,
+            typename Hash = std::hash<
+                typename std::iterator_traits<RandIter1>::value_type>,
+            typename Pred = std::equal_to<>,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_iterator_v<RandIter1> &&
+                hpx::traits::is_iterator_v<RandIter2> &&
+                hpx::traits::is_iterator_v<FwdIter>
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy,
+            FwdIter>::type
+        tag_fallback_invoke(unordered_set_intersection_t, ExPolicy&& policy,
+            RandIter1 first1, RandIter1 last1, RandIter2 first2,
+            RandIter2 last2, FwdIter dest, Hash&& hash = Hash(),
+            Pred&& pred = Pred())
+        {
+            return hpx::parallel::v1::detail::unordered_set_operation_call<
+                hpx::parallel::v1::detail::unordered_set_intersection_op>(
+                HPX_FORWARD(ExPolicy, policy), first1, last1, first2, last2,
+                dest, HPX_FORWARD(Hash, hash), HPX_FORWARD(Pred, pred));
+        }
+    } unordered_set_intersection{};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::unordered_set_difference
+    inline constexpr struct unordered_set_difference_t final
+      : hpx::detail::tag_parallel_algorithm<unordered_set_difference_t>
+    {
+        // clang-format off
+        template <typename RandIter1, typename RandIter2, typename FwdIter,
+            typename Hash = std::hash<
+                typename std::iterator_traits<RandIter1>::value_type>,
+            typename Pred = std::equal_to<>,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator_v<RandIter1> &&
+                hpx::traits::is_iterator_v<RandIter2> &&
+                hpx::traits::is_iterator_v<FwdIter>
+            )>
+        // clang-format on
+        friend FwdIter tag_fallback_invoke(unordered_set_difference_t,
+            RandIter1 first1, RandIter1 last1, RandIter2 first2,
+            RandIter2 last2, FwdIter dest, Hash&& hash = Hash(),
+            Pred&& pred = Pred())
+        {
+            return hpx::parallel::v1::detail::unordered_set_operation_call<
+                hpx::parallel::v1::detail::unordered_set_difference_op>(
+                hpx::execution::seq, first1, last1, first2, last2, dest,
+                HPX_FORWARD(Hash, hash), HPX_FORWARD(Pred, pred));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename RandIter1, typename RandIter2,
+            typename FwdIter,
+            typename Hash = std::hash<
+                typename std::iterator_traits<RandIter1>::value_type>,
+            typename Pred = std::equal_to<>,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_iterator_v<RandIter1> &&
+                hpx::traits::is_iterator_v<RandIter2> &&
+                hpx::traits::is_iterator_v<FwdIter>
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy,
+            FwdIter>::type
+        tag_fallback_invoke(unordered_set_difference_t, ExPolicy&& policy,
+            RandIter1 first1, RandIter1 last1, RandIter2 first2,
+            RandIter2 last2, FwdIter dest, Hash&& hash = Hash(),
+            Pred&& pred = Pred())
+        {
+            return hpx::parallel::v1::detail::unordered_set_operation_call<
+                hpx::parallel::v1::detail::unordered_set_difference_op>(
+                HPX_FORWARD(ExPolicy, policy), first1, last1, first2, last2,
+                dest, HPX_FORWARD(Hash, hash), HPX_FORWARD(Pred, pred));
+        }
+    } unordered_set_difference{};
+}}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
@@ -0,0 +1,328 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/unordered_unique.hpp
+
+#pragma once
+
+#if defined(DOXYGEN)
+
+namespace hpx { namespace experimental {
+    // clang-format off
+
+    /// Copies the elements from the range [first, last), to another range
+    /// beginning at \a dest in such a way that no two equivalent elements
+    /// are copied, regardless of where they are located in the input range.
+    /// Unlike \a hpx::unique_copy, the input range does not have to be
+    /// sorted. Of every group of equivalent elements the first one (in input
+    /// order) is copied.
+    ///
+    /// \note   Complexity: Performs O(\a last - \a first) applications of
+    ///         the hash function \a hash and on average O(\a last - \a first)
+    ///         applications of the predicate \a pred.
+    ///
+    /// The elements are radix-partitioned by their hash values, each
+    /// partition is then deduplicated independently using a local hash
+    /// table. The relative order of the copied elements is unspecified
+    /// when invoked with a parallel execution policy. Otherwise, the
+    /// elements are copied in the order of their first occurrence.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam RandIter    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Hash        The type of the function/function object to use
+    ///                     for hashing the elements (deduced). Defaults to
+    ///                     std::hash of the value type of \a RandIter.
+    /// \tparam Pred        The type of the function/function object to use
+    ///                     for comparing the elements for equality
+    ///                     (deduced). Defaults to std::equal_to<>.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param hash         Specifies the function (or function object) which
+    ///                     calculates the hash value of an element. Equivalent
+    ///                     elements have to produce the same hash value.
+    /// \param pred         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements with the
+    ///                     same hash value to decide whether they are
+    ///                     equivalent.
+    ///
+    /// The assignments in the parallel \a unordered_unique_copy algorithm
+    /// invoked with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The assignments in the parallel \a unordered_unique_copy algorithm
+    /// invoked with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a unordered_unique_copy algorithm returns a
+    ///           \a hpx::future<FwdIter> if the execution policy is of type
+    ///           \a sequenced_task_policy or \a parallel_task_policy and
+    ///           returns \a FwdIter otherwise.
+    ///           The \a unordered_unique_copy algorithm returns the
+    ///           destination iterator to the end of the \a dest range.
+    ///
+    template <typename ExPolicy, typename RandIter, typename FwdIter,
+        typename Hash = std::hash<
+            typename std::iterator_traits<RandIter>::value_type>,
+        typename Pred = std::equal_to<>>
+    typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+    unordered_unique_copy(ExPolicy&& policy, RandIter first, RandIter last,
+        FwdIter dest, Hash&& hash = Hash(), Pred&& pred = Pred());
+
+    /// Copies the elements from the range [first, last), to another range
+    /// beginning at \a dest in such a way that no two equivalent elements
+    /// are copied, regardless of where they are located in the input range.
+    /// The elements are copied in the order of their first occurrence.
+    ///
+    /// \note   Complexity: Performs O(\a last - \a first) applications of
+    ///         the hash function \a hash and on average O(\a last - \a first)
+    ///         applications of the predicate \a pred.
+    ///
+    /// \tparam RandIter    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam Hash        The type of the function/function object to use
+    ///                     for hashing the elements (deduced). Defaults to
+    ///                     std::hash of the value type of \a RandIter.
+    /// \tparam Pred        The type of the function/function object to use
+    ///                     for comparing the elements for equality
+    ///                     (deduced). Defaults to std::equal_to<>.
+    ///
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range.
+    /// \param hash         Specifies the function (or function object) which
+    ///                     calculates the hash value of an element. Equivalent
+    ///                     elements have to produce the same hash value.
+    /// \param pred         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements with the
+    ///                     same hash value to decide whether they are
+    ///                     equivalent.
+    ///
+    /// \returns  The \a unordered_unique_copy algorithm returns \a FwdIter.
+    ///           The \a unordered_unique_copy algorithm returns the
+    ///           destination iterator to the end of the \a dest range.
+    ///
+    template <typename RandIter, typename FwdIter,
+        typename Hash = std::hash<
+            typename std::iterator_traits<RandIter>::value_type>,
+        typename Pred = std::equal_to<>>
+    FwdIter unordered_unique_copy(RandIter first, RandIter last, FwdIter dest,
+        Hash&& hash = Hash(), Pred&& pred = Pred());
+
+    // clang-format on
+}}    // namespace hpx::experimental
+
+#else    // DOXYGEN
+
+#include <hpx/config.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/distance.hpp>
+#include <hpx/parallel/algorithms/detail/hash_partition.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/sender_util.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // unordered_unique_copy
+    template <typename ExPolicy, typename RandIter, typename FwdIter,
+        typename Hash, typename Pred>
+    FwdIter unordered_unique_copy_impl(ExPolicy& policy, RandIter first,
+        RandIter last, FwdIter dest, Hash& hash, Pred& pred)
+    {
+        std::size_t const count = detail::distance(first, last);
+
+        hash_partitions parts =
+            partition_by_hash(policy, count, [&](std::size_t i) {
+                return HPX_INVOKE(hash, *std::next(first, i));
+            });
+
+        // deduplicate every partition, the indices of the elements to copy
+        // are moved to the front of the partition
+        std::vector<std::size_t> sizes(parts.num_partitions);
+
+        invoke_each(policy, parts.num_partitions, [&](std::size_t part) {
+            auto equal = [&](std::size_t lhs, std::size_t rhs) -> bool {
+                return HPX_INVOKE(
+                    pred, *std::next(first, lhs), *std::next(first, rhs));
+            };
+
+            std::size_t* indices = parts.begin(part);
+            std::size_t const size = parts.size(part);
+
+            std::unordered_set<std::size_t, hash_partition_index_hash,
+                decltype(equal)>
+                seen(size, hash_partition_index_hash{parts.hashes.data()},
+                    equal);
+
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                if (seen.insert(indices[i]).second)
+                {
+                    indices[kept++] = indices[i];
+                }
+            }
+            sizes[part] = kept;
+        });
+
+        std::size_t const total = hash_partition_gather(
+            policy, sizes, [&](std::size_t part, std::size_t pos) {
+                std::size_t const* indices = parts.begin(part);
+                FwdIter out = std::next(dest, pos);
+                for (std::size_t i = 0; i != sizes[part]; ++i, ++out)
+                {
+                    *out = *std::next(first, indices[i]);
+                }
+            });
+
+        return std::next(dest, total);
+    }
+
+    template <typename FwdIter>
+    struct unordered_unique_copy
+      : public detail::algorithm<unordered_unique_copy<FwdIter>, FwdIter>
+    {
+        unordered_unique_copy()
+          : unordered_unique_copy::algorithm("unordered_unique_copy")
+        {
+        }
+
+        template <typename ExPolicy, typename RandIter, typename Hash,
+            typename Pred>
+        static FwdIter sequential(ExPolicy&& policy, RandIter first,
+            RandIter last, FwdIter dest, Hash&& hash, Pred&& pred)
+        {
+            return unordered_unique_copy_impl(
+                policy, first, last, dest, hash, pred);
+        }
+
+        template <typename ExPolicy, typename RandIter, typename Hash,
+            typename Pred>
+        static typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+        parallel(ExPolicy&& policy, RandIter first, RandIter last,
+            FwdIter dest, Hash&& hash, Pred&& pred)
+        {
+            using result = util::detail::algorithm_result<ExPolicy, FwdIter>;
+
+            if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+            {
+                return result::get(execution::async_execute(policy.executor(),
+                    [policy, first, last, dest, hash = HPX_FORWARD(Hash, hash),
+                        pred = HPX_FORWARD(Pred, pred)]() mutable {
+                        return unordered_unique_copy_impl(
+                            policy, first, last, dest, hash, pred);
+                    }));
+            }
+            else
+            {
+                return result::get(unordered_unique_copy_impl(
+                    policy, first, last, dest, hash, pred));
+            }
+        }
+    };
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
+
+namespace hpx { namespace experimental {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // CPO for hpx::experimental::unordered_unique_copy
+    inline constexpr struct unordered_unique_copy_t final
+      : hpx::detail::tag_parallel_algorithm<unordered_unique_copy_t>
+    {
+        // clang-format off
+        template <typename RandIter, typename FwdIter,
+            typename Hash = std::hash<
+                typename std::iterator_traits<RandIter>::value_type>,
+            typename Pred = std::equal_to<>,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_iterator_v<RandIter> &&
+                hpx::traits::is_iterator_v<FwdIter>
+            )>
+        // clang-format on
+        friend FwdIter tag_fallback_invoke(unordered_unique_copy_t,
+            RandIter first, RandIter last, FwdIter dest, Hash&& hash = Hash(),
+            Pred&& pred = Pred())
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandIter>,
+                "Requires at least random access iterator.");
+            static_assert(hpx::traits::is_forward_iterator_v<FwdIter>,
+                "Requires at least forward iterator.");
+
+            return hpx::parallel::v1::detail::unordered_unique_copy<FwdIter>()
+                .call(hpx::execution::seq, first, last, dest,
+                    HPX_FORWARD(Hash, hash), HPX_FORWARD(Pred, pred));
+        }
+
+        // clang-format off
+        template <typename ExPolicy, typename RandIter, typename FwdIter,
+            typename Hash = std::hash<
+                typename std::iterator_traits<RandIter>::value_type>,
+            typename Pred = std::equal_to<>,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::is_execution_policy_v<ExPolicy> &&
+                hpx::traits::is_iterator_v<RandIter> &&
+                hpx::traits::is_iterator_v<FwdIter>
+            )>
+        // clang-format on
+        friend typename parallel::util::detail::algorithm_result<ExPolicy,
+            FwdIter>::type
+        tag_fallback_invoke(unordered_unique_copy_t, ExPolicy&& policy,
+            RandIter first, RandIter last, FwdIter dest, Hash&& hash = Hash(),
+            Pred&& pred = Pred())
+        {
+            static_assert(hpx::traits::is_random_access_iterator_v<RandIter>,
+                "Requires at least random access iterator.");
+            static_assert(hpx::traits::is_forward_iterator_v<FwdIter>,
+                "Requires at least forward iterator.");
+
+            return hpx::parallel::v1::detail::unordered_unique_copy<FwdIter>()
+                .call(HPX_FORWARD(ExPolicy, policy), first, last, dest,
+                    HPX_FORWARD(Hash, hash), HPX_FORWARD(Pred, pred));
+        }
+    } unordered_unique_copy{};
+}}    // namespace hpx::experimental
+
+#endif    // DOXYGEN
@@ -0,0 +1,46 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/topology.hpp>
+#include <hpx/parallel/algorithms/for_loop_tiling.hpp>
+
+#include <array>
+#include <cstddef>
+
+namespace hpx::parallel {
+
+    inline namespace v2 { namespace detail {
+
+        std::size_t get_tiling_cache_size(int level)
+        {
+            constexpr int max_cache_level = 5;
+
+            // the topology does not change while the application is running
+            static std::array<std::size_t, max_cache_level> const cache_sizes =
+                [] {
+                    std::array<std::size_t, max_cache_level> result = {};
+
+                    // get_cache_size returns the share of the given
+                    // processing units, i.e. the cache size divided by the
+                    // number of processing units sharing it
+                    auto const& topo = hpx::threads::create_topology();
+                    auto const& pu_mask = topo.get_thread_affinity_mask(0);
+                    for (int l = 1; l <= max_cache_level; ++l)
+                    {
+                        result[l - 1] = topo.get_cache_size(pu_mask, l);
+                    }
+                    return result;
+                }();
+
+            if (level < 1 || level > max_cache_level)
+            {
+                return 0;
+            }
+            return cache_sizes[level - 1];
+        }
+    }}    // namespace v2::detail
+}    // namespace hpx::parallel
@@ -0,0 +1,193 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/algorithm.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_for_loop_tiled_2d(ExPolicy&& policy)
+{
+    static_assert(hpx::is_execution_policy<ExPolicy>::value,
+        "hpx::is_execution_policy<ExPolicy>::value");
+
+    std::size_t const rows = 517;
+    std::size_t const cols = 1031;
+    std::vector<std::size_t> c(rows * cols, 0);
+
+    // leave a halo of one element untouched in each dimension
+    hpx::experimental::md_range<2> range(
+        {{1, 1}}, {{rows - 1, cols - 1}});
+    HPX_TEST_EQ(range.size(), (rows - 2) * (cols - 2));
+
+    hpx::experimental::for_loop(policy, range,
+        [&](std::size_t i, std::size_t j) { ++c[i * cols + j]; });
+
+    for (std::size_t i = 0; i != rows; ++i)
+    {
+        for (std::size_t j = 0; j != cols; ++j)
+        {
+            bool const inside =
+                i != 0 && i != rows - 1 && j != 0 && j != cols - 1;
+            HPX_TEST_EQ(c[i * cols + j], std::size_t(inside ? 1 : 0));
+        }
+    }
+
+    // explicit tile sizes, including tiles that do not divide the extents
+    hpx::experimental::tiling<2> t;
+    t.tile_sizes = {{17, 64}};
+
+    hpx::experimental::for_loop(std::forward<ExPolicy>(policy), range, t,
+        [&](std::size_t i, std::size_t j) { ++c[i * cols + j]; });
+
+    for (std::size_t i = 1; i != rows - 1; ++i)
+    {
+        for (std::size_t j = 1; j != cols - 1; ++j)
+        {
+            HPX_TEST_EQ(c[i * cols + j], std::size_t(2));
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_for_loop_tiled_3d(ExPolicy&& policy)
+{
+    std::size_t const n = 37;
+    std::vector<std::atomic<std::size_t>> c(n * n * n);
+    for (auto& v : c)
+    {
+        v = 0;
+    }
+
+    // mix explicit and automatically chosen tile sizes
+    hpx::experimental::tiling<3> t;
+    t.tile_sizes = {{0, 5, 0}};
+    t.bytes_per_point = 4 * sizeof(double);
+
+    hpx::experimental::for_loop(std::forward<ExPolicy>(policy),
+        hpx::experimental::md_range<3>({{0, 0, 0}}, {{n, n, n}}), t,
+        [&](std::size_t i, std::size_t j, std::size_t k) {
+            ++c[(i * n + j) * n + k];
+        });
+
+    for (auto const& v : c)
+    {
+        HPX_TEST_EQ(v.load(), std::size_t(1));
+    }
+}
+
+template <typename ExPolicy>
+void test_for_loop_tiled_async(ExPolicy&& policy)
+{
+    std::size_t const n = 1007;
+    std::vector<std::size_t> c(n, 0);
+
+    auto f = hpx::experimental::for_loop(std::forward<ExPolicy>(policy),
+        hpx::experimental::md_range<1>({{0}}, {{n}}),
+        [&](std::size_t i) { c[i] = i; });
+    f.get();
+
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        HPX_TEST_EQ(c[i], i);
+    }
+}
+
+void test_tile_sizes()
+{
+    using hpx::parallel::v2::detail::count_tiles;
+    using hpx::parallel::v2::detail::get_tile_sizes;
+
+    hpx::experimental::md_range<2> range({{0, 0}}, {{4096, 4096}});
+
+    // automatically chosen tiles are non-empty and don't exceed the extents
+    auto tiles = get_tile_sizes(range, hpx::experimental::tiling<2>{}, 1);
+    for (std::size_t d = 0; d != 2; ++d)
+    {
+        HPX_TEST_LT(std::size_t(0), tiles[d]);
+        HPX_TEST_LTE(tiles[d], range.extent(d));
+    }
+
+    // explicit tile sizes are used as given
+    hpx::experimental::tiling<2> t;
+    t.tile_sizes = {{32, 128}};
+    tiles = get_tile_sizes(range, t, 64);
+    HPX_TEST_EQ(tiles[0], std::size_t(32));
+    HPX_TEST_EQ(tiles[1], std::size_t(128));
+
+    // small index spaces are split such that all cores get work
+    hpx::experimental::md_range<2> small({{0, 0}}, {{16, 16}});
+    tiles = get_tile_sizes(small, hpx::experimental::tiling<2>{}, 8);
+    HPX_TEST_LTE(std::size_t(8), count_tiles(small, tiles));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    using namespace hpx::execution;
+
+    test_tile_sizes();
+
+    test_for_loop_tiled_2d(seq);
+    test_for_loop_tiled_2d(par);
+    test_for_loop_tiled_2d(par_unseq);
+
+    test_for_loop_tiled_3d(seq);
+    test_for_loop_tiled_3d(par);
+
+    // the chunking requested by the user replaces the default chunking
+    using hpx::execution::experimental::dynamic_chunk_size;
+    using hpx::execution::experimental::static_chunk_size;
+    using hpx::parallel::v2::detail::has_chunking_parameters;
+
+    auto const dynamic = par.with(dynamic_chunk_size(1));
+    auto const fixed = par.with(static_chunk_size(3));
+
+    HPX_TEST(!has_chunking_parameters(par, 4, 100));
+    HPX_TEST(!has_chunking_parameters(par.with(static_chunk_size()), 4, 100));
+    HPX_TEST(has_chunking_parameters(dynamic, 4, 100));
+    HPX_TEST(has_chunking_parameters(fixed, 4, 100));
+
+    test_for_loop_tiled_2d(dynamic);
+    test_for_loop_tiled_3d(fixed);
+
+    test_for_loop_tiled_async(seq(task));
+    test_for_loop_tiled_async(par(task));
+
+    // the overloads without execution policy run sequentially
+    std::size_t count = 0;
+    hpx::experimental::md_range<2> range({{0, 0}}, {{3, 5}});
+    hpx::experimental::for_loop(
+        range, [&](std::size_t, std::size_t) { ++count; });
+    HPX_TEST_EQ(count, std::size_t(15));
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
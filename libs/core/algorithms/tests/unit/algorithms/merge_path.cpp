@@ -0,0 +1,352 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The parallel merge, inplace_merge, and set operations split their inputs
+// using merge-path partitioning. The inputs used here consist of long runs of
+// equivalent elements which straddle the partition boundaries. All elements
+// carry their original position, the results have to be identical to the
+// ones produced by the (stable) standard algorithms.
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/detail/merge_path.hpp>
+#include <hpx/parallel/algorithms/merge.hpp>
+#include <hpx/parallel/algorithms/set_difference.hpp>
+#include <hpx/parallel/algorithms/set_intersection.hpp>
+#include <hpx/parallel/algorithms/set_union.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// larger than the threshold below which the algorithms run sequentially
+constexpr std::size_t size1 = 150000;
+constexpr std::size_t size2 = 130000;
+
+struct element
+{
+    std::size_t key = 0;
+    std::size_t origin = 0;
+
+    friend bool operator==(element const& lhs, element const& rhs)
+    {
+        return lhs.key == rhs.key && lhs.origin == rhs.origin;
+    }
+};
+
+// Elements of these types can't be moved without the risk of an exception,
+// inplace_merge can't use its buffered implementation for those.
+template <bool NothrowConstruct, bool NothrowAssign>
+struct throwing_move_element
+{
+    throwing_move_element() = default;
+
+    throwing_move_element(std::size_t key, std::size_t origin)
+      : key(key)
+      , origin(origin)
+    {
+    }
+
+    throwing_move_element(throwing_move_element const&) = default;
+    throwing_move_element(throwing_move_element&& rhs) noexcept(
+        NothrowConstruct)
+      : key(rhs.key)
+      , origin(rhs.origin)
+    {
+    }
+
+    throwing_move_element& operator=(throwing_move_element const&) = default;
+    throwing_move_element& operator=(throwing_move_element&& rhs) noexcept(
+        NothrowAssign)
+    {
+        key = rhs.key;
+        origin = rhs.origin;
+        return *this;
+    }
+
+    friend bool operator==(
+        throwing_move_element const& lhs, throwing_move_element const& rhs)
+    {
+        return lhs.key == rhs.key && lhs.origin == rhs.origin;
+    }
+
+    std::size_t key = 0;
+    std::size_t origin = 0;
+};
+
+using throwing_construct_element = throwing_move_element<false, true>;
+using throwing_assign_element = throwing_move_element<true, false>;
+
+struct compare_keys
+{
+    template <typename T>
+    bool operator()(T const& lhs, T const& rhs) const
+    {
+        return lhs.key < rhs.key;
+    }
+};
+
+// Create a sorted sequence whose keys are generated by the given function,
+// each element records its position (offset by origin).
+template <typename T, typename F>
+std::vector<T> make_sequence(std::size_t size, std::size_t origin, F&& key)
+{
+    std::vector<std::size_t> keys(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        keys[i] = key(i);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    std::vector<T> result;
+    result.reserve(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        result.push_back(T{keys[i], origin + i});
+    }
+    return result;
+}
+
+// The inputs used by all tests: a few very long runs, runs of a length
+// which doesn't evenly divide the partitions, and runs of random length.
+template <typename T>
+std::vector<std::pair<std::vector<T>, std::vector<T>>> make_inputs(
+    unsigned int seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<std::size_t> dis(0, 999);
+
+    std::vector<std::pair<std::vector<T>, std::vector<T>>> inputs;
+
+    inputs.emplace_back(
+        make_sequence<T>(size1, 0, [](std::size_t) { return 42; }),
+        make_sequence<T>(size2, size1, [](std::size_t) { return 42; }));
+    inputs.emplace_back(
+        make_sequence<T>(size1, 0, [](std::size_t i) { return i % 3; }),
+        make_sequence<T>(size2, size1, [](std::size_t i) { return i % 2; }));
+    inputs.emplace_back(
+        make_sequence<T>(size1, 0, [](std::size_t i) { return i / 10007; }),
+        make_sequence<T>(
+            size2, size1, [](std::size_t i) { return i / 7919 + 3; }));
+    inputs.emplace_back(make_sequence<T>(size1, 0, [&](std::size_t) {
+        return dis(gen);
+    }),
+        make_sequence<T>(size2, size1, [&](std::size_t) { return dis(gen); }));
+
+    return inputs;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the partitions found by merge_path_search are those of the stable merge
+void test_merge_path_search()
+{
+    using hpx::parallel::detail::merge_path_diagonal;
+    using hpx::parallel::detail::merge_path_search;
+    using hpx::parallel::util::projection_identity;
+
+    std::vector<std::size_t> const a = {1, 1, 1, 2, 2, 4, 4, 4, 4, 5};
+    std::vector<std::size_t> const b = {0, 1, 1, 2, 4, 4, 6, 6};
+
+    // the origin of all elements of the stable merge of both sequences
+    std::vector<bool> from_a;
+    std::size_t i = 0, j = 0;
+    while (i != a.size() || j != b.size())
+    {
+        bool const take_a = j == b.size() || (i != a.size() && !(b[j] < a[i]));
+        from_a.push_back(take_a);
+        if (take_a)
+            ++i;
+        else
+            ++j;
+    }
+
+    std::size_t const total = a.size() + b.size();
+    std::size_t expected = 0;
+    for (std::size_t diag = 0; diag <= total; ++diag)
+    {
+        HPX_TEST_EQ(merge_path_search(a.begin(), a.size(), b.begin(),
+                        b.size(), diag, std::less<>(), projection_identity(),
+                        projection_identity()),
+            expected);
+
+        if (diag != total && from_a[diag])
+        {
+            ++expected;
+        }
+    }
+
+    // the partitions cover the whole output and differ in size by one at most
+    for (std::size_t parts = 1; parts <= total + 1; ++parts)
+    {
+        HPX_TEST_EQ(merge_path_diagonal(total, 0, parts), std::size_t(0));
+        HPX_TEST_EQ(merge_path_diagonal(total, parts, parts), total);
+
+        for (std::size_t part = 0; part != parts; ++part)
+        {
+            std::size_t const size =
+                merge_path_diagonal(total, part + 1, parts) -
+                merge_path_diagonal(total, part, parts);
+            HPX_TEST(size == total / parts || size == total / parts + 1);
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void test_merge(unsigned int seed)
+{
+    for (auto const& input : make_inputs<T>(seed))
+    {
+        std::vector<T> const& a = input.first;
+        std::vector<T> const& b = input.second;
+
+        std::vector<T> result(a.size() + b.size());
+        std::vector<T> expected(a.size() + b.size());
+
+        auto const end = hpx::merge(hpx::execution::par, a.begin(), a.end(),
+            b.begin(), b.end(), result.begin(), compare_keys());
+        std::merge(a.begin(), a.end(), b.begin(), b.end(), expected.begin(),
+            compare_keys());
+
+        HPX_TEST(end == result.end());
+        HPX_TEST(result == expected);
+    }
+}
+
+// inplace_merge uses its buffered implementation for element types which
+// can be moved without throwing, and falls back to rotating the elements for
+// all other types
+template <typename T>
+void test_inplace_merge(unsigned int seed)
+{
+    for (auto const& input : make_inputs<T>(seed))
+    {
+        std::vector<T> result(input.first);
+        result.insert(result.end(), input.second.begin(), input.second.end());
+        std::vector<T> expected(result);
+
+        auto const middle = std::next(result.begin(), input.first.size());
+        hpx::inplace_merge(hpx::execution::par, result.begin(), middle,
+            result.end(), compare_keys());
+        std::inplace_merge(expected.begin(),
+            std::next(expected.begin(), input.first.size()), expected.end(),
+            compare_keys());
+
+        HPX_TEST(result == expected);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// equivalent elements are handled as a multiset: the set operations have to
+// account for the number of times a key appears in each of the sequences,
+// even if those elements are spread over several partitions
+void test_set_operations(unsigned int seed)
+{
+    for (auto const& input : make_inputs<element>(seed))
+    {
+        std::vector<element> const& a = input.first;
+        std::vector<element> const& b = input.second;
+
+        {
+            std::vector<element> result(a.size() + b.size());
+            std::vector<element> expected(a.size() + b.size());
+
+            auto const end = hpx::set_union(hpx::execution::par, a.begin(),
+                a.end(), b.begin(), b.end(), result.begin(), compare_keys());
+            auto const expected_end = std::set_union(a.begin(), a.end(),
+                b.begin(), b.end(), expected.begin(), compare_keys());
+
+            HPX_TEST_EQ(std::distance(result.begin(), end),
+                std::distance(expected.begin(), expected_end));
+            HPX_TEST(std::equal(result.begin(), end, expected.begin()));
+        }
+
+        {
+            std::vector<element> result(a.size());
+            std::vector<element> expected(a.size());
+
+            auto const end = hpx::set_intersection(hpx::execution::par,
+                a.begin(), a.end(), b.begin(), b.end(), result.begin(),
+                compare_keys());
+            auto const expected_end = std::set_intersection(a.begin(), a.end(),
+                b.begin(), b.end(), expected.begin(), compare_keys());
+
+            HPX_TEST_EQ(std::distance(result.begin(), end),
+                std::distance(expected.begin(), expected_end));
+            HPX_TEST(std::equal(result.begin(), end, expected.begin()));
+        }
+
+        {
+            std::vector<element> result(a.size());
+            std::vector<element> expected(a.size());
+
+            auto const end = hpx::set_difference(hpx::execution::par,
+                a.begin(), a.end(), b.begin(), b.end(), result.begin(),
+                compare_keys());
+            auto const expected_end = std::set_difference(a.begin(), a.end(),
+                b.begin(), b.end(), expected.begin(), compare_keys());
+
+            HPX_TEST_EQ(std::distance(result.begin(), end),
+                std::distance(expected.begin(), expected_end));
+            HPX_TEST(std::equal(result.begin(), end, expected.begin()));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    unsigned int seed = std::random_device{}();
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+
+    test_merge_path_search();
+
+    test_merge<element>(seed);
+    test_merge<throwing_construct_element>(seed);
+
+    test_inplace_merge<element>(seed);
+    test_inplace_merge<throwing_construct_element>(seed);
+    test_inplace_merge<throwing_assign_element>(seed);
+
+    test_set_operations(seed);
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
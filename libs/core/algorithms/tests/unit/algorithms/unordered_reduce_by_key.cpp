@@ -0,0 +1,228 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/unordered_reduce_by_key.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// large enough for the input to be partitioned when run in parallel
+constexpr std::size_t test_size = 100007;
+
+template <typename T>
+std::vector<T> make_input(std::size_t size, int max_value)
+{
+    std::uniform_int_distribution<int> dis(0, max_value);
+
+    std::vector<T> c(size);
+    std::generate(c.begin(), c.end(), [&]() { return T(dis(gen)); });
+    return c;
+}
+
+// combines the values in a way which depends on the order of application
+struct ordered_combine
+{
+    std::uint64_t operator()(std::uint64_t lhs, std::uint64_t rhs) const
+    {
+        return lhs * 31 + rhs;
+    }
+};
+
+template <typename Func>
+std::map<int, std::uint64_t> get_expected(std::vector<int> const& keys,
+    std::vector<std::uint64_t> const& values, Func func)
+{
+    std::map<int, std::uint64_t> expected;
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        auto it = expected.find(keys[i]);
+        if (it == expected.end())
+        {
+            expected.emplace(keys[i], values[i]);
+        }
+        else
+        {
+            it->second = func(it->second, values[i]);
+        }
+    }
+    return expected;
+}
+
+std::map<int, std::uint64_t> get_result(std::vector<int> const& keys,
+    std::vector<std::uint64_t> const& values, std::size_t count)
+{
+    std::map<int, std::uint64_t> result;
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        // every key has to be produced exactly once
+        HPX_TEST(result.emplace(keys[i], values[i]).second);
+    }
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_unordered_reduce_by_key()
+{
+    std::vector<int> keys = make_input<int>(test_size, 5000);
+    std::vector<std::uint64_t> values =
+        make_input<std::uint64_t>(test_size, 1000);
+
+    std::vector<int> keys_out(keys.size());
+    std::vector<std::uint64_t> values_out(values.size());
+
+    auto result = hpx::experimental::unordered_reduce_by_key(keys.begin(),
+        keys.end(), values.begin(), keys_out.begin(), values_out.begin());
+
+    HPX_TEST(result.out == values_out.begin() + (result.in - keys_out.begin()));
+    HPX_TEST(get_result(keys_out, values_out, result.in - keys_out.begin()) ==
+        get_expected(keys, values, std::plus<std::uint64_t>()));
+}
+
+template <typename ExPolicy>
+void test_unordered_reduce_by_key(ExPolicy&& policy)
+{
+    for (std::size_t size : {std::size_t(0), std::size_t(1), test_size})
+    {
+        std::vector<int> keys = make_input<int>(size, 5000);
+        std::vector<std::uint64_t> values =
+            make_input<std::uint64_t>(size, 1000);
+
+        std::vector<int> keys_out(keys.size());
+        std::vector<std::uint64_t> values_out(values.size());
+
+        // the values of each key have to be combined in input order
+        auto result = hpx::experimental::unordered_reduce_by_key(policy,
+            keys.begin(), keys.end(), values.begin(), keys_out.begin(),
+            values_out.begin(), std::hash<int>(), std::equal_to<>(),
+            ordered_combine());
+
+        std::size_t const count = result.in - keys_out.begin();
+        HPX_TEST(result.out == values_out.begin() + count);
+        HPX_TEST(get_result(keys_out, values_out, count) ==
+            get_expected(keys, values, ordered_combine()));
+    }
+}
+
+template <typename ExPolicy>
+void test_unordered_reduce_by_key_async(ExPolicy&& policy)
+{
+    std::vector<int> keys = make_input<int>(test_size, 5000);
+    std::vector<std::uint64_t> values =
+        make_input<std::uint64_t>(test_size, 1000);
+
+    std::vector<int> keys_out(keys.size());
+    std::vector<std::uint64_t> values_out(values.size());
+
+    auto f = hpx::experimental::unordered_reduce_by_key(policy, keys.begin(),
+        keys.end(), values.begin(), keys_out.begin(), values_out.begin());
+    auto result = f.get();
+
+    HPX_TEST(get_result(keys_out, values_out, result.in - keys_out.begin()) ==
+        get_expected(keys, values, std::plus<std::uint64_t>()));
+}
+
+template <typename ExPolicy>
+void test_unordered_reduce_by_key_exception(ExPolicy&& policy)
+{
+    std::vector<int> keys = make_input<int>(test_size, 5000);
+    std::vector<std::uint64_t> values =
+        make_input<std::uint64_t>(test_size, 1000);
+
+    std::vector<int> keys_out(keys.size());
+    std::vector<std::uint64_t> values_out(values.size());
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::experimental::unordered_reduce_by_key(policy, keys.begin(),
+            keys.end(), values.begin(), keys_out.begin(), values_out.begin(),
+            std::hash<int>(), std::equal_to<>(),
+            [](std::uint64_t, std::uint64_t) -> std::uint64_t {
+                throw std::runtime_error("test");
+                return 0;
+            });
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e)
+    {
+        caught_exception = true;
+        HPX_TEST(e.size() != 0);
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+    HPX_TEST(caught_exception);
+}
+
+void unordered_reduce_by_key_test()
+{
+    using namespace hpx::execution;
+
+    test_unordered_reduce_by_key();
+
+    test_unordered_reduce_by_key(seq);
+    test_unordered_reduce_by_key(par);
+    test_unordered_reduce_by_key(par_unseq);
+
+    test_unordered_reduce_by_key_async(seq(task));
+    test_unordered_reduce_by_key_async(par(task));
+
+    test_unordered_reduce_by_key_exception(seq);
+    test_unordered_reduce_by_key_exception(par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    unordered_reduce_by_key_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
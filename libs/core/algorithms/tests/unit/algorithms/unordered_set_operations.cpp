@@ -0,0 +1,226 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/unordered_set_operations.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// large enough for the input to be partitioned when run in parallel
+constexpr std::size_t test_size = 100007;
+
+std::vector<int> make_input(std::size_t size, int max_value)
+{
+    std::uniform_int_distribution<int> dis(0, max_value);
+
+    std::vector<int> c(size);
+    std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+    return c;
+}
+
+std::vector<int> sorted_unique(std::vector<int> c)
+{
+    std::sort(c.begin(), c.end());
+    c.erase(std::unique(c.begin(), c.end()), c.end());
+    return c;
+}
+
+struct expected_results
+{
+    std::vector<int> set_union;
+    std::vector<int> set_intersection;
+    std::vector<int> set_difference;
+};
+
+expected_results get_expected(
+    std::vector<int> const& c1, std::vector<int> const& c2)
+{
+    std::vector<int> const s1 = sorted_unique(c1);
+    std::vector<int> const s2 = sorted_unique(c2);
+
+    expected_results expected;
+    std::set_union(s1.begin(), s1.end(), s2.begin(), s2.end(),
+        std::back_inserter(expected.set_union));
+    std::set_intersection(s1.begin(), s1.end(), s2.begin(), s2.end(),
+        std::back_inserter(expected.set_intersection));
+    std::set_difference(s1.begin(), s1.end(), s2.begin(), s2.end(),
+        std::back_inserter(expected.set_difference));
+    return expected;
+}
+
+std::vector<int> sorted_result(
+    std::vector<int> d, std::vector<int>::iterator end)
+{
+    d.erase(end, d.end());
+    std::sort(d.begin(), d.end());
+    return d;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_unordered_set_operations()
+{
+    std::vector<int> c1 = make_input(test_size, 20000);
+    std::vector<int> c2 = make_input(test_size / 2, 20000);
+    std::vector<int> d(c1.size() + c2.size());
+
+    expected_results expected = get_expected(c1, c2);
+
+    auto result = hpx::experimental::unordered_set_union(
+        c1.begin(), c1.end(), c2.begin(), c2.end(), d.begin());
+    HPX_TEST(sorted_result(d, result) == expected.set_union);
+
+    result = hpx::experimental::unordered_set_intersection(
+        c1.begin(), c1.end(), c2.begin(), c2.end(), d.begin());
+    HPX_TEST(sorted_result(d, result) == expected.set_intersection);
+
+    result = hpx::experimental::unordered_set_difference(
+        c1.begin(), c1.end(), c2.begin(), c2.end(), d.begin());
+    HPX_TEST(sorted_result(d, result) == expected.set_difference);
+}
+
+template <typename ExPolicy>
+void test_unordered_set_operations(ExPolicy&& policy)
+{
+    for (std::size_t size : {std::size_t(0), std::size_t(1), test_size})
+    {
+        std::vector<int> c1 = make_input(size, 20000);
+        std::vector<int> c2 = make_input(size / 2, 20000);
+        std::vector<int> d(c1.size() + c2.size());
+
+        expected_results expected = get_expected(c1, c2);
+
+        auto result = hpx::experimental::unordered_set_union(
+            policy, c1.begin(), c1.end(), c2.begin(), c2.end(), d.begin());
+        HPX_TEST(sorted_result(d, result) == expected.set_union);
+
+        result = hpx::experimental::unordered_set_intersection(
+            policy, c1.begin(), c1.end(), c2.begin(), c2.end(), d.begin());
+        HPX_TEST(sorted_result(d, result) == expected.set_intersection);
+
+        result = hpx::experimental::unordered_set_difference(
+            policy, c1.begin(), c1.end(), c2.begin(), c2.end(), d.begin());
+        HPX_TEST(sorted_result(d, result) == expected.set_difference);
+    }
+}
+
+template <typename ExPolicy>
+void test_unordered_set_operations_async(ExPolicy&& policy)
+{
+    std::vector<int> c1 = make_input(test_size, 20000);
+    std::vector<int> c2 = make_input(test_size / 2, 20000);
+    std::vector<int> d(c1.size() + c2.size());
+
+    expected_results expected = get_expected(c1, c2);
+
+    auto f = hpx::experimental::unordered_set_union(
+        policy, c1.begin(), c1.end(), c2.begin(), c2.end(), d.begin());
+    HPX_TEST(sorted_result(d, f.get()) == expected.set_union);
+
+    f = hpx::experimental::unordered_set_intersection(
+        policy, c1.begin(), c1.end(), c2.begin(), c2.end(), d.begin());
+    HPX_TEST(sorted_result(d, f.get()) == expected.set_intersection);
+
+    f = hpx::experimental::unordered_set_difference(
+        policy, c1.begin(), c1.end(), c2.begin(), c2.end(), d.begin());
+    HPX_TEST(sorted_result(d, f.get()) == expected.set_difference);
+}
+
+template <typename ExPolicy>
+void test_unordered_set_operations_exception(ExPolicy&& policy)
+{
+    std::vector<int> c1 = make_input(test_size, 20000);
+    std::vector<int> c2 = make_input(test_size / 2, 20000);
+    std::vector<int> d(c1.size() + c2.size());
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::experimental::unordered_set_intersection(policy, c1.begin(),
+            c1.end(), c2.begin(), c2.end(), d.begin(),
+            [](int) -> std::size_t {
+                throw std::runtime_error("test");
+                return 0;
+            });
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e)
+    {
+        caught_exception = true;
+        HPX_TEST(e.size() != 0);
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+    HPX_TEST(caught_exception);
+}
+
+void unordered_set_operations_test()
+{
+    using namespace hpx::execution;
+
+    test_unordered_set_operations();
+
+    test_unordered_set_operations(seq);
+    test_unordered_set_operations(par);
+    test_unordered_set_operations(par_unseq);
+
+    test_unordered_set_operations_async(seq(task));
+    test_unordered_set_operations_async(par(task));
+
+    test_unordered_set_operations_exception(seq);
+    test_unordered_set_operations_exception(par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    unordered_set_operations_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,231 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parallel/algorithms/unordered_unique.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+// large enough for the input to be partitioned when run in parallel
+constexpr std::size_t test_size = 100007;
+
+std::vector<int> make_input(std::size_t size, int max_value)
+{
+    std::uniform_int_distribution<int> dis(0, max_value);
+
+    std::vector<int> c(size);
+    std::generate(c.begin(), c.end(), [&]() { return dis(gen); });
+    return c;
+}
+
+std::vector<int> sorted_unique(std::vector<int> c)
+{
+    std::sort(c.begin(), c.end());
+    c.erase(std::unique(c.begin(), c.end()), c.end());
+    return c;
+}
+
+// elements are equivalent if they have the same remainder modulo 1000
+struct mod_hash
+{
+    std::size_t operator()(int x) const
+    {
+        return std::hash<int>()(x % 1000);
+    }
+};
+
+struct mod_equal
+{
+    bool operator()(int lhs, int rhs) const
+    {
+        return lhs % 1000 == rhs % 1000;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_unordered_unique_copy()
+{
+    for (std::size_t size : {std::size_t(0), std::size_t(1), test_size})
+    {
+        std::vector<int> c = make_input(size, 5000);
+        std::vector<int> d(c.size());
+
+        auto result = hpx::experimental::unordered_unique_copy(
+            c.begin(), c.end(), d.begin());
+        d.erase(result, d.end());
+
+        // the sequential version keeps the order of the first occurrences
+        std::vector<int> expected;
+        std::unordered_set<int> seen;
+        for (int x : c)
+        {
+            if (seen.insert(x).second)
+            {
+                expected.push_back(x);
+            }
+        }
+        HPX_TEST(d == expected);
+    }
+}
+
+template <typename ExPolicy>
+void test_unordered_unique_copy(ExPolicy&& policy)
+{
+    for (std::size_t size : {std::size_t(0), std::size_t(1), test_size})
+    {
+        std::vector<int> c = make_input(size, 5000);
+        std::vector<int> d(c.size());
+
+        auto result = hpx::experimental::unordered_unique_copy(
+            policy, c.begin(), c.end(), d.begin());
+        d.erase(result, d.end());
+
+        std::sort(d.begin(), d.end());
+        HPX_TEST(d == sorted_unique(c));
+    }
+}
+
+template <typename ExPolicy>
+void test_unordered_unique_copy_async(ExPolicy&& policy)
+{
+    std::vector<int> c = make_input(test_size, 5000);
+    std::vector<int> d(c.size());
+
+    auto f = hpx::experimental::unordered_unique_copy(
+        policy, c.begin(), c.end(), d.begin());
+    d.erase(f.get(), d.end());
+
+    std::sort(d.begin(), d.end());
+    HPX_TEST(d == sorted_unique(c));
+}
+
+template <typename ExPolicy>
+void test_unordered_unique_copy_pred(ExPolicy&& policy)
+{
+    std::vector<int> c = make_input(test_size, 100000);
+    std::vector<int> d(c.size());
+
+    auto result = hpx::experimental::unordered_unique_copy(
+        policy, c.begin(), c.end(), d.begin(), mod_hash(), mod_equal());
+    d.erase(result, d.end());
+
+    // exactly one element per remainder, and it's the first one of those
+    std::vector<int> first(1000, -1);
+    for (int x : c)
+    {
+        if (first[x % 1000] == -1)
+        {
+            first[x % 1000] = x;
+        }
+    }
+
+    std::vector<int> expected;
+    std::copy_if(first.begin(), first.end(), std::back_inserter(expected),
+        [](int x) { return x != -1; });
+
+    std::sort(d.begin(), d.end());
+    std::sort(expected.begin(), expected.end());
+    HPX_TEST(d == expected);
+}
+
+template <typename ExPolicy>
+void test_unordered_unique_copy_exception(ExPolicy&& policy)
+{
+    std::vector<int> c = make_input(test_size, 5000);
+    std::vector<int> d(c.size());
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::experimental::unordered_unique_copy(policy, c.begin(), c.end(),
+            d.begin(), [](int) -> std::size_t {
+                throw std::runtime_error("test");
+                return 0;
+            });
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e)
+    {
+        caught_exception = true;
+        HPX_TEST(e.size() != 0);
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+    HPX_TEST(caught_exception);
+}
+
+void unordered_unique_copy_test()
+{
+    using namespace hpx::execution;
+
+    test_unordered_unique_copy();
+
+    test_unordered_unique_copy(seq);
+    test_unordered_unique_copy(par);
+    test_unordered_unique_copy(par_unseq);
+
+    test_unordered_unique_copy_async(seq(task));
+    test_unordered_unique_copy_async(par(task));
+
+    test_unordered_unique_copy_pred(seq);
+    test_unordered_unique_copy_pred(par);
+
+    test_unordered_unique_copy_exception(seq);
+    test_unordered_unique_copy_exception(par);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    unordered_unique_copy_test();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run");
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -612,6 +612,11 @@ namespace hpx::local::detail {
         // handle high-priority threads
         handle_high_priority_threads(vm, ini_config);
 
+        if (vm.count("hpx:print-startup-times"))
+        {
+            ini_config.emplace_back("hpx.print_startup_times=1");
+        }
+
         enable_logging_settings(vm, ini_config);
 
         if (debug_clp)
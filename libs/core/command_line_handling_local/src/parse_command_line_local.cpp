@@ -503,8 +503,9 @@ namespace hpx { namespace local { namespace detail {
             ("hpx:queuing", value<std::string>(),
                 "the queue scheduling policy to use, options are "
                 "'local', 'local-priority-fifo','local-priority-lifo', "
-                "'abp-priority-fifo', 'abp-priority-lifo', 'static', and "
-                "'static-priority' (default: 'local-priority'; "
+                "'abp-priority-fifo', 'abp-priority-lifo', 'static', "
+                "'static-priority', 'shared-priority', and 'deadline' "
+                "(default: 'local-priority'; "
                 "all option values can be abbreviated)")
             ("hpx:high-priority-threads", value<std::size_t>(),
                 "the number of operating system threads maintaining a high "
@@ -536,6 +537,9 @@ namespace hpx { namespace local { namespace detail {
         all_options[options_type::debugging_options].add_options()
             ("hpx:dump-config-initial", "print the initial runtime configuration")
             ("hpx:dump-config", "print the final runtime configuration")
+            ("hpx:print-startup-times",
+                "print the time spent in the phases of the runtime startup "
+                "before hpx_main is invoked")
             // enable debug output from command line handling
             ("hpx:debug-clp", "debug command line processing")
 #if defined(_POSIX_VERSION) || defined(HPX_WINDOWS)
@@ -14,6 +14,7 @@
 
 #include <hpx/allocator_support/detail/new.hpp>
 #include <hpx/compute_local/host/block_executor.hpp>
+#include <hpx/compute_local/host/huge_pages.hpp>
 #include <hpx/compute_local/host/target.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/execution/executors/static_chunk_size.hpp>
@@ -62,13 +63,17 @@ namespace hpx { namespace compute { namespace host {
                 using other = policy_allocator<U, policy_type>;
             };
 
-            policy_allocator(Policy&& policy)
+            policy_allocator(
+                Policy&& policy, huge_pages pages = huge_pages::none)
               : policy_(HPX_MOVE(policy))
+              , pages_(pages)
             {
             }
 
-            policy_allocator(Policy const& policy)
+            policy_allocator(
+                Policy const& policy, huge_pages pages = huge_pages::none)
               : policy_(policy)
+              , pages_(pages)
             {
             }
 
@@ -77,6 +82,12 @@ namespace hpx { namespace compute { namespace host {
                 return policy_;
             }
 
+            // The kind of pages backing the allocated memory
+            huge_pages pages() const noexcept
+            {
+                return pages_;
+            }
+
             // Returns the actual address of x even in presence of overloaded
             // operator&
             pointer address(reference x) const noexcept
@@ -90,13 +101,15 @@ namespace hpx { namespace compute { namespace host {
             }
 
             // Allocates n * sizeof(T) bytes of uninitialized storage by calling
-            // topo.allocate(). The pointer hint may be used to provide locality of
-            // reference: the allocator, if supported by the implementation, will
-            // attempt to allocate the new memory block as close as possible to hint.
+            // topo.allocate() (or by mapping huge pages, if requested). The
+            // memory is not touched, its pages are placed by bulk_construct.
+            // The pointer hint may be used to provide locality of reference:
+            // the allocator, if supported by the implementation, will attempt
+            // to allocate the new memory block as close as possible to hint.
             pointer allocate(size_type n, void const* /* hint */ = nullptr)
             {
                 return reinterpret_cast<pointer>(
-                    hpx::threads::create_topology().allocate(n * sizeof(T)));
+                    allocate_pages(n * sizeof(T), pages_));
             }
 
             // Deallocates the storage referenced by the pointer p, which must be a
@@ -105,14 +118,7 @@ namespace hpx { namespace compute { namespace host {
             // originally produced p; otherwise, the behavior is undefined.
             void deallocate(pointer p, size_type n) noexcept
             {
-                try
-                {
-                    hpx::threads::create_topology().deallocate(p, n);
-                }
-                catch (...)
-                {
-                    ;    // just ignore errors from create_topology
-                }
+                deallocate_pages(p, n * sizeof(T), pages_);
             }
 
             // Returns the maximum theoretically possible value of n, for which the
@@ -236,6 +242,7 @@ namespace hpx { namespace compute { namespace host {
         private:
             target_type target_;
             policy_type policy_;
+            huge_pages pages_;
         };
     }    // namespace detail
 
@@ -252,6 +259,12 @@ namespace hpx { namespace compute { namespace host {
     /// std::size_t N = 2048;
     /// vector_type v(N, allocator_type(numa_nodes));
     ///
+    /// Large buffers can additionally be backed by huge pages, the pages are
+    /// still placed by the thread touching them first:
+    ///
+    /// using hpx::compute::host::huge_pages;
+    /// vector_type v(N, allocator_type(numa_nodes, huge_pages::transparent));
+    ///
     template <typename T,
         typename Executor =
             hpx::parallel::execution::restricted_thread_pool_executor>
@@ -276,15 +289,19 @@ namespace hpx { namespace compute { namespace host {
         {
         }
 
-        block_allocator(target_type const& targets)
+        block_allocator(
+            target_type const& targets, huge_pages pages = huge_pages::none)
           : base_type(
-                policy_type(executor_type(targets), executor_parameters_type()))
+                policy_type(executor_type(targets), executor_parameters_type()),
+                pages)
         {
         }
 
-        block_allocator(target_type&& targets)
-          : base_type(policy_type(
-                executor_type(HPX_MOVE(targets)), executor_parameters_type()))
+        block_allocator(
+            target_type&& targets, huge_pages pages = huge_pages::none)
+          : base_type(policy_type(executor_type(HPX_MOVE(targets)),
+                          executor_parameters_type()),
+                pages)
         {
         }
 
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/assert.hpp>
 #include <hpx/compute_local/host/numa_domains.hpp>
 #include <hpx/compute_local/host/target.hpp>
 #include <hpx/concepts/concepts.hpp>
@@ -18,12 +19,15 @@
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/execution_base/traits/is_executor.hpp>
 #include <hpx/executors/fork_join_executor.hpp>
+#include <hpx/functional/invoke.hpp>
 #include <hpx/iterator_support/counting_shape.hpp>
 #include <hpx/iterator_support/iterator_range.hpp>
+#include <hpx/iterator_support/range.hpp>
 #include <hpx/modules/concepts.hpp>
 #include <hpx/modules/topology.hpp>
 #include <hpx/resource_partitioner/detail/partitioner.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <exception>
@@ -54,6 +58,12 @@ namespace hpx::execution::experimental {
     /// This behaviour is similar to the plain \a fork_join_executor except that
     /// the block_fork_join_executor creates a hierarchy of fork_join_executors,
     /// one for each target used to initialize it.
+    ///
+    /// Parallel regions (see \a block_fork_join_executor::parallel_region)
+    /// are executed hierarchically as well: the loops executed inside a region
+    /// assign one contiguous block of the iteration space to each target, and
+    /// barriers and reductions synchronize the threads of each target first
+    /// before the targets synchronize with each other.
     class block_fork_join_executor
     {
         static hpx::threads::mask_type cores_for_targets(
@@ -207,6 +217,228 @@ namespace hpx::execution::experimental {
                 hpx::parallel::execution::bulk_sync_execute(
                     exec_, init_f, hpx::util::counting_shape(targets.size()));
             }
+
+            // the global index of the first thread of each target
+            thread_offsets_.push_back(0);
+            if (block_execs_.empty())
+            {
+                thread_offsets_.push_back(hpx::threads::count(
+                    hpx::execution::experimental::get_processing_units_mask(
+                        exec_)));
+            }
+            else
+            {
+                for (auto const& exec : block_execs_)
+                {
+                    thread_offsets_.push_back(thread_offsets_.back() +
+                        hpx::threads::count(hpx::execution::experimental::
+                                get_processing_units_mask(exec)));
+                }
+            }
+        }
+
+        /// \brief The context of one worker thread participating in a
+        ///        parallel region started by \a parallel_region.
+        ///
+        /// This provides the same operations as
+        /// \a fork_join_executor::region_context, spanning the worker threads
+        /// of all targets of the executor.
+        class region_context
+        {
+        public:
+            HPX_NON_COPYABLE(region_context);
+
+            /// Returns the index of the calling worker thread, this is a
+            /// number in [0, num_threads()). The threads of each target are
+            /// numbered consecutively.
+            std::size_t thread_index() const noexcept
+            {
+                return thread_offset_ + inner_.thread_index();
+            }
+
+            /// Returns the number of worker threads executing the region.
+            std::size_t num_threads() const noexcept
+            {
+                return num_threads_;
+            }
+
+            /// Returns the index of the target the calling thread belongs to.
+            std::size_t target_index() const noexcept
+            {
+                return target_;
+            }
+
+            std::size_t num_targets() const noexcept
+            {
+                return num_targets_;
+            }
+
+            /// Blocks the calling worker thread until all worker threads of
+            /// the region have called barrier.
+            void barrier()
+            {
+                inner_.barrier();
+                if (num_targets_ != 1)
+                {
+                    if (outer_ != nullptr)
+                    {
+                        outer_->barrier();
+                    }
+                    inner_.barrier();
+                }
+            }
+
+            /// Invokes \a f for the part of \a shape that belongs to the
+            /// calling worker thread without waiting for the other threads.
+            /// The shape is split into one contiguous block per target, each
+            /// of which is split between the threads of that target.
+            template <typename F, typename S, typename... Ts>
+            void bulk_execute_nowait(F&& f, S const& shape, Ts&&... ts)
+            {
+                if (num_targets_ == 1)
+                {
+                    inner_.bulk_execute_nowait(HPX_FORWARD(F, f), shape, ts...);
+                    return;
+                }
+
+                std::size_t const size = hpx::util::size(shape);
+                auto const part_begin = (target_ * size) / num_targets_;
+                auto const part_end = ((target_ + 1) * size) / num_targets_;
+
+                auto begin = std::next(hpx::util::begin(shape), part_begin);
+                auto inner_shape = hpx::util::iterator_range(
+                    begin, std::next(begin, part_end - part_begin));
+
+                inner_.bulk_execute_nowait(
+                    HPX_FORWARD(F, f), inner_shape, ts...);
+            }
+
+            /// Invokes \a f for the part of \a shape that belongs to the
+            /// calling worker thread (see \a bulk_execute_nowait) and waits
+            /// for all worker threads to finish their parts.
+            template <typename F, typename S, typename... Ts>
+            void bulk_sync_execute(F&& f, S const& shape, Ts&&... ts)
+            {
+                bulk_execute_nowait(HPX_FORWARD(F, f), shape, ts...);
+                barrier();
+            }
+
+            /// Combines the values passed by all worker threads using the
+            /// binary operation \a op and returns the result on all of them.
+            /// The values of each target are combined first, followed by the
+            /// partial results of the targets.
+            template <typename T, typename Op>
+            T reduce(T value, Op&& op)
+            {
+                T result = inner_.reduce(HPX_MOVE(value), op);
+                if (num_targets_ == 1)
+                {
+                    return result;
+                }
+
+                if (outer_ != nullptr)
+                {
+                    result = outer_->reduce(HPX_MOVE(result), op);
+                }
+                return inner_.broadcast(
+                    HPX_MOVE(result), inner_.main_thread_index());
+            }
+
+            /// Returns the value passed by the worker thread \a root on all
+            /// worker threads. The value is passed to the thread that has
+            /// entered the region of each target first, which passes it on
+            /// to the other threads of its target.
+            template <typename T>
+            T broadcast(T value, std::size_t root)
+            {
+                HPX_ASSERT(root < num_threads_);
+                if (num_targets_ == 1)
+                {
+                    return inner_.broadcast(HPX_MOVE(value), root);
+                }
+
+                std::size_t const root_target = static_cast<std::size_t>(
+                    std::upper_bound(thread_offsets_.begin(),
+                        thread_offsets_.end(), root) -
+                    thread_offsets_.begin() - 1);
+
+                if (target_ == root_target)
+                {
+                    value = inner_.broadcast(
+                        HPX_MOVE(value), root - thread_offsets_[root_target]);
+                }
+
+                if (outer_ != nullptr)
+                {
+                    value = outer_->broadcast(HPX_MOVE(value), root_target);
+                }
+                return inner_.broadcast(
+                    HPX_MOVE(value), inner_.main_thread_index());
+            }
+
+        private:
+            friend class block_fork_join_executor;
+
+            region_context(fork_join_executor::region_context* outer,
+                fork_join_executor::region_context& inner, std::size_t target,
+                std::size_t num_targets,
+                std::vector<std::size_t> const& thread_offsets) noexcept
+              : outer_(outer)
+              , inner_(inner)
+              , target_(target)
+              , num_targets_(num_targets)
+              , thread_offset_(thread_offsets[target])
+              , num_threads_(thread_offsets.back())
+              , thread_offsets_(thread_offsets)
+            {
+            }
+
+            // the context of the region spanning the targets, this is valid
+            // only on the thread that has entered the region of its target
+            fork_join_executor::region_context* outer_;
+            fork_join_executor::region_context& inner_;
+            std::size_t const target_;
+            std::size_t const num_targets_;
+            std::size_t const thread_offset_;
+            std::size_t const num_threads_;
+
+            // the global index of the first thread of each target
+            std::vector<std::size_t> const& thread_offsets_;
+        };
+
+        /// \brief Execute a parallel region on all worker threads of this
+        ///        executor.
+        ///
+        /// Invokes \a f(ctx, ts...) once on each of the worker threads of all
+        /// targets, where \a ctx is the \a region_context of that thread (see
+        /// \a fork_join_executor::parallel_region).
+        template <typename F, typename... Ts>
+        void parallel_region(F&& f, Ts&&... ts) const
+        {
+            std::size_t const num_targets = block_execs_.size();
+            if (num_targets == 0)
+            {
+                exec_.parallel_region(
+                    [&](fork_join_executor::region_context& inner) {
+                        region_context ctx(
+                            nullptr, inner, 0, 1, thread_offsets_);
+                        HPX_INVOKE(f, ctx, ts...);
+                    });
+                return;
+            }
+
+            exec_.parallel_region(
+                [&](fork_join_executor::region_context& outer) {
+                    std::size_t const target = outer.thread_index();
+                    block_execs_[target].parallel_region(
+                        [&](fork_join_executor::region_context& inner) {
+                            region_context ctx(
+                                inner.is_main_thread() ? &outer : nullptr,
+                                inner, target, num_targets,
+                                thread_offsets_);
+                            HPX_INVOKE(f, ctx, ts...);
+                        });
+                });
         }
 
         template <typename F, typename S, typename... Ts>
@@ -305,6 +537,7 @@ namespace hpx::execution::experimental {
     private:
         fork_join_executor exec_;
         std::vector<fork_join_executor> block_execs_;
+        std::vector<std::size_t> thread_offsets_;
     };
 }    // namespace hpx::execution::experimental
 
@@ -0,0 +1,44 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+
+namespace hpx { namespace compute { namespace host {
+
+    /// Selects the kind of pages used for the memory allocated by the host
+    /// allocators (see \a block_allocator).
+    enum class huge_pages
+    {
+        /// use the default pages of the system
+        none = 0,
+
+        /// ask the system to back the memory with transparent huge pages
+        /// (THP), this is a hint only
+        transparent = 1,
+
+        /// allocate the memory from the pool of explicitly reserved huge
+        /// pages (hugetlbfs), falls back to transparent huge pages if no
+        /// huge pages are available
+        hugetlb = 2
+    };
+
+    namespace detail {
+        /// Allocate \a bytes bytes of page-aligned memory without touching
+        /// it, the physical pages are placed on first touch.
+        HPX_CORE_EXPORT void* allocate_pages(std::size_t bytes, huge_pages hp);
+
+        /// Free memory allocated by \a allocate_pages using the same
+        /// arguments.
+        HPX_CORE_EXPORT void deallocate_pages(
+            void* p, std::size_t bytes, huge_pages hp) noexcept;
+    }    // namespace detail
+}}}    // namespace hpx::compute::host
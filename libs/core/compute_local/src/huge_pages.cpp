@@ -0,0 +1,109 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+///////////////////////////////////////////////////////////////////////////////
+
+#include <hpx/config.hpp>
+#include <hpx/compute_local/host/huge_pages.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <cstddef>
+#include <new>
+
+#if defined(__linux) || defined(linux) || defined(__linux__)
+#include <sys/mman.h>
+#define HPX_COMPUTE_HOST_HAVE_MMAP
+#endif
+
+namespace hpx { namespace compute { namespace host { namespace detail {
+
+#if defined(HPX_COMPUTE_HOST_HAVE_MMAP)
+    // All memory backed by huge pages is mapped in multiples of this size,
+    // this keeps the mapping aligned for THP and valid for hugetlbfs
+    constexpr std::size_t huge_page_size = std::size_t(2) * 1024 * 1024;
+
+    constexpr std::size_t round_to_huge_page(std::size_t bytes) noexcept
+    {
+        return (bytes + huge_page_size - 1) & ~(huge_page_size - 1);
+    }
+
+    void* allocate_pages(std::size_t bytes, huge_pages hp)
+    {
+        if (hp == huge_pages::none)
+        {
+            return hpx::threads::create_topology().allocate(bytes);
+        }
+
+        std::size_t const len = round_to_huge_page(bytes);
+        void* p = MAP_FAILED;
+
+#if defined(MAP_HUGETLB)
+        if (hp == huge_pages::hugetlb)
+        {
+            int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#if defined(MAP_HUGE_2MB)
+            flags |= MAP_HUGE_2MB;
+#endif
+            p = mmap(nullptr, len, PROT_READ | PROT_WRITE, flags, -1, 0);
+        }
+#endif
+
+        if (p == MAP_FAILED)
+        {
+            // no (reserved) huge pages available, rely on THP instead
+            p = mmap(nullptr, len, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (p == MAP_FAILED)
+            {
+                throw std::bad_alloc();
+            }
+
+#if defined(MADV_HUGEPAGE)
+            // this is a hint only, ignore errors (THP might be disabled)
+            madvise(p, len, MADV_HUGEPAGE);
+#endif
+        }
+        return p;
+    }
+
+    void deallocate_pages(void* p, std::size_t bytes, huge_pages hp) noexcept
+    {
+        if (hp == huge_pages::none)
+        {
+            try
+            {
+                hpx::threads::create_topology().deallocate(p, bytes);
+            }
+            catch (...)
+            {
+                ;    // just ignore errors from create_topology
+            }
+            return;
+        }
+
+        munmap(p, round_to_huge_page(bytes));
+    }
+#else
+    // huge pages are supported on Linux only, use the default pages
+    // everywhere else
+    void* allocate_pages(std::size_t bytes, huge_pages)
+    {
+        return hpx::threads::create_topology().allocate(bytes);
+    }
+
+    void deallocate_pages(void* p, std::size_t bytes, huge_pages) noexcept
+    {
+        try
+        {
+            hpx::threads::create_topology().deallocate(p, bytes);
+        }
+        catch (...)
+        {
+            ;    // just ignore errors from create_topology
+        }
+    }
+#endif
+}}}}    // namespace hpx::compute::host::detail
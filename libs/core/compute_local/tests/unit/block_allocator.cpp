@@ -55,6 +55,24 @@ void test_bulk_allocator(std::size_t count)
     test_block_deallocation(alloc, p, count);
 }
 
+// large buffers backed by huge pages are first touched by the targets
+void test_huge_pages(hpx::compute::host::huge_pages pages, std::size_t count)
+{
+    using allocator_type = hpx::compute::host::block_allocator<int>;
+    using vector_type = hpx::compute::vector<int, allocator_type>;
+
+    allocator_type alloc(hpx::compute::host::numa_domains(), pages);
+    HPX_TEST(alloc.pages() == pages);
+
+    vector_type v(count, 42, alloc);
+    HPX_TEST_EQ(v.size(), count);
+
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(v[i], 42);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 std::atomic<std::size_t> construction_count(0);
 std::atomic<std::size_t> destruction_count(0);
@@ -96,6 +114,17 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     test_bulk_allocator<int>(0);
 
+    {
+        // span a couple of (huge) pages, the size is not a multiple of the
+        // page size
+        std::size_t count = 3 * 1024 * 1024 + dis(gen);
+
+        using hpx::compute::host::huge_pages;
+        test_huge_pages(huge_pages::none, count);
+        test_huge_pages(huge_pages::transparent, count);
+        test_huge_pages(huge_pages::hugetlb, count);
+    }
+
     return hpx::finalize();
 }
 
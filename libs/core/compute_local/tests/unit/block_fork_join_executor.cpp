@@ -17,6 +17,7 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <numeric>
@@ -153,6 +154,59 @@ void test_bulk_async_exception(ExecutorArgs&&... args)
     HPX_TEST(caught_exception);
 }
 
+template <typename... ExecutorArgs>
+void test_parallel_region(ExecutorArgs&&... args)
+{
+    std::cerr << "test_parallel_region\n";
+
+    std::size_t const n = 107;
+    std::size_t const steps = 100;
+    std::vector<std::size_t> v(n, 0);
+
+    block_fork_join_executor exec{std::forward<ExecutorArgs>(args)...};
+
+    std::atomic<std::size_t> entered(0);
+    std::atomic<std::size_t> num_threads(0);
+    exec.parallel_region(
+        [&](block_fork_join_executor::region_context& ctx) {
+            ++entered;
+            num_threads = ctx.num_threads();
+            HPX_TEST_LT(ctx.thread_index(), ctx.num_threads());
+            HPX_TEST_LT(ctx.target_index(), ctx.num_targets());
+
+            for (std::size_t step = 0; step != steps; ++step)
+            {
+                ctx.bulk_sync_execute([&](std::size_t i) { ++v[i]; },
+                    hpx::util::counting_shape(n));
+
+                std::size_t const sum =
+                    ctx.reduce(std::size_t(1), std::plus<std::size_t>());
+                HPX_TEST_EQ(sum, ctx.num_threads());
+            }
+
+            // the values are combined in the order of the thread indices
+            std::string expected;
+            for (std::size_t t = 0; t != ctx.num_threads(); ++t)
+            {
+                expected += std::to_string(t) + ",";
+            }
+            HPX_TEST_EQ(ctx.reduce(std::to_string(ctx.thread_index()) + ",",
+                            std::plus<std::string>()),
+                expected);
+
+            for (std::size_t root = 0; root != ctx.num_threads(); ++root)
+            {
+                HPX_TEST_EQ(ctx.broadcast(ctx.thread_index(), root), root);
+            }
+        });
+
+    HPX_TEST_EQ(entered.load(), num_threads.load());
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        HPX_TEST_EQ(v[i], steps);
+    }
+}
+
 template <typename... ExecutorArgs>
 void test_executor(hpx::threads::thread_priority priority,
     hpx::threads::thread_stacksize stacksize,
@@ -165,6 +219,7 @@ void test_executor(hpx::threads::thread_priority priority,
     test_bulk_async(priority, stacksize, schedule);
     test_bulk_sync_exception(priority, stacksize, schedule);
     test_bulk_async_exception(priority, stacksize, schedule);
+    test_parallel_region(priority, stacksize, schedule);
 }
 
 ///////////////////////////////////////////////////////////////////////////////
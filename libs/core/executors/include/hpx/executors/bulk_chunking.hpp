@@ -0,0 +1,222 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/executors/bulk_chunking.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_base/scheduling_properties.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/traits/is_executor_parameters.hpp>
+#include <hpx/executors/sequenced_executor.hpp>
+#include <hpx/functional/detail/tag_fallback_invoke.hpp>
+#include <hpx/functional/function_ref.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::execution::experimental {
+
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        // Type-erased executor parameters object used by the bulk algorithm
+        // of the thread_pool_scheduler. The measured iteration time is
+        // shared by all copies of a scheduler.
+        struct bulk_chunking_base
+        {
+            virtual ~bulk_chunking_base() = default;
+
+            virtual bool has_variable_chunk_size() const noexcept = 0;
+            virtual bool invokes_testing_function() const noexcept = 0;
+
+            virtual std::size_t get_chunk_size(
+                hpx::chrono::steady_duration const& iteration_duration,
+                std::size_t cores, std::size_t count) = 0;
+
+            virtual hpx::chrono::steady_duration measure_iteration(
+                hpx::function_ref<std::size_t(std::size_t)> f,
+                std::size_t count) = 0;
+
+            // Return the time one iteration takes, the first caller measures
+            // it using the given function, all later callers reuse the
+            // measured value (a zero duration while the measurement is in
+            // progress).
+            hpx::chrono::steady_duration get_iteration_duration(
+                hpx::function_ref<std::size_t(std::size_t)> f,
+                std::size_t count)
+            {
+                if (!invokes_testing_function() ||
+                    measured.exchange(true, std::memory_order_relaxed))
+                {
+                    return std::chrono::nanoseconds(
+                        iteration_duration.load(std::memory_order_acquire));
+                }
+
+                bool invoked = false;
+                auto const ns =
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        measure_iteration(
+                            [&](std::size_t n) {
+                                invoked = true;
+                                return f(n);
+                            },
+                            count)
+                            .value());
+                if (!invoked)
+                {
+                    // nothing was measured (e.g. too few iterations), try
+                    // again next time
+                    measured.store(false, std::memory_order_relaxed);
+                    return ns;
+                }
+
+                iteration_duration.store(
+                    static_cast<std::uint64_t>(ns.count()),
+                    std::memory_order_release);
+                return ns;
+            }
+
+            std::atomic<bool> measured{false};
+            std::atomic<std::uint64_t> iteration_duration{0};
+        };
+
+        template <typename Parameters>
+        struct bulk_chunking_impl final : bulk_chunking_base
+        {
+            template <typename Params>
+            explicit bulk_chunking_impl(Params&& params)
+              : params(HPX_FORWARD(Params, params))
+            {
+            }
+
+            bool has_variable_chunk_size() const noexcept override
+            {
+                return hpx::parallel::execution::
+                    extract_has_variable_chunk_size_v<Parameters>;
+            }
+
+            bool invokes_testing_function() const noexcept override
+            {
+                return hpx::parallel::execution::
+                    extract_invokes_testing_function_v<Parameters>;
+            }
+
+            std::size_t get_chunk_size(
+                hpx::chrono::steady_duration const& iteration_duration,
+                std::size_t cores, std::size_t count) override
+            {
+                return hpx::parallel::execution::get_chunk_size(
+                    params, exec, iteration_duration, cores, count);
+            }
+
+            hpx::chrono::steady_duration measure_iteration(
+                hpx::function_ref<std::size_t(std::size_t)> f,
+                std::size_t count) override
+            {
+                return hpx::parallel::execution::measure_iteration(
+                    params, exec, f, count);
+            }
+
+            Parameters params;
+
+            // the measurements are performed on the calling thread
+            hpx::execution::sequenced_executor exec;
+        };
+        /// \endcond
+    }    // namespace detail
+
+    /// Holds the executor parameters object (e.g. static_chunk_size,
+    /// guided_chunk_size, or auto_chunk_size) which the bulk algorithm of the
+    /// thread_pool_scheduler uses to split the iteration space into chunks.
+    /// The chunks are distributed over per-worker queues, worker threads
+    /// that run out of work steal chunks from their neighbors unless the
+    /// scheduler's hint disables sharing.
+    ///
+    /// Parameters which measure the time an iteration takes (see
+    /// auto_chunk_size) do so for the first bulk operation only, all later
+    /// bulk operations using the same scheduler (or copies of it) reuse the
+    /// measured time.
+    class bulk_chunking
+    {
+    public:
+        /// Use the default chunking of the thread_pool_scheduler.
+        bulk_chunking() = default;
+
+        /// Use the given executor parameters object to calculate the chunk
+        /// size.
+        template <typename Parameters,
+            typename Enable = std::enable_if_t<
+                !std::is_same_v<std::decay_t<Parameters>, bulk_chunking> &&
+                hpx::traits::is_executor_parameters_v<
+                    std::decay_t<Parameters>>>>
+        /*implicit*/ bulk_chunking(Parameters&& params)
+          : impl_(std::make_shared<
+                detail::bulk_chunking_impl<std::decay_t<Parameters>>>(
+                HPX_FORWARD(Parameters, params)))
+        {
+        }
+
+        /// Return whether the default chunking is used.
+        [[nodiscard]] bool is_default() const noexcept
+        {
+            return !impl_;
+        }
+
+        /// \cond NOINTERNAL
+        [[nodiscard]] detail::bulk_chunking_base* get() const noexcept
+        {
+            return impl_.get();
+        }
+
+        friend bool operator==(
+            bulk_chunking const& lhs, bulk_chunking const& rhs) noexcept
+        {
+            return lhs.impl_ == rhs.impl_;
+        }
+
+        friend bool operator!=(
+            bulk_chunking const& lhs, bulk_chunking const& rhs) noexcept
+        {
+            return !(lhs == rhs);
+        }
+        /// \endcond
+
+    private:
+        std::shared_ptr<detail::bulk_chunking_base> impl_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    inline constexpr struct with_bulk_chunking_t final
+      : detail::property_base<with_bulk_chunking_t>
+    {
+    } with_bulk_chunking{};
+
+    inline constexpr struct get_bulk_chunking_t final
+      : hpx::functional::detail::tag_fallback<get_bulk_chunking_t>
+    {
+    private:
+        // simply return the default chunking if not supported
+        template <typename Target>
+        friend HPX_FORCEINLINE bulk_chunking tag_fallback_invoke(
+            get_bulk_chunking_t, Target&&) noexcept
+        {
+            return bulk_chunking{};
+        }
+    } get_bulk_chunking{};
+
+    template <>
+    struct is_scheduling_property<get_bulk_chunking_t> : std::true_type
+    {
+    };
+}    // namespace hpx::execution::experimental
@@ -0,0 +1,443 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/executors/chunk_affinity_executor.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_base/scheduling_properties.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/errors/exception_list.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/execution.hpp>
+#include <hpx/execution_base/traits/is_executor.hpp>
+#include <hpx/executors/parallel_executor.hpp>
+#include <hpx/functional/detail/invoke.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/iterator_support/range.hpp>
+#include <hpx/modules/concepts.hpp>
+#include <hpx/pack_traversal/unwrap.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx::execution::experimental {
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        // The worker threads which have run the chunks of a bulk operation,
+        // indexed by the number of chunks of the operation. This is shared
+        // by all copies of a chunk_affinity_executor.
+        struct chunk_affinity_placements
+        {
+            std::vector<std::uint32_t> find(std::size_t num_chunks)
+            {
+                std::lock_guard<hpx::spinlock> l(mtx);
+                auto const it = placements.find(num_chunks);
+                if (it == placements.end())
+                {
+                    return {};
+                }
+                return it->second;
+            }
+
+            // the first recording for a number of chunks is kept
+            void store(std::vector<std::uint32_t>&& workers)
+            {
+                std::lock_guard<hpx::spinlock> l(mtx);
+                placements.emplace(workers.size(), HPX_MOVE(workers));
+            }
+
+            void clear()
+            {
+                std::lock_guard<hpx::spinlock> l(mtx);
+                placements.clear();
+            }
+
+            hpx::spinlock mtx;
+            std::unordered_map<std::size_t, std::vector<std::uint32_t>>
+                placements;
+        };
+
+        // Records the worker threads running the chunks of a single bulk
+        // operation. The placement is stored once all chunks have started.
+        struct chunk_affinity_recording
+        {
+            chunk_affinity_recording(
+                std::shared_ptr<chunk_affinity_placements> placements,
+                std::size_t num_chunks)
+              : placements(HPX_MOVE(placements))
+              , workers(num_chunks)
+              , remaining(num_chunks)
+            {
+            }
+
+            void record(std::size_t chunk)
+            {
+                workers[chunk] = static_cast<std::uint32_t>(
+                    hpx::get_local_worker_thread_num());
+                if (--remaining == 0)
+                {
+                    placements->store(HPX_MOVE(workers));
+                }
+            }
+
+            std::shared_ptr<chunk_affinity_placements> placements;
+            std::vector<std::uint32_t> workers;
+            std::atomic<std::size_t> remaining;
+        };
+
+        template <typename F>
+        struct chunk_affinity_function
+        {
+            template <typename... Ts>
+            decltype(auto) operator()(Ts&&... ts)
+            {
+                if (recording)
+                {
+                    recording->record(chunk);
+                }
+                return HPX_INVOKE(f, HPX_FORWARD(Ts, ts)...);
+            }
+
+            F f;
+            std::shared_ptr<chunk_affinity_recording> recording;
+            std::size_t chunk;
+        };
+    }    // namespace detail
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A \a chunk_affinity_executor wraps a parallel executor and runs every
+    /// chunk of a bulk operation on the worker thread which has run the same
+    /// chunk the first time a bulk operation with the same number of chunks
+    /// was executed. This allows for data initialized by one parallel
+    /// algorithm (first touch) to be processed by the same worker threads in
+    /// all subsequent algorithms using the same partitioning. The placement
+    /// is a scheduling hint only, idle worker threads may still steal chunks
+    /// from busy ones.
+    ///
+    /// The recorded placements are shared by all copies of the executor,
+    /// including the ones created when applying properties.
+    template <typename BaseExecutor = hpx::execution::parallel_executor>
+    struct chunk_affinity_executor
+    {
+        static_assert(
+            hpx::traits::is_executor_any_v<std::decay_t<BaseExecutor>>,
+            "chunk_affinity_executor requires an executor");
+
+        chunk_affinity_executor()
+          : placements_(std::make_shared<detail::chunk_affinity_placements>())
+        {
+        }
+
+        template <typename Executor,
+            typename Enable = std::enable_if_t<
+                hpx::traits::is_executor_any_v<Executor> &&
+                !std::is_same_v<std::decay_t<Executor>,
+                    chunk_affinity_executor>>>
+        explicit chunk_affinity_executor(Executor&& exec)
+          : exec_(HPX_FORWARD(Executor, exec))
+          , placements_(std::make_shared<detail::chunk_affinity_placements>())
+        {
+        }
+
+        /// Forget all recorded placements, the next bulk operation of any
+        /// size records its placement anew.
+        void reset() const
+        {
+            placements_->clear();
+        }
+
+        /// \cond NOINTERNAL
+        bool operator==(chunk_affinity_executor const& rhs) const noexcept
+        {
+            return exec_ == rhs.exec_ && placements_ == rhs.placements_;
+        }
+
+        bool operator!=(chunk_affinity_executor const& rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
+
+        [[nodiscard]] constexpr auto const& context() const noexcept
+        {
+            return exec_.context();
+        }
+
+        [[nodiscard]] constexpr std::decay_t<BaseExecutor> const& get_executor()
+            const noexcept
+        {
+            return exec_;
+        }
+
+        using execution_category =
+            hpx::traits::executor_execution_category_t<BaseExecutor>;
+
+        using parameters_type =
+            hpx::traits::executor_parameters_type_t<BaseExecutor>;
+
+        template <typename T, typename... Ts>
+        using future_type =
+            hpx::traits::executor_future_t<BaseExecutor, T, Ts...>;
+
+    private:
+        chunk_affinity_executor(std::decay_t<BaseExecutor> exec,
+            std::shared_ptr<detail::chunk_affinity_placements> placements)
+          : exec_(HPX_MOVE(exec))
+          , placements_(HPX_MOVE(placements))
+        {
+        }
+
+        // NonBlockingOneWayExecutor interface
+        template <typename F, typename... Ts>
+        friend decltype(auto) tag_invoke(hpx::parallel::execution::post_t,
+            chunk_affinity_executor const& exec, F&& f, Ts&&... ts)
+        {
+            return parallel::execution::post(
+                exec.exec_, HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+        }
+
+        // OneWayExecutor interface
+        template <typename F, typename... Ts>
+        friend decltype(auto) tag_invoke(
+            hpx::parallel::execution::sync_execute_t,
+            chunk_affinity_executor const& exec, F&& f, Ts&&... ts)
+        {
+            return parallel::execution::sync_execute(
+                exec.exec_, HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+        }
+
+        // TwoWayExecutor interface
+        template <typename F, typename... Ts>
+        friend decltype(auto) tag_invoke(
+            hpx::parallel::execution::async_execute_t,
+            chunk_affinity_executor const& exec, F&& f, Ts&&... ts)
+        {
+            return parallel::execution::async_execute(
+                exec.exec_, HPX_FORWARD(F, f), HPX_FORWARD(Ts, ts)...);
+        }
+
+        template <typename F, typename Future, typename... Ts>
+        friend decltype(auto) tag_invoke(
+            hpx::parallel::execution::then_execute_t,
+            chunk_affinity_executor const& exec, F&& f, Future&& predecessor,
+            Ts&&... ts)
+        {
+            return parallel::execution::then_execute(exec.exec_,
+                HPX_FORWARD(F, f), HPX_FORWARD(Future, predecessor),
+                HPX_FORWARD(Ts, ts)...);
+        }
+
+        // BulkTwoWayExecutor interface
+        //
+        // Every chunk (element of the shape) is run as a separate task which
+        // is scheduled on the recorded worker thread. If no placement was
+        // recorded for the number of chunks yet, the chunks are distributed
+        // depth-first over the worker threads of the executor and the worker
+        // threads actually running them are recorded.
+        template <typename F, typename S, typename... Ts>
+        friend auto tag_invoke(hpx::parallel::execution::bulk_async_execute_t,
+            chunk_affinity_executor const& exec, F&& f, S const& shape,
+            Ts&&... ts)
+        {
+            using result_type =
+                parallel::execution::detail::bulk_function_result_t<F, S,
+                    Ts...>;
+            using function_type =
+                detail::chunk_affinity_function<std::decay_t<F>>;
+
+            std::size_t const size = hpx::util::size(shape);
+
+            std::vector<hpx::future<result_type>> results;
+            results.reserve(size);
+
+            std::shared_ptr<detail::chunk_affinity_recording> recording;
+            std::vector<std::uint32_t> workers =
+                exec.placements_->find(size);
+            if (workers.empty() && size != 0)
+            {
+                recording =
+                    std::make_shared<detail::chunk_affinity_recording>(
+                        exec.placements_, size);
+
+                std::size_t const first_core =
+                    hpx::execution::experimental::get_first_core(exec.exec_);
+                std::size_t const num_cores =
+                    parallel::execution::processing_units_count(exec.exec_);
+
+                workers.reserve(size);
+                for (std::size_t chunk = 0; chunk != size; ++chunk)
+                {
+                    workers.push_back(static_cast<std::uint32_t>(
+                        first_core + (chunk * num_cores) / size));
+                }
+            }
+
+            auto it = hpx::util::begin(shape);
+            for (std::size_t chunk = 0; chunk != size; (void) ++it, ++chunk)
+            {
+                auto hinted_exec = hpx::execution::experimental::with_hint(
+                    exec.exec_,
+                    threads::thread_schedule_hint(
+                        static_cast<std::int16_t>(workers[chunk])));
+
+                results.push_back(parallel::execution::async_execute(
+                    hinted_exec, function_type{f, recording, chunk}, *it,
+                    ts...));
+            }
+
+            return results;
+        }
+
+        template <typename F, typename S, typename... Ts>
+        friend auto tag_invoke(hpx::parallel::execution::bulk_sync_execute_t,
+            chunk_affinity_executor const& exec, F&& f, S const& shape,
+            Ts&&... ts)
+        {
+            using result_type =
+                parallel::execution::detail::bulk_function_result_t<F, S,
+                    Ts...>;
+
+            auto results = parallel::execution::bulk_async_execute(
+                exec, HPX_FORWARD(F, f), shape, HPX_FORWARD(Ts, ts)...);
+
+            if constexpr (std::is_void_v<result_type>)
+            {
+                hpx::wait_all_nothrow(results);
+
+                hpx::exception_list exceptions;
+                for (auto& result : results)
+                {
+                    if (result.has_exception())
+                    {
+                        exceptions.add(result.get_exception_ptr());
+                    }
+                }
+
+                if (exceptions.size() != 0)
+                {
+                    throw exceptions;
+                }
+            }
+            else
+            {
+                return hpx::unwrap(results);
+            }
+        }
+
+        // support all properties exposed by the wrapped executor, the
+        // recorded placements are shared with the new executor
+        // clang-format off
+        template <typename Tag, typename Property,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::execution::experimental::is_scheduling_property_v<Tag> &&
+                hpx::functional::is_tag_invocable_v<
+                    Tag, std::decay_t<BaseExecutor>, Property>
+            )>
+        // clang-format on
+        friend chunk_affinity_executor tag_invoke(
+            Tag tag, chunk_affinity_executor const& exec, Property&& prop)
+        {
+            return chunk_affinity_executor(
+                tag(exec.exec_, HPX_FORWARD(Property, prop)),
+                exec.placements_);
+        }
+
+        // clang-format off
+        template <typename Tag,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::execution::experimental::is_scheduling_property_v<Tag> &&
+                hpx::functional::is_tag_invocable_v<
+                    Tag, std::decay_t<BaseExecutor>>
+            )>
+        // clang-format on
+        friend decltype(auto) tag_invoke(
+            Tag tag, chunk_affinity_executor const& exec)
+        {
+            return tag(exec.exec_);
+        }
+
+        friend decltype(auto) tag_invoke(
+            hpx::parallel::execution::processing_units_count_t tag,
+            chunk_affinity_executor const& exec,
+            hpx::chrono::steady_duration const& iteration_duration =
+                hpx::chrono::null_duration,
+            std::size_t num_tasks = 0)
+        {
+            return hpx::functional::tag_invoke(
+                tag, exec.exec_, iteration_duration, num_tasks);
+        }
+
+        std::decay_t<BaseExecutor> exec_;
+        std::shared_ptr<detail::chunk_affinity_placements> placements_;
+        /// \endcond
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+#if !defined(DOXYGEN)    // doxygen gets confused by the deduction guides
+    template <typename BaseExecutor>
+    explicit chunk_affinity_executor(BaseExecutor&& exec)
+        -> chunk_affinity_executor<std::decay_t<BaseExecutor>>;
+#endif
+}    // namespace hpx::execution::experimental
+
+namespace hpx::parallel::execution {
+
+    // The chunk_affinity_executor exposes the same executor categories as its
+    // underlying (wrapped) executor.
+
+    /// \cond NOINTERNAL
+    template <typename BaseExecutor>
+    struct is_one_way_executor<
+        hpx::execution::experimental::chunk_affinity_executor<BaseExecutor>>
+      : is_one_way_executor<BaseExecutor>
+    {
+    };
+
+    template <typename BaseExecutor>
+    struct is_never_blocking_one_way_executor<
+        hpx::execution::experimental::chunk_affinity_executor<BaseExecutor>>
+      : is_never_blocking_one_way_executor<BaseExecutor>
+    {
+    };
+
+    template <typename BaseExecutor>
+    struct is_bulk_one_way_executor<
+        hpx::execution::experimental::chunk_affinity_executor<BaseExecutor>>
+      : is_bulk_one_way_executor<BaseExecutor>
+    {
+    };
+
+    template <typename BaseExecutor>
+    struct is_two_way_executor<
+        hpx::execution::experimental::chunk_affinity_executor<BaseExecutor>>
+      : is_two_way_executor<BaseExecutor>
+    {
+    };
+
+    template <typename BaseExecutor>
+    struct is_bulk_two_way_executor<
+        hpx::execution::experimental::chunk_affinity_executor<BaseExecutor>>
+      : is_bulk_two_way_executor<BaseExecutor>
+    {
+    };
+    /// \endcond
+}    // namespace hpx::parallel::execution
@@ -24,6 +24,8 @@
 #include <hpx/execution_base/traits/is_executor.hpp>
 #include <hpx/functional/invoke.hpp>
 #include <hpx/functional/invoke_fused.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
+#include <hpx/iterator_support/range.hpp>
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/hardware.hpp>
 #include <hpx/modules/itt_notify.hpp>
@@ -39,6 +41,7 @@
 #include <cstdint>
 #include <exception>
 #include <iosfwd>
+#include <iterator>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -63,6 +66,12 @@ namespace hpx::execution::experimental {
     /// worker threads is a slow operation the executor should be reused
     /// whenever possible for multiple adjacent parallel algorithms or
     /// invocations of bulk_(a)sync_execute.
+    ///
+    /// Iterative algorithms that execute many small parallel loops can avoid
+    /// entering and leaving a parallel region for each of the loops by using
+    /// \a fork_join_executor::parallel_region. The worker threads then stay
+    /// inside the region for all of the loops and synchronize through a
+    /// barrier instead.
     class fork_join_executor
     {
     public:
@@ -156,6 +165,22 @@ namespace hpx::execution::experimental {
             // The current queues for each worker HPX thread.
             queues_type queues_;
 
+            // Members used by parallel regions (see parallel_region). The
+            // barrier counts the arriving threads, the last one to arrive
+            // resets the count and releases the others by incrementing the
+            // generation.
+            hpx::util::cache_aligned_data<std::atomic<std::size_t>>
+                barrier_count_;
+            hpx::util::cache_aligned_data<std::atomic<std::uint32_t>>
+                barrier_generation_;
+            std::atomic<bool> region_cancelled_{false};
+            std::atomic<bool> region_active_{false};
+
+            // Each thread publishes a pointer to its contribution to a
+            // reduction or broadcast here.
+            std::vector<hpx::util::cache_aligned_data<void const*>>
+                region_slots_;
+
             // executor properties
             char const* annotation_ = nullptr;
 
@@ -435,6 +460,7 @@ namespace hpx::execution::experimental {
               , exception_mutex_()
               , exception_()
               , region_data_(num_threads_)
+              , region_slots_(num_threads_)
             {
                 HPX_ASSERT(pool_);
 
@@ -456,6 +482,7 @@ namespace hpx::execution::experimental {
               , exception_mutex_()
               , exception_()
               , region_data_(num_threads_)
+              , region_slots_(num_threads_)
             {
                 HPX_ASSERT(pool_);
                 if (pool_ == nullptr ||
@@ -472,6 +499,82 @@ namespace hpx::execution::experimental {
                 init_threads();
             }
 
+            // Wait for all threads of the current parallel region to arrive
+            // at the barrier. Throws if the region was cancelled as one of the
+            // threads has exited with an exception, as that thread would never
+            // arrive.
+            void region_barrier()
+            {
+                if (num_threads_ == 1)
+                {
+                    return;
+                }
+
+                std::uint32_t const generation =
+                    barrier_generation_.data_.load(std::memory_order_acquire);
+                if (barrier_count_.data_.fetch_add(
+                        1, std::memory_order_acq_rel) +
+                        1 ==
+                    num_threads_)
+                {
+                    barrier_count_.data_.store(0, std::memory_order_relaxed);
+                    barrier_generation_.data_.store(
+                        generation + 1, std::memory_order_release);
+                    return;
+                }
+
+                std::uint64_t const base_time = util::hardware::timestamp();
+                while (barrier_generation_.data_.load(
+                           std::memory_order_acquire) == generation)
+                {
+                    if (HPX_UNLIKELY(region_cancelled_.load(
+                            std::memory_order_acquire)))
+                    {
+                        HPX_THROW_EXCEPTION(hpx::error::thread_cancelled,
+                            "fork_join_executor::region_context::barrier",
+                            "the parallel region was cancelled as one of its "
+                            "threads has exited with an exception");
+                    }
+
+                    HPX_SMT_PAUSE;
+
+                    if (HPX_UNLIKELY((util::hardware::timestamp() -
+                                         base_time) > yield_delay_))
+                    {
+                        hpx::this_thread::yield();
+                    }
+                }
+            }
+
+            // The worker threads don't pick up any other work while they are
+            // inside a parallel region, thus neither loops nor parallel
+            // regions can be started from inside a region.
+            void check_outside_region(char const* function) const
+            {
+                if (HPX_UNLIKELY(
+                        region_active_.load(std::memory_order_acquire)))
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::invalid_status, function,
+                        "work can't be scheduled on a fork_join_executor "
+                        "from inside one of its parallel regions, use the "
+                        "operations of the region_context instead");
+                }
+            }
+
+            // Record the (first) exception thrown in the current parallel
+            // region and release all threads waiting in a barrier.
+            void cancel_region(std::exception_ptr&& ep) noexcept
+            {
+                {
+                    std::lock_guard<hpx::spinlock> l(exception_mutex_);
+                    if (!exception_)
+                    {
+                        exception_ = HPX_MOVE(ep);
+                    }
+                }
+                region_cancelled_.store(true, std::memory_order_release);
+            }
+
             ~shared_data()
             {
                 set_state_all(thread_state::stopping);
@@ -649,11 +752,11 @@ namespace hpx::execution::experimental {
 
             template <typename F, typename S, typename Args>
             thread_function_helper_type* set_all_states_and_region_data(
-                thread_state state, F& f, S const& shape,
-                Args& argument_pack) noexcept
+                thread_state state, loop_schedule schedule, F& f,
+                S const& shape, Args& argument_pack) noexcept
             {
                 thread_function_helper_type* func = nullptr;
-                if (schedule_ == loop_schedule::static_ || num_threads_ == 1)
+                if (schedule == loop_schedule::static_ || num_threads_ == 1)
                 {
                     func = &thread_function_helper<F, S, Args>::call_static;
                 }
@@ -679,6 +782,15 @@ namespace hpx::execution::experimental {
         public:
             template <typename F, typename S, typename... Ts>
             void bulk_sync_execute(F&& f, S const& shape, Ts&&... ts)
+            {
+                check_outside_region("fork_join_executor::bulk_sync_execute");
+                bulk_sync_execute_with(schedule_, HPX_FORWARD(F, f), shape,
+                    HPX_FORWARD(Ts, ts)...);
+            }
+
+            template <typename F, typename S, typename... Ts>
+            void bulk_sync_execute_with(
+                loop_schedule schedule, F&& f, S const& shape, Ts&&... ts)
             {
                 hpx::scoped_annotation annotate(
                     generate_annotation(hpx::get_worker_thread_num(),
@@ -692,7 +804,7 @@ namespace hpx::execution::experimental {
                 // themselves, and then starting the actual work.
                 thread_function_helper_type* func =
                     set_all_states_and_region_data(
-                        thread_state::partitioning_work, f, shape,
+                        thread_state::partitioning_work, schedule, f, shape,
                         argument_pack);
 
                 // Start work on the main thread.
@@ -732,6 +844,221 @@ namespace hpx::execution::experimental {
     private:
         std::shared_ptr<shared_data> shared_data_ = nullptr;
 
+    public:
+        /// \brief The context of one worker thread participating in a
+        ///        parallel region started by \a parallel_region.
+        ///
+        /// All worker threads of the executor execute the region function
+        /// concurrently, each with its own region_context. All of the
+        /// collective operations (\a barrier, \a bulk_sync_execute,
+        /// \a reduce, and \a broadcast) have to be called by all worker
+        /// threads of the region in the same order.
+        class region_context
+        {
+        public:
+            HPX_NON_COPYABLE(region_context);
+
+            /// Returns the index of the calling worker thread, this is a
+            /// number in [0, num_threads()).
+            std::size_t thread_index() const noexcept
+            {
+                return thread_index_;
+            }
+
+            /// Returns the number of worker threads executing the region.
+            std::size_t num_threads() const noexcept
+            {
+                return data_.num_threads_;
+            }
+
+            /// Returns the index of the worker thread that has entered the
+            /// parallel region.
+            std::size_t main_thread_index() const noexcept
+            {
+                return data_.main_thread_;
+            }
+
+            bool is_main_thread() const noexcept
+            {
+                return thread_index_ == data_.main_thread_;
+            }
+
+            /// Blocks the calling worker thread until all worker threads of
+            /// the region have called barrier.
+            void barrier()
+            {
+                data_.region_barrier();
+            }
+
+            /// Invokes \a f for the part of \a shape that belongs to the
+            /// calling worker thread without waiting for the other threads.
+            /// The shape is split into contiguous blocks of equal size, the
+            /// same block is assigned to the same worker thread for all
+            /// shapes of the same size. Thus data touched in one step is
+            /// accessed again by the same core (and NUMA domain) in the next
+            /// step.
+            template <typename F, typename S, typename... Ts>
+            void bulk_execute_nowait(F&& f, S const& shape, Ts&&... ts)
+            {
+                std::size_t const size = hpx::util::size(shape);
+                std::size_t const num_threads = data_.num_threads_;
+
+                std::size_t part_begin = (thread_index_ * size) / num_threads;
+                std::size_t const part_end =
+                    ((thread_index_ + 1) * size) / num_threads;
+
+                auto it = std::next(hpx::util::begin(shape), part_begin);
+                for (/**/; part_begin != part_end; ++part_begin, ++it)
+                {
+                    HPX_INVOKE(f, *it, ts...);
+                }
+            }
+
+            /// Invokes \a f for the part of \a shape that belongs to the
+            /// calling worker thread (see \a bulk_execute_nowait) and waits
+            /// for all worker threads to finish their parts.
+            template <typename F, typename S, typename... Ts>
+            void bulk_sync_execute(F&& f, S const& shape, Ts&&... ts)
+            {
+                bulk_execute_nowait(HPX_FORWARD(F, f), shape, ts...);
+                barrier();
+            }
+
+            /// Combines the values passed by all worker threads using the
+            /// binary operation \a op and returns the result on all of them.
+            /// The values are combined pairwise in log2(num_threads()) steps,
+            /// preserving the order of the thread indices. Thus the result is
+            /// deterministic, \a op has to be associative but doesn't need
+            /// to be commutative.
+            template <typename T, typename Op>
+            T reduce(T value, Op&& op)
+            {
+                std::size_t const num_threads = data_.num_threads_;
+                if (num_threads == 1)
+                {
+                    return value;
+                }
+
+                auto& slots = data_.region_slots_;
+                slots[thread_index_].data_ = &value;
+                barrier();
+
+                // in each step thread i combines its partial result with the
+                // one of thread i + stride, which is not modified anymore
+                for (std::size_t stride = 1; stride < num_threads;
+                     stride *= 2)
+                {
+                    if (thread_index_ % (2 * stride) == 0 &&
+                        thread_index_ + stride < num_threads)
+                    {
+                        value = HPX_INVOKE(op, HPX_MOVE(value),
+                            *static_cast<T const*>(
+                                slots[thread_index_ + stride].data_));
+                    }
+                    barrier();
+                }
+
+                T result = *static_cast<T const*>(slots[0].data_);
+
+                // make sure no thread leaves before the result has been read
+                barrier();
+                return result;
+            }
+
+            /// Returns the value passed by the worker thread \a root on all
+            /// worker threads.
+            template <typename T>
+            T broadcast(T value, std::size_t root)
+            {
+                HPX_ASSERT(root < data_.num_threads_);
+                if (data_.num_threads_ == 1)
+                {
+                    return value;
+                }
+
+                auto& slots = data_.region_slots_;
+                if (thread_index_ == root)
+                {
+                    slots[root].data_ = &value;
+                }
+                barrier();
+
+                T result = *static_cast<T const*>(slots[root].data_);
+
+                barrier();
+                return result;
+            }
+
+        private:
+            friend class fork_join_executor;
+
+            region_context(
+                shared_data& data, std::size_t thread_index) noexcept
+              : data_(data)
+              , thread_index_(thread_index)
+            {
+            }
+
+            shared_data& data_;
+            std::size_t const thread_index_;
+        };
+
+        /// \brief Execute a parallel region on all worker threads of this
+        ///        executor.
+        ///
+        /// Invokes \a f(ctx, ts...) once on each of the worker threads, where
+        /// \a ctx is the \a region_context of that thread, and returns after
+        /// all threads have finished. The worker threads stay inside the
+        /// region until \a f returns, thus any number of parallel loops
+        /// (\a region_context::bulk_sync_execute), barriers, and reductions
+        /// can be executed without the cost of entering and leaving a
+        /// parallel region for each of them.
+        ///
+        /// If \a f exits with an exception on any of the threads, all other
+        /// threads waiting in (or later calling) a collective operation exit
+        /// with an exception as well. The first exception is rethrown by
+        /// parallel_region.
+        ///
+        /// \throws hpx::exception with hpx::error::invalid_status if called
+        ///         from inside a parallel region of the same executor.
+        ///         Likewise, no other work can be scheduled on the executor
+        ///         from inside the region.
+        template <typename F, typename... Ts>
+        void parallel_region(F&& f, Ts&&... ts) const
+        {
+            shared_data& data = *shared_data_;
+
+            data.check_outside_region("fork_join_executor::parallel_region");
+            data.region_active_.store(true, std::memory_order_release);
+
+            // the worker threads are idle, thus there is no need to
+            // synchronize the reset
+            data.barrier_count_.data_.store(0, std::memory_order_relaxed);
+            data.region_cancelled_.store(false, std::memory_order_relaxed);
+
+            auto region_f = [&](std::size_t thread_index) {
+                region_context ctx(data, thread_index);
+                hpx::detail::try_catch_exception_ptr(
+                    [&]() { HPX_INVOKE(f, ctx, ts...); },
+                    [&](std::exception_ptr&& ep) {
+                        data.cancel_region(HPX_MOVE(ep));
+                    });
+            };
+
+            // the static schedule assigns exactly one index to each thread
+            try
+            {
+                data.bulk_sync_execute_with(loop_schedule::static_, region_f,
+                    hpx::util::counting_shape(data.num_threads_));
+            }
+            catch (...)
+            {
+                data.region_active_.store(false, std::memory_order_release);
+                throw;
+            }
+            data.region_active_.store(false, std::memory_order_release);
+        }
+
     private:
         // clang-format off
         template <typename F, typename S, typename... Ts,
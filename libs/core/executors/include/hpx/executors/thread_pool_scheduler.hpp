@@ -18,6 +18,7 @@
 #include <hpx/execution_base/completion_signatures.hpp>
 #include <hpx/execution_base/receiver.hpp>
 #include <hpx/execution_base/sender.hpp>
+#include <hpx/executors/bulk_chunking.hpp>
 #include <hpx/modules/topology.hpp>
 #include <hpx/threading_base/annotated_function.hpp>
 #include <hpx/threading_base/register_thread.hpp>
@@ -135,6 +136,24 @@ namespace hpx::execution::experimental {
             return exec.get_first_core();
         }
 
+        // support with_bulk_chunking property
+        friend thread_pool_policy_scheduler tag_invoke(
+            hpx::execution::experimental::with_bulk_chunking_t,
+            thread_pool_policy_scheduler const& scheduler,
+            bulk_chunking chunking) noexcept
+        {
+            auto scheduler_with_chunking = scheduler;
+            scheduler_with_chunking.bulk_chunking_ = HPX_MOVE(chunking);
+            return scheduler_with_chunking;
+        }
+
+        friend bulk_chunking tag_invoke(
+            hpx::execution::experimental::get_bulk_chunking_t,
+            thread_pool_policy_scheduler const& scheduler) noexcept
+        {
+            return scheduler.bulk_chunking_;
+        }
+
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
         // support with_annotation property
         friend constexpr thread_pool_policy_scheduler tag_invoke(
@@ -373,6 +392,7 @@ namespace hpx::execution::experimental {
         Policy policy_;
         std::size_t first_core_ = 0;
         std::size_t num_cores_ = 0;
+        bulk_chunking bulk_chunking_;
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
         char const* annotation_ = nullptr;
 #endif
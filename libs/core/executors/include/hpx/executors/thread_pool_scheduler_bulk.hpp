@@ -23,6 +23,7 @@
 #include <hpx/execution_base/completion_signatures.hpp>
 #include <hpx/execution_base/receiver.hpp>
 #include <hpx/execution_base/sender.hpp>
+#include <hpx/executors/bulk_chunking.hpp>
 #include <hpx/executors/thread_pool_scheduler.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/functional/detail/tag_fallback_invoke.hpp>
@@ -139,10 +140,19 @@ namespace hpx::execution::experimental::detail {
 #endif
             using index_pack_type = hpx::detail::fused_index_pack_t<Ts>;
 
-            auto const i_begin =
-                static_cast<std::size_t>(index) * task_f->chunk_size;
-            auto const i_end =
-                (std::min)(i_begin + task_f->chunk_size, task_f->size);
+            std::size_t i_begin, i_end;
+            if (op_state->chunk_boundaries.empty())
+            {
+                i_begin = op_state->first_index +
+                    static_cast<std::size_t>(index) * task_f->chunk_size;
+                i_end = (std::min)(i_begin + task_f->chunk_size, task_f->size);
+            }
+            else
+            {
+                // chunks of varying size
+                i_begin = op_state->chunk_boundaries[index];
+                i_end = op_state->chunk_boundaries[index + 1];
+            }
 
             auto it = std::next(hpx::util::begin(op_state->shape), i_begin);
             for (std::uint32_t i = i_begin; i != i_end; (void) ++it, ++i)
@@ -436,6 +446,109 @@ namespace hpx::execution::experimental::detail {
             }
         }
 
+        // Execute up to count of the iterations following first_index on the
+        // calling thread, returns the number of executed iterations.
+        std::size_t run_iterations(std::size_t const count) const
+        {
+            std::uint32_t const begin = op_state->first_index;
+            auto const end = static_cast<std::uint32_t>(
+                (std::min)(begin + count, hpx::util::size(op_state->shape)));
+
+            hpx::visit(
+                [&](auto& ts) {
+                    using ts_type = std::decay_t<decltype(ts)>;
+                    if constexpr (!std::is_same_v<ts_type, hpx::monostate>)
+                    {
+                        using index_pack_type =
+                            hpx::detail::fused_index_pack_t<ts_type>;
+
+                        auto it = std::next(
+                            hpx::util::begin(op_state->shape), begin);
+                        for (std::uint32_t i = begin; i != end;
+                             (void) ++it, ++i)
+                        {
+                            bulk_scheduler_invoke_helper(
+                                index_pack_type{}, op_state->f, *it, ts);
+                        }
+                    }
+                },
+                op_state->ts);
+
+            op_state->first_index = end;
+            return end - begin;
+        }
+
+        // Calculate the chunk size and the number of chunks using the
+        // executor parameters of the scheduler. Returns false if no work is
+        // left to be scheduled.
+        bool calculate_chunks(bulk_chunking const& chunking,
+            std::uint32_t const size, std::uint32_t& chunk_size,
+            std::uint32_t& num_chunks)
+        {
+            auto const num_threads =
+                static_cast<std::uint32_t>(op_state->num_worker_threads);
+
+            detail::bulk_chunking_base* params = chunking.get();
+            if (params == nullptr)
+            {
+                chunk_size = get_bulk_scheduler_chunk_size(num_threads, size);
+                num_chunks = (size + chunk_size - 1) / chunk_size;
+                return true;
+            }
+
+            // parameters measuring the iteration time execute the first
+            // iterations on this thread, see get_iteration_duration
+            hpx::chrono::steady_duration const iteration_duration =
+                params->get_iteration_duration(
+                    [this](std::size_t count) { return run_iterations(count); },
+                    size);
+
+            std::uint32_t const first = op_state->first_index;
+            if (first == size)
+            {
+                return false;
+            }
+
+            if (params->has_variable_chunk_size())
+            {
+                // store the boundaries of the chunks, the size of each chunk
+                // depends on the number of remaining iterations
+                auto& boundaries = op_state->chunk_boundaries;
+                boundaries.clear();
+                boundaries.push_back(first);
+
+                std::uint32_t begin = first;
+                while (begin != size)
+                {
+                    std::uint32_t const remaining = size - begin;
+                    std::size_t const current = params->get_chunk_size(
+                        iteration_duration, num_threads, remaining);
+                    begin += static_cast<std::uint32_t>((std::min)(
+                        (std::max)(current, std::size_t(1)),
+                        std::size_t(remaining)));
+                    boundaries.push_back(begin);
+                }
+
+                chunk_size = boundaries[1] - boundaries[0];
+                num_chunks =
+                    static_cast<std::uint32_t>(boundaries.size() - 1);
+                return true;
+            }
+
+            std::uint32_t const remaining = size - first;
+            std::size_t const current = params->get_chunk_size(
+                iteration_duration, num_threads, remaining);
+
+            // fall back to the default if the parameters don't specify a
+            // chunk size
+            chunk_size = current != 0 ?
+                static_cast<std::uint32_t>(
+                    (std::min)(current, std::size_t(remaining))) :
+                get_bulk_scheduler_chunk_size(num_threads, remaining);
+            num_chunks = (remaining + chunk_size - 1) / chunk_size;
+            return true;
+        }
+
         using range_value_type =
             hpx::traits::iter_value_t<hpx::traits::range_iterator_t<Shape>>;
 
@@ -452,10 +565,25 @@ namespace hpx::execution::experimental::detail {
                 return;
             }
 
+            // Store sent values in the operation state
+            op_state->ts.template emplace<hpx::tuple<Ts...>>(
+                HPX_FORWARD(Ts, ts)...);
+
             // Calculate chunk size and number of chunks
-            std::uint32_t chunk_size = get_bulk_scheduler_chunk_size(
-                op_state->num_worker_threads, size);
-            std::uint32_t num_chunks = (size + chunk_size - 1) / chunk_size;
+            bulk_chunking const chunking =
+                hpx::execution::experimental::get_bulk_chunking(
+                    op_state->scheduler);
+
+            std::uint32_t chunk_size = 0;
+            std::uint32_t num_chunks = 0;
+            if (!calculate_chunks(chunking, size, chunk_size, num_chunks))
+            {
+                // all work was done while measuring
+                auto visitor =
+                    set_value_end_loop_visitor<OperationState>{op_state};
+                hpx::visit(HPX_MOVE(visitor), HPX_MOVE(op_state->ts));
+                return;
+            }
 
             // launch only as many tasks as we have chunks
             std::size_t const num_pus = op_state->num_worker_threads;
@@ -471,10 +599,6 @@ namespace hpx::execution::experimental::detail {
             HPX_ASSERT(hpx::threads::count(op_state->pu_mask) ==
                 op_state->num_worker_threads);
 
-            // Store sent values in the operation state
-            op_state->ts.template emplace<hpx::tuple<Ts...>>(
-                HPX_FORWARD(Ts, ts)...);
-
             // thread placement
             hpx::threads::thread_schedule_hint const hint =
                 hpx::execution::experimental::get_hint(op_state->scheduler);
@@ -486,8 +610,12 @@ namespace hpx::execution::experimental::detail {
             for (std::uint32_t worker_thread = 0;
                  worker_thread != op_state->num_worker_threads; ++worker_thread)
             {
+                // chunks of varying size are distributed round-robin,
+                // otherwise the first worker would get all of the large
+                // chunks
                 if (hint.placement_mode() == placement::breadth_first ||
-                    hint.placement_mode() == placement::breadth_first_reverse)
+                    hint.placement_mode() == placement::breadth_first_reverse ||
+                    !op_state->chunk_boundaries.empty())
                 {
                     init_queue_breadth_first(worker_thread, num_chunks,
                         op_state->num_worker_threads);
@@ -722,6 +850,12 @@ namespace hpx::execution::experimental::detail {
             hpx::util::cache_aligned_data<std::atomic<std::size_t>>
                 tasks_remaining;
 
+            // iterations before first_index were executed while measuring
+            // the chunk size, chunk_boundaries is used only for chunks of
+            // varying size
+            std::uint32_t first_index = 0;
+            std::vector<std::uint32_t> chunk_boundaries;
+
             using value_types = value_types_of_t<Sender, empty_env,
                 decayed_tuple, hpx::variant>;
             hpx::util::detail::prepend_t<value_types, hpx::monostate> ts;
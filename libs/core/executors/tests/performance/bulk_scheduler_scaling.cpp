@@ -0,0 +1,124 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the performance of bulk on the thread_pool_scheduler
+// for different executor parameters, using a uniform and an irregular
+// (triangular) amount of work per iteration. Run it with varying numbers of
+// threads (--hpx:threads) to assess scaling.
+
+#include <hpx/config.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ex = hpx::execution::experimental;
+namespace tt = hpx::this_thread::experimental;
+
+///////////////////////////////////////////////////////////////////////////////
+void worker_timed(std::uint64_t delay_ns)
+{
+    if (delay_ns == 0)
+        return;
+
+    std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+    while (hpx::chrono::high_resolution_clock::now() - start < delay_ns)
+    {
+    }
+}
+
+template <typename Scheduler>
+void measure_bulk(Scheduler const& sched, std::size_t size,
+    std::uint64_t delay, bool irregular)
+{
+    // for the irregular case the work grows linearly with the index, the
+    // overall amount of work is the same as for the uniform case
+    tt::sync_wait(
+        ex::schedule(sched) | ex::bulk(size, [&](std::size_t i) {
+            worker_timed(irregular ? (2 * delay * i) / size : delay);
+        }));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const size = vm["size"].as<std::size_t>();
+    std::uint64_t const delay = vm["work_delay"].as<std::uint64_t>();
+    int const test_count = vm["test_count"].as<int>();
+    std::size_t const chunk_size = vm["chunk_size"].as<std::size_t>();
+
+    if (test_count <= 0)
+    {
+        std::cerr << "test_count must be positive...\n" << std::flush;
+        hpx::local::finalize();
+        return -1;
+    }
+
+    for (bool irregular : {false, true})
+    {
+        // the iteration time is measured once per executor parameters
+        // object, create new ones for each kind of work
+        std::vector<std::pair<std::string, ex::bulk_chunking>> const
+            chunkings = {
+                {"automatic", ex::bulk_chunking()},
+                {"static", ex::static_chunk_size(chunk_size)},
+                {"guided",
+                    ex::guided_chunk_size(
+                        (std::max)(chunk_size, std::size_t(1)))},
+                {"auto", ex::auto_chunk_size()},
+            };
+
+        for (auto const& chunking : chunkings)
+        {
+            auto const sched = ex::with_bulk_chunking(
+                ex::thread_pool_scheduler{}, chunking.second);
+
+            hpx::util::perftests_report(
+                irregular ? "bulk, irregular" : "bulk, uniform",
+                chunking.first, test_count,
+                [&]() { measure_bulk(sched, size, delay, irregular); });
+        }
+    }
+
+    hpx::util::perftests_print_times();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("size", value<std::size_t>()->default_value(100000),
+            "number of iterations of each bulk operation")
+        ("work_delay", value<std::uint64_t>()->default_value(1000),
+            "average work per iteration in nanoseconds")
+        ("test_count", value<int>()->default_value(10),
+            "number of tests to be averaged")
+        ("chunk_size", value<std::size_t>()->default_value(0),
+            "chunk size for static chunking, minimal chunk size for guided "
+            "chunking")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = {"hpx.os_threads=all"};
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
@@ -0,0 +1,164 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/local/algorithm.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+constexpr std::size_t num_elements = 10007;
+
+// run a for_each on the given policy, returns the worker thread which has
+// processed each of the elements
+template <typename ExPolicy>
+std::vector<std::size_t> run_for_each(ExPolicy&& policy)
+{
+    std::vector<std::size_t> indices(num_elements);
+    std::iota(indices.begin(), indices.end(), std::size_t(0));
+
+    std::vector<std::size_t> workers(num_elements);
+    hpx::for_each(policy, indices.begin(), indices.end(),
+        [&](std::size_t i) { workers[i] = hpx::get_worker_thread_num(); });
+
+    return workers;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_replay()
+{
+    hpx::execution::experimental::chunk_affinity_executor<> exec;
+
+    // bound tasks are not stolen, the recorded placement is replayed exactly
+    auto bound_exec = hpx::execution::experimental::with_priority(
+        exec, hpx::threads::thread_priority::bound);
+
+    auto const chunk_size = hpx::execution::experimental::static_chunk_size(97);
+    std::vector<std::size_t> const recorded =
+        run_for_each(hpx::execution::par.on(exec).with(chunk_size));
+
+    for (int i = 0; i != 10; ++i)
+    {
+        HPX_TEST(recorded ==
+            run_for_each(hpx::execution::par.on(bound_exec).with(chunk_size)));
+    }
+
+    // asynchronous execution uses the same placements
+    {
+        std::vector<std::size_t> indices(num_elements);
+        std::iota(indices.begin(), indices.end(), std::size_t(0));
+
+        std::vector<std::size_t> workers(num_elements);
+        hpx::future<void> f = hpx::for_each(
+            hpx::execution::par(hpx::execution::task)
+                .on(bound_exec)
+                .with(chunk_size),
+            indices.begin(), indices.end(),
+            [&](std::size_t i) { workers[i] = hpx::get_worker_thread_num(); });
+        f.get();
+
+        HPX_TEST(recorded == workers);
+    }
+
+    // a different number of chunks records its own placement, the existing
+    // one is kept
+    auto const other_chunk_size =
+        hpx::execution::experimental::static_chunk_size(31);
+    std::vector<std::size_t> const other_recorded =
+        run_for_each(hpx::execution::par.on(exec).with(other_chunk_size));
+    HPX_TEST(other_recorded ==
+        run_for_each(
+            hpx::execution::par.on(bound_exec).with(other_chunk_size)));
+    HPX_TEST(recorded ==
+        run_for_each(hpx::execution::par.on(bound_exec).with(chunk_size)));
+}
+
+void test_reset()
+{
+    hpx::execution::experimental::chunk_affinity_executor<> exec;
+    auto bound_exec = hpx::execution::experimental::with_priority(
+        exec, hpx::threads::thread_priority::bound);
+
+    auto const chunk_size = hpx::execution::experimental::static_chunk_size(97);
+    run_for_each(hpx::execution::par.on(exec).with(chunk_size));
+
+    // after resetting, the placement of the next run is recorded anew
+    bound_exec.reset();
+
+    std::vector<std::size_t> const recorded =
+        run_for_each(hpx::execution::par.on(exec).with(chunk_size));
+    HPX_TEST(recorded ==
+        run_for_each(hpx::execution::par.on(bound_exec).with(chunk_size)));
+
+    // independent executors don't share their placements
+    hpx::execution::experimental::chunk_affinity_executor<> other_exec;
+    HPX_TEST(exec != other_exec);
+}
+
+void test_exceptions()
+{
+    hpx::execution::experimental::chunk_affinity_executor<> exec;
+
+    std::vector<std::size_t> indices(num_elements);
+    std::iota(indices.begin(), indices.end(), std::size_t(0));
+
+    for (int run = 0; run != 2; ++run)
+    {
+        bool caught_exception = false;
+        try
+        {
+            hpx::for_each(hpx::execution::par.on(exec), indices.begin(),
+                indices.end(), [](std::size_t i) {
+                    if (i == num_elements / 2)
+                    {
+                        throw std::runtime_error("test");
+                    }
+                });
+            HPX_TEST(false);
+        }
+        catch (hpx::exception_list const& e)
+        {
+            caught_exception = true;
+            HPX_TEST_EQ(e.size(), std::size_t(1));
+        }
+        catch (...)
+        {
+            HPX_TEST(false);
+        }
+        HPX_TEST(caught_exception);
+    }
+}
+
+int hpx_main()
+{
+    test_replay();
+    test_reset();
+    test_exceptions();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    // Initialize and run HPX
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
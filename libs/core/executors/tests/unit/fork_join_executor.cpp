@@ -16,6 +16,7 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <iterator>
 #include <numeric>
@@ -170,6 +171,200 @@ void test_bulk_async_exception(ExecutorArgs&&... args)
     HPX_TEST(caught_exception);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+template <typename... ExecutorArgs>
+void test_parallel_region(ExecutorArgs&&... args)
+{
+    std::cerr << "test_parallel_region\n";
+
+    std::size_t const n = 107;
+    std::size_t const steps = 100;
+    std::vector<std::size_t> v(n, 0);
+
+    fork_join_executor exec{std::forward<ExecutorArgs>(args)...};
+
+    std::atomic<std::size_t> entered(0);
+    std::size_t num_threads = 0;
+    exec.parallel_region(
+        [&](fork_join_executor::region_context& ctx, std::size_t increment) {
+            ++entered;
+            if (ctx.is_main_thread())
+            {
+                num_threads = ctx.num_threads();
+            }
+
+            for (std::size_t step = 0; step != steps; ++step)
+            {
+                ctx.bulk_sync_execute(
+                    [&](std::size_t i) { v[i] += increment; },
+                    hpx::util::counting_shape(n));
+
+                // all threads have to see the updates of all other threads
+                // after the loop
+                std::size_t local_sum = 0;
+                for (std::size_t i = 0; i != n; ++i)
+                {
+                    local_sum += v[i];
+                }
+                HPX_TEST_EQ(local_sum, (step + 1) * n * increment);
+
+                std::size_t const sum = ctx.reduce(
+                    ctx.thread_index() + 1, std::plus<std::size_t>());
+                HPX_TEST_EQ(sum,
+                    ctx.num_threads() * (ctx.num_threads() + 1) / 2);
+
+                HPX_TEST_EQ(ctx.broadcast(ctx.thread_index(), 0),
+                    static_cast<std::size_t>(0));
+            }
+        },
+        std::size_t(2));
+
+    HPX_TEST_EQ(entered.load(), num_threads);
+    for (std::size_t i = 0; i != n; ++i)
+    {
+        HPX_TEST_EQ(v[i], 2 * steps);
+    }
+
+    // the executor is still usable after a parallel region
+    count = 0;
+    hpx::parallel::execution::bulk_sync_execute(
+        exec, &bulk_test, hpx::util::counting_shape(int(n)), 42);
+    HPX_TEST_EQ(count.load(), n);
+}
+
+template <typename... ExecutorArgs>
+void test_parallel_region_exception(ExecutorArgs&&... args)
+{
+    std::cerr << "test_parallel_region_exception\n";
+
+    fork_join_executor exec{std::forward<ExecutorArgs>(args)...};
+
+    bool caught_exception = false;
+    try
+    {
+        // the other threads would wait forever in the barrier if the
+        // region was not cancelled
+        exec.parallel_region([](fork_join_executor::region_context& ctx) {
+            if (ctx.thread_index() == ctx.num_threads() - 1)
+            {
+                throw std::runtime_error("test");
+            }
+            ctx.barrier();
+        });
+
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const& /*e*/)
+    {
+        caught_exception = true;
+    }
+    catch (...)
+    {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+
+    // a new region can be started after a cancelled one
+    std::atomic<std::size_t> barriers_passed(0);
+    exec.parallel_region([&](fork_join_executor::region_context& ctx) {
+        ctx.barrier();
+        ++barriers_passed;
+        ctx.barrier();
+        HPX_TEST_EQ(barriers_passed.load(), ctx.num_threads());
+    });
+}
+
+// the values are combined in the order of the thread indices
+template <typename... ExecutorArgs>
+void test_parallel_region_reduce(ExecutorArgs&&... args)
+{
+    std::cerr << "test_parallel_region_reduce\n";
+
+    fork_join_executor exec{std::forward<ExecutorArgs>(args)...};
+
+    exec.parallel_region([](fork_join_executor::region_context& ctx) {
+        std::string expected;
+        for (std::size_t t = 0; t != ctx.num_threads(); ++t)
+        {
+            expected += std::to_string(t) + ",";
+        }
+
+        for (int i = 0; i != 10; ++i)
+        {
+            std::string const result =
+                ctx.reduce(std::to_string(ctx.thread_index()) + ",",
+                    std::plus<std::string>());
+            HPX_TEST_EQ(result, expected);
+        }
+
+        for (std::size_t root = 0; root != ctx.num_threads(); ++root)
+        {
+            HPX_TEST_EQ(ctx.broadcast(ctx.thread_index(), root), root);
+        }
+    });
+}
+
+// scheduling work on the executor from inside one of its parallel regions
+// is reported as an error
+template <typename... ExecutorArgs>
+void test_parallel_region_nested(ExecutorArgs&&... args)
+{
+    std::cerr << "test_parallel_region_nested\n";
+
+    fork_join_executor exec{std::forward<ExecutorArgs>(args)...};
+
+    auto nested_region = [&](fork_join_executor::region_context& ctx) {
+        if (ctx.is_main_thread())
+        {
+            exec.parallel_region([](fork_join_executor::region_context&) {});
+        }
+        ctx.barrier();
+    };
+
+    auto nested_loop = [&](fork_join_executor::region_context& ctx) {
+        if (ctx.is_main_thread())
+        {
+            hpx::parallel::execution::bulk_sync_execute(
+                exec, &bulk_test, hpx::util::counting_shape(10), 42);
+        }
+        ctx.barrier();
+    };
+
+    for (int i = 0; i != 2; ++i)
+    {
+        bool caught_exception = false;
+        try
+        {
+            if (i == 0)
+            {
+                exec.parallel_region(nested_region);
+            }
+            else
+            {
+                exec.parallel_region(nested_loop);
+            }
+            HPX_TEST(false);
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_TEST_EQ(e.get_error(), hpx::error::invalid_status);
+            caught_exception = true;
+        }
+        catch (...)
+        {
+            HPX_TEST(false);
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    // the executor is still usable afterwards
+    count = 0;
+    hpx::parallel::execution::bulk_sync_execute(
+        exec, &bulk_test, hpx::util::counting_shape(10), 42);
+    HPX_TEST_EQ(count.load(), std::size_t(10));
+}
+
 void static_check_executor()
 {
     using namespace hpx::traits;
@@ -192,6 +387,10 @@ void test_executor(hpx::threads::thread_priority priority,
     test_bulk_async(priority, stacksize, schedule);
     test_bulk_sync_exception(priority, stacksize, schedule);
     test_bulk_async_exception(priority, stacksize, schedule);
+    test_parallel_region(priority, stacksize, schedule);
+    test_parallel_region_exception(priority, stacksize, schedule);
+    test_parallel_region_reduce(priority, stacksize, schedule);
+    test_parallel_region_nested(priority, stacksize, schedule);
 
     test_processing_mask(priority, stacksize, schedule);
 }
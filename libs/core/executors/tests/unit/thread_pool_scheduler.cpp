@@ -1664,6 +1664,33 @@ void test_bulk()
         }
     }
 
+    // all executor parameters visit every element exactly once
+    for (auto const& chunking : {ex::bulk_chunking(),
+             ex::bulk_chunking(ex::static_chunk_size()),
+             ex::bulk_chunking(ex::static_chunk_size(3)),
+             ex::bulk_chunking(ex::guided_chunk_size()),
+             ex::bulk_chunking(ex::guided_chunk_size(4)),
+             ex::bulk_chunking(ex::dynamic_chunk_size(5)),
+             ex::bulk_chunking(ex::auto_chunk_size()),
+             ex::bulk_chunking(ex::auto_chunk_size(3))})
+    {
+        auto sched =
+            ex::with_bulk_chunking(ex::thread_pool_scheduler{}, chunking);
+        HPX_TEST(ex::get_bulk_chunking(sched) == chunking);
+
+        for (int n : {0, 1, 10, 43, 1000})
+        {
+            std::vector<std::atomic<int>> v(n);
+            ex::schedule(sched) | ex::bulk(n, [&](int i) { ++v[i]; }) |
+                tt::sync_wait();
+
+            for (int i = 0; i < n; ++i)
+            {
+                HPX_TEST_EQ(v[i].load(), 1);
+            }
+        }
+    }
+
     for (auto n : ns)
     {
         int i_fail = 3;
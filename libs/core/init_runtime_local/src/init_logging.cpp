@@ -13,12 +13,14 @@
 #include <hpx/runtime_local/get_locality_id.hpp>
 #include <hpx/runtime_local/get_worker_thread_num.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/util/get_entry_as.hpp>
 
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <iostream>
 #include <string>
+#include <string_view>
 
 #if defined(ANDROID) || defined(__ANDROID__)
 #include <android/log.h>
@@ -29,22 +31,54 @@ namespace hpx { namespace util {
 
     using logger_writer_type = logging::writer::named_write;
 
+    namespace {
+
+        // the custom formatters write their output either to a stream or,
+        // if the message is written by the asynchronous logging backend,
+        // into the binary record (see manipulator::capture)
+        template <typename... Ts>
+        void write_context(
+            std::ostream& to, std::string_view fmt, Ts const&... ts)
+        {
+            util::format_to(to, fmt, ts...);
+        }
+
+        template <typename... Ts>
+        void write_context(logging::detail::record_encoder& rec,
+            std::string_view fmt, Ts const&... ts)
+        {
+            rec.format(fmt, ts...);
+        }
+    }    // namespace
+
     ///////////////////////////////////////////////////////////////////////////
     // custom formatter: shepherd
     struct shepherd_thread_id : logging::formatter::manipulator
     {
         void operator()(std::ostream& to) const override
+        {
+            write(to);
+        }
+
+        void capture(logging::detail::record_encoder& rec) const override
+        {
+            write(rec);
+        }
+
+    private:
+        template <typename Out>
+        static void write(Out& to)
         {
             error_code ec(throwmode::lightweight);
             std::size_t thread_num = hpx::get_worker_thread_num(ec);
 
             if (std::size_t(-1) != thread_num)
             {
-                util::format_to(to, "{:016x}", thread_num);
+                write_context(to, "{:016x}", thread_num);
             }
             else
             {
-                to << std::string(16, '-');
+                write_context(to, "----------------");
             }
         }
     };
@@ -54,17 +88,29 @@ namespace hpx { namespace util {
     struct locality_prefix : logging::formatter::manipulator
     {
         void operator()(std::ostream& to) const override
+        {
+            write(to);
+        }
+
+        void capture(logging::detail::record_encoder& rec) const override
+        {
+            write(rec);
+        }
+
+    private:
+        template <typename Out>
+        static void write(Out& to)
         {
             std::uint32_t locality_id = hpx::get_locality_id();
 
             if (~static_cast<std::uint32_t>(0) != locality_id)
             {
-                util::format_to(to, "{:08x}", locality_id);
+                write_context(to, "{:08x}", locality_id);
             }
             else
             {
                 // called from outside a HPX thread
-                to << std::string(8, '-');
+                write_context(to, "--------");
             }
         }
     };
@@ -74,6 +120,18 @@ namespace hpx { namespace util {
     struct thread_id : logging::formatter::manipulator
     {
         void operator()(std::ostream& to) const override
+        {
+            write(to);
+        }
+
+        void capture(logging::detail::record_encoder& rec) const override
+        {
+            write(rec);
+        }
+
+    private:
+        template <typename Out>
+        static void write(Out& to)
         {
             threads::thread_self* self = threads::get_self_ptr();
             if (nullptr != self)
@@ -84,13 +142,13 @@ namespace hpx { namespace util {
                 {
                     std::ptrdiff_t value =
                         reinterpret_cast<std::ptrdiff_t>(id.get());
-                    util::format_to(to, "{:016x}", value);
+                    write_context(to, "{:016x}", value);
                     return;
                 }
             }
 
             // called from outside a HPX thread or invalid thread id
-            to << std::string(16, '-');
+            write_context(to, "----------------");
         }
     };
 
@@ -99,6 +157,18 @@ namespace hpx { namespace util {
     struct thread_phase : logging::formatter::manipulator
     {
         void operator()(std::ostream& to) const override
+        {
+            write(to);
+        }
+
+        void capture(logging::detail::record_encoder& rec) const override
+        {
+            write(rec);
+        }
+
+    private:
+        template <typename Out>
+        static void write(Out& to)
         {
             threads::thread_self* self = threads::get_self_ptr();
             if (nullptr != self)
@@ -107,13 +177,13 @@ namespace hpx { namespace util {
                 std::size_t phase = self->get_thread_phase();
                 if (0 != phase)
                 {
-                    util::format_to(to, "{:04x}", self->get_thread_phase());
+                    write_context(to, "{:04x}", phase);
                     return;
                 }
             }
 
             // called from outside a HPX thread or no phase given
-            to << std::string(4, '-');    //-V112
+            write_context(to, "----");
         }
     };
 
@@ -122,18 +192,30 @@ namespace hpx { namespace util {
     struct parent_thread_locality : logging::formatter::manipulator
     {
         void operator()(std::ostream& to) const override
+        {
+            write(to);
+        }
+
+        void capture(logging::detail::record_encoder& rec) const override
+        {
+            write(rec);
+        }
+
+    private:
+        template <typename Out>
+        static void write(Out& to)
         {
             std::uint32_t parent_locality_id =
                 threads::get_parent_locality_id();
             if (~static_cast<std::uint32_t>(0) != parent_locality_id)
             {
                 // called from inside a HPX thread
-                util::format_to(to, "{:08x}", parent_locality_id);
+                write_context(to, "{:08x}", parent_locality_id);
             }
             else
             {
                 // called from outside a HPX thread
-                to << std::string(8, '-');
+                write_context(to, "--------");
             }
         }
     };
@@ -143,6 +225,18 @@ namespace hpx { namespace util {
     struct parent_thread_id : logging::formatter::manipulator
     {
         void operator()(std::ostream& to) const override
+        {
+            write(to);
+        }
+
+        void capture(logging::detail::record_encoder& rec) const override
+        {
+            write(rec);
+        }
+
+    private:
+        template <typename Out>
+        static void write(Out& to)
         {
             threads::thread_id_type parent_id = threads::get_parent_id();
             if (nullptr != parent_id)
@@ -150,12 +244,12 @@ namespace hpx { namespace util {
                 // called from inside a HPX thread
                 std::ptrdiff_t value =
                     reinterpret_cast<std::ptrdiff_t>(parent_id.get());
-                util::format_to(to, "{:016x}", value);
+                write_context(to, "{:016x}", value);
             }
             else
             {
                 // called from outside a HPX thread
-                to << std::string(16, '-');
+                write_context(to, "----------------");
             }
         }
     };
@@ -165,17 +259,29 @@ namespace hpx { namespace util {
     struct parent_thread_phase : logging::formatter::manipulator
     {
         void operator()(std::ostream& to) const override
+        {
+            write(to);
+        }
+
+        void capture(logging::detail::record_encoder& rec) const override
+        {
+            write(rec);
+        }
+
+    private:
+        template <typename Out>
+        static void write(Out& to)
         {
             std::size_t parent_phase = threads::get_parent_phase();
             if (0 != parent_phase)
             {
                 // called from inside a HPX thread
-                util::format_to(to, "{:04x}", parent_phase);
+                write_context(to, "{:04x}", parent_phase);
             }
             else
             {
                 // called from outside a HPX thread
-                to << std::string(4, '-');    //-V112
+                write_context(to, "----");
             }
         }
     };
@@ -946,6 +1052,21 @@ namespace hpx { namespace util {
             init_debuglog_log(
                 ini, isconsole, set_console_dest, define_formatters);
 
+            // hand the normal logs over to the asynchronous backend, if
+            // requested (console logs are always written synchronously)
+            if (get_entry_as<int>(ini, "hpx.logging.async", 0) != 0)
+            {
+                logging::enable_async_logging(get_entry_as<std::size_t>(
+                    ini, "hpx.logging.async_buffer_size", 1048576));
+
+                agas_logger()->set_async(true);
+                parcel_logger()->set_async(true);
+                timing_logger()->set_async(true);
+                hpx_logger()->set_async(true);
+                app_logger()->set_async(true);
+                debuglog_logger()->set_async(true);
+            }
+
             // initialize console logs
             init_agas_console_log(ini);
             init_parcel_console_log(ini);
@@ -29,6 +29,7 @@
 #include <hpx/program_options/parsers.hpp>
 #include <hpx/program_options/variables_map.hpp>
 #include <hpx/resource_partitioner/partitioner.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
 #include <hpx/runtime_local/config_entry.hpp>
 #include <hpx/runtime_local/custom_exception_info.hpp>
 #include <hpx/runtime_local/debugging.hpp>
@@ -42,6 +43,7 @@
 #include <hpx/string_util/split.hpp>
 #include <hpx/threading/thread.hpp>
 #include <hpx/threading_base/detail/get_default_timer_service.hpp>
+#include <hpx/topology/topology.hpp>
 #include <hpx/type_support/pack.hpp>
 #include <hpx/type_support/unused.hpp>
 #include <hpx/util/from_string.hpp>
@@ -54,6 +56,7 @@
 #include <cstddef>
 #include <exception>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -437,6 +440,7 @@ namespace hpx {
                     hpx::program_options::variables_map& vm)> const& f,
                 int argc, char** argv, init_params const& params, bool blocking)
             {
+                hpx::util::reset_startup_timings();
                 init_environment();
 
                 int result = 0;
@@ -447,10 +451,19 @@ namespace hpx {
                         return result;
                     }
 
+                    // discover the hardware topology while the configuration
+                    // is being read, errors will be reported when the
+                    // topology is used below
+                    auto topology_discovery =
+                        std::async(std::launch::async, []() {
+                            hpx::threads::create_topology();
+                        });
+
                     hpx::local::detail::command_line_handling cmdline{
                         hpx::util::runtime_configuration(
                             argv[0], hpx::runtime_mode::local),
                         params.cfg, f};
+                    hpx::util::record_startup_phase("runtime configuration");
 
                     // scope exception handling to resource partitioner initialization
                     // any exception thrown during run_or_start below are handled
@@ -458,6 +471,11 @@ namespace hpx {
                     try
                     {
                         result = cmdline.call(params.desc_cmdline, argc, argv);
+                        hpx::util::record_startup_phase(
+                            "command line handling");
+
+                        topology_discovery.wait();
+                        hpx::util::record_startup_phase("topology discovery");
 
                         hpx::threads::policies::detail::affinity_data
                             affinity_data{};
@@ -499,6 +517,7 @@ namespace hpx {
 
                         // Setup all internal parameters of the resource_partitioner
                         rp.configure_pools();
+                        hpx::util::record_startup_phase("resource partitioner");
                     }
                     catch (hpx::exception const& e)
                     {
@@ -516,6 +535,7 @@ namespace hpx {
                     // Command line handling should have updated this by now.
                     LPROGRESS_ << "creating local runtime";
                     rt.reset(new hpx::runtime(cmdline.rtcfg_, true));
+                    hpx::util::record_startup_phase("runtime construction");
 
                     result = run_or_start(blocking, HPX_MOVE(rt), cmdline,
                         HPX_MOVE(params.startup), HPX_MOVE(params.shutdown));
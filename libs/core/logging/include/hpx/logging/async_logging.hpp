@@ -0,0 +1,43 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::util::logging {
+
+    /// Start the asynchronous logging backend. Messages of all loggers marked
+    /// with logger::set_async are encoded into binary records which are
+    /// pushed into a ring buffer of buffer_size bytes owned by the calling OS
+    /// thread. A background thread formats the records and writes them to
+    /// the destinations of their logger in batches, at the latest after
+    /// flush_interval has passed. Records are dropped if the ring buffer of
+    /// a thread is full.
+    HPX_CORE_EXPORT void enable_async_logging(std::size_t buffer_size,
+        std::chrono::milliseconds flush_interval =
+            std::chrono::milliseconds(10));
+
+    /// Write all pending records and stop the background thread, all
+    /// messages are written synchronously afterwards.
+    HPX_CORE_EXPORT void disable_async_logging();
+
+    HPX_CORE_EXPORT bool is_async_logging_enabled() noexcept;
+
+    /// Wait for all records pushed before this call to be written.
+    HPX_CORE_EXPORT void flush_async_logging();
+
+    /// Return the number of records written by the background thread.
+    HPX_CORE_EXPORT std::uint64_t get_async_logging_written(bool reset);
+
+    /// Return the number of records dropped because the ring buffer of the
+    /// logging thread was full.
+    HPX_CORE_EXPORT std::uint64_t get_async_logging_dropped(bool reset);
+}    // namespace hpx::util::logging
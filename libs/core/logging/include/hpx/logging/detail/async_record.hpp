@@ -0,0 +1,287 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/logging/level.hpp>
+#include <hpx/modules/format.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace hpx::util::logging {
+
+    class logger;
+
+    namespace formatter {
+
+        struct manipulator;
+    }    // namespace formatter
+}    // namespace hpx::util::logging
+
+namespace hpx::util::logging::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The items a binary log record is composed of. Each item is stored as
+    // its tag followed by its (unaligned) payload.
+    enum class record_item : std::uint8_t
+    {
+        format = 0,        // length, format string, number of arguments
+        boolean = 1,
+        character = 2,
+        int32 = 3,
+        int64 = 4,
+        uint32 = 5,
+        uint64 = 6,
+        floating_point = 7,
+        pointer = 8,
+        string = 9,        // length, characters (zero terminated)
+        log_level = 10,
+        ostream_manipulator = 11,
+        ios_manipulator = 12,
+        formatter = 13    // formatter, value to pass to format_captured
+    };
+
+    // format() calls with more arguments are formatted immediately
+    inline constexpr std::size_t max_record_format_args = 16;
+
+    using ostream_manipulator_type = std::ostream& (*) (std::ostream&);
+    using ios_manipulator_type = std::ios_base& (*) (std::ios_base&);
+
+    template <typename T>
+    inline constexpr bool is_record_encodable_v =
+        std::is_same_v<T, bool> || std::is_same_v<T, char> ||
+        (std::is_integral_v<T> && sizeof(T) > 1 && sizeof(T) <= 8) ||
+        std::is_same_v<T, float> || std::is_same_v<T, double> ||
+        std::is_same_v<T, level> ||
+        std::is_convertible_v<T const&, std::string_view> ||
+        std::is_same_v<T, ostream_manipulator_type> ||
+        std::is_same_v<T, ios_manipulator_type> ||
+        (std::is_pointer_v<T> &&
+            !std::is_function_v<std::remove_pointer_t<T>>);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Encodes the parts of a log message into a binary record, the record is
+    // turned into text only once it is written by the background thread of
+    // the asynchronous logging backend. Values of types which can't be
+    // encoded are formatted right away and stored as text.
+    class record_encoder
+    {
+    public:
+        explicit record_encoder(std::vector<char>& data) noexcept
+          : data_(data)
+        {
+        }
+
+        record_encoder(record_encoder const&) = delete;
+        record_encoder& operator=(record_encoder const&) = delete;
+
+        template <typename... Args>
+        void format(std::string_view format_str, Args const&... args)
+        {
+            if constexpr ((is_record_encodable_v<Args> && ...) &&
+                sizeof...(Args) <= max_record_format_args)
+            {
+                put(record_item::format);
+                put_value(static_cast<std::uint32_t>(format_str.size()));
+                put_bytes(format_str.data(), format_str.size());
+                put_value(static_cast<std::uint8_t>(sizeof...(Args)));
+                (encode(args), ...);
+            }
+            else
+            {
+                std::ostringstream& strm = scratch_stream();
+                util::format_to(strm, format_str, args...);
+                put_string(strm.str());
+            }
+        }
+
+        template <typename T>
+        void stream(T const& value)
+        {
+            if constexpr (is_record_encodable_v<T>)
+            {
+                encode(value);
+            }
+            else
+            {
+                std::ostringstream& strm = scratch_stream();
+                strm << value;
+                put_string(strm.str());
+            }
+        }
+
+        void stream(ostream_manipulator_type value)
+        {
+            encode(value);
+        }
+
+        void stream(ios_manipulator_type value)
+        {
+            encode(value);
+        }
+
+        bool empty() const noexcept
+        {
+            return data_.size() == start_;
+        }
+
+        // marks the end of the record header
+        void start_items() noexcept
+        {
+            start_ = data_.size();
+        }
+
+        template <typename T>
+        void put_value(T const& value)
+        {
+            put_bytes(&value, sizeof(T));
+        }
+
+        void put_bytes(void const* p, std::size_t size)
+        {
+            char const* begin = static_cast<char const*>(p);
+            data_.insert(data_.end(), begin, begin + size);
+        }
+
+        void put_string(std::string_view value)
+        {
+            put(record_item::string);
+            put_value(static_cast<std::uint32_t>(value.size()));
+            put_bytes(value.data(), value.size());
+            data_.push_back('\0');
+        }
+
+        // the value is turned into text by calling fmt->format_captured,
+        // the formatter has to be kept alive until the record is written
+        // (just like the logger the record belongs to)
+        void put_formatter(
+            formatter::manipulator const* fmt, std::int64_t value)
+        {
+            put(record_item::formatter);
+            put_value(fmt);
+            put_value(value);
+        }
+
+    private:
+        void put(record_item item)
+        {
+            data_.push_back(static_cast<char>(item));
+        }
+
+        template <typename T>
+        void encode(T const& value)
+        {
+            if constexpr (std::is_same_v<T, bool>)
+            {
+                put(record_item::boolean);
+                put_value(static_cast<std::uint8_t>(value));
+            }
+            else if constexpr (std::is_same_v<T, char>)
+            {
+                put(record_item::character);
+                put_value(value);
+            }
+            else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+            {
+                if constexpr (sizeof(T) <= 4)
+                {
+                    put(record_item::int32);
+                    put_value(static_cast<std::int32_t>(value));
+                }
+                else
+                {
+                    put(record_item::int64);
+                    put_value(static_cast<std::int64_t>(value));
+                }
+            }
+            else if constexpr (std::is_integral_v<T>)
+            {
+                if constexpr (sizeof(T) <= 4)
+                {
+                    put(record_item::uint32);
+                    put_value(static_cast<std::uint32_t>(value));
+                }
+                else
+                {
+                    put(record_item::uint64);
+                    put_value(static_cast<std::uint64_t>(value));
+                }
+            }
+            else if constexpr (std::is_floating_point_v<T>)
+            {
+                put(record_item::floating_point);
+                put_value(static_cast<double>(value));
+            }
+            else if constexpr (std::is_same_v<T, level>)
+            {
+                put(record_item::log_level);
+                put_value(static_cast<unsigned int>(value));
+            }
+            else if constexpr (std::is_same_v<T, ostream_manipulator_type>)
+            {
+                put(record_item::ostream_manipulator);
+                put_value(value);
+            }
+            else if constexpr (std::is_same_v<T, ios_manipulator_type>)
+            {
+                put(record_item::ios_manipulator);
+                put_value(value);
+            }
+            else if constexpr (std::is_convertible_v<T const&,
+                                   std::string_view>)
+            {
+                if constexpr (std::is_pointer_v<T>)
+                {
+                    put_string(value != nullptr ? std::string_view(value) :
+                                                  std::string_view("(null)"));
+                }
+                else
+                {
+                    put_string(std::string_view(value));
+                }
+            }
+            else
+            {
+                static_assert(std::is_pointer_v<T>);
+                put(record_item::pointer);
+                put_value(static_cast<void const*>(value));
+            }
+        }
+
+        static std::ostringstream& scratch_stream()
+        {
+            thread_local std::ostringstream strm;
+            strm.str(std::string());
+            strm.clear();
+            return strm;
+        }
+
+        std::vector<char>& data_;
+        std::size_t start_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Start a binary record for the given logger on the calling OS thread,
+    // returns nullptr if the message has to be written synchronously.
+    HPX_CORE_EXPORT record_encoder* begin_async_record(logger& l);
+
+    // Hand the record over to the background thread.
+    HPX_CORE_EXPORT void end_async_record(record_encoder* rec) noexcept;
+
+    // Turn the items of a binary record into text.
+    HPX_CORE_EXPORT void format_record_items(
+        std::ostream& os, char const* data, std::size_t size);
+}    // namespace hpx::util::logging::detail
@@ -17,10 +17,14 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/logging/detail/async_record.hpp>
 #include <hpx/logging/format/named_write.hpp>
 #include <hpx/logging/level.hpp>
+#include <hpx/logging/message.hpp>
 #include <hpx/modules/format.hpp>
 
+#include <optional>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -81,23 +85,71 @@ namespace hpx::util::logging {
     {
         HPX_NON_COPYABLE(logger);
 
-        struct gather_holder : message
+        struct gather_holder
         {    //-V690
             HPX_NON_COPYABLE(gather_holder);
 
             gather_holder(logger& p_this)
               : m_this(p_this)
+              , m_record(p_this.m_is_async ?
+                        detail::begin_async_record(p_this) :
+                        nullptr)
             {
+                if (m_record == nullptr)
+                    m_msg.emplace();
             }
 
             ~gather_holder()
             {
-                if (!empty())
-                    m_this.write(HPX_MOVE(*this));
+                if (m_record != nullptr)
+                    detail::end_async_record(m_record);
+                else if (!m_msg->empty())
+                    m_this.write(HPX_MOVE(*m_msg));
+            }
+
+            template <typename T>
+            gather_holder& operator<<(T&& v)
+            {
+                if (m_record != nullptr)
+                    m_record->stream(v);
+                else
+                    *m_msg << HPX_FORWARD(T, v);
+                return *this;
+            }
+
+            gather_holder& operator<<(detail::ostream_manipulator_type v)
+            {
+                if (m_record != nullptr)
+                    m_record->stream(v);
+                else
+                    *m_msg << v;
+                return *this;
+            }
+
+            gather_holder& operator<<(detail::ios_manipulator_type v)
+            {
+                if (m_record != nullptr)
+                    m_record->stream(v);
+                else
+                    *m_msg << v;
+                return *this;
+            }
+
+            template <typename... Args>
+            gather_holder& format(
+                std::string_view format_str, Args const&... args)
+            {
+                if (m_record != nullptr)
+                    m_record->format(format_str, args...);
+                else
+                    m_msg->format(format_str, args...);
+                return *this;
             }
 
         private:
             logger& m_this;
+            detail::record_encoder* m_record;
+            std::optional<message> m_msg;
         };
 
     public:
@@ -144,6 +196,19 @@ namespace hpx::util::logging {
             m_level = level;
         }
 
+        /// Hand all messages over to the asynchronous logging backend (see
+        /// enable_async_logging) instead of writing them on the calling
+        /// thread. This has an effect only while the backend is running.
+        void set_async(bool async) noexcept
+        {
+            m_is_async = async;
+        }
+
+        bool is_async() const noexcept
+        {
+            return m_is_async;
+        }
+
         /** @brief Marks this logger as initialized
 
         You might log messages before the logger is initialized.
@@ -180,6 +245,7 @@ namespace hpx::util::logging {
     private:
         mutable std::vector<message> m_cache;
         mutable bool m_is_caching_off = false;
+        bool m_is_async = false;
         writer::named_write m_writer;
         level m_level;
     };
@@ -17,11 +17,13 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/logging/detail/async_record.hpp>
 #include <hpx/logging/format/destinations.hpp>
 #include <hpx/logging/format/formatters.hpp>
 
 #include <cstddef>
 #include <memory>
+#include <ostream>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -139,6 +141,36 @@ You could have an output like this:
             }
         }
 
+        // captures everything preceding the message into prefix and
+        // everything following it into suffix (see manipulator::capture),
+        // returns whether the message itself is part of the output
+        bool capture_context(
+            record_encoder& prefix, record_encoder& suffix) const
+        {
+            record_encoder* out = &prefix;
+            bool has_message = false;
+            for (auto const& step : write_steps)
+            {
+                if (!step.prefix.empty())
+                {
+                    out->put_string(step.prefix);
+                }
+                if (step.fmt)
+                {
+                    if (step.fmt == (formatter::manipulator*) -1)
+                    {
+                        out = &suffix;
+                        has_message = true;
+                    }
+                    else
+                    {
+                        step.fmt->capture(*out);
+                    }
+                }
+            }
+            return has_message;
+        }
+
     private:
         // recomputes the write steps - note that this takes place after
         // each operation for instance, the user might have first set the
@@ -404,6 +436,23 @@ namespace hpx::util::logging::writer {
 #endif
         }
 
+        /** @brief Captures the context of a message (see
+            named_formatters::capture_context)
+         */
+        bool capture_context(detail::record_encoder& prefix,
+            detail::record_encoder& suffix) const
+        {
+            return m_format.capture_context(prefix, suffix);
+        }
+
+        /** @brief Writes an already formatted message to all destinations,
+            bypassing the formatters
+         */
+        void write_formatted(message const& msg) const
+        {
+            m_destination(msg);
+        }
+
         /** @brief Replaces a formatter from the named formatter.
 
             You can use this, for instance, when you want to share
@@ -20,12 +20,18 @@
 #include <hpx/logging/message.hpp>
 #include <hpx/modules/format.hpp>
 
+#include <cstdint>
 #include <iosfwd>
 #include <string>
 #include <string_view>
 
 namespace hpx::util::logging {
 
+    namespace detail {
+
+        class record_encoder;
+    }    // namespace detail
+
     /// @brief Formatter is a manipulator.
     /// It allows you to format the message before writing it to the destination(s)
     ///
@@ -52,6 +58,22 @@ namespace hpx::util::logging {
             /// That is, this allows configuration of your manipulator at run-time.
             virtual void configure(std::string const&) {}
 
+            /// @brief Override this if the output of your formatter depends on
+            /// the thread the message is logged from.
+            ///
+            /// Used instead of operator() for messages written by the
+            /// asynchronous logging backend. It is called on the logging
+            /// thread and stores the values the output depends on into the
+            /// binary record, the record is turned into text by the
+            /// background thread. By default, the output of operator() is
+            /// stored.
+            virtual void capture(detail::record_encoder& rec) const;
+
+            /// @brief Writes a value stored by capture using
+            /// record_encoder::put_formatter, called by the background thread
+            /// of the asynchronous logging backend.
+            virtual void format_captured(std::ostream&, std::int64_t) const {}
+
             virtual ~manipulator();
 
         protected:
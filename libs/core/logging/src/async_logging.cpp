@@ -0,0 +1,862 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_LOGGING)
+#include <hpx/assert.hpp>
+#include <hpx/logging/async_logging.hpp>
+#include <hpx/logging/detail/async_record.hpp>
+#include <hpx/logging/detail/logger.hpp>
+#include <hpx/logging/level.hpp>
+#include <hpx/logging/manipulator.hpp>
+#include <hpx/logging/message.hpp>
+#include <hpx/modules/format.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace hpx::util::logging {
+
+    namespace {
+
+        ///////////////////////////////////////////////////////////////////////
+        // A single-producer single-consumer ring buffer of variable sized
+        // records. Every record is preceded by its size, records never wrap
+        // around the end of the buffer.
+        class record_ring
+        {
+            static constexpr std::size_t header_size = sizeof(std::uint64_t);
+            static constexpr std::uint32_t wrap_marker = ~0u;
+
+            static constexpr std::size_t aligned(std::size_t size) noexcept
+            {
+                return (size + header_size - 1) & ~(header_size - 1);
+            }
+
+        public:
+            explicit record_ring(std::size_t capacity)
+              : buffer_(new char[capacity])
+              , capacity_(capacity)
+              , head_(0)
+              , tail_(0)
+              , dropped_(0)
+              , orphaned_(false)
+            {
+                HPX_ASSERT((capacity & (capacity - 1)) == 0);
+            }
+
+            // called by the owning thread only
+            bool push(char const* data, std::size_t size) noexcept
+            {
+                std::size_t const total = aligned(header_size + size);
+                std::uint64_t head = head_.load(std::memory_order_relaxed);
+                std::uint64_t const tail =
+                    tail_.load(std::memory_order_acquire);
+
+                std::size_t offset = head & (capacity_ - 1);
+                std::size_t const contiguous = capacity_ - offset;
+                std::size_t const needed =
+                    contiguous < total ? total + contiguous : total;
+
+                if (head - tail + needed > capacity_)
+                {
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                }
+
+                if (contiguous < total)
+                {
+                    // skip the remainder of the buffer
+                    write_size(offset, wrap_marker);
+                    head += contiguous;
+                    offset = 0;
+                }
+
+                write_size(offset, static_cast<std::uint32_t>(size));
+                std::memcpy(&buffer_[offset + header_size], data, size);
+                head_.store(head + total, std::memory_order_release);
+                return true;
+            }
+
+            // called by the background thread only
+            template <typename F>
+            std::size_t pop_all(F&& f)
+            {
+                std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+                std::uint64_t const head =
+                    head_.load(std::memory_order_acquire);
+
+                std::size_t count = 0;
+                while (tail != head)
+                {
+                    std::size_t const offset = tail & (capacity_ - 1);
+                    std::uint32_t const size = read_size(offset);
+                    if (size == wrap_marker)
+                    {
+                        tail += capacity_ - offset;
+                        continue;
+                    }
+
+                    f(&buffer_[offset + header_size], std::size_t(size));
+                    tail += aligned(header_size + size);
+                    ++count;
+                }
+
+                tail_.store(tail, std::memory_order_release);
+                return count;
+            }
+
+            bool empty() const noexcept
+            {
+                return head_.load(std::memory_order_acquire) ==
+                    tail_.load(std::memory_order_relaxed);
+            }
+
+            std::uint64_t dropped() const noexcept
+            {
+                return dropped_.load(std::memory_order_relaxed);
+            }
+
+            // set once the owning thread has exited
+            std::atomic<bool>& orphaned() noexcept
+            {
+                return orphaned_;
+            }
+
+            // number of dropped records already reported to the log
+            std::uint64_t reported_ = 0;
+
+        private:
+            void write_size(std::size_t offset, std::uint32_t size) noexcept
+            {
+                std::memcpy(&buffer_[offset], &size, sizeof(size));
+            }
+
+            std::uint32_t read_size(std::size_t offset) const noexcept
+            {
+                std::uint32_t size = 0;
+                std::memcpy(&size, &buffer_[offset], sizeof(size));
+                return size;
+            }
+
+            std::unique_ptr<char[]> buffer_;
+            std::size_t const capacity_;
+
+            alignas(64) std::atomic<std::uint64_t> head_;
+            alignas(64) std::atomic<std::uint64_t> tail_;
+            alignas(64) std::atomic<std::uint64_t> dropped_;
+            std::atomic<bool> orphaned_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // A record which was turned into text, waiting to be written.
+        struct formatted_record
+        {
+            std::int64_t timestamp_;
+            logger* logger_;
+            std::string text_;
+        };
+
+        template <typename T>
+        char const* get_value(char const* p, T& value) noexcept
+        {
+            std::memcpy(&value, p, sizeof(T));
+            return p + sizeof(T);
+        }
+
+        // every item of a format call is decoded into one of these
+        struct decoded_arg
+        {
+            union
+            {
+                bool b;
+                char c;
+                std::int32_t i32;
+                std::int64_t i64;
+                std::uint32_t u32;
+                std::uint64_t u64;
+                double d;
+                void const* ptr;
+                char const* str;
+                level lvl;
+            };
+        };
+
+        char const* decode_arg(char const* p, decoded_arg& arg,
+            util::detail::format_arg& fmt_arg) noexcept
+        {
+            std::uint32_t len = 0;
+            switch (static_cast<detail::record_item>(*p++))
+            {
+            case detail::record_item::boolean:
+            {
+                std::uint8_t value = 0;
+                p = get_value(p, value);
+                arg.b = value != 0;
+                fmt_arg = util::detail::format_arg(arg.b);
+                break;
+            }
+            case detail::record_item::character:
+                p = get_value(p, arg.c);
+                fmt_arg = util::detail::format_arg(arg.c);
+                break;
+            case detail::record_item::int32:
+                p = get_value(p, arg.i32);
+                fmt_arg = util::detail::format_arg(arg.i32);
+                break;
+            case detail::record_item::int64:
+                p = get_value(p, arg.i64);
+                fmt_arg = util::detail::format_arg(arg.i64);
+                break;
+            case detail::record_item::uint32:
+                p = get_value(p, arg.u32);
+                fmt_arg = util::detail::format_arg(arg.u32);
+                break;
+            case detail::record_item::uint64:
+                p = get_value(p, arg.u64);
+                fmt_arg = util::detail::format_arg(arg.u64);
+                break;
+            case detail::record_item::floating_point:
+                p = get_value(p, arg.d);
+                fmt_arg = util::detail::format_arg(arg.d);
+                break;
+            case detail::record_item::pointer:
+                p = get_value(p, arg.ptr);
+                fmt_arg = util::detail::format_arg(arg.ptr);
+                break;
+            case detail::record_item::string:
+                p = get_value(p, len);
+                arg.str = p;
+                fmt_arg = util::detail::format_arg(arg.str);
+                p += len + 1;
+                break;
+            case detail::record_item::log_level:
+            {
+                unsigned int value = 0;
+                p = get_value(p, value);
+                arg.lvl = static_cast<level>(value);
+                fmt_arg = util::detail::format_arg(arg.lvl);
+                break;
+            }
+            default:
+                // manipulators and nested format calls are never used as
+                // arguments
+                HPX_ASSERT(false);
+                break;
+            }
+            return p;
+        }
+
+        char const* format_item(std::ostream& os, char const* p)
+        {
+            std::uint32_t len = 0;
+            switch (static_cast<detail::record_item>(*p++))
+            {
+            case detail::record_item::format:
+            {
+                p = get_value(p, len);
+                std::string_view const format_str(p, len);
+                p += len;
+
+                std::uint8_t count = 0;
+                p = get_value(p, count);
+
+                decoded_arg args[detail::max_record_format_args];
+                util::detail::format_arg
+                    fmt_args[detail::max_record_format_args + 1];
+                for (std::uint8_t i = 0; i != count; ++i)
+                {
+                    p = decode_arg(p, args[i], fmt_args[i]);
+                }
+                util::detail::format_to(os, format_str, fmt_args, count);
+                break;
+            }
+            case detail::record_item::boolean:
+            {
+                std::uint8_t value = 0;
+                p = get_value(p, value);
+                os << (value != 0);
+                break;
+            }
+            case detail::record_item::character:
+            {
+                char value = 0;
+                p = get_value(p, value);
+                os << value;
+                break;
+            }
+            case detail::record_item::int32:
+            {
+                std::int32_t value = 0;
+                p = get_value(p, value);
+                os << value;
+                break;
+            }
+            case detail::record_item::int64:
+            {
+                std::int64_t value = 0;
+                p = get_value(p, value);
+                os << value;
+                break;
+            }
+            case detail::record_item::uint32:
+            {
+                std::uint32_t value = 0;
+                p = get_value(p, value);
+                os << value;
+                break;
+            }
+            case detail::record_item::uint64:
+            {
+                std::uint64_t value = 0;
+                p = get_value(p, value);
+                os << value;
+                break;
+            }
+            case detail::record_item::floating_point:
+            {
+                double value = 0;
+                p = get_value(p, value);
+                os << value;
+                break;
+            }
+            case detail::record_item::pointer:
+            {
+                void const* value = nullptr;
+                p = get_value(p, value);
+                os << value;
+                break;
+            }
+            case detail::record_item::string:
+                p = get_value(p, len);
+                os.write(p, len);
+                p += len + 1;
+                break;
+            case detail::record_item::log_level:
+            {
+                unsigned int value = 0;
+                p = get_value(p, value);
+                format_value(os, "", static_cast<level>(value));
+                break;
+            }
+            case detail::record_item::ostream_manipulator:
+            {
+                detail::ostream_manipulator_type value = nullptr;
+                p = get_value(p, value);
+                value(os);
+                break;
+            }
+            case detail::record_item::ios_manipulator:
+            {
+                detail::ios_manipulator_type value = nullptr;
+                p = get_value(p, value);
+                value(os);
+                break;
+            }
+            case detail::record_item::formatter:
+            {
+                formatter::manipulator const* fmt = nullptr;
+                std::int64_t value = 0;
+                p = get_value(p, fmt);
+                p = get_value(p, value);
+                fmt->format_captured(os, value);
+                break;
+            }
+            default:
+                HPX_ASSERT(false);
+                break;
+            }
+            return p;
+        }
+
+        // the context of a message is stored as its size followed by the
+        // items it is composed of
+        char const* format_context(std::ostream& os, char const* p)
+        {
+            std::uint32_t size = 0;
+            p = get_value(p, size);
+            detail::format_record_items(os, p, size);
+            return p + size;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        class async_backend
+        {
+        public:
+            async_backend() = default;
+
+            async_backend(async_backend const&) = delete;
+            async_backend& operator=(async_backend const&) = delete;
+
+            ~async_backend()
+            {
+                stop();
+            }
+
+            void start(std::size_t buffer_size,
+                std::chrono::milliseconds flush_interval)
+            {
+                std::lock_guard<std::mutex> l(mtx_);
+                if (running_.load(std::memory_order_relaxed))
+                {
+                    return;
+                }
+
+                // the ring buffers have a size which is a power of two
+                std::size_t capacity = 4096;
+                while (capacity < buffer_size)
+                {
+                    capacity *= 2;
+                }
+
+                buffer_size_ = capacity;
+                flush_interval_ = flush_interval;
+                stop_requested_ = false;
+                generation_.fetch_add(1, std::memory_order_relaxed);
+
+                thread_ = std::thread(&async_backend::run, this);
+                running_.store(true, std::memory_order_release);
+            }
+
+            void stop()
+            {
+                {
+                    std::lock_guard<std::mutex> l(mtx_);
+                    if (!running_.load(std::memory_order_relaxed))
+                    {
+                        return;
+                    }
+
+                    running_.store(false, std::memory_order_relaxed);
+                    stop_requested_ = true;
+                }
+
+                cond_.notify_all();
+                if (thread_.get_id() != std::this_thread::get_id())
+                {
+                    thread_.join();
+                }
+                else
+                {
+                    thread_.detach();
+                }
+
+                std::lock_guard<std::mutex> l(rings_mtx_);
+                for (auto const& ring : rings_)
+                {
+                    dropped_retired_ += ring->dropped();
+                }
+                rings_.clear();
+            }
+
+            bool is_running() const noexcept
+            {
+                return running_.load(std::memory_order_acquire);
+            }
+
+            std::uint64_t generation() const noexcept
+            {
+                return generation_.load(std::memory_order_relaxed);
+            }
+
+            std::shared_ptr<record_ring> create_ring()
+            {
+                auto ring = std::make_shared<record_ring>(buffer_size_);
+
+                std::lock_guard<std::mutex> l(rings_mtx_);
+                rings_.push_back(ring);
+                return ring;
+            }
+
+            void flush()
+            {
+                std::unique_lock<std::mutex> l(mtx_);
+                if (!running_.load(std::memory_order_relaxed) ||
+                    thread_.get_id() == std::this_thread::get_id())
+                {
+                    return;
+                }
+
+                std::uint64_t const request = ++flush_requested_;
+                cond_.notify_all();
+                cond_.wait(l, [&] {
+                    return flush_completed_ >= request || stop_requested_;
+                });
+            }
+
+            std::uint64_t written(bool reset) noexcept
+            {
+                return reset ? written_.exchange(0, std::memory_order_relaxed) :
+                               written_.load(std::memory_order_relaxed);
+            }
+
+            std::uint64_t dropped(bool reset)
+            {
+                std::lock_guard<std::mutex> l(rings_mtx_);
+
+                std::uint64_t total = dropped_retired_;
+                for (auto const& ring : rings_)
+                {
+                    total += ring->dropped();
+                }
+
+                std::uint64_t const result = total - dropped_base_;
+                if (reset)
+                {
+                    dropped_base_ = total;
+                }
+                return result;
+            }
+
+        private:
+            void run()
+            {
+                std::unique_lock<std::mutex> l(mtx_);
+                while (!stop_requested_)
+                {
+                    std::uint64_t const request = flush_requested_;
+
+                    l.unlock();
+                    write_pending();
+                    l.lock();
+
+                    flush_completed_ = request;
+                    cond_.notify_all();
+
+                    if (!stop_requested_ && flush_requested_ == request)
+                    {
+                        cond_.wait_for(l, flush_interval_);
+                    }
+                }
+
+                // write everything which was logged before stopping
+                l.unlock();
+                write_pending();
+                l.lock();
+
+                flush_completed_ = flush_requested_;
+                cond_.notify_all();
+            }
+
+            void format_record(char const* data, std::size_t size)
+            {
+                char const* const end = data + size;
+
+                formatted_record rec;
+                data = get_value(data, rec.logger_);
+                data = get_value(data, rec.timestamp_);
+
+                std::uint8_t has_message = 0;
+                data = get_value(data, has_message);
+
+                strm_.str(std::string());
+                strm_.clear();
+
+                data = format_context(strm_, data);
+
+                suffix_strm_.str(std::string());
+                suffix_strm_.clear();
+                data = format_context(suffix_strm_, data);
+
+                if (has_message)
+                {
+                    detail::format_record_items(
+                        strm_, data, static_cast<std::size_t>(end - data));
+                }
+                strm_ << suffix_strm_.str();
+
+                rec.text_ = strm_.str();
+                records_.push_back(HPX_MOVE(rec));
+            }
+
+            void write_pending()
+            {
+                std::vector<std::shared_ptr<record_ring>> rings;
+                {
+                    std::lock_guard<std::mutex> l(rings_mtx_);
+                    rings = rings_;
+                }
+
+                for (auto const& ring : rings)
+                {
+                    std::uint64_t const dropped = ring->dropped();
+                    unreported_ += dropped - ring->reported_;
+                    ring->reported_ = dropped;
+
+                    ring->pop_all([this](char const* data, std::size_t size) {
+                        format_record(data, size);
+                    });
+                }
+
+                if (records_.empty())
+                {
+                    remove_orphaned_rings();
+                    return;
+                }
+
+                // restore the order of the records logged by different
+                // threads
+                std::stable_sort(records_.begin(), records_.end(),
+                    [](formatted_record const& lhs,
+                        formatted_record const& rhs) {
+                        return lhs.timestamp_ < rhs.timestamp_;
+                    });
+
+                if (unreported_ != 0)
+                {
+                    formatted_record& first = records_.front();
+                    first.text_.insert(0,
+                        util::format("{} log record(s) were dropped as the "
+                                     "asynchronous logging buffer was full\n",
+                            unreported_));
+                    unreported_ = 0;
+                }
+
+                // write consecutive records of the same logger at once
+                std::size_t const count = records_.size();
+                for (std::size_t first = 0; first != count; /**/)
+                {
+                    logger* const l = records_[first].logger_;
+
+                    std::stringstream batch;
+                    std::size_t last = first;
+                    for (/**/; last != count && records_[last].logger_ == l;
+                         ++last)
+                    {
+                        batch << records_[last].text_;
+                    }
+
+                    l->writer().write_formatted(message(HPX_MOVE(batch)));
+                    first = last;
+                }
+
+                written_.fetch_add(count, std::memory_order_relaxed);
+                records_.clear();
+
+                remove_orphaned_rings();
+            }
+
+            void remove_orphaned_rings()
+            {
+                std::lock_guard<std::mutex> l(rings_mtx_);
+                auto it = std::remove_if(rings_.begin(), rings_.end(),
+                    [this](std::shared_ptr<record_ring> const& ring) {
+                        if (!ring->orphaned().load(std::memory_order_acquire) ||
+                            !ring->empty())
+                        {
+                            return false;
+                        }
+                        dropped_retired_ += ring->dropped();
+                        return true;
+                    });
+                rings_.erase(it, rings_.end());
+            }
+
+            std::mutex mtx_;
+            std::condition_variable cond_;
+            std::thread thread_;
+
+            std::atomic<bool> running_ = false;
+            std::atomic<std::uint64_t> generation_ = 0;
+            bool stop_requested_ = false;
+            std::uint64_t flush_requested_ = 0;
+            std::uint64_t flush_completed_ = 0;
+
+            std::size_t buffer_size_ = 0;
+            std::chrono::milliseconds flush_interval_{10};
+
+            std::mutex rings_mtx_;
+            std::vector<std::shared_ptr<record_ring>> rings_;
+            std::uint64_t dropped_retired_ = 0;
+            std::uint64_t dropped_base_ = 0;
+
+            std::atomic<std::uint64_t> written_ = 0;
+
+            // used by the background thread only
+            std::uint64_t unreported_ = 0;
+            std::vector<formatted_record> records_;
+            std::ostringstream strm_;
+            std::ostringstream suffix_strm_;
+        };
+
+        async_backend& get_async_backend()
+        {
+            static async_backend backend;
+            return backend;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // the state used by an OS thread to create records
+        struct thread_state
+        {
+            thread_state() = default;
+
+            thread_state(thread_state const&) = delete;
+            thread_state& operator=(thread_state const&) = delete;
+
+            ~thread_state()
+            {
+                if (ring_)
+                {
+                    ring_->orphaned().store(true, std::memory_order_release);
+                }
+            }
+
+            std::shared_ptr<record_ring> ring_;
+            std::uint64_t generation_ = 0;
+
+            std::vector<char> data_;
+            std::optional<detail::record_encoder> encoder_;
+            std::vector<char> prefix_;
+            std::vector<char> suffix_;
+            bool in_use_ = false;
+        };
+
+        thread_state& get_thread_state()
+        {
+            thread_local thread_state state;
+            return state;
+        }
+
+        void put_context(
+            detail::record_encoder& rec, std::vector<char> const& context)
+        {
+            rec.put_value(static_cast<std::uint32_t>(context.size()));
+            rec.put_bytes(context.data(), context.size());
+        }
+    }    // namespace
+
+    namespace detail {
+
+        record_encoder* begin_async_record(logger& l)
+        {
+            async_backend& backend = get_async_backend();
+            if (!backend.is_running())
+            {
+                return nullptr;
+            }
+
+            // messages logged while creating a record (e.g. by formatters)
+            // are written synchronously
+            thread_state& state = get_thread_state();
+            if (state.in_use_)
+            {
+                return nullptr;
+            }
+
+            std::uint64_t const generation = backend.generation();
+            if (!state.ring_ || state.generation_ != generation)
+            {
+                if (state.ring_)
+                {
+                    state.ring_->orphaned().store(
+                        true, std::memory_order_release);
+                }
+                state.ring_ = backend.create_ring();
+                state.generation_ = generation;
+            }
+
+            state.data_.clear();
+            record_encoder& encoder = state.encoder_.emplace(state.data_);
+
+            // the record header
+            std::int64_t const timestamp =
+                std::chrono::steady_clock::now().time_since_epoch().count();
+            logger* const logger_ptr = &l;
+            encoder.put_value(logger_ptr);
+            encoder.put_value(timestamp);
+
+            // the context of a message depends on the calling thread, the
+            // formatters capture the values they need right away, those are
+            // turned into text by the background thread
+            state.prefix_.clear();
+            state.suffix_.clear();
+            detail::record_encoder prefix(state.prefix_);
+            detail::record_encoder suffix(state.suffix_);
+            std::uint8_t const has_message =
+                l.writer().capture_context(prefix, suffix) ? 1 : 0;
+            encoder.put_value(has_message);
+            put_context(encoder, state.prefix_);
+            put_context(encoder, state.suffix_);
+
+            encoder.start_items();
+            state.in_use_ = true;
+            return &encoder;
+        }
+
+        void end_async_record(record_encoder* rec) noexcept
+        {
+            thread_state& state = get_thread_state();
+            HPX_ASSERT(state.in_use_ && rec == &*state.encoder_);
+
+            if (!rec->empty())
+            {
+                state.ring_->push(state.data_.data(), state.data_.size());
+            }
+            state.in_use_ = false;
+        }
+
+        void format_record_items(
+            std::ostream& os, char const* data, std::size_t size)
+        {
+            char const* const end = data + size;
+            while (data != end)
+            {
+                data = format_item(os, data);
+            }
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    void enable_async_logging(
+        std::size_t buffer_size, std::chrono::milliseconds flush_interval)
+    {
+        get_async_backend().start(buffer_size, flush_interval);
+    }
+
+    void disable_async_logging()
+    {
+        get_async_backend().stop();
+    }
+
+    bool is_async_logging_enabled() noexcept
+    {
+        return get_async_backend().is_running();
+    }
+
+    void flush_async_logging()
+    {
+        get_async_backend().flush();
+    }
+
+    std::uint64_t get_async_logging_written(bool reset)
+    {
+        return get_async_backend().written(reset);
+    }
+
+    std::uint64_t get_async_logging_dropped(bool reset)
+    {
+        return get_async_backend().dropped(reset);
+    }
+}    // namespace hpx::util::logging
+
+#endif    // HPX_HAVE_LOGGING
@@ -14,6 +14,7 @@
 // See http://www.boost.org for updates, documentation, and revision history.
 // See http://www.torjo.com/log2/ for more details
 
+#include <hpx/logging/detail/async_record.hpp>
 #include <hpx/logging/format/formatters.hpp>
 
 #include <hpx/config.hpp>
@@ -39,6 +40,11 @@ namespace hpx::util::logging::formatter {
             util::format_to(to, "{:016x}", ++value);
         }
 
+        void capture(detail::record_encoder& rec) const override
+        {
+            rec.format("{:016x}", ++value);
+        }
+
     private:
         mutable std::uint64_t value;
     };
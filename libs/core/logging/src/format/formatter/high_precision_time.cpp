@@ -14,6 +14,7 @@
 // See http://www.boost.org for updates, documentation, and revision history.
 // See http://www.torjo.com/log2/ for more details
 
+#include <hpx/logging/detail/async_record.hpp>
 #include <hpx/logging/format/formatters.hpp>
 
 #include <hpx/config.hpp>
@@ -48,7 +49,33 @@ namespace hpx::util::logging::formatter {
 
         void operator()(std::ostream& to) const override
         {
-            auto const val = std::chrono::system_clock::now();
+            format_time(to, std::chrono::system_clock::now());
+        }
+
+        // only the point in time is captured, converting it to local time
+        // and formatting it is left to the background thread
+        void capture(detail::record_encoder& rec) const override
+        {
+            auto const now = std::chrono::system_clock::now();
+            rec.put_formatter(
+                this, std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          now.time_since_epoch())
+                          .count());
+        }
+
+        void format_captured(
+            std::ostream& to, std::int64_t value) const override
+        {
+            format_time(to,
+                std::chrono::system_clock::time_point(
+                    std::chrono::duration_cast<
+                        std::chrono::system_clock::duration>(
+                        std::chrono::nanoseconds(value))));
+        }
+
+        void format_time(
+            std::ostream& to, std::chrono::system_clock::time_point val) const
+        {
             std::time_t const tt = std::chrono::system_clock::to_time_t(val);
 
 #if defined(__linux) || defined(linux) || defined(__linux__) ||                \
@@ -14,6 +14,7 @@
 // See http://www.boost.org for updates, documentation, and revision history.
 // See http://www.torjo.com/log2/ for more details
 
+#include <hpx/logging/detail/async_record.hpp>
 #include <hpx/logging/format/formatters.hpp>
 
 #include <hpx/config.hpp>
@@ -32,17 +33,28 @@ namespace hpx::util::logging::formatter {
 
     thread_id::~thread_id() = default;
 
+#if defined(HPX_WINDOWS)
+    static DWORD get_thread_id() noexcept
+    {
+        return ::GetCurrentThreadId();
+    }
+#else
+    static pthread_t get_thread_id() noexcept
+    {
+        return pthread_self();
+    }
+#endif
+
     struct thread_id_impl : thread_id
     {
         void operator()(std::ostream& to) const override
         {
-            util::format_to(to, "{}",
-#if defined(HPX_WINDOWS)
-                ::GetCurrentThreadId()
-#else
-                pthread_self()
-#endif
-            );
+            util::format_to(to, "{}", get_thread_id());
+        }
+
+        void capture(detail::record_encoder& rec) const override
+        {
+            rec.format("{}", get_thread_id());
         }
     };
 
@@ -14,12 +14,18 @@
 // See http://www.boost.org for updates, documentation, and revision history.
 // See http://www.torjo.com/log2/ for more details
 
+#include <hpx/logging/detail/async_record.hpp>
 #include <hpx/logging/manipulator.hpp>
 
 namespace hpx::util::logging {
 
     namespace formatter {
 
+        void manipulator::capture(detail::record_encoder& rec) const
+        {
+            rec.format("{}", *this);
+        }
+
         manipulator::~manipulator() = default;
 
     }    // namespace formatter
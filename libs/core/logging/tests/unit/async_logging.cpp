@@ -0,0 +1,311 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ios>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using hpx::util::logging::level;
+using hpx::util::logging::logger;
+using hpx::util::logging::detail::record_encoder;
+
+///////////////////////////////////////////////////////////////////////////////
+// a type which can't be encoded, it is formatted when the record is created
+struct point
+{
+    int x, y;
+};
+
+std::ostream& operator<<(std::ostream& os, point const& p)
+{
+    return os << '(' << p.x << ',' << p.y << ')';
+}
+
+std::string decode(std::vector<char> const& data)
+{
+    std::ostringstream strm;
+    hpx::util::logging::detail::format_record_items(
+        strm, data.data(), data.size());
+    return strm.str();
+}
+
+std::size_t count(std::string const& s, std::string const& what)
+{
+    std::size_t result = 0;
+    for (std::size_t pos = s.find(what); pos != std::string::npos;
+         pos = s.find(what, pos + what.size()))
+    {
+        ++result;
+    }
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// encoding a message and turning the record into text gives the same result
+// as formatting the message right away
+void test_encode_decode()
+{
+    {
+        std::vector<char> data;
+        record_encoder rec(data);
+        rec.start_items();
+        HPX_TEST(rec.empty());
+
+        rec.format("{:5}|{:x}|{:.3f}|{}|{}|{}|{}|{}", 42, 255u,
+            3.14159265, true, 'c', std::int64_t(-1), std::uint64_t(1) << 40,
+            std::int16_t(-7));
+        HPX_TEST(!rec.empty());
+        HPX_TEST_EQ(decode(data),
+            hpx::util::format("{:5}|{:x}|{:.3f}|{}|{}|{}|{}|{}", 42, 255u,
+                3.14159265, true, 'c', std::int64_t(-1),
+                std::uint64_t(1) << 40, std::int16_t(-7)));
+    }
+
+    {
+        std::string const str("std::string");
+        char const* null_str = nullptr;
+
+        std::vector<char> data;
+        record_encoder rec(data);
+        rec.format("{}, {}, {}, {}, {:8}", "literal", str,
+            std::string_view("view"), null_str, "right");
+        HPX_TEST_EQ(decode(data),
+            std::string(
+                "literal, std::string, view, (null),    right"));
+    }
+
+    {
+        std::vector<char> data;
+        record_encoder rec(data);
+        rec.format("{} {}", level::error, level::debug);
+        rec.format("{} {}", level::error, point{1, 2});
+        HPX_TEST_EQ(decode(data),
+            hpx::util::format("{} {}{} {}", level::error, level::debug,
+                level::error, point{1, 2}));
+    }
+
+    {
+        std::vector<char> data;
+        record_encoder rec(data);
+        rec.stream("value: ");
+        rec.stream(std::hex);
+        rec.stream(255);
+        rec.stream(std::dec);
+        rec.stream(' ');
+        rec.stream(255);
+        rec.stream(std::endl<char, std::char_traits<char>>);
+        rec.stream(point{3, 4});
+        rec.stream(2.5);
+        rec.stream(false);
+
+        std::ostringstream expected;
+        expected << "value: " << std::hex << 255 << std::dec << ' ' << 255
+                 << std::endl
+                 << point{3, 4} << 2.5 << false;
+        HPX_TEST_EQ(decode(data), expected.str());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// A logger writing every message on a line of its own to a string stream.
+struct test_logger
+{
+    explicit test_logger(bool async)
+    {
+        l.writer().set_destination<hpx::util::logging::destination::stream>(
+            "strm", &strm);
+        l.writer().write("|\n", "strm");
+        l.mark_as_initialized();
+        l.set_async(async);
+    }
+
+    std::string str() const
+    {
+        return strm.str();
+    }
+
+    std::ostringstream strm;
+    logger l;
+};
+
+void log_messages(logger& l)
+{
+    int const i = 42;
+    std::string const str("string");
+
+    l.gather().format("format: {:04} {:.2f} {} {} {}", i, 1.5, str,
+        level::warning, point{5, 6});
+    l.gather() << "stream: " << i << ' ' << str << ' ' << std::hex << 255
+               << ' ' << true << ' ' << point{7, 8};
+    l.gather().format("{}", "mixed ") << 1 << " and " << 2.5;
+}
+
+void test_async_matches_sync()
+{
+    test_logger sync(false);
+    test_logger async(true);
+
+    log_messages(sync.l);
+    log_messages(async.l);
+    hpx::util::logging::flush_async_logging();
+
+    HPX_TEST_EQ(count(sync.str(), "\n"), std::size_t(3));
+    HPX_TEST_EQ(async.str(), sync.str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// formatters capture the values they depend on when a message is logged,
+// those are turned into text by the background thread
+std::int64_t captured_count = 0;
+std::thread::id formatted_on;
+
+struct captured_context : hpx::util::logging::formatter::manipulator
+{
+    void operator()(std::ostream& to) const override
+    {
+        to << "sync";
+    }
+
+    void capture(record_encoder& rec) const override
+    {
+        rec.put_formatter(this, ++captured_count);
+    }
+
+    void format_captured(std::ostream& to, std::int64_t value) const override
+    {
+        formatted_on = std::this_thread::get_id();
+        to << "captured " << value;
+    }
+};
+
+void test_captured_context()
+{
+    test_logger sync(false);
+    sync.l.writer().set_formatter("ctx", captured_context());
+    sync.l.writer().format("[%ctx%] |\n");
+
+    test_logger async(true);
+    async.l.writer().set_formatter("ctx", captured_context());
+    async.l.writer().format("[%ctx%] |\n");
+
+    sync.l.gather() << "message";
+    HPX_TEST_EQ(sync.str(), std::string("[sync] message\n"));
+
+    async.l.gather() << "first";
+    async.l.gather() << "second";
+    HPX_TEST_EQ(captured_count, std::int64_t(2));
+
+    hpx::util::logging::flush_async_logging();
+    HPX_TEST_EQ(
+        async.str(), std::string("[captured 1] first\n[captured 2] second\n"));
+    HPX_TEST(formatted_on != std::thread::id());
+    HPX_TEST(formatted_on != std::this_thread::get_id());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// all records pushed before flushing are written in order
+void test_flush()
+{
+    test_logger async(true);
+
+    std::string expected;
+    for (int i = 0; i != 100; ++i)
+    {
+        async.l.gather().format("message {}", i);
+        expected += hpx::util::format("message {}\n", i);
+    }
+
+    hpx::util::logging::flush_async_logging();
+    HPX_TEST_EQ(async.str(), expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// records are dropped if the ring buffer is full, the drops are counted and
+// reported in the output
+void test_dropped()
+{
+    using namespace hpx::util::logging;
+
+    // the background thread writes the records only when being flushed
+    disable_async_logging();
+    enable_async_logging(4096, std::chrono::hours(1));
+    get_async_logging_written(true);
+    get_async_logging_dropped(true);
+
+    test_logger async(true);
+
+    constexpr std::size_t num_messages = 1000;
+    std::string const payload(100, 'x');
+    for (std::size_t i = 0; i != num_messages; ++i)
+    {
+        async.l.gather() << "message " << payload;
+    }
+
+    flush_async_logging();
+
+    std::uint64_t const written = get_async_logging_written(true);
+    std::uint64_t const dropped = get_async_logging_dropped(true);
+    HPX_TEST_LT(std::uint64_t(0), written);
+    HPX_TEST_LT(std::uint64_t(0), dropped);
+    HPX_TEST_EQ(written + dropped, std::uint64_t(num_messages));
+
+    std::string const output = async.str();
+    HPX_TEST_EQ(count(output, "message "), std::size_t(written));
+    HPX_TEST_NEQ(output.find("log record(s) were dropped"), std::string::npos);
+
+    HPX_TEST_EQ(get_async_logging_dropped(false), std::uint64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// disabling the backend writes all pending records, messages are written
+// synchronously afterwards
+void test_disable()
+{
+    using namespace hpx::util::logging;
+
+    enable_async_logging(1 << 16, std::chrono::hours(1));
+    HPX_TEST(is_async_logging_enabled());
+
+    test_logger async(true);
+    async.l.gather() << "before";
+
+    disable_async_logging();
+    HPX_TEST(!is_async_logging_enabled());
+    HPX_TEST_EQ(async.str(), std::string("before\n"));
+
+    async.l.gather() << "after";
+    HPX_TEST_EQ(async.str(), std::string("before\nafter\n"));
+
+    // flushing is a no-op while the backend is not running
+    flush_async_logging();
+    HPX_TEST_EQ(async.str(), std::string("before\nafter\n"));
+}
+
+int main()
+{
+    test_encode_decode();
+
+    hpx::util::logging::enable_async_logging(1 << 16);
+    test_async_matches_sync();
+    test_captured_context();
+    test_flush();
+    test_dropped();
+    test_disable();
+
+    return hpx::util::report_errors();
+}
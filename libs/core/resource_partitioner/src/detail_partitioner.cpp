@@ -157,6 +157,9 @@ namespace hpx::resource::detail {
         case resource::scheduling_policy::shared_priority:
             sched = "shared_priority";
             break;
+        case resource::scheduling_policy::deadline:
+            sched = "deadline";
+            break;
         }
 
         os << "\"" << sched << "\" is running on PUs : \n";
@@ -499,6 +502,10 @@ namespace hpx::resource::detail {
         {
             default_scheduler = scheduling_policy::shared_priority;
         }
+        else if (0 == std::string("deadline").find(default_scheduler_str))
+        {
+            default_scheduler = scheduling_policy::deadline;
+        }
         else
         {
             throw hpx::detail::command_line_error(
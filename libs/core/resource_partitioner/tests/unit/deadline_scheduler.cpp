@@ -0,0 +1,159 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the deadline scheduler runs threads in earliest-deadline-first
+// order and counts the threads which start running after their deadline.
+
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/mutex.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+using steady_clock = hpx::chrono::steady_clock;
+
+void test_inherit_deadline()
+{
+    hpx::threads::thread_id_type const self = hpx::threads::get_self_id();
+    HPX_TEST(hpx::threads::get_thread_deadline(self) ==
+        steady_clock::time_point());
+
+    steady_clock::time_point const deadline =
+        steady_clock::now() + std::chrono::hours(1);
+    hpx::threads::set_thread_deadline(self, deadline);
+
+    // threads inherit the deadline of the thread which created them
+    hpx::async([deadline]() {
+        HPX_TEST(hpx::threads::get_thread_deadline(
+                     hpx::threads::get_self_id()) == deadline);
+    }).get();
+
+    hpx::threads::set_thread_deadline(self, steady_clock::time_point());
+    HPX_TEST(hpx::threads::get_thread_deadline(self) ==
+        steady_clock::time_point());
+}
+
+void test_earliest_deadline_first()
+{
+    hpx::threads::thread_id_type const self = hpx::threads::get_self_id();
+
+    std::size_t const num_tasks = 16;
+
+    hpx::mutex mtx;
+    std::vector<std::size_t> order;
+    order.reserve(num_tasks);
+
+    // create the threads with decreasing deadlines, they have to run in
+    // reverse order
+    steady_clock::time_point const now = steady_clock::now();
+
+    std::vector<hpx::future<void>> fs;
+    fs.reserve(num_tasks + 1);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        hpx::threads::set_thread_deadline(
+            self, now + std::chrono::hours(1) - std::chrono::seconds(i));
+        fs.push_back(hpx::async([&mtx, &order, i]() {
+            std::lock_guard<hpx::mutex> l(mtx);
+            order.push_back(i);
+        }));
+    }
+
+    // threads without a deadline run after all threads with a deadline
+    hpx::threads::set_thread_deadline(self, steady_clock::time_point());
+    fs.push_back(hpx::async([&mtx, &order, num_tasks]() {
+        std::lock_guard<hpx::mutex> l(mtx);
+        order.push_back(num_tasks);
+    }));
+
+    hpx::wait_all(fs);
+
+    HPX_TEST_EQ(order.size(), num_tasks + 1);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        HPX_TEST_EQ(order[i], num_tasks - 1 - i);
+    }
+    HPX_TEST_EQ(order[num_tasks], num_tasks);
+}
+
+void test_deadline_misses()
+{
+    hpx::threads::thread_pool_base& tp =
+        hpx::resource::get_thread_pool("default");
+    hpx::threads::thread_id_type const self = hpx::threads::get_self_id();
+
+    // reset the counter
+    tp.get_num_deadline_misses(std::size_t(-1), true);
+
+    std::size_t const num_tasks = 10;
+
+    // deadlines far in the future are not missed
+    std::vector<hpx::future<void>> fs;
+    fs.reserve(num_tasks);
+
+    hpx::threads::set_thread_deadline(
+        self, steady_clock::now() + std::chrono::hours(1));
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        fs.push_back(hpx::async([]() {}));
+    }
+    hpx::threads::set_thread_deadline(self, steady_clock::time_point());
+    hpx::wait_all(fs);
+
+    HPX_TEST_EQ(
+        tp.get_num_deadline_misses(std::size_t(-1), false), std::int64_t(0));
+
+    // deadlines in the past are always missed
+    fs.clear();
+    hpx::threads::set_thread_deadline(
+        self, steady_clock::now() - std::chrono::milliseconds(1));
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        fs.push_back(hpx::async([]() {}));
+    }
+    hpx::threads::set_thread_deadline(self, steady_clock::time_point());
+    hpx::wait_all(fs);
+
+    HPX_TEST_EQ(tp.get_num_deadline_misses(std::size_t(-1), true),
+        static_cast<std::int64_t>(num_tasks));
+    HPX_TEST_EQ(
+        tp.get_num_deadline_misses(std::size_t(-1), false), std::int64_t(0));
+}
+
+int hpx_main()
+{
+    test_inherit_deadline();
+    test_earliest_deadline_first();
+    test_deadline_misses();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::local::init_params init_args;
+
+    // a single worker thread makes the execution order deterministic
+    init_args.cfg = {"hpx.os_threads=1"};
+    init_args.rp_callback = [](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        rp.create_thread_pool(
+            "default", hpx::resource::scheduling_policy::deadline);
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
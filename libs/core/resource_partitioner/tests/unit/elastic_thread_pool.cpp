@@ -0,0 +1,256 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the elastic_thread_pool_policy shrinks idle thread pools and
+// grows loaded ones within the given bounds.
+
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/schedulers.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread_pool_util/elastic_thread_pool_policy.hpp>
+#include <hpx/thread_pool_util/thread_pool_suspension_helpers.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+std::size_t const max_threads = (std::min)(
+    std::size_t(4), std::size_t(hpx::threads::hardware_concurrency()));
+
+// a second pool is created only if there are enough processing units
+std::size_t get_num_donor_threads()
+{
+    return max_threads >= 4 ? 2 : 0;
+}
+
+void test_bounds(hpx::threads::thread_pool_base& tp)
+{
+    std::size_t const num_threads = tp.get_os_thread_count();
+
+    {
+        hpx::threads::elastic_thread_pool_policy policy;
+
+        hpx::threads::elastic_pool_parameters params;
+        params.max_processing_units = 2;
+
+        // the upper bound is enforced right away
+        policy.add_pool(tp, params);
+        HPX_TEST_EQ(policy.get_active_processing_units(tp), std::size_t(2));
+        HPX_TEST_EQ(tp.get_active_os_thread_count(), std::size_t(2));
+
+        // stopping the policy resumes all processing units
+        policy.stop();
+        HPX_TEST_EQ(policy.get_active_processing_units(tp), num_threads);
+    }
+
+    {
+        hpx::threads::elastic_thread_pool_policy policy;
+
+        hpx::threads::elastic_pool_parameters params;
+        params.min_processing_units = 0;
+
+        bool exception_thrown = false;
+        try
+        {
+            policy.add_pool(tp, params);
+        }
+        catch (hpx::exception const&)
+        {
+            exception_thrown = true;
+        }
+        HPX_TEST(exception_thrown);
+    }
+}
+
+void test_shrink_and_grow(hpx::threads::thread_pool_base& tp)
+{
+    std::size_t const num_threads = tp.get_os_thread_count();
+
+    hpx::threads::elastic_thread_pool_policy policy;
+
+    hpx::threads::elastic_pool_parameters params;
+    params.num_samples = 1;
+    policy.add_pool(tp, params);
+
+    // an idle pool shrinks down to the lower bound
+    for (std::size_t i = 0;
+         i != 100 && policy.get_active_processing_units(tp) != 1; ++i)
+    {
+        policy.step();
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    HPX_TEST_EQ(policy.get_active_processing_units(tp), std::size_t(1));
+    HPX_TEST_EQ(policy.get_num_suspended(), num_threads - 1);
+
+    // a loaded pool grows
+    policy.start(std::chrono::milliseconds(1));
+
+    std::vector<hpx::future<void>> fs;
+    fs.reserve(100 * num_threads);
+    for (std::size_t i = 0; i != 100 * num_threads; ++i)
+    {
+        fs.push_back(hpx::async([]() {
+            hpx::chrono::high_resolution_timer t;
+            while (t.elapsed() < 0.001)
+            {
+            }
+        }));
+    }
+    hpx::wait_all(fs);
+
+    HPX_TEST_LT(std::size_t(0), policy.get_num_resumed());
+
+    policy.stop();
+    HPX_TEST_EQ(policy.get_active_processing_units(tp), num_threads);
+}
+
+// A pool that has to grow while the overall limit has been reached takes a
+// processing unit from another pool only if it can resume one of its own. The
+// processing units of this pool were suspended by somebody else, the donor
+// has to keep all of its processing units.
+void test_no_exchange(
+    hpx::threads::thread_pool_base& tp, hpx::threads::thread_pool_base& donor)
+{
+    std::size_t const num_threads = tp.get_os_thread_count();
+    std::size_t const num_donor_threads = donor.get_os_thread_count();
+
+    // suspend all other processing units of this pool
+    std::size_t const own = hpx::get_local_worker_thread_num();
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        if (i != own)
+        {
+            hpx::threads::suspend_processing_unit(tp, i).get();
+        }
+    }
+
+    {
+        hpx::threads::elastic_thread_pool_policy policy(1 + num_donor_threads);
+
+        // this pool always wants to grow, the donor never changes by itself
+        hpx::threads::elastic_pool_parameters params;
+        params.grow_queue_length = -1.0;
+        params.num_samples = 1;
+        policy.add_pool(tp, params);
+
+        hpx::threads::elastic_pool_parameters donor_params;
+        donor_params.grow_queue_length = 1e9;
+        donor_params.shrink_queue_length = -1.0;
+        donor_params.num_samples = 1;
+        policy.add_pool(donor, donor_params);
+
+        // queue some work on this pool, which makes it more loaded than the
+        // donor
+        std::vector<hpx::future<void>> fs;
+        fs.reserve(100);
+        for (std::size_t i = 0; i != 100; ++i)
+        {
+            fs.push_back(hpx::async([]() {}));
+        }
+
+        policy.step();
+
+        HPX_TEST_EQ(policy.get_num_suspended(), std::size_t(0));
+        HPX_TEST_EQ(policy.get_num_resumed(), std::size_t(0));
+        HPX_TEST_EQ(policy.get_active_processing_units(tp), std::size_t(1));
+        HPX_TEST_EQ(
+            policy.get_active_processing_units(donor), num_donor_threads);
+
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            if (i != own)
+            {
+                hpx::threads::resume_processing_unit(tp, i).get();
+            }
+        }
+        hpx::wait_all(fs);
+
+        policy.stop();
+    }
+
+    HPX_TEST_EQ(tp.get_active_os_thread_count(), num_threads);
+    HPX_TEST_EQ(donor.get_active_os_thread_count(), num_donor_threads);
+}
+
+int hpx_main()
+{
+    std::size_t const num_threads = hpx::resource::get_num_threads("default");
+    HPX_TEST_EQ(max_threads - get_num_donor_threads(), num_threads);
+
+    hpx::threads::thread_pool_base& tp =
+        hpx::resource::get_thread_pool("default");
+
+    test_bounds(tp);
+    test_shrink_and_grow(tp);
+
+    if (get_num_donor_threads() != 0)
+    {
+        test_no_exchange(tp, hpx::resource::get_thread_pool("donor"));
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // the pools can't shrink without a second processing unit
+    if (max_threads < 2)
+    {
+        std::cout << "skipping test, it needs at least 2 processing units"
+                  << std::endl;
+        return hpx::util::report_errors();
+    }
+
+    hpx::local::init_params init_args;
+
+    init_args.cfg = {"hpx.os_threads=" + std::to_string(max_threads)};
+    init_args.rp_callback = [](auto& rp,
+                                hpx::program_options::variables_map const&) {
+        auto const mode =
+            hpx::threads::policies::scheduler_mode::default_ |
+            hpx::threads::policies::scheduler_mode::enable_elasticity;
+
+        rp.create_thread_pool("default",
+            hpx::resource::scheduling_policy::local_priority_fifo, mode);
+
+        if (get_num_donor_threads() == 0)
+        {
+            return;
+        }
+
+        rp.create_thread_pool("donor",
+            hpx::resource::scheduling_policy::local_priority_fifo, mode);
+
+        std::size_t count = 0;
+        for (hpx::resource::numa_domain const& d : rp.numa_domains())
+        {
+            for (hpx::resource::core const& c : d.cores())
+            {
+                for (hpx::resource::pu const& p : c.pus())
+                {
+                    if (count != get_num_donor_threads())
+                    {
+                        rp.add_resource(p, "donor");
+                        ++count;
+                    }
+                }
+            }
+        }
+    };
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
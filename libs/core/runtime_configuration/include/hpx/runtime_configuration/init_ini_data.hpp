@@ -13,9 +13,11 @@
 #include <hpx/runtime_configuration/component_registry_base.hpp>
 #include <hpx/runtime_configuration/plugin_registry_base.hpp>
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -44,6 +46,59 @@ namespace hpx::util {
     // global function to read component ini information
     void merge_component_inis(section& ini);
 
+    ///////////////////////////////////////////////////////////////////////////
+    // the results of scanning directories for HPX modules, this allows to
+    // skip the scan (and loading all other shared libraries) as long as
+    // neither a directory nor any of the modules in it are modified
+    struct component_cache
+    {
+        struct module
+        {
+            std::string path;    // canonical path of the module
+            std::string name;
+            std::int64_t last_write_time = 0;
+            std::uint64_t file_size = 0;
+        };
+
+        struct directory
+        {
+            std::int64_t last_write_time = 0;
+
+            // all HPX modules in the directory
+            std::vector<module> modules;
+        };
+
+        std::map<std::string, directory> directories;
+        bool modified = false;
+    };
+
+    // read the given cache file, returns false (leaving the cache empty) if
+    // the file does not exist, is corrupt, or was written by a different
+    // version of HPX
+    HPX_CORE_EXPORT bool read_component_cache(
+        std::string const& cache_file, component_cache& cache);
+
+    // write the given cache file (if it was modified)
+    HPX_CORE_EXPORT void write_component_cache(
+        std::string const& cache_file, component_cache const& cache);
+
+    // return the cache entry of the given directory if neither the directory
+    // nor any of the cached modules were modified since the entry was created
+    HPX_CORE_EXPORT component_cache::directory const*
+    find_component_cache_directory(
+        component_cache const& cache, std::string const& path);
+
+    // (re-)create the cache entry of the given directory, returns nullptr if
+    // the directory can't be inspected
+    HPX_CORE_EXPORT component_cache::directory* add_component_cache_directory(
+        component_cache& cache, std::string const& path);
+
+    // add a module to the cache entry of a directory, returns false if the
+    // module can't be inspected
+    HPX_CORE_EXPORT bool add_component_cache_module(
+        component_cache::directory& dir, std::string const& path,
+        std::string const& name);
+
     ///////////////////////////////////////////////////////////////////////////
     // iterate over all shared libraries in the given directory and construct
     // default ini settings assuming all of those are components
@@ -52,5 +107,6 @@ namespace hpx::util {
         std::map<std::string, filesystem::path>& basenames,
         std::map<std::string, hpx::util::plugin::dll>& modules,
         std::vector<std::shared_ptr<components::component_registry_base>>&
-            component_registries);
+            component_registries,
+        component_cache* cache = nullptr);
 }    // namespace hpx::util
@@ -30,6 +30,8 @@
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::util {
 
+    struct component_cache;
+
     ///////////////////////////////////////////////////////////////////////////
     // The runtime_configuration class is a wrapper for the runtime
     // configuration data allowing to extract configuration information in a
@@ -91,6 +93,10 @@ namespace hpx::util {
 
         std::size_t get_agas_max_pending_refcnt_requests() const;
 
+        // Maximum time (in milliseconds) credit decrement requests are
+        // buffered before being sent to AGAS, zero disables the time limit.
+        std::size_t get_agas_max_pending_refcnt_delay() const;
+
         // Load application specific configuration and merge it with the
         // default configuration loaded from hpx.ini
         bool load_application_configuration(
@@ -173,7 +179,8 @@ namespace hpx::util {
             std::string const& component_base_paths,
             std::string const& component_path_suffixes,
             std::set<std::string>& component_paths,
-            std::map<std::string, filesystem::path>& basenames);
+            std::map<std::string, filesystem::path>& basenames,
+            component_cache* cache = nullptr);
 
         void load_component_path(
             std::vector<std::shared_ptr<plugins::plugin_registry_base>>&
@@ -181,7 +188,8 @@ namespace hpx::util {
             std::vector<std::shared_ptr<components::component_registry_base>>&
                 component_registries,
             std::string const& path, std::set<std::string>& component_paths,
-            std::map<std::string, filesystem::path>& basenames);
+            std::map<std::string, filesystem::path>& basenames,
+            component_cache* cache = nullptr);
 
     public:
         runtime_mode mode_;
@@ -0,0 +1,30 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file startup_timings.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <iosfwd>
+
+namespace hpx::util {
+
+    /// Start measuring the phases of the runtime startup, this discards all
+    /// phases recorded so far.
+    HPX_CORE_EXPORT void reset_startup_timings();
+
+    /// Record the end of the startup phase \a phase, which started at the end
+    /// of the previously recorded phase (or at the last call to
+    /// \a reset_startup_timings). The times of phases recorded more than once
+    /// are added up.
+    HPX_CORE_EXPORT void record_startup_phase(char const* phase);
+
+    /// Print the recorded startup phases (in the order they were first
+    /// recorded) and their overall time.
+    HPX_CORE_EXPORT void print_startup_timings(std::ostream& os);
+}    // namespace hpx::util
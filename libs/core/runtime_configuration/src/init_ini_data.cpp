@@ -17,9 +17,13 @@
 #include <hpx/runtime_configuration/component_registry_base.hpp>
 #include <hpx/runtime_configuration/init_ini_data.hpp>
 #include <hpx/runtime_configuration/plugin_registry_base.hpp>
+#include <hpx/util/from_string.hpp>
 #include <hpx/version.hpp>
 
 #include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -390,15 +394,253 @@ namespace hpx { namespace util {
         {
             return lhs.first == rhs.first;
         }
+
+        // returns zero if the time can't be determined
+        std::int64_t get_last_write_time(filesystem::path const& p)
+        {
+            std::error_code ec;
+#if !defined(HPX_FILESYSTEM_HAVE_BOOST_FILESYSTEM_COMPATIBILITY)
+            auto const t = filesystem::last_write_time(p, ec);
+            if (ec)
+                return 0;
+            return static_cast<std::int64_t>(t.time_since_epoch().count());
+#else
+            auto const t =
+                filesystem::last_write_time(p, compat_error_code(ec));
+            if (ec)
+                return 0;
+            return static_cast<std::int64_t>(t);
+#endif
+        }
+
+        // returns false if the size can't be determined
+        bool get_file_size(filesystem::path const& p, std::uint64_t& size)
+        {
+            std::error_code ec;
+#if !defined(HPX_FILESYSTEM_HAVE_BOOST_FILESYSTEM_COMPATIBILITY)
+            auto const result = filesystem::file_size(p, ec);
+#else
+            auto const result =
+                filesystem::file_size(p, compat_error_code(ec));
+#endif
+            if (ec)
+                return false;
+            size = static_cast<std::uint64_t>(result);
+            return true;
+        }
+
+        // split off the next space separated field of a cache file line
+        bool next_field(std::string const& line,
+            std::string::size_type& pos, std::string& field)
+        {
+            std::string::size_type const end = line.find(' ', pos);
+            if (end == std::string::npos)
+                return false;
+            field = line.substr(pos, end - pos);
+            pos = end + 1;
+            return true;
+        }
+
+        bool parse_component_cache_line(std::string const& line,
+            component_cache& cache, component_cache::directory*& dir)
+        {
+            std::string::size_type pos = 0;
+            std::string kind, last_write_time;
+            if (!next_field(line, pos, kind) ||
+                !next_field(line, pos, last_write_time))
+            {
+                return false;
+            }
+
+            constexpr std::int64_t invalid_time = 0;
+            constexpr std::uint64_t invalid_size = ~std::uint64_t(0);
+            if (kind == "directory")
+            {
+                dir = &cache.directories[line.substr(pos)];
+                dir->last_write_time = util::from_string<std::int64_t>(
+                    last_write_time, invalid_time);
+                dir->modules.clear();
+                return dir->last_write_time != invalid_time;
+            }
+
+            std::string file_size, name;
+            if (kind != "module" || dir == nullptr ||
+                !next_field(line, pos, file_size) ||
+                !next_field(line, pos, name))
+            {
+                return false;
+            }
+
+            component_cache::module m;
+            m.path = line.substr(pos);
+            m.name = HPX_MOVE(name);
+            m.last_write_time =
+                util::from_string<std::int64_t>(last_write_time, invalid_time);
+            m.file_size =
+                util::from_string<std::uint64_t>(file_size, invalid_size);
+            if (m.path.empty() || m.last_write_time == invalid_time ||
+                m.file_size == invalid_size)
+            {
+                return false;
+            }
+
+            dir->modules.push_back(HPX_MOVE(m));
+            return true;
+        }
+
+        constexpr char const* const component_cache_header =
+            "# HPX component cache, version ";
     }    // namespace detail
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The cache file has the format:
+    //
+    //      # HPX component cache, version <HPX version>
+    //      directory <last write time> <canonical directory path>
+    //      module <last write time> <file size> <name> <canonical path>
+    //      ...
+    bool read_component_cache(
+        std::string const& cache_file, component_cache& cache)
+    {
+        std::ifstream in(cache_file);
+        if (!in)
+            return false;
+
+        std::string line;
+        if (!std::getline(in, line) ||
+            line != detail::component_cache_header + full_version_as_string())
+        {
+            return false;
+        }
+
+        component_cache::directory* dir = nullptr;
+        while (std::getline(in, line))
+        {
+            if (!detail::parse_component_cache_line(line, cache, dir))
+            {
+                // corrupt cache file, all directories will be scanned again
+                // and the cache will be rewritten
+                cache.directories.clear();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void write_component_cache(
+        std::string const& cache_file, component_cache const& cache)
+    {
+        if (!cache.modified)
+            return;
+
+        // write to a temporary file first, concurrently starting processes
+        // will see either the old or the new cache file
+        std::random_device random_device;
+        std::string const tmp_file =
+            cache_file + "." + std::to_string(random_device()) + ".tmp";
+        {
+            std::ofstream out(tmp_file);
+            out << detail::component_cache_header << full_version_as_string()
+                << "\n";
+            for (auto const& d : cache.directories)
+            {
+                out << "directory " << d.second.last_write_time << " "
+                    << d.first << "\n";
+                for (auto const& m : d.second.modules)
+                {
+                    out << "module " << m.last_write_time << " "
+                        << m.file_size << " " << m.name << " " << m.path
+                        << "\n";
+                }
+            }
+
+            if (!out)
+            {
+                out.close();
+                std::remove(tmp_file.c_str());
+                return;
+            }
+        }
+
+        // failing to write the cache is not an error, the next run will scan
+        // the directories again
+        if (std::rename(tmp_file.c_str(), cache_file.c_str()) != 0)
+        {
+            std::remove(tmp_file.c_str());
+        }
+    }
+
+    component_cache::directory const* find_component_cache_directory(
+        component_cache const& cache, std::string const& path)
+    {
+        auto it = cache.directories.find(path);
+        if (it == cache.directories.end())
+            return nullptr;
+
+        // adding or removing modules changes the directory, replacing or
+        // rebuilding a module changes the module
+        std::int64_t const last_write_time =
+            detail::get_last_write_time(filesystem::path(path));
+        if (last_write_time == 0 ||
+            it->second.last_write_time != last_write_time)
+        {
+            return nullptr;
+        }
+
+        for (component_cache::module const& m : it->second.modules)
+        {
+            filesystem::path const p(m.path);
+
+            std::uint64_t file_size = 0;
+            if (!detail::get_file_size(p, file_size) ||
+                m.file_size != file_size ||
+                m.last_write_time != detail::get_last_write_time(p))
+            {
+                return nullptr;
+            }
+        }
+        return &it->second;
+    }
+
+    component_cache::directory* add_component_cache_directory(
+        component_cache& cache, std::string const& path)
+    {
+        std::int64_t const last_write_time =
+            detail::get_last_write_time(filesystem::path(path));
+        if (last_write_time == 0)
+            return nullptr;
+
+        component_cache::directory& dir = cache.directories[path];
+        dir.last_write_time = last_write_time;
+        dir.modules.clear();
+        cache.modified = true;
+        return &dir;
+    }
+
+    bool add_component_cache_module(component_cache::directory& dir,
+        std::string const& path, std::string const& name)
+    {
+        filesystem::path const p(path);
+
+        component_cache::module m;
+        m.path = path;
+        m.name = name;
+        m.last_write_time = detail::get_last_write_time(p);
+        if (m.last_write_time == 0 || !detail::get_file_size(p, m.file_size))
+            return false;
+
+        dir.modules.push_back(HPX_MOVE(m));
+        return true;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     std::vector<std::shared_ptr<plugins::plugin_registry_base>>
     init_ini_data_default(std::string const& libs, util::section& ini,
         std::map<std::string, filesystem::path>& basenames,
         std::map<std::string, hpx::util::plugin::dll>& modules,
         std::vector<std::shared_ptr<components::component_registry_base>>&
-            component_registries)
+            component_registries,
+        component_cache* cache)
     {
         namespace fs = filesystem;
 
@@ -409,6 +651,9 @@ namespace hpx { namespace util {
 
         // list of modules to load
         std::vector<std::pair<fs::path, std::string>> libdata;
+
+        // the cache entry for this directory, if it has to be (re-)created
+        component_cache::directory* cache_entry = nullptr;
         try
         {
             fs::directory_iterator nodir;
@@ -428,52 +673,89 @@ namespace hpx { namespace util {
                 hpx_sec->add_section("components", comp_sec);
             }
 
-            // generate component sections for all found shared libraries
-            // this will create too many sections, but the non-components will
-            // be filtered out during loading
-            for (fs::directory_iterator dir(libs_path); dir != nodir; ++dir)
+            // all candidates for modules, either from the cache or found by
+            // scanning the directory
+            std::vector<std::pair<fs::path, std::string>> candidates;
+
+            component_cache::directory const* cached = cache != nullptr ?
+                find_component_cache_directory(*cache, libs) :
+                nullptr;
+            if (cached != nullptr)
             {
-                fs::path curr(*dir);
-                if (curr.extension() != HPX_SHARED_LIB_EXTENSION)
-                    continue;
+                // neither the directory nor the modules in it were modified
+                // since it was scanned last
+                for (auto const& m : cached->modules)
+                {
+                    candidates.emplace_back(fs::path(m.path), m.name);
+                }
+            }
+            else
+            {
+                if (cache != nullptr)
+                {
+                    cache_entry = add_component_cache_directory(*cache, libs);
+                }
 
-                // instance name and module name are the same
-                std::string name(fs::basename(curr));    //-V821
+                // generate component sections for all found shared libraries
+                // this will create too many sections, but the non-components
+                // will be filtered out during loading
+                for (fs::directory_iterator dir(libs_path); dir != nodir; ++dir)
+                {
+                    fs::path curr(*dir);
+                    if (curr.extension() != HPX_SHARED_LIB_EXTENSION)
+                        continue;
+
+                    // instance name and module name are the same
+                    std::string name(fs::basename(curr));    //-V821
 
 #if !defined(HPX_WINDOWS)
-                if (0 == name.find("lib"))
-                    name = name.substr(3);
+                    if (0 == name.find("lib"))
+                        name = name.substr(3);
 #endif
 #if defined(__APPLE__)    // shared library version is added berfore extension
-                const std::string version = hpx::full_version_as_string();
-                std::string::size_type i = name.find(version);
-                if (i != std::string::npos)
-                    name.erase(
-                        i - 1, version.length() + 1);    // - 1 for one more dot
+                    const std::string version = hpx::full_version_as_string();
+                    std::string::size_type i = name.find(version);
+                    if (i != std::string::npos)
+                        name.erase(i - 1,
+                            version.length() + 1);    // - 1 for one more dot
 #endif
-                // ensure base directory, remove symlinks, etc.
-                std::error_code fsec;
-                fs::path canonical_curr =
-                    fs::canonical(curr, fs::initial_path(), fsec);
-                if (fsec)
-                    canonical_curr = curr;
+                    // ensure base directory, remove symlinks, etc.
+                    std::error_code fsec;
+                    fs::path canonical_curr =
+                        fs::canonical(curr, fs::initial_path(), fsec);
+                    if (fsec)
+                        canonical_curr = curr;
+
+                    candidates.emplace_back(HPX_MOVE(canonical_curr), name);
+                }
+            }
 
+            for (auto& candidate : candidates)
+            {
                 // make sure every module name is loaded exactly once, the
                 // first occurrence of a module name is used
-                std::string basename = canonical_curr.filename().string();
+                std::string basename = candidate.first.filename().string();
                 std::pair<std::map<std::string, fs::path>::iterator, bool> p =
-                    basenames.emplace(basename, canonical_curr);
+                    basenames.emplace(basename, candidate.first);
 
                 if (p.second)
                 {
-                    libdata.emplace_back(canonical_curr, name);
+                    libdata.emplace_back(HPX_MOVE(candidate));
                 }
                 else
                 {
                     LRT_(warning).format(
                         "skipping module {} ({}): ignored because of: {}",
-                        basename, canonical_curr.string(),
+                        basename, candidate.first.string(),
                         p.first->second.string());
+
+                    // it is unknown whether the skipped library is a module,
+                    // don't cache this directory
+                    if (cache_entry != nullptr)
+                    {
+                        cache->directories.erase(libs);
+                        cache_entry = nullptr;
+                    }
                 }
             }
         }
@@ -549,6 +831,15 @@ namespace hpx { namespace util {
             // store loaded library for future use
             if (must_keep_loaded)
             {
+                if (cache_entry != nullptr &&
+                    !add_component_cache_module(
+                        *cache_entry, p.first.string(), p.second))
+                {
+                    // don't cache a directory holding modules which can't
+                    // be verified later on
+                    cache->directories.erase(libs);
+                    cache_entry = nullptr;
+                }
                 modules.emplace(p.second, HPX_MOVE(d));
             }
         }
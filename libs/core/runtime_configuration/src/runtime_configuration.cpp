@@ -109,6 +109,8 @@ namespace hpx { namespace util {
                 HPX_INI_PATH_DELIMITER "$[system.executable_prefix]",
             "component_path_suffixes = " +
                 detail::convert_delimiters(HPX_DEFAULT_COMPONENT_PATH_SUFFIXES),
+            "component_cache = ${HPX_COMPONENT_CACHE}",
+            "print_startup_times = ${HPX_PRINT_STARTUP_TIMES:0}",
             "master_ini_path = $[hpx.location]" HPX_INI_PATH_DELIMITER
             "$[system.executable_prefix]/",
             "master_ini_path_suffixes = /share/" HPX_BASE_DIR_NAME
@@ -186,6 +188,14 @@ namespace hpx { namespace util {
                 HPX_PP_EXPAND(HPX_HAVE_THREAD_BACKTRACE_DEPTH)) "}",
 #if !defined(HPX_WINDOWS)
             "handle_signals = ${HPX_HANDLE_SIGNALS:1}",
+#endif
+#if defined(HPX_HAVE_TASK_TRACING)
+            // record a timeline of task events and write it to the given file
+            "[hpx.task_tracing]",
+            "file = ${HPX_TASK_TRACING_FILE:}",
+            "buffer_size = ${HPX_TASK_TRACING_BUFFER_SIZE:65536}",
+            "sampling_rate = ${HPX_TASK_TRACING_SAMPLING_RATE:1}",
+
 #endif
             // arity for collective operations implemented in a tree fashion
             "[hpx.lcos.collectives]",
@@ -304,6 +314,8 @@ namespace hpx { namespace util {
             "${HPX_AGAS_MAX_PENDING_REFCNT_REQUESTS:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(
                     HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS)) "}",
+            "max_pending_refcnt_delay = "
+            "${HPX_AGAS_MAX_PENDING_REFCNT_DELAY:100}",
             "service_mode = hosted",
             "local_cache_size = ${HPX_AGAS_LOCAL_CACHE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PP_EXPAND(HPX_AGAS_LOCAL_CACHE_SIZE)) "}",
@@ -380,6 +392,8 @@ namespace hpx { namespace util {
             "format = ${HPX_LOGFORMAT:" HPX_LOGFORMAT
                 "P%parentloc%/%hpxparent%.%hpxparentphase% %time%("
                 HPX_TIMEFORMAT ") [%idx%]|\\n}",
+            "async = ${HPX_LOGASYNC:0}",
+            "async_buffer_size = ${HPX_LOGASYNC_BUFFER_SIZE:1048576}",
 
             // general console logging
             "[hpx.logging.console]",
@@ -545,7 +559,8 @@ namespace hpx { namespace util {
         std::vector<std::shared_ptr<components::component_registry_base>>&
             component_registries,
         std::string const& path, std::set<std::string>& component_paths,
-        std::map<std::string, filesystem::path>& basenames)
+        std::map<std::string, filesystem::path>& basenames,
+        component_cache* cache)
     {
         namespace fs = filesystem;
 
@@ -572,7 +587,7 @@ namespace hpx { namespace util {
                 {
                     plugin_list_type tmp_regs =
                         util::init_ini_data_default(this_path.string(), *this,
-                            basenames, modules_, component_registries);
+                            basenames, modules_, component_registries, cache);
 
                     std::copy(tmp_regs.begin(), tmp_regs.end(),
                         std::back_inserter(plugin_registries));
@@ -589,7 +604,8 @@ namespace hpx { namespace util {
         std::string const& component_base_paths,
         std::string const& component_path_suffixes,
         std::set<std::string>& component_paths,
-        std::map<std::string, filesystem::path>& basenames)
+        std::map<std::string, filesystem::path>& basenames,
+        component_cache* cache)
     {
         namespace fs = filesystem;
 
@@ -613,13 +629,13 @@ namespace hpx { namespace util {
                     std::string p = path;
                     p += *jt;
                     load_component_path(plugin_registries, component_registries,
-                        p, component_paths, basenames);
+                        p, component_paths, basenames, cache);
                 }
             }
             else
             {
                 load_component_path(plugin_registries, component_registries,
-                    path, component_paths, basenames);
+                    path, component_paths, basenames, cache);
             }
         }
     }
@@ -642,6 +658,15 @@ namespace hpx { namespace util {
         // plugin registry object
         plugin_list_type plugin_registries;
 
+        // the results of scanning the directories during earlier runs
+        std::string const cache_file(get_entry("hpx.component_cache", ""));
+        component_cache cache;
+        if (!cache_file.empty())
+        {
+            read_component_cache(cache_file, cache);
+        }
+        component_cache* cache_ptr = cache_file.empty() ? nullptr : &cache;
+
         // load plugin paths from component_base_paths and suffixes
         std::string component_base_paths(
             get_entry("hpx.component_base_paths", HPX_DEFAULT_COMPONENT_PATH));
@@ -650,12 +675,17 @@ namespace hpx { namespace util {
 
         load_component_paths(plugin_registries, component_registries,
             component_base_paths, component_path_suffixes, component_paths,
-            basenames);
+            basenames, cache_ptr);
 
         // load additional explicit plugin paths from plugin_paths key
         std::string plugin_paths(get_entry("hpx.component_paths", ""));
         load_component_paths(plugin_registries, component_registries,
-            plugin_paths, "", component_paths, basenames);
+            plugin_paths, "", component_paths, basenames, cache_ptr);
+
+        if (!cache_file.empty())
+        {
+            write_component_cache(cache_file, cache);
+        }
 
         // read system and user ini files _again_, to allow the user to
         // overwrite the settings from the default component ini's.
@@ -922,6 +952,17 @@ namespace hpx { namespace util {
         return HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS;
     }
 
+    std::size_t runtime_configuration::get_agas_max_pending_refcnt_delay()
+        const
+    {
+        if (util::section const* sec = get_section("hpx.agas"); nullptr != sec)
+        {
+            return hpx::util::get_entry_as<std::size_t>(
+                *sec, "max_pending_refcnt_delay", 100);
+        }
+        return 100;
+    }
+
     bool runtime_configuration::get_itt_notify_mode() const
     {
 #if HPX_HAVE_ITTNOTIFY != 0
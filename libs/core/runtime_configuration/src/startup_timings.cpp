@@ -0,0 +1,88 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::util {
+
+    namespace {
+
+        struct startup_timings
+        {
+            using clock_type = std::chrono::steady_clock;
+
+            std::mutex mtx_;
+            clock_type::time_point start_ = clock_type::now();
+            clock_type::time_point last_ = start_;
+            std::vector<std::pair<std::string, double>> phases_;
+        };
+
+        startup_timings& get_startup_timings()
+        {
+            static startup_timings timings;
+            return timings;
+        }
+    }    // namespace
+
+    void reset_startup_timings()
+    {
+        startup_timings& t = get_startup_timings();
+
+        std::lock_guard<std::mutex> l(t.mtx_);
+        t.start_ = startup_timings::clock_type::now();
+        t.last_ = t.start_;
+        t.phases_.clear();
+    }
+
+    void record_startup_phase(char const* phase)
+    {
+        startup_timings& t = get_startup_timings();
+        auto const now = startup_timings::clock_type::now();
+
+        std::lock_guard<std::mutex> l(t.mtx_);
+        double const elapsed =
+            std::chrono::duration<double>(now - t.last_).count();
+        t.last_ = now;
+
+        auto it = std::find_if(t.phases_.begin(), t.phases_.end(),
+            [phase](auto const& p) { return p.first == phase; });
+        if (it != t.phases_.end())
+        {
+            it->second += elapsed;
+        }
+        else
+        {
+            t.phases_.emplace_back(phase, elapsed);
+        }
+    }
+
+    void print_startup_timings(std::ostream& os)
+    {
+        startup_timings& t = get_startup_timings();
+
+        std::lock_guard<std::mutex> l(t.mtx_);
+
+        os << "startup phases [s]:\n";
+        for (auto const& p : t.phases_)
+        {
+            os << "  " << std::left << std::setw(24) << p.first << std::right
+               << p.second << "\n";
+        }
+        os << "  " << std::left << std::setw(24) << "total" << std::right
+           << std::chrono::duration<double>(t.last_ - t.start_).count()
+           << std::endl;
+    }
+}    // namespace hpx::util
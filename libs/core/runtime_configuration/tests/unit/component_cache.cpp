@@ -0,0 +1,245 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_configuration/init_ini_data.hpp>
+#include <hpx/version.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+
+using hpx::util::component_cache;
+
+///////////////////////////////////////////////////////////////////////////////
+// A temporary directory holding two (fake) modules, removed on destruction.
+struct test_directory
+{
+    test_directory()
+      : path_(std::filesystem::temp_directory_path() /
+            ("hpx_component_cache_" + std::to_string(std::random_device{}())))
+    {
+        std::filesystem::create_directories(path_);
+        write(module1(), "module1");
+        write(module2(), "module2");
+    }
+
+    ~test_directory()
+    {
+        std::error_code ec;
+        std::filesystem::remove_all(path_, ec);
+        std::filesystem::remove(cache_file(), ec);
+    }
+
+    static void write(std::string const& file, std::string const& content,
+        std::ios_base::openmode mode = std::ios_base::trunc)
+    {
+        std::ofstream out(file, std::ios_base::out | mode);
+        out << content;
+    }
+
+    std::string path() const
+    {
+        return path_.string();
+    }
+    std::string module1() const
+    {
+        return (path_ / "libmodule1.so").string();
+    }
+    std::string module2() const
+    {
+        return (path_ / "libmodule2.so").string();
+    }
+    // writing the cache file must not modify the cached directory
+    std::string cache_file() const
+    {
+        return path_.string() + ".cache";
+    }
+
+    // create the cache entry of the directory
+    component_cache create_cache() const
+    {
+        component_cache cache;
+        component_cache::directory* dir =
+            hpx::util::add_component_cache_directory(cache, path());
+        HPX_TEST(dir != nullptr);
+        HPX_TEST(cache.modified);
+        if (dir != nullptr)
+        {
+            HPX_TEST(hpx::util::add_component_cache_module(
+                *dir, module1(), "module1"));
+            HPX_TEST(hpx::util::add_component_cache_module(
+                *dir, module2(), "module2"));
+        }
+        return cache;
+    }
+
+    std::filesystem::path path_;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+void test_load()
+{
+    test_directory d;
+
+    component_cache cache = d.create_cache();
+    HPX_TEST(hpx::util::find_component_cache_directory(cache, d.path()) !=
+        nullptr);
+    HPX_TEST(
+        hpx::util::find_component_cache_directory(cache, d.path() + "x") ==
+        nullptr);
+
+    hpx::util::write_component_cache(d.cache_file(), cache);
+
+    component_cache loaded;
+    HPX_TEST(hpx::util::read_component_cache(d.cache_file(), loaded));
+    HPX_TEST(!loaded.modified);
+    HPX_TEST_EQ(loaded.directories.size(), std::size_t(1));
+
+    component_cache::directory const* dir =
+        hpx::util::find_component_cache_directory(loaded, d.path());
+    HPX_TEST(dir != nullptr);
+    if (dir == nullptr)
+        return;
+
+    component_cache::directory const& expected =
+        cache.directories.begin()->second;
+    HPX_TEST_EQ(dir->last_write_time, expected.last_write_time);
+    HPX_TEST_EQ(dir->modules.size(), std::size_t(2));
+    for (std::size_t i = 0; i != dir->modules.size(); ++i)
+    {
+        HPX_TEST_EQ(dir->modules[i].path, expected.modules[i].path);
+        HPX_TEST_EQ(dir->modules[i].name, expected.modules[i].name);
+        HPX_TEST_EQ(dir->modules[i].last_write_time,
+            expected.modules[i].last_write_time);
+        HPX_TEST_EQ(dir->modules[i].file_size, expected.modules[i].file_size);
+    }
+    HPX_TEST_EQ(dir->modules[0].file_size, std::uint64_t(7));
+
+    // an unmodified cache is not written
+    std::filesystem::remove(d.cache_file());
+    hpx::util::write_component_cache(d.cache_file(), loaded);
+    HPX_TEST(!std::filesystem::exists(d.cache_file()));
+}
+
+void test_invalidation()
+{
+    test_directory d;
+
+    // rebuilding a module (changing its size) invalidates the entry
+    {
+        component_cache cache = d.create_cache();
+        test_directory::write(d.module2(), "rebuilt", std::ios_base::app);
+        HPX_TEST(hpx::util::find_component_cache_directory(cache, d.path()) ==
+            nullptr);
+    }
+
+    // replacing a module (changing its modification time) invalidates the
+    // entry
+    {
+        component_cache cache = d.create_cache();
+        std::filesystem::last_write_time(d.module1(),
+            std::filesystem::last_write_time(d.module1()) -
+                std::chrono::hours(1));
+        HPX_TEST(hpx::util::find_component_cache_directory(cache, d.path()) ==
+            nullptr);
+    }
+
+    // adding or removing modules changes the directory
+    {
+        component_cache cache = d.create_cache();
+        std::filesystem::last_write_time(d.path_,
+            std::filesystem::last_write_time(d.path_) -
+                std::chrono::hours(1));
+        HPX_TEST(hpx::util::find_component_cache_directory(cache, d.path()) ==
+            nullptr);
+    }
+
+    // a removed module invalidates the entry
+    {
+        component_cache cache = d.create_cache();
+        std::filesystem::remove(d.module2());
+        HPX_TEST(hpx::util::find_component_cache_directory(cache, d.path()) ==
+            nullptr);
+    }
+
+    // a missing directory can't be cached
+    component_cache cache;
+    HPX_TEST(hpx::util::add_component_cache_directory(
+                 cache, d.path() + "/missing") == nullptr);
+    HPX_TEST(!cache.modified);
+}
+
+// Corrupt cache files are rejected without throwing, leaving the cache empty.
+void test_corruption()
+{
+    test_directory d;
+
+    std::string const header =
+        "# HPX component cache, version " + hpx::full_version_as_string() +
+        "\n";
+    std::string const valid = "directory 42 " + d.path() + "\n" +
+        "module 42 7 module1 " + d.module1() + "\n";
+
+    component_cache cache;
+    HPX_TEST(!hpx::util::read_component_cache(d.cache_file(), cache));
+
+    test_directory::write(d.cache_file(), header + valid);
+    HPX_TEST(hpx::util::read_component_cache(d.cache_file(), cache));
+    HPX_TEST_EQ(cache.directories.size(), std::size_t(1));
+
+    char const* const corrupt_files[] = {
+        // a different version of HPX
+        "# HPX component cache, version 0.0.0\n",
+        // invalid times and sizes
+        "directory 4x2 /lib\n",
+        "directory 99999999999999999999999 /lib\n",
+        "directory /lib\n",
+        "module 42 x module1 /lib/libmodule1.so\n",
+        // missing fields
+        "module 42 7 module1\n",
+        "module 42 7\n",
+        "module\n",
+        // unknown entry
+        "library 42 7 module1 /lib/libmodule1.so\n",
+    };
+
+    for (char const* corrupt : corrupt_files)
+    {
+        std::string const content =
+            corrupt[0] == '#' ? std::string(corrupt) : header + corrupt;
+        test_directory::write(d.cache_file(), content);
+
+        component_cache c;
+        HPX_TEST(!hpx::util::read_component_cache(d.cache_file(), c));
+        HPX_TEST(c.directories.empty());
+
+        // also after a valid directory entry
+        if (corrupt[0] != '#')
+        {
+            test_directory::write(d.cache_file(), header + valid + corrupt);
+            HPX_TEST(!hpx::util::read_component_cache(d.cache_file(), c));
+            HPX_TEST(c.directories.empty());
+        }
+    }
+
+    // a module entry has to follow a directory entry
+    test_directory::write(
+        d.cache_file(), header + "module 42 7 module1 " + d.module1() + "\n");
+    HPX_TEST(!hpx::util::read_component_cache(d.cache_file(), cache));
+}
+
+int main()
+{
+    test_load();
+    test_invalidation();
+    test_corruption();
+
+    return hpx::util::report_errors();
+}
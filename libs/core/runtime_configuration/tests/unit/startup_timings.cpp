@@ -0,0 +1,92 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/modules/testing.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::string> split_lines(std::string const& s)
+{
+    std::vector<std::string> lines;
+    std::istringstream is(s);
+    for (std::string line; std::getline(is, line);)
+    {
+        lines.push_back(line);
+    }
+    return lines;
+}
+
+// Return the time printed for the given phase, or a negative value if the
+// phase is not listed.
+double phase_time(
+    std::vector<std::string> const& lines, std::string const& phase)
+{
+    for (std::string const& line : lines)
+    {
+        std::istringstream is(line);
+        std::string name;
+        double time = -1.0;
+        if (is >> name >> time && name == phase)
+        {
+            return time;
+        }
+    }
+    return -1.0;
+}
+
+void test_startup_timings()
+{
+    hpx::util::reset_startup_timings();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    hpx::util::record_startup_phase("first");
+    hpx::util::record_startup_phase("second");
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    hpx::util::record_startup_phase("first");
+
+    std::ostringstream os;
+    hpx::util::print_startup_timings(os);
+    std::vector<std::string> const lines = split_lines(os.str());
+
+    // phases recorded more than once are listed once, in the order they
+    // were first recorded, followed by the overall time
+    HPX_TEST_EQ(lines.size(), std::size_t(4));
+    HPX_TEST_EQ(lines[0], std::string("startup phases [s]:"));
+    HPX_TEST_EQ(lines[1].compare(0, 7, "  first"), 0);
+    HPX_TEST_EQ(lines[2].compare(0, 8, "  second"), 0);
+    HPX_TEST_EQ(lines[3].compare(0, 7, "  total"), 0);
+
+    // the times of repeated phases are added up
+    double const first = phase_time(lines, "first");
+    double const second = phase_time(lines, "second");
+    double const total = phase_time(lines, "total");
+    HPX_TEST_LTE(0.04, first);
+    HPX_TEST_LTE(0.0, second);
+    HPX_TEST_LTE(first + second, total * 1.0001);
+
+    // resetting discards all phases
+    hpx::util::reset_startup_timings();
+
+    std::ostringstream os2;
+    hpx::util::print_startup_timings(os2);
+    std::vector<std::string> const reset_lines = split_lines(os2.str());
+    HPX_TEST_EQ(reset_lines.size(), std::size_t(2));
+    HPX_TEST_EQ(phase_time(reset_lines, "total"), 0.0);
+}
+
+int main()
+{
+    test_startup_timings();
+
+    return hpx::util::report_errors();
+}
@@ -19,6 +19,7 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/modules/threadmanager.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
 #include <hpx/runtime_local/config_entry.hpp>
 #include <hpx/runtime_local/custom_exception_info.hpp>
 #include <hpx/runtime_local/debugging.hpp>
@@ -37,6 +38,7 @@
 #include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/topology/topology.hpp>
 #include <hpx/util/from_string.hpp>
+#include <hpx/util/get_entry_as.hpp>
 #include <hpx/version.hpp>
 
 #include <atomic>
@@ -1324,6 +1326,8 @@ namespace hpx {
         bool caught_exception = false;
         try
         {
+            util::record_startup_phase("runtime start");
+
             // no need to do late command line handling if this is called from
             // the distributed runtime
             if (handle_print_bind != nullptr)
@@ -1353,6 +1357,13 @@ namespace hpx {
                 call_startup_functions(false);
                 lbt_ << "(4th stage) run_helper: ran startup functions";
             }
+            util::record_startup_phase("startup functions");
+
+            if (util::get_entry_as<int>(
+                    get_config(), "hpx.print_startup_times", 0) != 0)
+            {
+                util::print_startup_timings(std::cout);
+            }
 
             lbt_ << "(4th stage) runtime::run_helper: bootstrap complete";
             set_state(hpx::state::running);
@@ -1598,6 +1609,13 @@ namespace hpx {
             LRT_(info).format("runtime_local: stopped all services");
         }
 
+#if defined(HPX_HAVE_LOGGING)
+        // write the records still held by the asynchronous logging backend
+        // and stop its background thread, everything logged from now on is
+        // written synchronously
+        util::logging::disable_async_logging();
+#endif
+
 #ifdef HPX_HAVE_TIMER_POOL
         LTM_(info).format("stop: stopping timer pool");
         timer_pool_.stop();
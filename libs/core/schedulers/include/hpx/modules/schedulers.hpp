@@ -9,6 +9,7 @@
 #include <hpx/config.hpp>
 
 #include <hpx/schedulers/background_scheduler.hpp>
+#include <hpx/schedulers/deadline_queue_scheduler.hpp>
 #include <hpx/schedulers/local_priority_queue_scheduler.hpp>
 #include <hpx/schedulers/local_queue_scheduler.hpp>
 #include <hpx/schedulers/shared_priority_queue_scheduler.hpp>
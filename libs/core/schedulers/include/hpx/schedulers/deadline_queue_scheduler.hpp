@@ -0,0 +1,421 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/schedulers/local_queue_scheduler.hpp>
+#include <hpx/schedulers/lockfree_queue_backends.hpp>
+#include <hpx/schedulers/thread_queue.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/timing/steady_clock.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::threads::policies {
+
+    ///////////////////////////////////////////////////////////////////////////
+#if defined(HPX_HAVE_CXX11_STD_ATOMIC_128BIT)
+    using default_deadline_queue_scheduler_terminated_queue = lockfree_lifo;
+#else
+    using default_deadline_queue_scheduler_terminated_queue = lockfree_fifo;
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The deadline_queue_scheduler is a local_queue_scheduler which
+    /// additionally maintains one heap of threads ordered by their deadline
+    /// per OS thread (earliest deadline first). Threads with a deadline (see
+    /// \a hpx::threads::set_thread_deadline) are always placed into those
+    /// heaps, all other threads are handled as by the local_queue_scheduler.
+    ///
+    /// An OS thread runs the thread with the earliest deadline from its own
+    /// heap first. If its heap is empty, it steals the thread with the
+    /// earliest deadline from the heaps of all other OS threads (if stealing
+    /// is enabled) before looking at the threads without a deadline. Threads
+    /// without a deadline will therefore only run while no thread with a
+    /// deadline is waiting.
+    ///
+    /// Threads which start running only after their deadline has passed are
+    /// counted as deadline misses.
+    template <typename Mutex = std::mutex,
+        typename PendingQueuing = lockfree_fifo,
+        typename StagedQueuing = lockfree_fifo,
+        typename TerminatedQueuing =
+            default_deadline_queue_scheduler_terminated_queue>
+    class deadline_queue_scheduler final
+      : public local_queue_scheduler<Mutex, PendingQueuing, StagedQueuing,
+            TerminatedQueuing>
+    {
+    public:
+        using base_type = local_queue_scheduler<Mutex, PendingQueuing,
+            StagedQueuing, TerminatedQueuing>;
+
+        using thread_queue_type = typename base_type::thread_queue_type;
+        using init_parameter_type = typename base_type::init_parameter_type;
+
+        explicit deadline_queue_scheduler(init_parameter_type const& init,
+            bool deferred_initialization = true)
+          : base_type(init, deferred_initialization)
+          , deadline_queues_(init.num_queues_)
+        {
+        }
+
+        static std::string_view get_scheduler_name()
+        {
+            return "deadline_queue_scheduler";
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        std::int64_t get_num_deadline_misses(
+            std::size_t num_thread, bool reset) override
+        {
+            if (std::size_t(-1) != num_thread)
+            {
+                HPX_ASSERT(num_thread < deadline_queues_.size());
+                return util::get_and_reset_value(
+                    deadline_queues_[num_thread].misses_, reset);
+            }
+
+            std::int64_t count = 0;
+            for (deadline_queue& q : deadline_queues_)
+            {
+                count += util::get_and_reset_value(q.misses_, reset);
+            }
+            return count;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // create a new thread and schedule it if the initial state is equal to
+        // pending
+        void create_thread(thread_init_data& data, thread_id_ref_type* id,
+            error_code& ec) override
+        {
+            if (data.deadline == 0 ||
+                data.initial_state != thread_schedule_state::pending)
+            {
+                base_type::create_thread(data, id, ec);
+                return;
+            }
+
+            std::size_t const num_thread = select_queue(data.schedulehint);
+
+            // Threads with a deadline are created right away (staged threads
+            // would end up in the queues of the base scheduler) and are
+            // scheduled by putting them into the heap.
+            data.run_now = true;
+            data.initial_state = thread_schedule_state::suspended;
+
+            thread_id_ref_type thrd;
+            this->queues_[num_thread]->create_thread(data, &thrd, ec);
+            if (ec)
+                return;
+
+            get_thread_id_data(thrd)->set_state(thread_schedule_state::pending);
+            if (id)
+            {
+                *id = thrd;
+            }
+
+            LTM_(debug)
+                .format("deadline_queue_scheduler::create_thread: pool({}), "
+                        "scheduler({}), worker_thread({}), thread({}), "
+                        "deadline({})",
+                    *this->get_parent_pool(), *this, num_thread, thrd,
+                    data.deadline)
+#ifdef HPX_HAVE_THREAD_DESCRIPTION
+                .format(", description({})", data.description)
+#endif
+                ;
+
+            push(num_thread, HPX_MOVE(thrd), true);
+        }
+
+        // Return the next thread to be executed, return false if none is
+        // available
+        bool get_next_thread(std::size_t num_thread, bool running,
+            threads::thread_id_ref_type& thrd, bool enable_stealing)
+        {
+            HPX_ASSERT(num_thread < deadline_queues_.size());
+
+            if (pop(num_thread, num_thread, thrd))
+            {
+                return true;
+            }
+
+            if (running && enable_stealing)
+            {
+                // steal the thread with the earliest deadline of all other OS
+                // threads
+                std::size_t const queues_size = deadline_queues_.size();
+                std::size_t victim = std::size_t(-1);
+                std::uint64_t earliest = no_deadline;
+                for (std::size_t i = 1; i != queues_size; ++i)
+                {
+                    std::size_t const idx = (i + num_thread) % queues_size;
+                    std::uint64_t const deadline =
+                        deadline_queues_[idx].earliest_.load(
+                            std::memory_order_relaxed);
+                    if (deadline < earliest)
+                    {
+                        earliest = deadline;
+                        victim = idx;
+                    }
+                }
+
+                if (victim != std::size_t(-1) &&
+                    pop(victim, num_thread, thrd))
+                {
+                    this->queues_[victim]->increment_num_stolen_from_pending();
+                    this->queues_[num_thread]
+                        ->increment_num_stolen_to_pending();
+                    return true;
+                }
+            }
+
+            return base_type::get_next_thread(
+                num_thread, running, thrd, enable_stealing);
+        }
+
+        // Schedule the passed thread
+        void schedule_thread(threads::thread_id_ref_type thrd,
+            threads::thread_schedule_hint schedulehint, bool allow_fallback,
+            thread_priority priority = thread_priority::default_) override
+        {
+            if (get_thread_id_data(thrd)->get_deadline() == 0)
+            {
+                base_type::schedule_thread(
+                    HPX_MOVE(thrd), schedulehint, allow_fallback, priority);
+                return;
+            }
+
+            HPX_ASSERT(get_thread_id_data(thrd)->get_scheduler_base() == this);
+            push(select_queue(schedulehint, allow_fallback), HPX_MOVE(thrd),
+                false);
+        }
+
+        // Threads with the same deadline are run in the order they were
+        // scheduled, thus scheduling a thread 'last' is the same as scheduling
+        // it normally.
+        void schedule_thread_last(threads::thread_id_ref_type thrd,
+            threads::thread_schedule_hint schedulehint, bool allow_fallback,
+            thread_priority priority = thread_priority::default_) override
+        {
+            if (get_thread_id_data(thrd)->get_deadline() == 0)
+            {
+                base_type::schedule_thread_last(
+                    HPX_MOVE(thrd), schedulehint, allow_fallback, priority);
+                return;
+            }
+
+            HPX_ASSERT(get_thread_id_data(thrd)->get_scheduler_base() == this);
+            push(select_queue(schedulehint, allow_fallback), HPX_MOVE(thrd),
+                false);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // This returns the current length of the queues (work items, new items
+        // and threads waiting in the heaps)
+        std::int64_t get_queue_length(
+            std::size_t num_thread = std::size_t(-1)) const override
+        {
+            std::int64_t count = base_type::get_queue_length(num_thread);
+            if (std::size_t(-1) != num_thread)
+            {
+                HPX_ASSERT(num_thread < deadline_queues_.size());
+                return count +
+                    deadline_queues_[num_thread].size_.load(
+                        std::memory_order_relaxed);
+            }
+
+            for (deadline_queue const& q : deadline_queues_)
+            {
+                count += q.size_.load(std::memory_order_relaxed);
+            }
+            return count;
+        }
+
+        // Queries whether a given core is idle
+        bool is_core_idle(std::size_t num_thread) const override
+        {
+            return base_type::is_core_idle(num_thread) &&
+                deadline_queues_[num_thread].size_.load(
+                    std::memory_order_relaxed) == 0;
+        }
+
+        // This is a function which gets called periodically by the thread
+        // manager to allow for maintenance tasks to be executed in the
+        // scheduler. Returns true if the OS thread calling this function has to
+        // be terminated (i.e. no more work has to be done).
+        bool wait_or_add_new(std::size_t num_thread, bool running,
+            std::int64_t& idle_loop_count, bool enable_stealing,
+            std::size_t& added, thread_id_ref_type* next_thrd = nullptr)
+        {
+            bool const result = base_type::wait_or_add_new(num_thread, running,
+                idle_loop_count, enable_stealing, added, next_thrd);
+
+            // threads waiting in the heap keep this OS thread alive
+            return result &&
+                deadline_queues_[num_thread].size_.load(
+                    std::memory_order_relaxed) == 0;
+        }
+
+    private:
+        static constexpr std::uint64_t no_deadline =
+            (std::numeric_limits<std::uint64_t>::max)();
+
+        static std::uint64_t now() noexcept
+        {
+            return static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    hpx::chrono::steady_clock::now().time_since_epoch())
+                    .count());
+        }
+
+        struct deadline_entry
+        {
+            std::uint64_t deadline_;
+            std::uint64_t sequence_;
+            thread_id_ref_type thrd_;
+            bool first_run_;    // the thread has not run yet
+        };
+
+        // std::push_heap and friends build a max-heap, the entry with the
+        // earliest deadline has to be on top
+        struct later
+        {
+            bool operator()(deadline_entry const& lhs,
+                deadline_entry const& rhs) const noexcept
+            {
+                return lhs.deadline_ > rhs.deadline_ ||
+                    (lhs.deadline_ == rhs.deadline_ &&
+                        lhs.sequence_ > rhs.sequence_);
+            }
+        };
+
+        struct deadline_queue
+        {
+            // must be called with mtx_ held
+            void update() noexcept
+            {
+                earliest_.store(
+                    heap_.empty() ? no_deadline : heap_.front().deadline_,
+                    std::memory_order_relaxed);
+                size_.store(static_cast<std::int64_t>(heap_.size()),
+                    std::memory_order_relaxed);
+            }
+
+            Mutex mtx_;
+            std::vector<deadline_entry> heap_;
+            std::uint64_t sequence_ = 0;
+
+            // allow to inspect the heap without acquiring the lock
+            std::atomic<std::uint64_t> earliest_{no_deadline};
+            std::atomic<std::int64_t> size_{0};
+
+            std::atomic<std::int64_t> misses_{0};
+        };
+
+        std::size_t select_queue(threads::thread_schedule_hint schedulehint,
+            bool allow_fallback = false)
+        {
+            // NOTE: This scheduler ignores NUMA hints.
+            std::size_t num_thread = std::size_t(-1);
+            if (schedulehint.mode == thread_schedule_hint_mode::thread)
+            {
+                num_thread = schedulehint.hint;
+            }
+            else
+            {
+                allow_fallback = false;
+            }
+
+            std::size_t const queue_size = this->queues_.size();
+            if (std::size_t(-1) == num_thread)
+            {
+                num_thread = this->curr_queue_++ % queue_size;
+            }
+            else if (num_thread >= queue_size)
+            {
+                num_thread %= queue_size;
+            }
+
+            return this->select_active_pu(num_thread, allow_fallback);
+        }
+
+        void push(std::size_t num_thread, thread_id_ref_type thrd,
+            bool first_run)
+        {
+            HPX_ASSERT(num_thread < deadline_queues_.size());
+
+            std::uint64_t const deadline =
+                get_thread_id_data(thrd)->get_deadline();
+
+            deadline_queue& q = deadline_queues_[num_thread];
+            {
+                std::lock_guard<Mutex> l(q.mtx_);
+                q.heap_.push_back(deadline_entry{
+                    deadline, q.sequence_++, HPX_MOVE(thrd), first_run});
+                std::push_heap(q.heap_.begin(), q.heap_.end(), later());
+                q.update();
+            }
+
+            this->do_some_work(num_thread);
+        }
+
+        // Take the thread with the earliest deadline from the heap of the OS
+        // thread 'num_queue' to be run by the OS thread 'num_thread'
+        bool pop(std::size_t num_queue, std::size_t num_thread,
+            thread_id_ref_type& thrd)
+        {
+            deadline_queue& q = deadline_queues_[num_queue];
+            if (q.size_.load(std::memory_order_relaxed) == 0)
+            {
+                return false;
+            }
+
+            deadline_entry entry;
+            {
+                std::lock_guard<Mutex> l(q.mtx_);
+                if (q.heap_.empty())
+                {
+                    return false;
+                }
+
+                std::pop_heap(q.heap_.begin(), q.heap_.end(), later());
+                entry = HPX_MOVE(q.heap_.back());
+                q.heap_.pop_back();
+                q.update();
+            }
+
+            if (entry.first_run_ && entry.deadline_ < now())
+            {
+                deadline_queues_[num_thread].misses_.fetch_add(
+                    1, std::memory_order_relaxed);
+            }
+
+            thrd = HPX_MOVE(entry.thrd_);
+            return true;
+        }
+
+        std::vector<util::cache_aligned_data_derived<deadline_queue>>
+            deadline_queues_;
+    };
+}    // namespace hpx::threads::policies
@@ -0,0 +1,205 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace hpx::serialization::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Type ids below this value are reserved for ids which are assigned
+    // explicitly (preassigned ids and ids handed out by locality 0 during
+    // startup), hashed type ids are always at or above this value.
+    inline constexpr std::uint32_t first_hashed_type_id = 0x10000;
+
+    // Compute the (stable) id of a type from its name using 32 bit FNV-1a.
+    // All localities compute the same id for the same name, which allows to
+    // use it on the wire without having to agree on it during startup.
+    constexpr std::uint32_t hashed_type_id(std::string_view name) noexcept
+    {
+        std::uint32_t hash = 2166136261u;
+        for (char const c : name)
+        {
+            hash ^= static_cast<std::uint8_t>(c);
+            hash *= 16777619u;
+        }
+
+        // keep clear of the explicitly assigned ids and of the invalid id
+        if (hash < first_hashed_type_id)
+        {
+            hash += first_hashed_type_id;
+        }
+        else if (hash == ~0u)
+        {
+            --hash;
+        }
+        return hash;
+    }
+
+    // Compute a 64 bit fingerprint of a type name (64 bit FNV-1a). Locality
+    // 0 uses the fingerprints to detect types on different localities which
+    // share the same hashed id without having to exchange all type names.
+    constexpr std::uint64_t type_name_fingerprint(
+        std::string_view name) noexcept
+    {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (char const c : name)
+        {
+            hash ^= static_cast<std::uint8_t>(c);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A flat open addressing table mapping type ids to factories, used to
+    // dispatch incoming ids (hashed or explicitly assigned) without touching
+    // any type names.
+    template <typename T>
+    class id_dispatch_table
+    {
+    public:
+        static constexpr std::uint32_t empty_id = ~0u;
+
+        id_dispatch_table() = default;
+
+        T const* find(std::uint32_t id) const noexcept
+        {
+            if (size_ == 0)
+            {
+                return nullptr;
+            }
+
+            std::size_t const mask = ids_.size() - 1;
+            for (std::size_t i = slot(id);; i = (i + 1) & mask)
+            {
+                if (ids_[i] == id)
+                {
+                    return &values_[i];
+                }
+                if (ids_[i] == empty_id)
+                {
+                    return nullptr;
+                }
+            }
+        }
+
+        void assign(std::uint32_t id, T value)
+        {
+            HPX_ASSERT(id != empty_id);
+
+            // keep the load factor below 1/2
+            if (2 * (size_ + 1) > ids_.size())
+            {
+                rehash(ids_.empty() ? 16 : 2 * ids_.size());
+            }
+
+            std::size_t const i = find_slot(id);
+            if (ids_[i] == empty_id)
+            {
+                ids_[i] = id;
+                ++size_;
+            }
+            values_[i] = HPX_MOVE(value);
+        }
+
+        void erase(std::uint32_t id) noexcept
+        {
+            if (size_ == 0)
+            {
+                return;
+            }
+
+            std::size_t i = find_slot(id);
+            if (ids_[i] == empty_id)
+            {
+                return;
+            }
+
+            // shift back all following entries of the same cluster which
+            // would not be reachable anymore once this slot is empty
+            std::size_t const mask = ids_.size() - 1;
+            for (std::size_t j = (i + 1) & mask; ids_[j] != empty_id;
+                 j = (j + 1) & mask)
+            {
+                std::size_t const home = slot(ids_[j]);
+                if (((j - home) & mask) >= ((j - i) & mask))
+                {
+                    ids_[i] = ids_[j];
+                    values_[i] = HPX_MOVE(values_[j]);
+                    i = j;
+                }
+            }
+
+            ids_[i] = empty_id;
+            values_[i] = T();
+            --size_;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+    private:
+        // Fibonacci hashing, spreads consecutive (explicitly assigned) ids
+        // evenly over the table
+        std::size_t slot(std::uint32_t id) const noexcept
+        {
+            return static_cast<std::size_t>(
+                static_cast<std::uint32_t>(id * 2654435769u) >> shift_);
+        }
+
+        std::size_t find_slot(std::uint32_t id) const noexcept
+        {
+            std::size_t const mask = ids_.size() - 1;
+            std::size_t i = slot(id);
+            while (ids_[i] != id && ids_[i] != empty_id)
+            {
+                i = (i + 1) & mask;
+            }
+            return i;
+        }
+
+        void rehash(std::size_t capacity)
+        {
+            std::vector<std::uint32_t> ids(capacity, empty_id);
+            std::vector<T> values(capacity);
+
+            std::swap(ids, ids_);
+            std::swap(values, values_);
+
+            shift_ = 32;
+            for (std::size_t c = capacity; c > 1; c >>= 1)
+            {
+                --shift_;
+            }
+
+            for (std::size_t k = 0; k != ids.size(); ++k)
+            {
+                if (ids[k] != empty_id)
+                {
+                    std::size_t const i = find_slot(ids[k]);
+                    ids_[i] = ids[k];
+                    values_[i] = HPX_MOVE(values[k]);
+                }
+            }
+        }
+
+        std::vector<std::uint32_t> ids_;
+        std::vector<T> values_;
+        std::size_t size_ = 0;
+        unsigned shift_ = 32;
+    };
+}    // namespace hpx::serialization::detail
@@ -13,6 +13,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/preprocessor/stringize.hpp>
+#include <hpx/serialization/detail/hashed_type_id.hpp>
 #include <hpx/serialization/detail/polymorphic_intrusive_factory.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/traits/polymorphic_traits.hpp>
@@ -24,12 +25,17 @@
 #include <map>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include <hpx/config/warnings_prefix.hpp>
 
 namespace hpx::serialization::detail {
 
+    // Every registered type is identified by the hash of its name (see
+    // hashed_type_id), which is the same on all localities. Types whose
+    // hashes collide are assigned ids explicitly by locality 0 during
+    // startup instead.
     class id_registry
     {
     public:
@@ -39,7 +45,8 @@ namespace hpx::serialization::detail {
         typedef void* (*ctor_t)();
         typedef std::map<std::string, ctor_t> typename_to_ctor_t;
         typedef std::map<std::string, std::uint32_t> typename_to_id_t;
-        typedef std::vector<ctor_t> cache_t;
+        typedef std::unordered_map<std::uint32_t, std::string> id_to_typename_t;
+        typedef id_dispatch_table<ctor_t> cache_t;
 
         static constexpr std::uint32_t invalid_id = ~0u;
 
@@ -51,6 +58,14 @@ namespace hpx::serialization::detail {
 
         HPX_CORE_EXPORT void fill_missing_typenames();
 
+        // Stop using the hashed id of the given type, e.g. because it
+        // collides with the hashed id of another type on locality 0.
+        HPX_CORE_EXPORT void retire_hashed_id(std::string const& type_name);
+
+        // Reserve a new explicitly assigned id, e.g. for a type registered
+        // on another locality only.
+        HPX_CORE_EXPORT std::uint32_t allocate_id();
+
         HPX_CORE_EXPORT std::uint32_t try_get_id(
             std::string const& type_name) const;
 
@@ -62,6 +77,15 @@ namespace hpx::serialization::detail {
         HPX_CORE_EXPORT std::vector<std::string> get_unassigned_typenames()
             const;
 
+        // Return the names of all registered types which can't be identified
+        // by their hashed id.
+        HPX_CORE_EXPORT std::vector<std::string> get_collided_typenames()
+            const;
+
+        // Return the names of all registered types which are identified by
+        // their hashed id.
+        HPX_CORE_EXPORT std::vector<std::string> get_hashed_typenames() const;
+
         HPX_CORE_EXPORT static id_registry& instance();
 
     private:
@@ -78,6 +102,10 @@ namespace hpx::serialization::detail {
         std::uint32_t max_id;
         typename_to_ctor_t typename_to_ctor;
         typename_to_id_t typename_to_id;
+
+        // hashed ids of all registered types, an empty name marks an id
+        // which can't be used as it is shared by more than one type
+        id_to_typename_t hashed_id_to_typename;
         cache_t cache;
     };
 
@@ -96,9 +124,9 @@ namespace hpx::serialization::detail {
         template <class T>
         static T* create(std::uint32_t id, std::string const* name = nullptr)
         {
-            cache_t const& vec = id_registry::instance().cache;
+            ctor_t const* ctor = id_registry::instance().cache.find(id);
 
-            if (id >= vec.size())    //-V104
+            if (ctor == nullptr)
             {
                 std::string msg(
                     "Unknown type descriptor " + std::to_string(id));
@@ -115,9 +143,8 @@ namespace hpx::serialization::detail {
                     "polymorphic_id_factory::create", msg);
             }
 
-            ctor_t ctor = vec[static_cast<std::size_t>(id)];
-            HPX_ASSERT(ctor != nullptr);    //-V108
-            return static_cast<T*>(ctor());
+            HPX_ASSERT(*ctor != nullptr);
+            return static_cast<T*>((*ctor)());
         }
 
         HPX_CORE_EXPORT static std::uint32_t get_id(
@@ -8,6 +8,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/serialization/detail/hashed_type_id.hpp>
 #include <hpx/serialization/detail/polymorphic_id_factory.hpp>
 
 #include <cstddef>
@@ -28,15 +29,7 @@ namespace hpx::serialization::detail {
 
     void id_registry::cache_id(std::uint32_t id, ctor_t ctor)
     {
-        if (id >= cache.size())    //-V104
-        {
-            cache.resize(std::size_t(id) + 1, nullptr);
-            cache[id] = ctor;    //-V108
-        }
-        else if (cache[id] == nullptr)    //-V108
-        {
-            cache[id] = ctor;    //-V108
-        }
+        cache.assign(id, ctor);
     }
 
     void id_registry::register_factory_function(
@@ -46,6 +39,21 @@ namespace hpx::serialization::detail {
 
         typename_to_ctor.emplace(type_name, ctor);
 
+        // verify that the hashed id of this type is unique, if not neither
+        // of the types sharing the id can use it
+        std::uint32_t const hashed_id = hashed_type_id(type_name);
+
+        auto p = hashed_id_to_typename.emplace(hashed_id, type_name);
+        if (p.second)
+        {
+            cache_id(hashed_id, ctor);
+        }
+        else if (p.first->second != type_name && !p.first->second.empty())
+        {
+            p.first->second.clear();
+            cache.erase(hashed_id);
+        }
+
         // populate cache
         typename_to_id_t::const_iterator it = typename_to_id.find(type_name);
         if (it != typename_to_id.end())
@@ -75,7 +83,8 @@ namespace hpx::serialization::detail {
         if (it != typename_to_ctor.end())
             cache_id(id, it->second);
 
-        if (id > max_id)
+        // hashed ids are never handed out explicitly
+        if (id > max_id && id < first_hashed_type_id)
             max_id = id;
     }
 
@@ -86,6 +95,8 @@ namespace hpx::serialization::detail {
         for (std::string const& str : get_unassigned_typenames())
             register_typename(str, ++max_id);
 
+        HPX_ASSERT(max_id < first_hashed_type_id);
+
         // Go over all registered mappings from type-names to ids and
         // fill in missing id to constructor mappings.
         for (auto const& d : typename_to_id)
@@ -95,19 +106,36 @@ namespace hpx::serialization::detail {
             if (it != typename_to_ctor.end())
                 cache_id(d.second, it->second);
         }
+    }
 
-        // Go over all registered mappings from type-names to
-        // constructors and fill in missing id to constructor mappings.
-        for (auto const& d : typename_to_ctor)
+    void id_registry::retire_hashed_id(std::string const& type_name)
+    {
+        std::uint32_t const hashed_id = hashed_type_id(type_name);
+
+        id_to_typename_t::iterator it = hashed_id_to_typename.find(hashed_id);
+        if (it != hashed_id_to_typename.end() && it->second == type_name)
         {
-            typename_to_id_t::const_iterator it = typename_to_id.find(d.first);
-            HPX_ASSERT(it != typename_to_id.end());
-            cache_id(it->second, d.second);    //-V783
+            it->second.clear();
+            cache.erase(hashed_id);
         }
     }
 
+    std::uint32_t id_registry::allocate_id()
+    {
+        HPX_ASSERT(max_id + 1 < first_hashed_type_id);
+        return ++max_id;
+    }
+
     std::uint32_t id_registry::try_get_id(std::string const& type_name) const
     {
+        // prefer the hashed id, if it is unique
+        std::uint32_t const hashed_id = hashed_type_id(type_name);
+
+        id_to_typename_t::const_iterator hit =
+            hashed_id_to_typename.find(hashed_id);
+        if (hit != hashed_id_to_typename.end() && hit->second == type_name)
+            return hashed_id;
+
         typename_to_id_t::const_iterator it = typename_to_id.find(type_name);
         if (it == typename_to_id.end())
             return invalid_id;
@@ -122,7 +150,41 @@ namespace hpx::serialization::detail {
         // O(Nlog(M)) ?
         for (auto const& v : typename_to_ctor)
         {
-            if (!typename_to_id.count(v.first))
+            if (try_get_id(v.first) == invalid_id)
+            {
+                result.push_back(v.first);
+            }
+        }
+
+        return result;
+    }
+
+    std::vector<std::string> id_registry::get_collided_typenames() const
+    {
+        std::vector<std::string> result;
+
+        for (auto const& v : typename_to_ctor)
+        {
+            id_to_typename_t::const_iterator it =
+                hashed_id_to_typename.find(hashed_type_id(v.first));
+            if (it == hashed_id_to_typename.end() || it->second != v.first)
+            {
+                result.push_back(v.first);
+            }
+        }
+
+        return result;
+    }
+
+    std::vector<std::string> id_registry::get_hashed_typenames() const
+    {
+        std::vector<std::string> result;
+
+        for (auto const& v : typename_to_ctor)
+        {
+            id_to_typename_t::const_iterator it =
+                hashed_id_to_typename.find(hashed_type_id(v.first));
+            if (it != hashed_id_to_typename.end() && it->second == v.first)
             {
                 result.push_back(v.first);
             }
@@ -169,6 +231,16 @@ namespace hpx::serialization::detail {
             msg += std::to_string(desc.second) + ")\n";
         }
 
+        msg += "\nhashed typenames:\n";
+        for (auto const& desc : id_registry::instance().hashed_id_to_typename)
+        {
+            if (!desc.second.empty())
+            {
+                msg += desc.second + " (";
+                msg += std::to_string(desc.first) + ")\n";
+            }
+        }
+
         return msg;
 #else
         return std::string();
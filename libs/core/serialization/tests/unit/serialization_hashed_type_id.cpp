@@ -0,0 +1,151 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/serialization/detail/hashed_type_id.hpp>
+#include <hpx/serialization/detail/polymorphic_id_factory.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using hpx::serialization::detail::first_hashed_type_id;
+using hpx::serialization::detail::hashed_type_id;
+using hpx::serialization::detail::id_dispatch_table;
+using hpx::serialization::detail::id_registry;
+using hpx::serialization::detail::type_name_fingerprint;
+
+// the hashed ids are usable at compile time
+static_assert(hashed_type_id("") == 2166136261u);
+static_assert(hashed_type_id("costarring") == hashed_type_id("liquid"));
+static_assert(type_name_fingerprint("costarring") !=
+    type_name_fingerprint("liquid"));
+
+///////////////////////////////////////////////////////////////////////////////
+void test_hashed_type_id()
+{
+    std::vector<std::uint32_t> ids;
+    for (int i = 0; i != 10000; ++i)
+    {
+        std::uint32_t const id = hashed_type_id("type" + std::to_string(i));
+        HPX_TEST_LTE(first_hashed_type_id, id);
+        HPX_TEST_NEQ(id, id_registry::invalid_id);
+        ids.push_back(id);
+    }
+
+    HPX_TEST_EQ(hashed_type_id(std::string("type42")), ids[42]);
+    HPX_TEST_NEQ(hashed_type_id("type42"), hashed_type_id("type43"));
+}
+
+void test_id_dispatch_table()
+{
+    id_dispatch_table<int> table;
+    HPX_TEST(table.find(0) == nullptr);
+
+    // mix small consecutive ids with hashed ones
+    for (int i = 0; i != 1000; ++i)
+    {
+        table.assign(static_cast<std::uint32_t>(i), i);
+        table.assign(hashed_type_id("type" + std::to_string(i)), -i);
+    }
+    HPX_TEST_EQ(table.size(), std::size_t(2000));
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        int const* value = table.find(static_cast<std::uint32_t>(i));
+        HPX_TEST(value != nullptr && *value == i);
+
+        value = table.find(hashed_type_id("type" + std::to_string(i)));
+        HPX_TEST(value != nullptr && *value == -i);
+    }
+    HPX_TEST(table.find(1000) == nullptr);
+
+    // erasing an entry must leave all other entries reachable
+    for (int i = 0; i < 1000; i += 2)
+    {
+        table.erase(static_cast<std::uint32_t>(i));
+        table.erase(hashed_type_id("type" + std::to_string(i)));
+    }
+    HPX_TEST_EQ(table.size(), std::size_t(1000));
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        int const* value = table.find(static_cast<std::uint32_t>(i));
+        HPX_TEST_EQ(value == nullptr, i % 2 == 0);
+
+        value = table.find(hashed_type_id("type" + std::to_string(i)));
+        HPX_TEST_EQ(value == nullptr, i % 2 == 0);
+    }
+
+    table.assign(1, 42);
+    HPX_TEST_EQ(*table.find(1), 42);
+    HPX_TEST_EQ(table.size(), std::size_t(1000));
+}
+
+void* make_nullptr()
+{
+    return nullptr;
+}
+
+void test_id_registry_collisions()
+{
+    id_registry& registry = id_registry::instance();
+
+    registry.register_factory_function("unique", &make_nullptr);
+    registry.register_factory_function("costarring", &make_nullptr);
+    registry.register_factory_function("liquid", &make_nullptr);
+
+    // types with unique hashes don't need an id to be assigned
+    HPX_TEST_EQ(registry.try_get_id("unique"), hashed_type_id("unique"));
+    HPX_TEST_EQ(registry.try_get_id("costarring"), id_registry::invalid_id);
+    HPX_TEST_EQ(registry.try_get_id("liquid"), id_registry::invalid_id);
+
+    std::vector<std::string> const unassigned =
+        registry.get_unassigned_typenames();
+    HPX_TEST_EQ(unassigned.size(), std::size_t(2));
+    HPX_TEST_EQ(registry.get_collided_typenames().size(), std::size_t(2));
+
+    registry.fill_missing_typenames();
+    HPX_TEST(registry.get_unassigned_typenames().empty());
+
+    std::uint32_t const id1 = registry.try_get_id("costarring");
+    std::uint32_t const id2 = registry.try_get_id("liquid");
+    HPX_TEST_NEQ(id1, id2);
+    HPX_TEST_LT(id1, first_hashed_type_id);
+    HPX_TEST_LT(id2, first_hashed_type_id);
+
+    // a retired hashed id forces an id to be assigned explicitly
+    registry.register_factory_function("unique2", &make_nullptr);
+    registry.retire_hashed_id("unique2");
+    HPX_TEST_EQ(registry.try_get_id("unique2"), id_registry::invalid_id);
+    HPX_TEST_EQ(registry.try_get_id("unique"), hashed_type_id("unique"));
+
+    // only types using their hashed id are reported as such
+    std::vector<std::string> const hashed = registry.get_hashed_typenames();
+    HPX_TEST(std::find(hashed.begin(), hashed.end(), "unique") != hashed.end());
+    HPX_TEST(
+        std::find(hashed.begin(), hashed.end(), "unique2") == hashed.end());
+    HPX_TEST(
+        std::find(hashed.begin(), hashed.end(), "liquid") == hashed.end());
+
+    // allocated ids are never handed out again
+    std::uint32_t const id3 = registry.allocate_id();
+    HPX_TEST_LT(std::max(id1, id2), id3);
+    registry.fill_missing_typenames();
+    HPX_TEST_LT(id3, registry.try_get_id("unique2"));
+}
+
+int main()
+{
+    test_hashed_type_id();
+    test_id_dispatch_table();
+    test_id_registry_collisions();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,35 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace hpx::detail {
+
+    // Futex-like waiting on a 32 bit atomic word for HPX threads. Waiting HPX
+    // threads are suspended in a global table of wait queues that is indexed
+    // by the address of the word, thus the word itself does not need any
+    // additional storage.
+
+    // Suspend the calling HPX thread if the word still holds the expected
+    // value, until futex_wake_one or futex_wake_all is called for the same
+    // word. Returns immediately if the value differs. Spurious wake-ups are
+    // possible, callers are expected to re-check their condition.
+    HPX_CORE_EXPORT void futex_wait(std::atomic<std::uint32_t> const& word,
+        std::uint32_t expected, char const* description = "futex_wait");
+
+    // Resume one of the HPX threads waiting on the given word.
+    HPX_CORE_EXPORT void futex_wake_one(
+        std::atomic<std::uint32_t> const& word) noexcept;
+
+    // Resume all HPX threads waiting on the given word.
+    HPX_CORE_EXPORT void futex_wake_all(
+        std::atomic<std::uint32_t> const& word) noexcept;
+}    // namespace hpx::detail
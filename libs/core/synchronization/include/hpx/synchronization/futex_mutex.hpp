@@ -0,0 +1,262 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file futex_mutex.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/lock_registration/detail/register_locks.hpp>
+#include <hpx/modules/itt_notify.hpp>
+#include <hpx/synchronization/detail/futex.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace hpx::experimental {
+
+    /// \brief \a futex_mutex is a mutual exclusion primitive whose whole state
+    ///        is held in a single atomic word. Locking and unlocking an
+    ///        uncontended \a futex_mutex is a single atomic operation each.
+    ///        If the mutex is locked, a thread calling \a lock spins for a
+    ///        while (adapting the number of iterations to how long it had to
+    ///        wait previously) before it suspends itself until the mutex is
+    ///        released.
+    ///
+    ///        Unlike \a hpx::mutex, \a futex_mutex does not record its owner,
+    ///        thus it does not detect recursive locking or unlocking from a
+    ///        thread that does not own it. The behavior of the program is
+    ///        undefined in these cases. \a futex_mutex satisfies all
+    ///        requirements of \namedrequirement{Mutex}.
+    class futex_mutex
+    {
+    public:
+        HPX_NON_COPYABLE(futex_mutex);
+
+        constexpr futex_mutex() noexcept = default;
+
+        explicit constexpr futex_mutex(char const* const) noexcept {}
+
+        ~futex_mutex() = default;
+
+        /// Locks the mutex, suspends the calling thread if necessary.
+        void lock()
+        {
+            HPX_ITT_SYNC_PREPARE(this);
+
+            std::uint32_t expected = unlocked;
+            if (!state_.compare_exchange_strong(expected, locked,
+                    std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                lock_contended();
+            }
+
+            HPX_ITT_SYNC_ACQUIRED(this);
+            util::register_lock(this);
+        }
+
+        /// Tries to lock the mutex, returns immediately.
+        ///
+        /// \returns \a true if the mutex was acquired, \a false otherwise.
+        bool try_lock() noexcept(
+            noexcept(util::register_lock(std::declval<futex_mutex*>())))
+        {
+            HPX_ITT_SYNC_PREPARE(this);
+
+            std::uint32_t expected = unlocked;
+            if (state_.compare_exchange_strong(expected, locked,
+                    std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                HPX_ITT_SYNC_ACQUIRED(this);
+                util::register_lock(this);
+                return true;
+            }
+
+            HPX_ITT_SYNC_CANCEL(this);
+            return false;
+        }
+
+        /// Unlocks the mutex, resumes one of the waiting threads (if any).
+        void unlock() noexcept(
+            noexcept(util::unregister_lock(std::declval<futex_mutex*>())))
+        {
+            HPX_ITT_SYNC_RELEASING(this);
+            util::unregister_lock(this);
+
+            if (state_.exchange(unlocked, std::memory_order_release) ==
+                contended)
+            {
+                hpx::detail::futex_wake_one(state_);
+            }
+
+            HPX_ITT_SYNC_RELEASED(this);
+        }
+
+    private:
+        HPX_CORE_EXPORT void lock_contended();
+
+        static constexpr std::uint32_t unlocked = 0;
+        static constexpr std::uint32_t locked = 1;
+        static constexpr std::uint32_t contended = 2;    // threads may wait
+
+        std::atomic<std::uint32_t> state_{unlocked};
+
+        // running estimate of the number of spins needed to acquire the lock
+        std::atomic<std::uint32_t> spin_estimate_{0};
+    };
+
+    /// \brief \a futex_shared_mutex is a reader-writer lock whose whole state
+    ///        (the number of readers, whether a writer holds the lock, and
+    ///        whether readers or writers are waiting) is held in a single
+    ///        atomic word. Uncontended locking and unlocking (shared or
+    ///        exclusive) is a single atomic operation each. Waiting writers
+    ///        take precedence over new readers. Threads that have to wait
+    ///        spin adaptively before suspending themselves.
+    ///
+    ///        \a futex_shared_mutex satisfies all requirements of
+    ///        \namedrequirement{SharedMutex}, it does not detect recursive
+    ///        locking.
+    class futex_shared_mutex
+    {
+    public:
+        HPX_NON_COPYABLE(futex_shared_mutex);
+
+        constexpr futex_shared_mutex() noexcept = default;
+
+        explicit constexpr futex_shared_mutex(char const* const) noexcept {}
+
+        ~futex_shared_mutex() = default;
+
+        /// Acquires exclusive ownership, suspends the calling thread if
+        /// necessary.
+        void lock()
+        {
+            HPX_ITT_SYNC_PREPARE(this);
+
+            std::uint32_t expected = 0;
+            if (!state_.compare_exchange_strong(expected, writer,
+                    std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                lock_contended();
+            }
+
+            HPX_ITT_SYNC_ACQUIRED(this);
+            util::register_lock(this);
+        }
+
+        /// Tries to acquire exclusive ownership, returns immediately.
+        bool try_lock() noexcept(
+            noexcept(util::register_lock(std::declval<futex_shared_mutex*>())))
+        {
+            HPX_ITT_SYNC_PREPARE(this);
+
+            std::uint32_t s = state_.load(std::memory_order_relaxed);
+            if ((s & (writer | readers_mask)) == 0 &&
+                state_.compare_exchange_strong(s, s | writer,
+                    std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                HPX_ITT_SYNC_ACQUIRED(this);
+                util::register_lock(this);
+                return true;
+            }
+
+            HPX_ITT_SYNC_CANCEL(this);
+            return false;
+        }
+
+        /// Releases exclusive ownership, resumes all waiting threads.
+        void unlock() noexcept(
+            noexcept(util::unregister_lock(std::declval<futex_shared_mutex*>())))
+        {
+            HPX_ITT_SYNC_RELEASING(this);
+            util::unregister_lock(this);
+
+            if ((state_.exchange(0, std::memory_order_release) &
+                    waiting_mask) != 0)
+            {
+                hpx::detail::futex_wake_all(state_);
+            }
+
+            HPX_ITT_SYNC_RELEASED(this);
+        }
+
+        /// Acquires shared ownership, suspends the calling thread if a writer
+        /// holds or waits for the lock.
+        void lock_shared()
+        {
+            HPX_ITT_SYNC_PREPARE(this);
+
+            std::uint32_t s = state_.load(std::memory_order_relaxed);
+            if ((s & (writer | writers_waiting)) != 0 ||
+                !state_.compare_exchange_strong(s, s + 1,
+                    std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                lock_shared_contended();
+            }
+
+            HPX_ITT_SYNC_ACQUIRED(this);
+            util::register_lock(this);
+        }
+
+        /// Tries to acquire shared ownership, returns immediately.
+        bool try_lock_shared() noexcept(
+            noexcept(util::register_lock(std::declval<futex_shared_mutex*>())))
+        {
+            HPX_ITT_SYNC_PREPARE(this);
+
+            std::uint32_t s = state_.load(std::memory_order_relaxed);
+            while ((s & (writer | writers_waiting)) == 0)
+            {
+                if (state_.compare_exchange_weak(s, s + 1,
+                        std::memory_order_acquire, std::memory_order_relaxed))
+                {
+                    HPX_ITT_SYNC_ACQUIRED(this);
+                    util::register_lock(this);
+                    return true;
+                }
+            }
+
+            HPX_ITT_SYNC_CANCEL(this);
+            return false;
+        }
+
+        /// Releases shared ownership, the last reader resumes the waiting
+        /// threads (if any).
+        void unlock_shared() noexcept(
+            noexcept(util::unregister_lock(std::declval<futex_shared_mutex*>())))
+        {
+            HPX_ITT_SYNC_RELEASING(this);
+            util::unregister_lock(this);
+
+            std::uint32_t const prev =
+                state_.fetch_sub(1, std::memory_order_release);
+            if ((prev & readers_mask) == 1 && (prev & waiting_mask) != 0)
+            {
+                unlock_shared_contended();
+            }
+
+            HPX_ITT_SYNC_RELEASED(this);
+        }
+
+    private:
+        HPX_CORE_EXPORT void lock_contended();
+        HPX_CORE_EXPORT void lock_shared_contended();
+        HPX_CORE_EXPORT void unlock_shared_contended() noexcept;
+
+        static constexpr std::uint32_t writer = 0x8000'0000;
+        static constexpr std::uint32_t writers_waiting = 0x4000'0000;
+        static constexpr std::uint32_t readers_waiting = 0x2000'0000;
+        static constexpr std::uint32_t waiting_mask =
+            writers_waiting | readers_waiting;
+        static constexpr std::uint32_t readers_mask = readers_waiting - 1;
+
+        std::atomic<std::uint32_t> state_{0};
+
+        // running estimate of the number of spins needed to acquire the lock
+        std::atomic<std::uint32_t> spin_estimate_{0};
+    };
+}    // namespace hpx::experimental
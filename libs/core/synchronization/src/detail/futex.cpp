@@ -0,0 +1,153 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/detail/condition_variable.hpp>
+#include <hpx/synchronization/detail/futex.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::detail {
+
+    namespace {
+
+        // The HPX threads waiting on one particular word.
+        struct futex_waiters
+        {
+            void const* addr_ = nullptr;
+            std::size_t count_ = 0;
+            hpx::lcos::local::detail::condition_variable cond_;
+        };
+
+        // Words are mapped onto a fixed number of buckets, every bucket
+        // holds the wait queues of all words mapped to it that have waiting
+        // threads. Wait queues are recycled once they become unused.
+        struct futex_bucket
+        {
+            futex_waiters* find(void const* addr) const noexcept
+            {
+                for (auto const& w : waiters_)
+                {
+                    if (w->addr_ == addr)
+                    {
+                        return w.get();
+                    }
+                }
+                return nullptr;
+            }
+
+            futex_waiters& get(void const* addr)
+            {
+                futex_waiters* unused = nullptr;
+                for (auto const& w : waiters_)
+                {
+                    if (w->addr_ == addr)
+                    {
+                        return *w;
+                    }
+                    if (unused == nullptr && w->count_ == 0)
+                    {
+                        unused = w.get();
+                    }
+                }
+
+                if (unused == nullptr)
+                {
+                    waiters_.push_back(std::make_unique<futex_waiters>());
+                    unused = waiters_.back().get();
+                }
+                unused->addr_ = addr;
+                return *unused;
+            }
+
+            hpx::spinlock mtx_;
+            std::vector<std::unique_ptr<futex_waiters>> waiters_;
+        };
+
+        constexpr std::size_t num_futex_buckets = 257;
+
+        futex_bucket& get_futex_bucket(void const* addr) noexcept
+        {
+            static util::cache_aligned_data_derived<futex_bucket>
+                buckets[num_futex_buckets];
+
+            return buckets[(reinterpret_cast<std::uintptr_t>(addr) >> 2) %
+                num_futex_buckets];
+        }
+
+        struct decrement_waiters
+        {
+            ~decrement_waiters()
+            {
+                if (--w_.count_ == 0)
+                {
+                    w_.addr_ = nullptr;
+                }
+            }
+
+            futex_waiters& w_;
+        };
+    }    // namespace
+
+    void futex_wait(std::atomic<std::uint32_t> const& word,
+        std::uint32_t expected, char const* description)
+    {
+        futex_bucket& b = get_futex_bucket(&word);
+        std::unique_lock<hpx::spinlock> l(b.mtx_);
+
+        // the value is re-checked while holding the bucket lock, wakers
+        // change the value before acquiring the lock, thus no wake-up can be
+        // missed
+        if (word.load(std::memory_order_acquire) != expected)
+        {
+            return;
+        }
+
+        futex_waiters& w = b.get(&word);
+        ++w.count_;
+
+        [[maybe_unused]] decrement_waiters on_exit{w};
+        w.cond_.wait(l, description);
+    }
+
+    void futex_wake_one(std::atomic<std::uint32_t> const& word) noexcept
+    {
+        futex_bucket& b = get_futex_bucket(&word);
+        std::unique_lock<hpx::spinlock> l(b.mtx_);
+
+        futex_waiters* w = b.find(&word);
+        if (w != nullptr)
+        {
+            error_code ec(throwmode::lightweight);
+            w->cond_.notify_one(
+                HPX_MOVE(l), threads::thread_priority::boost, ec);
+        }
+    }
+
+    void futex_wake_all(std::atomic<std::uint32_t> const& word) noexcept
+    {
+        futex_bucket& b = get_futex_bucket(&word);
+        std::unique_lock<hpx::spinlock> l(b.mtx_);
+
+        futex_waiters* w = b.find(&word);
+        if (w != nullptr)
+        {
+            error_code ec(throwmode::lightweight);
+            w->cond_.notify_all(
+                HPX_MOVE(l), threads::thread_priority::boost, ec);
+        }
+    }
+}    // namespace hpx::detail
@@ -0,0 +1,173 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/synchronization/detail/futex.hpp>
+#include <hpx/synchronization/futex_mutex.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace hpx::experimental {
+
+    namespace {
+
+        constexpr std::uint32_t min_spin_count = 16;
+        constexpr std::uint32_t max_spin_count = 1024;
+
+        // Spin until try_acquire succeeds or the spin budget is exhausted.
+        // The budget is derived from the number of iterations that were
+        // needed recently, similar to glibc's adaptive mutexes.
+        template <typename F>
+        bool adaptive_spin(std::atomic<std::uint32_t>& estimate, F&& try_acquire)
+        {
+            std::uint32_t const current =
+                estimate.load(std::memory_order_relaxed);
+            std::uint32_t const limit =
+                (std::min)(2 * current + min_spin_count, max_spin_count);
+
+            for (std::uint32_t k = 0; k != limit; ++k)
+            {
+                if (try_acquire())
+                {
+                    // move the estimate towards the number of spins needed
+                    estimate.store(current +
+                            static_cast<std::uint32_t>(
+                                (static_cast<std::int32_t>(k) -
+                                    static_cast<std::int32_t>(current)) /
+                                8),
+                        std::memory_order_relaxed);
+                    return true;
+                }
+                HPX_SMT_PAUSE;
+            }
+
+            // spinning did not help, spin less next time
+            estimate.store(current - current / 8, std::memory_order_relaxed);
+            return false;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void futex_mutex::lock_contended()
+    {
+        bool const acquired = adaptive_spin(spin_estimate_, [this]() {
+            std::uint32_t s = state_.load(std::memory_order_relaxed);
+            return s == unlocked &&
+                state_.compare_exchange_weak(s, locked,
+                    std::memory_order_acquire, std::memory_order_relaxed);
+        });
+
+        if (!acquired)
+        {
+            // mark the mutex as contended, unlock will wake up one of the
+            // waiting threads
+            while (state_.exchange(contended, std::memory_order_acquire) !=
+                unlocked)
+            {
+                hpx::detail::futex_wait(
+                    state_, contended, "futex_mutex::lock");
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void futex_shared_mutex::lock_contended()
+    {
+        auto try_acquire = [this](std::uint32_t& s) {
+            // waiting bits are retained, unlock will wake up the waiting
+            // threads
+            return (s & (writer | readers_mask)) == 0 &&
+                state_.compare_exchange_weak(s, s | writer,
+                    std::memory_order_acquire, std::memory_order_relaxed);
+        };
+
+        if (adaptive_spin(spin_estimate_, [&]() {
+                std::uint32_t s = state_.load(std::memory_order_relaxed);
+                return try_acquire(s);
+            }))
+        {
+            return;
+        }
+
+        std::uint32_t s = state_.load(std::memory_order_relaxed);
+        while (!try_acquire(s))
+        {
+            if ((s & (writer | readers_mask)) == 0)
+            {
+                continue;    // the CAS failed spuriously or s was changed
+            }
+
+            // announce that a writer is waiting, this prevents new readers
+            // from acquiring the lock
+            if ((s & writers_waiting) == 0 &&
+                !state_.compare_exchange_weak(s, s | writers_waiting,
+                    std::memory_order_relaxed, std::memory_order_relaxed))
+            {
+                continue;
+            }
+
+            hpx::detail::futex_wait(
+                state_, s | writers_waiting, "futex_shared_mutex::lock");
+            s = state_.load(std::memory_order_relaxed);
+        }
+    }
+
+    void futex_shared_mutex::lock_shared_contended()
+    {
+        auto try_acquire = [this](std::uint32_t& s) {
+            return (s & (writer | writers_waiting)) == 0 &&
+                state_.compare_exchange_weak(s, s + 1,
+                    std::memory_order_acquire, std::memory_order_relaxed);
+        };
+
+        if (adaptive_spin(spin_estimate_, [&]() {
+                std::uint32_t s = state_.load(std::memory_order_relaxed);
+                return try_acquire(s);
+            }))
+        {
+            return;
+        }
+
+        std::uint32_t s = state_.load(std::memory_order_relaxed);
+        while (!try_acquire(s))
+        {
+            if ((s & (writer | writers_waiting)) == 0)
+            {
+                continue;    // the CAS failed spuriously or s was changed
+            }
+
+            if ((s & readers_waiting) == 0 &&
+                !state_.compare_exchange_weak(s, s | readers_waiting,
+                    std::memory_order_relaxed, std::memory_order_relaxed))
+            {
+                continue;
+            }
+
+            hpx::detail::futex_wait(state_, s | readers_waiting,
+                "futex_shared_mutex::lock_shared");
+            s = state_.load(std::memory_order_relaxed);
+        }
+    }
+
+    void futex_shared_mutex::unlock_shared_contended() noexcept
+    {
+        // the last reader left while threads are waiting, clear the waiting
+        // bits (unless another reader or a writer got in between) and wake up
+        // all waiting threads
+        std::uint32_t s = state_.load(std::memory_order_relaxed);
+        while ((s & (writer | readers_mask)) == 0 && (s & waiting_mask) != 0)
+        {
+            if (state_.compare_exchange_weak(s, s & ~waiting_mask,
+                    std::memory_order_relaxed, std::memory_order_relaxed))
+            {
+                hpx::detail::futex_wake_all(state_);
+                return;
+            }
+        }
+    }
+}    // namespace hpx::experimental
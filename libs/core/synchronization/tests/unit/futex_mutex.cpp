@@ -0,0 +1,178 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/synchronization/futex_mutex.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+constexpr std::size_t num_tasks = 64;
+constexpr std::size_t num_iterations = 1000;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Mutex>
+void test_exclusive()
+{
+    Mutex mtx;
+    std::size_t counter = 0;
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        tasks.push_back(hpx::async([&]() {
+            for (std::size_t j = 0; j != num_iterations; ++j)
+            {
+                std::lock_guard<Mutex> l(mtx);
+                ++counter;
+                if (j % 100 == 0)
+                {
+                    // force some contention with suspended threads
+                    hpx::this_thread::yield();
+                }
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+
+    HPX_TEST_EQ(counter, num_tasks * num_iterations);
+}
+
+template <typename Mutex>
+void test_try_lock()
+{
+    Mutex mtx;
+
+    HPX_TEST(mtx.try_lock());
+    HPX_TEST(!mtx.try_lock());
+    HPX_TEST(!hpx::async([&]() { return mtx.try_lock(); }).get());
+    mtx.unlock();
+
+    HPX_TEST(mtx.try_lock());
+    mtx.unlock();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_shared()
+{
+    hpx::experimental::futex_shared_mutex mtx;
+
+    // multiple readers may hold the lock at the same time
+    mtx.lock_shared();
+    HPX_TEST(mtx.try_lock_shared());
+    HPX_TEST(!mtx.try_lock());
+    mtx.unlock_shared();
+    HPX_TEST(!mtx.try_lock());
+    mtx.unlock_shared();
+
+    // a writer excludes readers and other writers
+    HPX_TEST(mtx.try_lock());
+    HPX_TEST(!mtx.try_lock_shared());
+    HPX_TEST(!mtx.try_lock());
+    mtx.unlock();
+
+    // a waiting writer is resumed once the last reader leaves
+    std::atomic<bool> writer_done(false);
+    mtx.lock_shared();
+    hpx::future<void> writer = hpx::async([&]() {
+        std::lock_guard<hpx::experimental::futex_shared_mutex> l(mtx);
+        writer_done = true;
+    });
+
+    for (int i = 0; i != 100 && !writer_done; ++i)
+    {
+        hpx::this_thread::yield();
+    }
+    HPX_TEST(!writer_done);
+
+    mtx.unlock_shared();
+    writer.get();
+    HPX_TEST(writer_done);
+}
+
+void test_readers_writers()
+{
+    hpx::experimental::futex_shared_mutex mtx;
+    std::size_t value = 0;
+    std::atomic<std::size_t> active_readers(0);
+    std::atomic<bool> failed(false);
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        if (i % 8 == 0)
+        {
+            tasks.push_back(hpx::async([&]() {
+                for (std::size_t j = 0; j != num_iterations; ++j)
+                {
+                    std::lock_guard<hpx::experimental::futex_shared_mutex> l(
+                        mtx);
+                    if (active_readers.load() != 0)
+                    {
+                        failed = true;
+                    }
+                    ++value;
+                }
+            }));
+        }
+        else
+        {
+            tasks.push_back(hpx::async([&]() {
+                for (std::size_t j = 0; j != num_iterations; ++j)
+                {
+                    std::shared_lock<hpx::experimental::futex_shared_mutex> l(
+                        mtx);
+                    ++active_readers;
+                    std::size_t const v = value;
+                    if (j % 100 == 0)
+                    {
+                        hpx::this_thread::yield();
+                    }
+                    if (v != value)
+                    {
+                        failed = true;
+                    }
+                    --active_readers;
+                }
+            }));
+        }
+    }
+    hpx::wait_all(tasks);
+
+    HPX_TEST(!failed);
+    HPX_TEST_EQ(value, (num_tasks / 8) * num_iterations);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_try_lock<hpx::experimental::futex_mutex>();
+    test_try_lock<hpx::experimental::futex_shared_mutex>();
+
+    test_exclusive<hpx::experimental::futex_mutex>();
+    test_exclusive<hpx::experimental::futex_shared_mutex>();
+
+    test_shared();
+    test_readers_writers();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,156 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace hpx::threads {
+
+    /// The bounds and thresholds used by an \a elastic_thread_pool_policy to
+    /// decide whether to grow or shrink a thread pool.
+    struct elastic_pool_parameters
+    {
+        /// The minimal number of processing units that are kept running.
+        std::size_t min_processing_units = 1;
+
+        /// The maximal number of processing units that are kept running
+        /// (limited by the number of processing units of the pool).
+        std::size_t max_processing_units = std::size_t(-1);
+
+        /// A processing unit is resumed if the average number of pending
+        /// threads per running processing unit exceeds this value.
+        double grow_queue_length = 2.0;
+
+        /// A processing unit is suspended if the average number of pending
+        /// threads per running processing unit is at most this value and at
+        /// least \a shrink_idle_fraction of the running processing units are
+        /// idle.
+        double shrink_queue_length = 0.5;
+
+        /// The fraction of the running processing units that have to be idle
+        /// for a processing unit to be suspended.
+        double shrink_idle_fraction = 0.5;
+
+        /// The number of consecutive samples that have to agree before a
+        /// processing unit is suspended or resumed.
+        std::size_t num_samples = 3;
+    };
+
+    /// An \a elastic_thread_pool_policy monitors the queue lengths and the
+    /// number of idle processing units of a set of thread pools and
+    /// suspends or resumes processing units of those pools depending on
+    /// the load, within the bounds given for each of the pools. At most one
+    /// processing unit per pool is suspended or resumed for each sample.
+    ///
+    /// If a maximal overall number of running processing units is given and
+    /// a pool has to grow while this limit has been reached, a processing
+    /// unit of the least loaded of the other pools is suspended in exchange
+    /// (as long as that pool stays within its bounds). If the pools were
+    /// created by the resource partitioner on the same processing units
+    /// (see \a hpx::resource::mode_allow_oversubscription), this moves
+    /// cores between the pools.
+    ///
+    /// The pools have to be created with
+    /// threads::policies::scheduler_mode::enable_elasticity set. Only
+    /// processing units suspended by the policy are resumed by it, all of
+    /// them are resumed when the policy is stopped.
+    class HPX_CORE_EXPORT elastic_thread_pool_policy
+    {
+    public:
+        HPX_NON_COPYABLE(elastic_thread_pool_policy);
+
+        /// \param max_processing_units [in] The maximal overall number of
+        ///                  running processing units of all managed pools
+        ///                  (0: unlimited).
+        explicit elastic_thread_pool_policy(
+            std::size_t max_processing_units = 0) noexcept;
+
+        ~elastic_thread_pool_policy();
+
+        /// Add the given pool to the set of pools managed by this policy.
+        /// If the pool currently runs more processing units than allowed by
+        /// \a params, the surplus processing units are suspended right away.
+        ///
+        /// \throws hpx::exception if the pool does not support suspending
+        ///         processing units or if the bounds are invalid.
+        void add_pool(thread_pool_base& pool,
+            elastic_pool_parameters const& params = elastic_pool_parameters(),
+            error_code& ec = throws);
+
+        /// Sample all managed pools once and suspend or resume processing
+        /// units as needed. Does nothing if another sample is being taken
+        /// concurrently.
+        void step();
+
+        /// Start a background thread sampling the managed pools with the
+        /// given interval.
+        void start(hpx::chrono::steady_duration const& interval);
+
+        /// Stop the background thread (if running) and resume all processing
+        /// units which were suspended by this policy.
+        void stop();
+
+        /// Return the number of processing units of the given pool which are
+        /// currently running.
+        std::size_t get_active_processing_units(
+            thread_pool_base const& pool) const;
+
+        /// Return the number of processing units suspended and resumed by
+        /// this policy so far.
+        std::size_t get_num_suspended() const noexcept
+        {
+            return num_suspended_.load(std::memory_order_relaxed);
+        }
+        std::size_t get_num_resumed() const noexcept
+        {
+            return num_resumed_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        struct pool_data
+        {
+            thread_pool_base* pool_;
+            elastic_pool_parameters params_;
+            std::vector<bool> suspended_;    // suspended by this policy
+            double queue_length_ = 0.0;      // smoothed, per running PU
+            double idle_fraction_ = 0.0;     // smoothed
+            std::int64_t trend_ = 0;    // >0: consecutive grow decisions
+        };
+
+        void sample(pool_data& p) const;
+        bool suspend_one(pool_data& p);
+        bool resume_one(pool_data& p);
+        static bool can_resume(pool_data const& p) noexcept;
+        void resume_all();
+
+        void lock() noexcept;
+        void unlock() noexcept;
+
+        std::size_t max_processing_units_;
+        std::vector<pool_data> pools_;
+        std::atomic<bool> busy_;
+
+        std::atomic<std::size_t> num_suspended_;
+        std::atomic<std::size_t> num_resumed_;
+
+        std::mutex mtx_;
+        std::condition_variable cond_;
+        bool stop_requested_;
+        std::thread monitor_;
+    };
+}    // namespace hpx::threads
@@ -0,0 +1,402 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/thread_pool_util/elastic_thread_pool_policy.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
+#include <hpx/threading_base/scheduler_state.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_helpers.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/threading_base/thread_pool_base.hpp>
+#include <hpx/timing/steady_clock.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+namespace hpx::threads {
+
+    namespace {
+
+        // weight of the newest sample for the smoothed load values
+        constexpr double sample_weight = 0.5;
+
+        bool is_running(thread_pool_base const& pool, std::size_t virt_core)
+        {
+            return pool.get_scheduler()->get_state(virt_core).load() ==
+                hpx::state::running;
+        }
+
+        // The processing unit the calling HPX thread runs on if it belongs
+        // to the given pool, it must not be suspended by the policy.
+        std::size_t get_own_processing_unit(thread_pool_base const& pool)
+        {
+            if (threads::get_self_ptr() != nullptr &&
+                hpx::this_thread::get_pool() == &pool)
+            {
+                return hpx::get_local_worker_thread_num();
+            }
+            return std::size_t(-1);
+        }
+    }    // namespace
+
+    elastic_thread_pool_policy::elastic_thread_pool_policy(
+        std::size_t max_processing_units) noexcept
+      : max_processing_units_(max_processing_units)
+      , busy_(false)
+      , num_suspended_(0)
+      , num_resumed_(0)
+      , stop_requested_(false)
+    {
+    }
+
+    elastic_thread_pool_policy::~elastic_thread_pool_policy()
+    {
+        try
+        {
+            stop();
+        }
+        catch (...)
+        {
+            ;    // ignore errors during shutdown
+        }
+    }
+
+    void elastic_thread_pool_policy::lock() noexcept
+    {
+        hpx::util::yield_while(
+            [this]() {
+                return busy_.exchange(true, std::memory_order_acquire);
+            },
+            "elastic_thread_pool_policy::lock");
+    }
+
+    void elastic_thread_pool_policy::unlock() noexcept
+    {
+        busy_.store(false, std::memory_order_release);
+    }
+
+    void elastic_thread_pool_policy::add_pool(thread_pool_base& pool,
+        elastic_pool_parameters const& params, error_code& ec)
+    {
+        policies::scheduler_base* sched = pool.get_scheduler();
+        if (sched == nullptr ||
+            !sched->has_scheduler_mode(
+                policies::scheduler_mode::enable_elasticity))
+        {
+            HPX_THROWS_IF(ec, hpx::error::invalid_status,
+                "elastic_thread_pool_policy::add_pool",
+                "thread pool {} does not support suspending processing units",
+                pool.get_pool_name());
+            return;
+        }
+
+        std::size_t const num_threads = pool.get_os_thread_count();
+        if (params.min_processing_units == 0 ||
+            params.min_processing_units > params.max_processing_units ||
+            params.min_processing_units > num_threads)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "elastic_thread_pool_policy::add_pool",
+                "invalid bounds for the number of processing units of thread "
+                "pool {}: min: {}, max: {}, available: {}",
+                pool.get_pool_name(), params.min_processing_units,
+                params.max_processing_units, num_threads);
+            return;
+        }
+
+        lock();
+
+        pool_data p;
+        p.pool_ = &pool;
+        p.params_ = params;
+        p.params_.max_processing_units =
+            (std::min)(params.max_processing_units, num_threads);
+        p.params_.num_samples = (std::max)(params.num_samples, std::size_t(1));
+        p.suspended_.resize(num_threads, false);
+
+        pools_.push_back(HPX_MOVE(p));
+
+        // enforce the upper bound right away
+        pool_data& added = pools_.back();
+        while (get_active_processing_units(pool) >
+                added.params_.max_processing_units &&
+            suspend_one(added))
+        {
+        }
+
+        unlock();
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+
+    std::size_t elastic_thread_pool_policy::get_active_processing_units(
+        thread_pool_base const& pool) const
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i != pool.get_os_thread_count(); ++i)
+        {
+            if (is_running(pool, i))
+            {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    void elastic_thread_pool_policy::sample(pool_data& p) const
+    {
+        thread_pool_base& pool = *p.pool_;
+
+        std::size_t const num_threads = pool.get_os_thread_count();
+        std::size_t const active =
+            (std::max)(get_active_processing_units(pool), std::size_t(1));
+
+        // suspended processing units are reported as idle as well
+        std::int64_t const idle = (std::max)(pool.get_idle_core_count() -
+                static_cast<std::int64_t>(num_threads - active),
+            std::int64_t(0));
+
+        double const queue_length =
+            static_cast<double>(pool.get_queue_length(std::size_t(-1), false)) /
+            static_cast<double>(active);
+        double const idle_fraction =
+            static_cast<double>(idle) / static_cast<double>(active);
+
+        p.queue_length_ = sample_weight * queue_length +
+            (1.0 - sample_weight) * p.queue_length_;
+        p.idle_fraction_ = sample_weight * idle_fraction +
+            (1.0 - sample_weight) * p.idle_fraction_;
+
+        elastic_pool_parameters const& params = p.params_;
+        if (p.queue_length_ > params.grow_queue_length &&
+            active < params.max_processing_units)
+        {
+            p.trend_ = (std::max)(p.trend_, std::int64_t(0)) + 1;
+        }
+        else if (p.queue_length_ <= params.shrink_queue_length &&
+            p.idle_fraction_ >= params.shrink_idle_fraction &&
+            active > params.min_processing_units)
+        {
+            p.trend_ = (std::min)(p.trend_, std::int64_t(0)) - 1;
+        }
+        else
+        {
+            p.trend_ = 0;
+        }
+    }
+
+    bool elastic_thread_pool_policy::suspend_one(pool_data& p)
+    {
+        thread_pool_base& pool = *p.pool_;
+        std::size_t const own = get_own_processing_unit(pool);
+
+        // suspend the running processing unit with the highest index
+        for (std::size_t i = pool.get_os_thread_count(); i != 0; --i)
+        {
+            std::size_t const virt_core = i - 1;
+            if (virt_core != own && is_running(pool, virt_core))
+            {
+                error_code ec(throwmode::lightweight);
+                pool.suspend_processing_unit_direct(virt_core, ec);
+                if (ec)
+                {
+                    return false;
+                }
+
+                p.suspended_[virt_core] = true;
+                ++num_suspended_;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool elastic_thread_pool_policy::can_resume(pool_data const& p) noexcept
+    {
+        return std::find(p.suspended_.begin(), p.suspended_.end(), true) !=
+            p.suspended_.end();
+    }
+
+    bool elastic_thread_pool_policy::resume_one(pool_data& p)
+    {
+        thread_pool_base& pool = *p.pool_;
+
+        // resume the suspended processing unit with the lowest index
+        for (std::size_t virt_core = 0; virt_core != p.suspended_.size();
+             ++virt_core)
+        {
+            if (p.suspended_[virt_core])
+            {
+                error_code ec(throwmode::lightweight);
+                pool.resume_processing_unit_direct(virt_core, ec);
+                if (ec)
+                {
+                    return false;
+                }
+
+                p.suspended_[virt_core] = false;
+                ++num_resumed_;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void elastic_thread_pool_policy::step()
+    {
+        if (busy_.exchange(true, std::memory_order_acquire))
+        {
+            return;    // somebody else is taking a sample
+        }
+
+        std::size_t total_active = 0;
+        for (pool_data& p : pools_)
+        {
+            sample(p);
+            total_active += get_active_processing_units(*p.pool_);
+        }
+
+        // shrink first, this frees processing units for the pools that have
+        // to grow
+        for (pool_data& p : pools_)
+        {
+            std::int64_t const num_samples =
+                static_cast<std::int64_t>(p.params_.num_samples);
+            if (-p.trend_ >= num_samples)
+            {
+                if (suspend_one(p))
+                {
+                    --total_active;
+                }
+                p.trend_ = 0;
+            }
+        }
+
+        for (pool_data& p : pools_)
+        {
+            std::int64_t const num_samples =
+                static_cast<std::int64_t>(p.params_.num_samples);
+            if (p.trend_ < num_samples)
+            {
+                continue;
+            }
+            p.trend_ = 0;
+
+            if (max_processing_units_ == 0 ||
+                total_active < max_processing_units_)
+            {
+                if (resume_one(p))
+                {
+                    ++total_active;
+                }
+                continue;
+            }
+
+            // take a processing unit from the least loaded pool which is
+            // less loaded than this one
+            pool_data* donor = nullptr;
+            for (pool_data& other : pools_)
+            {
+                if (&other == &p || other.queue_length_ >= p.queue_length_ ||
+                    get_active_processing_units(*other.pool_) <=
+                        other.params_.min_processing_units)
+                {
+                    continue;
+                }
+
+                if (donor == nullptr ||
+                    other.queue_length_ < donor->queue_length_ ||
+                    (other.queue_length_ == donor->queue_length_ &&
+                        other.idle_fraction_ > donor->idle_fraction_))
+                {
+                    donor = &other;
+                }
+            }
+
+            // only processing units suspended by this policy can be resumed
+            if (donor == nullptr || !can_resume(p) || !suspend_one(*donor))
+            {
+                continue;
+            }
+
+            if (!resume_one(p))
+            {
+                // give the processing unit back to the donor
+                if (!resume_one(*donor))
+                {
+                    --total_active;
+                }
+            }
+        }
+
+        unlock();
+    }
+
+    void elastic_thread_pool_policy::start(
+        hpx::chrono::steady_duration const& interval)
+    {
+        std::unique_lock<std::mutex> l(mtx_);
+        if (monitor_.joinable())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                "elastic_thread_pool_policy::start",
+                "the elastic thread pool policy is already running");
+        }
+
+        stop_requested_ = false;
+        monitor_ = std::thread([this, interval = interval.value()]() {
+            std::unique_lock<std::mutex> l(mtx_);
+            while (!cond_.wait_for(
+                l, interval, [this]() { return stop_requested_; }))
+            {
+                l.unlock();
+                step();
+                l.lock();
+            }
+        });
+    }
+
+    void elastic_thread_pool_policy::resume_all()
+    {
+        for (pool_data& p : pools_)
+        {
+            while (resume_one(p))
+            {
+            }
+        }
+    }
+
+    void elastic_thread_pool_policy::stop()
+    {
+        std::thread monitor;
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            stop_requested_ = true;
+            std::swap(monitor, monitor_);
+        }
+        cond_.notify_all();
+
+        if (monitor.joinable())
+        {
+            monitor.join();
+        }
+
+        lock();
+        resume_all();
+        unlock();
+    }
+}    // namespace hpx::threads
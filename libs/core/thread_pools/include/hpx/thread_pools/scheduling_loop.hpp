@@ -23,6 +23,9 @@
 #if defined(HPX_HAVE_APEX)
 #include <hpx/threading_base/external_timer.hpp>
 #endif
+#if defined(HPX_HAVE_TASK_TRACING)
+#include <hpx/threading_base/task_tracer.hpp>
+#endif
 
 #include <atomic>
 #include <cstddef>
@@ -267,6 +270,14 @@ namespace hpx::threads::detail {
                                 [[maybe_unused]] exec_time_wrapper
                                     exec_time_collector(idle_rate);
 
+#if defined(HPX_HAVE_TASK_TRACING)
+                                detail::trace_task(
+                                    thrdptr->get_thread_phase() == 0 ?
+                                        task_trace_event::start :
+                                        task_trace_event::resume,
+                                    thrdptr);
+#endif
+
 #if defined(HPX_HAVE_APEX)
                                 // get the APEX data pointer, in case we are
                                 // resuming the thread and have to restore any
@@ -293,6 +304,15 @@ namespace hpx::threads::detail {
 #else
                                 thrd_stat = (*thrdptr)(context_storage);
 #endif
+
+#if defined(HPX_HAVE_TASK_TRACING)
+                                detail::trace_task(
+                                    thrd_stat.get_previous() ==
+                                            thread_schedule_state::terminated ?
+                                        task_trace_event::terminate :
+                                        task_trace_event::suspend,
+                                    thrdptr);
+#endif
                             }
 
                             detail::write_state_log(scheduler, num_thread, thrd,
@@ -542,6 +562,13 @@ namespace hpx::threads::detail {
                 idle_loop_count = 0;
             }
 
+            // wake up the threads whose timers have expired, idle worker
+            // threads handle the timers of the other worker threads as well
+            if (scheduler.poll_timers(num_thread, idle_loop_count != 0))
+            {
+                idle_loop_count = 0;
+            }
+
             // something went badly wrong, give up
             if (HPX_UNLIKELY(this_state.load(std::memory_order_relaxed) ==
                     hpx::state::terminating))
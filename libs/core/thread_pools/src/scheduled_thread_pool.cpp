@@ -6,6 +6,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/schedulers/background_scheduler.hpp>
+#include <hpx/schedulers/deadline_queue_scheduler.hpp>
 #include <hpx/schedulers/local_priority_queue_scheduler.hpp>
 #include <hpx/schedulers/local_queue_scheduler.hpp>
 #include <hpx/schedulers/shared_priority_queue_scheduler.hpp>
@@ -66,3 +67,8 @@ template class HPX_CORE_EXPORT
     hpx::threads::policies::shared_priority_queue_scheduler<>;
 template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
     hpx::threads::policies::shared_priority_queue_scheduler<>>;
+
+template class HPX_CORE_EXPORT
+    hpx::threads::policies::deadline_queue_scheduler<>;
+template class HPX_CORE_EXPORT hpx::threads::detail::scheduled_thread_pool<
+    hpx::threads::policies::deadline_queue_scheduler<>>;
@@ -0,0 +1,186 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/memory.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::threads::detail {
+
+    class timer_wheel;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A single timer registered with a timer_wheel. Once the timer expires
+    // the wheel sets the referenced (suspended) HPX thread to pending with
+    // thread_restart_state::timeout, retrying while that thread is still
+    // active if retry_on_active is true. The wheel holds a reference to the
+    // entry for as long as the timer is armed.
+    struct timer_wheel_entry
+    {
+        timer_wheel_entry(std::chrono::steady_clock::time_point expiry,
+            thread_id_ref_type thrd, thread_priority priority,
+            bool retry_on_active = true) noexcept
+          : expiry_(expiry)
+          , thrd_(HPX_MOVE(thrd))
+          , priority_(priority)
+          , retry_on_active_(retry_on_active)
+          , count_(1)
+          , wheel_(nullptr)
+          , tick_(0)
+          , prev_(nullptr)
+          , next_(nullptr)
+          , level_(0)
+          , slot_(0)
+        {
+        }
+
+        timer_wheel_entry(timer_wheel_entry const&) = delete;
+        timer_wheel_entry(timer_wheel_entry&&) = delete;
+        timer_wheel_entry& operator=(timer_wheel_entry const&) = delete;
+        timer_wheel_entry& operator=(timer_wheel_entry&&) = delete;
+
+        ~timer_wheel_entry() = default;
+
+        // Disarm the timer if it has not expired yet.
+        HPX_CORE_EXPORT void cancel() noexcept;
+
+        std::chrono::steady_clock::time_point const expiry_;
+        thread_id_ref_type thrd_;
+        thread_priority const priority_;
+        bool const retry_on_active_;
+
+    private:
+        friend class timer_wheel;
+
+        friend void intrusive_ptr_add_ref(timer_wheel_entry* p) noexcept
+        {
+            p->count_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        friend void intrusive_ptr_release(timer_wheel_entry* p) noexcept
+        {
+            if (p->count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                delete p;
+            }
+        }
+
+        std::atomic<std::int32_t> count_;
+
+        // the wheel this entry is linked into, nullptr once the timer has
+        // expired or was canceled
+        std::atomic<timer_wheel*> wheel_;
+
+        std::uint64_t tick_;
+        timer_wheel_entry* prev_;
+        timer_wheel_entry* next_;
+        std::uint8_t level_;
+        std::uint8_t slot_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A hierarchical timing wheel (Varghese and Lauck). Timers are sorted
+    // into num_levels levels of num_slots slots each, where a slot on level
+    // n spans num_slots^n ticks. Adding and canceling timers is O(1), timers
+    // on the higher levels are cascaded down once their slot is reached.
+    // Timers expiring beyond the range of the top level are kept aside until
+    // the wheel reaches their range.
+    //
+    // Each worker thread of a scheduler owns one wheel and polls it from its
+    // scheduling loop, timers can be added from any thread.
+    class HPX_CORE_EXPORT timer_wheel
+    {
+    public:
+        using clock_type = std::chrono::steady_clock;
+        using time_point = clock_type::time_point;
+
+        static constexpr std::size_t num_levels = 4;
+        static constexpr std::size_t slot_bits = 6;
+        static constexpr std::size_t num_slots = std::size_t(1) << slot_bits;
+
+        // the granularity of all timers managed by a wheel
+        static constexpr std::chrono::microseconds tick_duration{50};
+
+        timer_wheel() noexcept;
+        ~timer_wheel();
+
+        timer_wheel(timer_wheel const&) = delete;
+        timer_wheel(timer_wheel&&) = delete;
+        timer_wheel& operator=(timer_wheel const&) = delete;
+        timer_wheel& operator=(timer_wheel&&) = delete;
+
+        // Arm the given timer, returns whether it is the earliest timer of
+        // this wheel.
+        bool add(hpx::intrusive_ptr<timer_wheel_entry> const& entry);
+
+        // Fire all timers which have expired at the given point in time,
+        // returns the number of expired timers. If try_lock is true this
+        // does nothing if the wheel is currently locked by another thread.
+        std::size_t poll(time_point now, std::size_t num_thread,
+            bool try_lock = false);
+
+        bool empty() const noexcept
+        {
+            return count_.load(std::memory_order_relaxed) == 0;
+        }
+
+        // A lower bound for the expiry of the earliest armed timer,
+        // time_point::max() if no timer is armed.
+        time_point next_expiry() const noexcept
+        {
+            return time_point(clock_type::duration(
+                next_expiry_.load(std::memory_order_relaxed)));
+        }
+
+    private:
+        friend struct timer_wheel_entry;
+
+        std::uint64_t to_tick(time_point t, bool round_up) const noexcept;
+        time_point from_tick(std::uint64_t tick) const noexcept;
+
+        void link(timer_wheel_entry* entry,
+            timer_wheel_entry*& expired) noexcept;
+        void unlink(timer_wheel_entry* entry) noexcept;
+        void expire(timer_wheel_entry* entry,
+            timer_wheel_entry*& expired) noexcept;
+        void cascade(timer_wheel_entry*& head,
+            timer_wheel_entry*& expired) noexcept;
+        void advance(
+            std::uint64_t target, timer_wheel_entry*& expired) noexcept;
+        void update_next_expiry() noexcept;
+
+        void cancel(timer_wheel_entry* entry) noexcept;
+
+        hpx::util::detail::spinlock mtx_;
+
+        time_point const start_;
+        std::uint64_t current_tick_;
+
+        std::atomic<std::size_t> count_;
+        std::atomic<clock_type::duration::rep> next_expiry_;
+
+        // one bit per non-empty slot
+        std::array<std::uint64_t, num_levels> occupied_;
+        std::array<std::array<timer_wheel_entry*, num_slots>, num_levels>
+            slots_;
+
+        // timers expiring beyond the range of the top level
+        timer_wheel_entry* overflow_;
+    };
+}    // namespace hpx::threads::detail
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -12,6 +12,8 @@
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
+#include <hpx/modules/memory.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
 #include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/scheduler_state.hpp>
 #include <hpx/threading_base/thread_data.hpp>
@@ -194,6 +196,15 @@ namespace hpx::threads::policies {
             std::size_t num_thread, bool reset) = 0;
 #endif
 
+        // Return the number of threads which started running only after
+        // their deadline had passed (schedulers which do not order threads by
+        // deadline do not count those).
+        virtual std::int64_t get_num_deadline_misses(
+            std::size_t /* num_thread */, bool /* reset */)
+        {
+            return 0;
+        }
+
         virtual std::int64_t get_queue_length(
             std::size_t num_thread = std::size_t(-1)) const = 0;
 
@@ -206,6 +217,17 @@ namespace hpx::threads::policies {
         // Queries whether a given core is idle
         virtual bool is_core_idle(std::size_t num_thread) const = 0;
 
+        ///////////////////////////////////////////////////////////////////////
+        // Arm the given timer on the timer wheel of the given worker thread
+        void add_timer(
+            hpx::intrusive_ptr<threads::detail::timer_wheel_entry> const& entry,
+            std::size_t num_thread);
+
+        // Fire the expired timers of the given worker thread. Idle worker
+        // threads fire the expired timers of all other worker threads as
+        // well. Returns whether any timer has fired.
+        bool poll_timers(std::size_t num_thread, bool idle);
+
         // count active background threads
         std::int64_t get_background_thread_count() const noexcept;
         void increment_background_thread_count() noexcept;
@@ -335,6 +357,10 @@ namespace hpx::threads::policies {
         std::vector<util::cache_line_data<std::atomic<hpx::state>>> states_;
         char const* description_;
 
+        // one timer wheel per worker thread
+        std::vector<util::cache_line_data<threads::detail::timer_wheel>>
+            timer_wheels_;
+
         thread_queue_init_parameters thread_queue_init_;
 
         // the pool that owns this scheduler
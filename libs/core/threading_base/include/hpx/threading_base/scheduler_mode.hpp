@@ -80,6 +80,11 @@ namespace hpx::threads::policies {
         /// 'normal' work scheduling is performed.
         do_background_work_only = 0x1000,
 
+        /// Timed suspension of HPX threads is handled by timer wheels owned
+        /// by the worker threads of the scheduler instead of by the shared
+        /// timer service.
+        enable_timer_wheel = 0x2000,
+
         // clang-format off
         /// This option represents the default mode.
         default_ =
@@ -90,7 +95,8 @@ namespace hpx::threads::policies {
             enable_stealing_numa |
             assign_work_round_robin |
             steal_after_local |
-            enable_idle_backoff,
+            enable_idle_backoff |
+            enable_timer_wheel,
 
         /// This enables all available options.
         all_flags =
@@ -106,7 +112,8 @@ namespace hpx::threads::policies {
             steal_high_priority_first |
             steal_after_local |
             enable_idle_backoff |
-            do_background_work_only
+            do_background_work_only |
+            enable_timer_wheel
         // clang-format on
     };
 
@@ -0,0 +1,114 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_TASK_TRACING)
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace hpx::threads {
+
+    ///////////////////////////////////////////////////////////////////////////
+    enum class task_trace_event : std::uint8_t
+    {
+        create = 0,       // the HPX thread was created (or recycled)
+        start = 1,        // the HPX thread started executing
+        suspend = 2,      // the HPX thread stopped executing, not finished
+        resume = 3,       // the HPX thread continued executing
+        terminate = 4,    // the HPX thread finished executing
+    };
+
+    /// One entry of the task trace. Records are kept in per-worker ring
+    /// buffers, thus only the most recent records are retained if more
+    /// events are traced than fit into the buffers.
+    struct task_trace_record
+    {
+        // point in time when the event happened (nanoseconds,
+        // hpx::chrono::high_resolution_clock)
+        std::int64_t timestamp_ = 0;
+
+        // identifies the HPX thread the event refers to
+        void const* task_ = nullptr;
+
+        // the annotation of the HPX thread, this refers to static storage
+        char const* name_ = nullptr;
+
+        // global number of the worker thread that recorded the event, -1 if
+        // the event was recorded on a thread not managed by HPX
+        std::int32_t worker_ = -1;
+
+        task_trace_event event_ = task_trace_event::create;
+    };
+
+    /// Start recording task traces. Every worker thread records into a ring
+    /// buffer holding up to \a buffer_size records. Only one out of
+    /// \a sampling_rate created tasks is recorded (all tasks if
+    /// sampling_rate is 1), all events of a sampled task are recorded. Tasks
+    /// created while tracing is disabled are not recorded.
+    HPX_CORE_EXPORT void enable_task_tracing(
+        std::size_t buffer_size, std::size_t sampling_rate = 1);
+
+    /// Stop recording task traces, already recorded data is retained.
+    HPX_CORE_EXPORT void disable_task_tracing() noexcept;
+
+    HPX_CORE_EXPORT bool is_task_tracing_enabled() noexcept;
+
+    /// Discard all recorded task traces.
+    HPX_CORE_EXPORT void reset_task_trace();
+
+    /// Return all recorded task traces, sorted by time.
+    HPX_CORE_EXPORT std::vector<task_trace_record> get_task_trace();
+
+    /// Write all recorded task traces in Chrome trace event format (JSON),
+    /// suitable for chrome://tracing or Perfetto. Each worker thread is shown
+    /// as a separate track, every execution phase of a task is shown as one
+    /// slice on the track of the worker thread that executed it.
+    HPX_CORE_EXPORT void write_task_trace(std::ostream& os);
+    HPX_CORE_EXPORT void write_task_trace(std::string const& filename);
+
+    namespace detail {
+
+        HPX_CORE_EXPORT extern std::atomic<bool> task_tracing_enabled;
+
+        HPX_CORE_EXPORT bool trace_task_created_impl(
+            thread_data const* thrd) noexcept;
+
+        HPX_CORE_EXPORT void trace_task_impl(
+            task_trace_event event, thread_data const* thrd) noexcept;
+
+        // decide whether the given (newly created or recycled) HPX thread is
+        // sampled and record its creation if it is, returns whether the
+        // events of the thread are recorded
+        inline bool trace_task_created(thread_data const* thrd) noexcept
+        {
+            return task_tracing_enabled.load(std::memory_order_relaxed) &&
+                trace_task_created_impl(thrd);
+        }
+
+        // record one event for the given HPX thread if it was sampled when
+        // it was created, this is cheap enough to be left in place if
+        // tracing is not enabled at runtime
+        inline void trace_task(
+            task_trace_event event, thread_data const* thrd) noexcept
+        {
+            if (task_tracing_enabled.load(std::memory_order_relaxed))
+            {
+                trace_task_impl(event, thrd);
+            }
+        }
+    }    // namespace detail
+}    // namespace hpx::threads
+
+#endif
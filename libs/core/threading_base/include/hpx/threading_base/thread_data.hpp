@@ -438,6 +438,17 @@ namespace hpx { namespace threads {
             priority_ = priority;
         }
 
+        // The absolute deadline of this thread in nanoseconds of the steady
+        // clock, zero if the thread has no deadline.
+        constexpr std::uint64_t get_deadline() const noexcept
+        {
+            return deadline_;
+        }
+        void set_deadline(std::uint64_t deadline) noexcept
+        {
+            deadline_ = deadline;
+        }
+
         // handle thread interruption
         bool interruption_requested() const noexcept
         {
@@ -505,6 +516,15 @@ namespace hpx { namespace threads {
             last_worker_thread_num_ = last_worker_thread_num;
         }
 
+#if defined(HPX_HAVE_TASK_TRACING)
+        // whether the events of this thread are recorded in the task trace,
+        // this is decided once whenever the thread is created (or recycled)
+        constexpr bool is_task_traced() const noexcept
+        {
+            return task_traced_;
+        }
+#endif
+
         constexpr std::ptrdiff_t get_stack_size() const noexcept
         {
             return stacksize_;
@@ -614,11 +634,15 @@ namespace hpx { namespace threads {
 #endif
         ///////////////////////////////////////////////////////////////////////
         thread_priority priority_;
+        std::uint64_t deadline_;
 
         bool requested_interrupt_;
         bool enabled_interrupt_;
         bool ran_exit_funcs_;
         bool const is_stackless_;
+#if defined(HPX_HAVE_TASK_TRACING)
+        bool task_traced_;
+#endif
 
         // Singly linked list (heap-allocated)
         std::forward_list<hpx::function<void()>> exit_funcs_;
@@ -360,6 +360,45 @@ namespace hpx::threads {
     HPX_CORE_EXPORT threads::thread_priority get_thread_priority(
         thread_id_type const& id, error_code& ec = throws) noexcept;
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// Return the deadline of the given thread
+    ///
+    /// \param id         [in] The thread id of the thread whose deadline
+    ///                   is queried.
+    /// \param ec         [in,out] this represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws
+    ///                   the function will throw on error instead.
+    ///
+    /// \returns          The absolute deadline of the thread, or a default
+    ///                   constructed time point if the thread has no
+    ///                   deadline.
+    HPX_CORE_EXPORT hpx::chrono::steady_clock::time_point get_thread_deadline(
+        thread_id_type const& id, error_code& ec = throws) noexcept;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Set the deadline of the given thread. The deadline is passed on to all
+    /// threads created by the given thread from now on (unless those specify
+    /// a deadline explicitly). The deadline is used by schedulers which order
+    /// the threads by deadline (see \a hpx::threads::policies::
+    /// deadline_queue_scheduler), all other schedulers ignore it.
+    ///
+    /// \param id         [in] The thread id of the thread whose deadline
+    ///                   should be set.
+    /// \param deadline   [in] The new absolute deadline, a default
+    ///                   constructed time point removes the deadline.
+    /// \param ec         [in,out] this represents the error status on exit,
+    ///                   if this is pre-initialized to \a hpx#throws
+    ///                   the function will throw on error instead.
+    ///
+    /// \note             As long as \a ec is not pre-initialized to
+    ///                   \a hpx#throws this function doesn't
+    ///                   throw but returns the result code using the
+    ///                   parameter \a ec. Otherwise it throws an instance
+    ///                   of hpx#exception.
+    HPX_CORE_EXPORT void set_thread_deadline(thread_id_type const& id,
+        hpx::chrono::steady_time_point const& deadline,
+        error_code& ec = throws);
+
     ///////////////////////////////////////////////////////////////////////////
     /// Return stack size of the given thread
     ///
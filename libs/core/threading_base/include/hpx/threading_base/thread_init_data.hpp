@@ -44,6 +44,7 @@ namespace hpx { namespace threads {
           , stacksize(thread_stacksize::default_)
           , initial_state(thread_schedule_state::pending)
           , run_now(false)
+          , deadline(0)
           , scheduler_base(nullptr)
         {
             if (initial_state == thread_schedule_state::staged)
@@ -62,6 +63,7 @@ namespace hpx { namespace threads {
             stacksize = rhs.stacksize;
             initial_state = rhs.initial_state;
             run_now = rhs.run_now;
+            deadline = rhs.deadline;
             scheduler_base = rhs.scheduler_base;
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
             description = HPX_MOVE(rhs.description);
@@ -100,6 +102,7 @@ namespace hpx { namespace threads {
           , stacksize(rhs.stacksize)
           , initial_state(rhs.initial_state)
           , run_now(rhs.run_now)
+          , deadline(rhs.deadline)
           , scheduler_base(rhs.scheduler_base)
         {
         }
@@ -133,6 +136,7 @@ namespace hpx { namespace threads {
           , stacksize(stacksize_)
           , initial_state(initial_state_)
           , run_now(run_now_)
+          , deadline(0)
           , scheduler_base(scheduler_base_)
         {
             HPX_UNUSED(desc);
@@ -167,6 +171,10 @@ namespace hpx { namespace threads {
         thread_schedule_state initial_state;
         bool run_now;
 
+        // absolute deadline of the new thread (in nanoseconds of the steady
+        // clock), zero if the thread has no deadline
+        std::uint64_t deadline;
+
         policies::scheduler_base* scheduler_base;
     };
 }}    // namespace hpx::threads
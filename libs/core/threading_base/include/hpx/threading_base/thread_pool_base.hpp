@@ -389,6 +389,12 @@ namespace hpx::threads {
             return 0;
         }
 #endif
+        virtual std::int64_t get_num_deadline_misses(
+            std::size_t /*thread_num*/, bool /*reset*/)
+        {
+            return 0;
+        }
+
         virtual std::int64_t get_thread_count(thread_schedule_state /*state*/,
             thread_priority /*priority*/, std::size_t /*num_thread*/,
             bool /*reset*/)
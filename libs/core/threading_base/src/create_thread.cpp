@@ -85,6 +85,14 @@ namespace hpx::threads::detail {
         if (data.priority == thread_priority::default_)
             data.priority = thread_priority::normal;
 
+        // Pass the deadline from parent to child (but only if none is
+        // explicitly specified).
+        if (self && data.deadline == 0)
+        {
+            data.deadline =
+                get_thread_id_data(threads::get_self_id())->get_deadline();
+        }
+
         // create the new thread
         scheduler->create_thread(data, &id, ec);
 
@@ -0,0 +1,445 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/memory.hpp>
+#include <hpx/thread_support/spinlock.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+#include <hpx/threading_base/set_thread_state.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+
+namespace hpx::threads::detail {
+
+    namespace {
+
+        constexpr std::uint64_t slot_mask = timer_wheel::num_slots - 1;
+
+        // number of tick bits covered by all levels of the wheel
+        constexpr std::size_t wheel_bits =
+            timer_wheel::num_levels * timer_wheel::slot_bits;
+
+        // timers are never armed for longer than this, which avoids overflows
+        // while converting (infinite) time points to ticks
+        constexpr std::chrono::hours max_timeout(24 * 365 * 100);
+
+        constexpr auto no_expiry =
+            (std::numeric_limits<timer_wheel::clock_type::rep>::max)();
+
+        // index of the lowest bit set in the given non-zero mask
+        std::size_t lowest_bit(std::uint64_t mask) noexcept
+        {
+            HPX_ASSERT(mask != 0);
+
+            std::size_t n = 0;
+            while ((mask & 1) == 0)
+            {
+                mask >>= 1;
+                ++n;
+            }
+            return n;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void timer_wheel_entry::cancel() noexcept
+    {
+        // the wheel is reset only once, while holding the lock of the wheel
+        timer_wheel* wheel = wheel_.load(std::memory_order_acquire);
+        if (wheel != nullptr)
+        {
+            wheel->cancel(this);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    timer_wheel::timer_wheel() noexcept
+      : start_(clock_type::now())
+      , current_tick_(0)
+      , count_(0)
+      , next_expiry_(no_expiry)
+      , occupied_()
+      , slots_()
+      , overflow_(nullptr)
+    {
+    }
+
+    timer_wheel::~timer_wheel()
+    {
+        // All timers have normally expired or were canceled at this point.
+        // The threads referenced by any remaining timer might have been
+        // destroyed already, so those are not touched anymore.
+        auto release = [](timer_wheel_entry* entry) {
+            while (entry != nullptr)
+            {
+                timer_wheel_entry* next = entry->next_;
+                entry->wheel_.store(nullptr, std::memory_order_relaxed);
+                entry->thrd_.detach();
+                intrusive_ptr_release(entry);
+                entry = next;
+            }
+        };
+
+        for (auto& level : slots_)
+        {
+            for (timer_wheel_entry* head : level)
+            {
+                release(head);
+            }
+        }
+        release(overflow_);
+    }
+
+    std::uint64_t timer_wheel::to_tick(
+        time_point t, bool round_up) const noexcept
+    {
+        if (t <= start_)
+        {
+            return 0;
+        }
+
+        clock_type::duration d = t - start_;
+        if (d > max_timeout)
+        {
+            d = max_timeout;
+        }
+        if (round_up)
+        {
+            d += tick_duration - clock_type::duration(1);
+        }
+        return static_cast<std::uint64_t>(d / tick_duration);
+    }
+
+    timer_wheel::time_point timer_wheel::from_tick(
+        std::uint64_t tick) const noexcept
+    {
+        return start_ + static_cast<std::int64_t>(tick) * tick_duration;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void timer_wheel::link(
+        timer_wheel_entry* entry, timer_wheel_entry*& expired) noexcept
+    {
+        std::uint64_t const tick = entry->tick_;
+        if (tick <= current_tick_)
+        {
+            expire(entry, expired);
+            return;
+        }
+
+        // The level is determined by the highest tick bit which differs from
+        // the current tick, this guarantees that the slot of the timer lies
+        // ahead of the current slot on that level.
+        std::uint64_t const diff = tick ^ current_tick_;
+        if ((diff >> wheel_bits) != 0)
+        {
+            entry->prev_ = nullptr;
+            entry->next_ = overflow_;
+            if (overflow_ != nullptr)
+            {
+                overflow_->prev_ = entry;
+            }
+            overflow_ = entry;
+            entry->level_ = static_cast<std::uint8_t>(num_levels);
+            return;
+        }
+
+        std::size_t level = 0;
+        while ((diff >> ((level + 1) * slot_bits)) != 0)
+        {
+            ++level;
+        }
+
+        std::size_t const slot = (tick >> (level * slot_bits)) & slot_mask;
+
+        timer_wheel_entry*& head = slots_[level][slot];
+        entry->prev_ = nullptr;
+        entry->next_ = head;
+        if (head != nullptr)
+        {
+            head->prev_ = entry;
+        }
+        head = entry;
+
+        entry->level_ = static_cast<std::uint8_t>(level);
+        entry->slot_ = static_cast<std::uint8_t>(slot);
+        occupied_[level] |= std::uint64_t(1) << slot;
+    }
+
+    void timer_wheel::unlink(timer_wheel_entry* entry) noexcept
+    {
+        std::size_t const level = entry->level_;
+        timer_wheel_entry*& head =
+            level == num_levels ? overflow_ : slots_[level][entry->slot_];
+
+        if (entry->prev_ != nullptr)
+        {
+            entry->prev_->next_ = entry->next_;
+        }
+        else
+        {
+            head = entry->next_;
+        }
+
+        if (entry->next_ != nullptr)
+        {
+            entry->next_->prev_ = entry->prev_;
+        }
+
+        if (level != num_levels && head == nullptr)
+        {
+            occupied_[level] &= ~(std::uint64_t(1) << entry->slot_);
+        }
+
+        entry->prev_ = nullptr;
+        entry->next_ = nullptr;
+    }
+
+    void timer_wheel::expire(
+        timer_wheel_entry* entry, timer_wheel_entry*& expired) noexcept
+    {
+        entry->wheel_.store(nullptr, std::memory_order_release);
+        count_.fetch_sub(1, std::memory_order_relaxed);
+
+        entry->prev_ = nullptr;
+        entry->next_ = expired;
+        expired = entry;
+    }
+
+    // Re-link all timers of the given (already reached) slot, this moves them
+    // to the lower levels or expires them.
+    void timer_wheel::cascade(
+        timer_wheel_entry*& head, timer_wheel_entry*& expired) noexcept
+    {
+        timer_wheel_entry* entry = head;
+        head = nullptr;
+
+        while (entry != nullptr)
+        {
+            timer_wheel_entry* next = entry->next_;
+            link(entry, expired);
+            entry = next;
+        }
+    }
+
+    void timer_wheel::advance(
+        std::uint64_t target, timer_wheel_entry*& expired) noexcept
+    {
+        while (current_tick_ < target)
+        {
+            // skip all ticks up to the next slot boundary of the lowest
+            // non-empty level
+            std::size_t lowest = 0;
+            while (lowest != num_levels && occupied_[lowest] == 0)
+            {
+                ++lowest;
+            }
+
+            if (lowest == num_levels && overflow_ == nullptr)
+            {
+                current_tick_ = target;
+                break;
+            }
+
+            std::size_t const shift = lowest * slot_bits;
+            std::uint64_t const next = ((current_tick_ >> shift) + 1) << shift;
+            if (next > target)
+            {
+                current_tick_ = target;
+                break;
+            }
+            current_tick_ = next;
+
+            if ((current_tick_ & ((std::uint64_t(1) << wheel_bits) - 1)) == 0)
+            {
+                cascade(overflow_, expired);
+            }
+
+            for (std::size_t level = num_levels - 1; level != 0; --level)
+            {
+                std::size_t const level_shift = level * slot_bits;
+                if ((current_tick_ &
+                        ((std::uint64_t(1) << level_shift) - 1)) == 0)
+                {
+                    std::size_t const slot =
+                        (current_tick_ >> level_shift) & slot_mask;
+                    occupied_[level] &= ~(std::uint64_t(1) << slot);
+                    cascade(slots_[level][slot], expired);
+                }
+            }
+
+            // all timers in the current slot of the lowest level have expired
+            std::size_t const slot = current_tick_ & slot_mask;
+            occupied_[0] &= ~(std::uint64_t(1) << slot);
+
+            timer_wheel_entry* entry = slots_[0][slot];
+            slots_[0][slot] = nullptr;
+            while (entry != nullptr)
+            {
+                timer_wheel_entry* next = entry->next_;
+                expire(entry, expired);
+                entry = next;
+            }
+        }
+    }
+
+    void timer_wheel::update_next_expiry() noexcept
+    {
+        if (count_.load(std::memory_order_relaxed) == 0)
+        {
+            next_expiry_.store(no_expiry, std::memory_order_relaxed);
+            return;
+        }
+
+        // all slots at or before the current slot of each level are empty,
+        // the start of the first non-empty slot is a lower bound for the
+        // expiry of its timers
+        std::uint64_t next = (std::numeric_limits<std::uint64_t>::max)();
+        for (std::size_t level = 0; level != num_levels; ++level)
+        {
+            if (occupied_[level] != 0)
+            {
+                std::size_t const shift = level * slot_bits;
+                std::uint64_t const base =
+                    (current_tick_ >> (shift + slot_bits))
+                    << (shift + slot_bits);
+                next = (std::min)(next,
+                    base |
+                        (std::uint64_t(lowest_bit(occupied_[level])) << shift));
+            }
+        }
+
+        if (overflow_ != nullptr)
+        {
+            next = (std::min)(
+                next, ((current_tick_ >> wheel_bits) + 1) << wheel_bits);
+        }
+
+        next_expiry_.store(from_tick(next).time_since_epoch().count(),
+            std::memory_order_relaxed);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool timer_wheel::add(hpx::intrusive_ptr<timer_wheel_entry> const& entry)
+    {
+        HPX_ASSERT(entry);
+        HPX_ASSERT(entry->wheel_.load(std::memory_order_relaxed) == nullptr);
+
+        timer_wheel_entry* e = entry.get();
+        std::uint64_t const tick = to_tick(e->expiry_, true);
+
+        // the wheel holds a reference to all armed timers
+        intrusive_ptr_add_ref(e);
+
+        std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+
+        // next_expiry_ might be outdated if all timers were canceled
+        auto prev_expiry = no_expiry;
+        if (count_.load(std::memory_order_relaxed) == 0)
+        {
+            // an empty wheel is not advanced while being polled, catch up
+            current_tick_ = (std::max)(
+                current_tick_, to_tick(clock_type::now(), false));
+        }
+        else
+        {
+            prev_expiry = next_expiry_.load(std::memory_order_relaxed);
+        }
+
+        // timers which have expired already fire on the next tick
+        e->tick_ = (std::max)(tick, current_tick_ + 1);
+        e->wheel_.store(this, std::memory_order_relaxed);
+        count_.fetch_add(1, std::memory_order_relaxed);
+
+        [[maybe_unused]] timer_wheel_entry* expired = nullptr;
+        link(e, expired);
+        HPX_ASSERT(expired == nullptr);
+
+        update_next_expiry();
+        return next_expiry_.load(std::memory_order_relaxed) < prev_expiry;
+    }
+
+    void timer_wheel::cancel(timer_wheel_entry* entry) noexcept
+    {
+        {
+            std::lock_guard<hpx::util::detail::spinlock> l(mtx_);
+
+            // the timer might have expired in the meantime
+            if (entry->wheel_.load(std::memory_order_relaxed) != this)
+            {
+                return;
+            }
+
+            unlink(entry);
+            entry->wheel_.store(nullptr, std::memory_order_relaxed);
+            entry->thrd_ = thread_id_ref_type();
+            count_.fetch_sub(1, std::memory_order_relaxed);
+
+            // next_expiry_ stays a valid lower bound
+        }
+
+        intrusive_ptr_release(entry);
+    }
+
+    std::size_t timer_wheel::poll(
+        time_point now, std::size_t num_thread, bool try_lock)
+    {
+        if (empty() || now < next_expiry())
+        {
+            return 0;
+        }
+
+        timer_wheel_entry* expired = nullptr;
+
+        {
+            std::unique_lock<hpx::util::detail::spinlock> l(
+                mtx_, std::defer_lock);
+            if (try_lock)
+            {
+                if (!l.try_lock())
+                {
+                    return 0;
+                }
+            }
+            else
+            {
+                l.lock();
+            }
+
+            advance(to_tick(now, false), expired);
+            update_next_expiry();
+        }
+
+        // wake up the threads of all expired timers, this can't be done while
+        // holding the lock
+        std::size_t count = 0;
+        while (expired != nullptr)
+        {
+            timer_wheel_entry* entry = expired;
+            expired = entry->next_;
+
+            thread_id_ref_type thrd = HPX_MOVE(entry->thrd_);
+
+            error_code ec(throwmode::lightweight);    // do not throw
+            set_thread_state(thrd.noref(), thread_schedule_state::pending,
+                thread_restart_state::timeout, entry->priority_,
+                thread_schedule_hint(static_cast<std::int16_t>(num_thread)),
+                entry->retry_on_active_, ec);
+
+            intrusive_ptr_release(entry);
+            ++count;
+        }
+        return count;
+    }
+}    // namespace hpx::threads::detail
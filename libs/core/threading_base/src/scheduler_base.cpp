@@ -45,6 +45,7 @@ namespace hpx::threads::policies {
       , pu_mtxs_(num_threads)
       , states_(num_threads)
       , description_(description)
+      , timer_wheels_(num_threads)
       , thread_queue_init_(thread_queue_init)
       , parent_pool_(nullptr)
       , background_thread_count_(0)
@@ -87,8 +88,24 @@ namespace hpx::threads::policies {
             double exponent =
                 (std::min)(double(data.wait_count_), double(max_exponent - 1));
 
-            std::chrono::milliseconds period(std::lround((std::min)(
-                data.max_idle_backoff_time_, std::pow(2.0, exponent))));
+            std::chrono::steady_clock::duration period =
+                std::chrono::milliseconds(std::lround((std::min)(
+                    data.max_idle_backoff_time_, std::pow(2.0, exponent))));
+
+            // don't sleep past the expiry of any armed timer
+            auto const now = std::chrono::steady_clock::now();
+            for (auto const& wheel : timer_wheels_)
+            {
+                auto const next_expiry = wheel.data_.next_expiry();
+                if (next_expiry - now < period)
+                {
+                    if (next_expiry <= now)
+                    {
+                        return;
+                    }
+                    period = next_expiry - now;
+                }
+            }
 
             ++data.wait_count_;
 
@@ -359,6 +376,63 @@ namespace hpx::threads::policies {
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    void scheduler_base::add_timer(
+        hpx::intrusive_ptr<threads::detail::timer_wheel_entry> const& entry,
+        std::size_t num_thread)
+    {
+        if (num_thread >= timer_wheels_.size())
+        {
+            num_thread = 0;
+        }
+
+        if (timer_wheels_[num_thread].data_.add(entry))
+        {
+            // wake up idling worker threads, the new timer expires before
+            // all others
+            do_some_work(num_thread);
+        }
+    }
+
+    bool scheduler_base::poll_timers(std::size_t num_thread, bool idle)
+    {
+        HPX_ASSERT(num_thread < timer_wheels_.size());
+
+        using clock_type = threads::detail::timer_wheel::clock_type;
+
+        if (!idle)
+        {
+            threads::detail::timer_wheel& wheel =
+                timer_wheels_[num_thread].data_;
+            return !wheel.empty() &&
+                wheel.poll(clock_type::now(), num_thread) != 0;
+        }
+
+        // idle worker threads take care of the timers of busy or suspended
+        // worker threads as well
+        std::size_t const num_threads = timer_wheels_.size();
+
+        clock_type::time_point now;
+        std::size_t fired = 0;
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            std::size_t const n = (num_thread + i) % num_threads;
+
+            threads::detail::timer_wheel& wheel = timer_wheels_[n].data_;
+            if (wheel.empty())
+            {
+                continue;
+            }
+
+            if (now == clock_type::time_point())
+            {
+                now = clock_type::now();
+            }
+            fired += wheel.poll(now, num_thread, n != num_thread);
+        }
+        return fired != 0;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     std::int64_t scheduler_base::get_background_thread_count() const noexcept
     {
@@ -11,9 +11,15 @@
 #include <hpx/functional/bind.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/modules/memory.hpp>
 #include <hpx/threading_base/create_thread.hpp>
 #include <hpx/threading_base/detail/get_default_timer_service.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
 #include <hpx/threading_base/set_thread_state_timed.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
 #include <hpx/threading_base/threading_base_fwd.hpp>
 
 #include <asio/basic_waitable_timer.hpp>
@@ -21,6 +27,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <system_error>
@@ -160,6 +167,85 @@ namespace hpx::threads::detail {
             thread_schedule_state::terminated, invalid_thread_id);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // This thread function is executed once the timer of a timer wheel has
+    // expired (or if the timer was canceled).
+    thread_result_type expire_timer_thread(
+        hpx::intrusive_ptr<timer_wheel_entry> const& timer,
+        thread_id_ref_type const& thrd, thread_schedule_state newstate,
+        thread_restart_state newstate_ex, thread_priority priority,
+        bool retry_on_active, thread_restart_state my_statex)
+    {
+        HPX_ASSERT(my_statex == thread_restart_state::abort ||
+            my_statex == thread_restart_state::timeout);
+
+        // NOLINTNEXTLINE(bugprone-branch-clone)
+        if (thread_restart_state::timeout != my_statex)    //-V601
+        {
+            // the timer has been canceled
+            timer->cancel();
+        }
+        else
+        {
+            detail::set_thread_state(thrd.noref(), newstate, newstate_ex,
+                priority, thread_schedule_hint(), retry_on_active);
+        }
+
+        return thread_result_type(
+            thread_schedule_state::terminated, invalid_thread_id);
+    }
+
+    // Arm a timer on the timer wheel of the calling worker thread. The
+    // returned (suspended) thread is woken up by the worker thread polling
+    // the wheel once the timer expires, it then initiates the required
+    // set_state action.
+    thread_id_ref_type set_thread_state_timer_wheel(
+        policies::scheduler_base* scheduler,
+        hpx::chrono::steady_time_point const& abs_time,
+        thread_id_type const& thrd, thread_schedule_state newstate,
+        thread_restart_state newstate_ex, thread_priority priority,
+        thread_schedule_hint schedulehint, std::atomic<bool>* started,
+        bool retry_on_active, error_code& ec)
+    {
+        hpx::intrusive_ptr<timer_wheel_entry> timer(
+            new timer_wheel_entry(abs_time.value(), invalid_thread_id,
+                priority, retry_on_active),
+            false);
+
+        thread_init_data data(
+            hpx::bind_front(&expire_timer_thread, timer,
+                thread_id_ref_type(thrd), newstate, newstate_ex, priority,
+                retry_on_active),
+            "wake_timer", priority, schedulehint, thread_stacksize::small_,
+            thread_schedule_state::suspended, true);
+
+        thread_id_ref_type newid = invalid_thread_id;
+        create_thread(scheduler, data, newid, ec);    //-V601
+        if (!newid)
+        {
+            return invalid_thread_id;
+        }
+
+        // prefer the wheel of the calling worker thread
+        std::size_t num_thread = std::size_t(-1);
+        thread_data const* self = get_self_id_data();
+        if (self != nullptr && self->get_scheduler_base() == scheduler)
+        {
+            num_thread = get_local_thread_num_tss();
+        }
+
+        timer->thrd_ = newid;
+        scheduler->add_timer(timer, num_thread);
+
+        if (started != nullptr)
+        {
+            started->store(true);
+        }
+
+        return newid;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
     // Set a timer to set the state of the given \a thread to the given new
     // value after it expired (at the given time)
     thread_id_ref_type set_thread_state_timed(
@@ -178,6 +264,14 @@ namespace hpx::threads::detail {
             return invalid_thread_id;
         }
 
+        if (scheduler->has_scheduler_mode(
+                policies::scheduler_mode::enable_timer_wheel))
+        {
+            return set_thread_state_timer_wheel(scheduler, abs_time, thrd,
+                newstate, newstate_ex, priority, schedulehint, started,
+                retry_on_active, ec);
+        }
+
         // this creates a new thread which creates the timer and handles the
         // requested actions
         thread_init_data data(
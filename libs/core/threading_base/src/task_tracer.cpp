@@ -0,0 +1,475 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_TASK_TRACING)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace hpx::threads {
+
+    namespace detail {
+
+        std::atomic<bool> task_tracing_enabled(false);
+    }
+
+    namespace {
+
+        // Ring buffer of trace records, written by exactly one OS thread and
+        // read concurrently while collecting the trace. Every slot is
+        // guarded by a sequence lock: the sequence number is odd while the
+        // slot is being written and it identifies the record the slot
+        // holds. The record itself is stored in relaxed atomic words, a
+        // reader discards whatever it copied if the sequence number changed
+        // in the meantime.
+        struct trace_buffer
+        {
+            static constexpr std::size_t num_words =
+                (sizeof(task_trace_record) + sizeof(std::uint64_t) - 1) /
+                sizeof(std::uint64_t);
+
+            static_assert(std::is_trivially_copyable_v<task_trace_record>);
+
+            struct slot
+            {
+                std::atomic<std::uint64_t> seq_{0};
+                std::atomic<std::uint64_t> data_[num_words] = {};
+            };
+
+            explicit trace_buffer(std::size_t capacity)
+              : slots_(new slot[capacity])
+              , capacity_(capacity)
+              , head_(0)
+            {
+            }
+
+            void push(task_trace_record const& r) noexcept
+            {
+                std::uint64_t words[num_words] = {};
+                std::memcpy(words, &r, sizeof(r));
+
+                std::uint64_t const head =
+                    head_.load(std::memory_order_relaxed);
+                slot& s = slots_[head % capacity_];
+
+                s.seq_.store(2 * head + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+
+                for (std::size_t i = 0; i != num_words; ++i)
+                {
+                    s.data_[i].store(words[i], std::memory_order_relaxed);
+                }
+
+                s.seq_.store(2 * head + 2, std::memory_order_release);
+                head_.store(head + 1, std::memory_order_release);
+            }
+
+            void collect(std::vector<task_trace_record>& result) const
+            {
+                std::uint64_t const head =
+                    head_.load(std::memory_order_acquire);
+                std::uint64_t first =
+                    head > capacity_ ? head - capacity_ : 0;
+
+                for (/**/; first != head; ++first)
+                {
+                    slot const& s = slots_[first % capacity_];
+
+                    // skip records which are overwritten concurrently
+                    std::uint64_t const seq =
+                        s.seq_.load(std::memory_order_acquire);
+                    if (seq != 2 * first + 2)
+                    {
+                        continue;
+                    }
+
+                    std::uint64_t words[num_words];
+                    for (std::size_t i = 0; i != num_words; ++i)
+                    {
+                        words[i] = s.data_[i].load(std::memory_order_relaxed);
+                    }
+
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (s.seq_.load(std::memory_order_relaxed) != seq)
+                    {
+                        continue;
+                    }
+
+                    task_trace_record r;
+                    std::memcpy(&r, words, sizeof(r));
+                    result.push_back(r);
+                }
+            }
+
+            std::unique_ptr<slot[]> slots_;
+            std::size_t capacity_;
+            std::atomic<std::uint64_t> head_;
+        };
+
+        struct tracer
+        {
+            trace_buffer& get_buffer()
+            {
+                thread_local std::shared_ptr<trace_buffer> buffer;
+                thread_local std::uint64_t generation = 0;
+
+                std::uint64_t const current =
+                    generation_.load(std::memory_order_acquire);
+                if (buffer == nullptr || generation != current)
+                {
+                    std::lock_guard<std::mutex> l(mtx_);
+                    buffer = std::make_shared<trace_buffer>(capacity_);
+                    buffers_.push_back(buffer);
+                    generation = current;
+                }
+                return *buffer;
+            }
+
+            // Decide whether a newly created HPX thread is traced. Every OS
+            // thread counts the threads it creates, exactly one out of
+            // sampling_rate of those is sampled. The decision is stored with
+            // the thread, thus either all or none of the events of a task
+            // end up in the trace.
+            bool sample_created() noexcept
+            {
+                std::size_t const rate =
+                    sampling_rate_.load(std::memory_order_relaxed);
+                if (rate <= 1)
+                {
+                    return true;
+                }
+
+                // a thread local counter avoids contention between the
+                // workers creating threads concurrently
+                thread_local std::uint64_t created = 0;
+                return (created++ % rate) == 0;
+            }
+
+            std::atomic<std::uint64_t> generation_{1};
+            std::atomic<std::size_t> sampling_rate_{1};
+
+            std::mutex mtx_;
+            std::size_t capacity_ = 0;
+            std::vector<std::shared_ptr<trace_buffer>> buffers_;
+        };
+
+        tracer& get_tracer()
+        {
+            static tracer t;
+            return t;
+        }
+
+        void write_json_string(std::ostream& os, char const* s)
+        {
+            os << '"';
+            for (/**/; s != nullptr && *s != '\0'; ++s)
+            {
+                char const c = *s;
+                if (c == '"' || c == '\\')
+                {
+                    os << '\\' << c;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    hpx::util::format_to(os, "\\u{:04x}", static_cast<int>(c));
+                }
+                else
+                {
+                    os << c;
+                }
+            }
+            os << '"';
+        }
+
+        constexpr bool is_begin_event(task_trace_event event) noexcept
+        {
+            return event == task_trace_event::start ||
+                event == task_trace_event::resume;
+        }
+
+        constexpr bool is_end_event(task_trace_event event) noexcept
+        {
+            return event == task_trace_event::suspend ||
+                event == task_trace_event::terminate;
+        }
+
+        constexpr char const* get_event_name(task_trace_event event) noexcept
+        {
+            switch (event)
+            {
+            case task_trace_event::create:
+                return "create";
+            case task_trace_event::start:
+                return "start";
+            case task_trace_event::suspend:
+                return "suspend";
+            case task_trace_event::resume:
+                return "resume";
+            case task_trace_event::terminate:
+                return "terminate";
+            }
+            return "unknown";
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void enable_task_tracing(std::size_t buffer_size, std::size_t sampling_rate)
+    {
+        if (buffer_size == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "hpx::threads::enable_task_tracing",
+                "the trace buffer size must be larger than zero");
+        }
+        if (sampling_rate == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "hpx::threads::enable_task_tracing",
+                "the sampling rate must be larger than zero");
+        }
+
+        tracer& t = get_tracer();
+        {
+            std::lock_guard<std::mutex> l(t.mtx_);
+            if (t.capacity_ != buffer_size)
+            {
+                // force all threads to allocate new buffers
+                t.capacity_ = buffer_size;
+                t.generation_.fetch_add(1, std::memory_order_acq_rel);
+            }
+            t.sampling_rate_.store(sampling_rate, std::memory_order_relaxed);
+        }
+        detail::task_tracing_enabled.store(true, std::memory_order_release);
+    }
+
+    void disable_task_tracing() noexcept
+    {
+        detail::task_tracing_enabled.store(false, std::memory_order_release);
+    }
+
+    bool is_task_tracing_enabled() noexcept
+    {
+        return detail::task_tracing_enabled.load(std::memory_order_relaxed);
+    }
+
+    void reset_task_trace()
+    {
+        tracer& t = get_tracer();
+
+        std::lock_guard<std::mutex> l(t.mtx_);
+        t.buffers_.clear();
+        t.generation_.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    std::vector<task_trace_record> get_task_trace()
+    {
+        std::vector<task_trace_record> result;
+
+        tracer& t = get_tracer();
+        {
+            std::lock_guard<std::mutex> l(t.mtx_);
+            for (auto const& buffer : t.buffers_)
+            {
+                buffer->collect(result);
+            }
+        }
+
+        std::stable_sort(result.begin(), result.end(),
+            [](task_trace_record const& lhs, task_trace_record const& rhs) {
+                return lhs.timestamp_ < rhs.timestamp_;
+            });
+        return result;
+    }
+
+    void write_task_trace(std::ostream& os)
+    {
+        std::vector<task_trace_record> records = get_task_trace();
+
+        // group the records by worker thread, this keeps the records of each
+        // worker sorted by time
+        std::stable_sort(records.begin(), records.end(),
+            [](task_trace_record const& lhs, task_trace_record const& rhs) {
+                return lhs.worker_ < rhs.worker_;
+            });
+
+        error_code ec(throwmode::lightweight);
+        std::uint32_t pid = detail::get_locality_id(ec);
+        if (pid == ~static_cast<std::uint32_t>(0))
+        {
+            pid = 0;
+        }
+
+        os << "{\"traceEvents\":[\n";
+        bool first = true;
+        auto separate = [&]() {
+            if (!first)
+            {
+                os << ",\n";
+            }
+            first = false;
+        };
+
+        // a worker executes at most one task at a time, the task that is
+        // currently running on the worker is the one that started last
+        task_trace_record const* running = nullptr;
+        std::int32_t current_worker = -2;
+
+        for (task_trace_record const& r : records)
+        {
+            if (r.worker_ != current_worker)
+            {
+                current_worker = r.worker_;
+                running = nullptr;
+
+                separate();
+                os << "{\"name\":\"thread_name\",\"ph\":\"M\",";
+                hpx::util::format_to(os,
+                    "\"pid\":{},\"tid\":{},\"args\":{{\"name\":", pid,
+                    r.worker_);
+                if (r.worker_ < 0)
+                {
+                    os << "\"external\"}}";
+                }
+                else
+                {
+                    hpx::util::format_to(
+                        os, "\"worker-thread#{}\"}}}}", r.worker_);
+                }
+            }
+
+            if (is_begin_event(r.event_))
+            {
+                running = &r;
+                continue;
+            }
+
+            if (is_end_event(r.event_))
+            {
+                // the matching begin event may have been overwritten in the
+                // ring buffer, skip the end event in this case
+                if (running == nullptr || running->task_ != r.task_)
+                {
+                    continue;
+                }
+
+                separate();
+                os << "{\"name\":";
+                write_json_string(os, running->name_);
+                hpx::util::format_to(os,
+                    ",\"cat\":\"task\",\"ph\":\"X\",\"pid\":{},\"tid\":{},"
+                    "\"ts\":{:.3f},\"dur\":{:.3f},\"args\":{{\"task\":\"{}\","
+                    "\"begin\":\"{}\",\"end\":\"{}\"}}}}",
+                    pid, r.worker_,
+                    static_cast<double>(running->timestamp_) / 1000.0,
+                    static_cast<double>(r.timestamp_ - running->timestamp_) /
+                        1000.0,
+                    r.task_, get_event_name(running->event_),
+                    get_event_name(r.event_));
+
+                running = nullptr;
+                continue;
+            }
+
+            // task creation is shown as an instant event on the track of
+            // the creating thread
+            separate();
+            os << "{\"name\":";
+            write_json_string(os, r.name_);
+            hpx::util::format_to(os,
+                ",\"cat\":\"create\",\"ph\":\"i\",\"s\":\"t\",\"pid\":{},"
+                "\"tid\":{},\"ts\":{:.3f},\"args\":{{\"task\":\"{}\"}}}}",
+                pid, r.worker_, static_cast<double>(r.timestamp_) / 1000.0,
+                r.task_);
+        }
+        os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    }
+
+    void write_task_trace(std::string const& filename)
+    {
+        std::ofstream os(filename);
+        if (!os)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::threads::write_task_trace",
+                "could not open task trace file: {}", filename);
+        }
+        write_task_trace(os);
+    }
+
+    namespace detail {
+
+        void record_task_event(tracer& t, task_trace_event event,
+            thread_data const* thrd) noexcept
+        {
+            task_trace_record r;
+            r.timestamp_ = static_cast<std::int64_t>(
+                hpx::chrono::high_resolution_clock::now());
+            r.task_ = thrd;
+
+            threads::thread_description const desc = thrd->get_description();
+            r.name_ = desc.kind() ==
+                    threads::thread_description::data_type_description ?
+                desc.get_description() :
+                "<address>";
+
+            std::size_t const worker = get_global_thread_num_tss();
+            r.worker_ = worker == static_cast<std::size_t>(-1) ?
+                -1 :
+                static_cast<std::int32_t>(worker);
+            r.event_ = event;
+
+            try
+            {
+                t.get_buffer().push(r);
+            }
+            catch (...)
+            {
+                // tracing must never interfere with scheduling
+            }
+        }
+
+        bool trace_task_created_impl(thread_data const* thrd) noexcept
+        {
+            tracer& t = get_tracer();
+            if (!t.sample_created())
+            {
+                return false;
+            }
+
+            record_task_event(t, task_trace_event::create, thrd);
+            return true;
+        }
+
+        void trace_task_impl(
+            task_trace_event event, thread_data const* thrd) noexcept
+        {
+            if (thrd->is_task_traced())
+            {
+                record_task_event(get_tracer(), event, thrd);
+            }
+        }
+    }    // namespace detail
+}    // namespace hpx::threads
+
+#endif
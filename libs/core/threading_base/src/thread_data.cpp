@@ -18,6 +18,9 @@
 #if defined(HPX_HAVE_APEX)
 #include <hpx/threading_base/external_timer.hpp>
 #endif
+#if defined(HPX_HAVE_TASK_TRACING)
+#include <hpx/threading_base/task_tracer.hpp>
+#endif
 
 #include <cstddef>
 #include <cstdint>
@@ -68,10 +71,14 @@ namespace hpx::threads {
       , backtrace_(nullptr)
 #endif
       , priority_(init_data.priority)
+      , deadline_(init_data.deadline)
       , requested_interrupt_(false)
       , enabled_interrupt_(true)
       , ran_exit_funcs_(false)
       , is_stackless_(is_stackless)
+#if defined(HPX_HAVE_TASK_TRACING)
+      , task_traced_(false)
+#endif
       , scheduler_base_(init_data.scheduler_base)
       , last_worker_thread_num_(std::size_t(-1))
       , stacksize_(stacksize)
@@ -100,6 +107,9 @@ namespace hpx::threads {
 #endif
 #if defined(HPX_HAVE_APEX)
         set_timer_data(init_data.timer_data);
+#endif
+#if defined(HPX_HAVE_TASK_TRACING)
+        task_traced_ = detail::trace_task_created(this);
 #endif
     }
 
@@ -215,6 +225,7 @@ namespace hpx::threads {
         backtrace_ = nullptr;
 #endif
         priority_ = init_data.priority;
+        deadline_ = init_data.deadline;
         requested_interrupt_ = false;
         enabled_interrupt_ = true;
         ran_exit_funcs_ = false;
@@ -251,6 +262,9 @@ namespace hpx::threads {
 #endif
 #if defined(HPX_HAVE_APEX)
         set_timer_data(init_data.timer_data);
+#endif
+#if defined(HPX_HAVE_TASK_TRACING)
+        task_traced_ = detail::trace_task_created(this);
 #endif
     }
 
@@ -31,7 +31,9 @@
 #endif
 
 #include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <limits>
 #include <memory>
 #include <string>
@@ -90,6 +92,42 @@ namespace hpx::threads {
                     thread_priority::unknown;
     }
 
+    hpx::chrono::steady_clock::time_point get_thread_deadline(
+        thread_id_type const& id, error_code& /* ec */) noexcept
+    {
+        std::uint64_t const deadline =
+            id ? get_thread_id_data(id)->get_deadline() : 0;
+        return hpx::chrono::steady_clock::time_point(
+            std::chrono::nanoseconds(deadline));
+    }
+
+    void set_thread_deadline(thread_id_type const& id,
+        hpx::chrono::steady_time_point const& deadline, error_code& ec)
+    {
+        if (HPX_UNLIKELY(!id))
+        {
+            HPX_THROWS_IF(ec, hpx::error::null_thread_id,
+                "hpx::threads::set_thread_deadline",
+                "null thread id encountered");
+            return;
+        }
+
+        // zero is reserved for 'no deadline'
+        std::uint64_t value = 0;
+        if (deadline.value() != hpx::chrono::steady_clock::time_point())
+        {
+            std::chrono::nanoseconds const since_epoch =
+                deadline.value().time_since_epoch();
+            value = since_epoch.count() > 0 ?
+                static_cast<std::uint64_t>(since_epoch.count()) :
+                1;
+        }
+        get_thread_id_data(id)->set_deadline(value);
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+
     std::ptrdiff_t get_stack_size(
         thread_id_type const& id, error_code& /* ec */) noexcept
     {
@@ -76,7 +76,8 @@ int main(int argc, char** argv)
         "abp-priority-fifo",
         "abp-priority-lifo",
 #endif
-        "shared-priority"
+        "shared-priority",
+        "deadline"
     };
     // clang-format on
     for (auto const& scheduler : schedulers)
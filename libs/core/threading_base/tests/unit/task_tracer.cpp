@@ -0,0 +1,141 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using hpx::threads::task_trace_event;
+using hpx::threads::task_trace_record;
+
+constexpr std::size_t num_tasks = 100;
+
+std::size_t count_events(
+    std::vector<task_trace_record> const& trace, task_trace_event event)
+{
+    std::size_t count = 0;
+    for (task_trace_record const& r : trace)
+    {
+        if (r.event_ == event)
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
+void run_tasks(std::size_t count = num_tasks)
+{
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        tasks.push_back(hpx::async(hpx::annotated_function(
+            [] { hpx::this_thread::yield(); }, "traced_task")));
+    }
+    hpx::wait_all(tasks);
+}
+
+int hpx_main()
+{
+    // all tasks are traced
+    {
+        hpx::threads::enable_task_tracing(1024);
+        run_tasks();
+        hpx::threads::disable_task_tracing();
+
+        std::vector<task_trace_record> trace = hpx::threads::get_task_trace();
+
+        HPX_TEST_LTE(num_tasks, count_events(trace, task_trace_event::create));
+        HPX_TEST_LTE(
+            num_tasks, count_events(trace, task_trace_event::terminate));
+        HPX_TEST_LTE(num_tasks, count_events(trace, task_trace_event::suspend));
+
+        for (std::size_t i = 1; i < trace.size(); ++i)
+        {
+            HPX_TEST_LTE(trace[i - 1].timestamp_, trace[i].timestamp_);
+        }
+
+#if defined(HPX_HAVE_THREAD_DESCRIPTION)
+        std::size_t named = 0;
+        for (task_trace_record const& r : trace)
+        {
+            if (r.name_ != nullptr && std::strcmp(r.name_, "traced_task") == 0)
+            {
+                ++named;
+            }
+        }
+        HPX_TEST_LTE(3 * num_tasks, named);
+#endif
+
+        std::ostringstream strm;
+        hpx::threads::write_task_trace(strm);
+        std::string const json = strm.str();
+        HPX_TEST_EQ(json.find("{\"traceEvents\":["), std::size_t(0));
+        HPX_TEST_NEQ(json.find("\"ph\":\"X\""), std::string::npos);
+    }
+
+    // nothing is recorded while tracing is disabled
+    {
+        hpx::threads::reset_task_trace();
+        run_tasks();
+        HPX_TEST(hpx::threads::get_task_trace().empty());
+    }
+
+    // only a subset of the tasks is traced when sampling
+    {
+        hpx::threads::reset_task_trace();
+        hpx::threads::enable_task_tracing(1024, 1000000);
+        run_tasks();
+        hpx::threads::disable_task_tracing();
+
+        std::vector<task_trace_record> trace = hpx::threads::get_task_trace();
+        HPX_TEST_LT(count_events(trace, task_trace_event::create), num_tasks);
+    }
+
+    // the observed sampling rate matches the requested one, the sampling
+    // decision does not depend on where the tasks are allocated
+    {
+        constexpr std::size_t sampling_rate = 10;
+        constexpr std::size_t num_sampled_tasks = 50 * num_tasks;
+
+        hpx::threads::reset_task_trace();
+        hpx::threads::enable_task_tracing(4096, sampling_rate);
+        run_tasks(num_sampled_tasks);
+        hpx::threads::disable_task_tracing();
+
+        std::vector<task_trace_record> trace = hpx::threads::get_task_trace();
+
+        // allow for a few other tasks created while tracing
+        std::size_t const expected = num_sampled_tasks / sampling_rate;
+        std::size_t const created =
+            count_events(trace, task_trace_event::create);
+        HPX_TEST_LTE(expected - expected / 10, created);
+        HPX_TEST_LTE(created, expected + expected / 10);
+
+        // only tasks which were sampled when they were created are traced
+        HPX_TEST_LTE(count_events(trace, task_trace_event::terminate), created);
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,204 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The timer wheel is driven directly using synthetic points in time. The
+// timers don't reference any thread, expiring them only counts them.
+
+#include <hpx/config.hpp>
+#include <hpx/modules/memory.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/detail/timer_wheel.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using hpx::threads::detail::timer_wheel;
+using hpx::threads::detail::timer_wheel_entry;
+
+using namespace std::chrono_literals;
+using time_point = timer_wheel::time_point;
+
+hpx::intrusive_ptr<timer_wheel_entry> make_timer(time_point expiry)
+{
+    return hpx::intrusive_ptr<timer_wheel_entry>(
+        new timer_wheel_entry(expiry, hpx::threads::invalid_thread_id,
+            hpx::threads::thread_priority::normal),
+        false);
+}
+
+// timers expire at the granularity of the wheel
+constexpr auto tick = timer_wheel::tick_duration;
+
+// the range covered by all levels of the wheel (about 838s)
+constexpr auto wheel_range = tick *
+    (std::int64_t(1) << (timer_wheel::num_levels * timer_wheel::slot_bits));
+
+///////////////////////////////////////////////////////////////////////////////
+void test_next_expiry()
+{
+    timer_wheel wheel;
+    time_point const t0 = timer_wheel::clock_type::now();
+
+    HPX_TEST(wheel.empty());
+    HPX_TEST(wheel.next_expiry() == (time_point::max)());
+    HPX_TEST_EQ(wheel.poll(t0 + 1h, 0), std::size_t(0));
+
+    // the earliest timer changes the next expiry, which is a lower bound
+    HPX_TEST(wheel.add(make_timer(t0 + 2s)));
+    HPX_TEST(!wheel.empty());
+    HPX_TEST(wheel.next_expiry() <= t0 + 2s + tick);
+
+    HPX_TEST(!wheel.add(make_timer(t0 + 3s)));
+    HPX_TEST(wheel.next_expiry() <= t0 + 2s + tick);
+
+    HPX_TEST(wheel.add(make_timer(t0 + 10ms)));
+    HPX_TEST(wheel.next_expiry() <= t0 + 10ms + tick);
+
+    // polling before the next expiry does nothing
+    HPX_TEST_EQ(wheel.poll(t0 + 9ms, 0), std::size_t(0));
+
+    HPX_TEST_EQ(wheel.poll(t0 + 11ms, 0), std::size_t(1));
+    HPX_TEST(wheel.next_expiry() > t0 + 11ms);
+    HPX_TEST(wheel.next_expiry() <= t0 + 2s + tick);
+
+    HPX_TEST_EQ(wheel.poll(t0 + 3001ms, 0), std::size_t(2));
+    HPX_TEST(wheel.empty());
+    HPX_TEST(wheel.next_expiry() == (time_point::max)());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// timers on the higher levels are moved to the lower levels while the wheel
+// advances, none of them may expire early
+void test_cascade()
+{
+    timer_wheel wheel;
+    time_point const t0 = timer_wheel::clock_type::now();
+
+    // one timer on each level of the wheel
+    std::vector<time_point> const expiries = {
+        t0 + 1ms, t0 + 100ms, t0 + 5s, t0 + 300s};
+    for (auto it = expiries.rbegin(); it != expiries.rend(); ++it)
+    {
+        wheel.add(make_timer(*it));
+    }
+
+    for (time_point const expiry : expiries)
+    {
+        HPX_TEST(wheel.next_expiry() <= expiry + tick);
+
+        // approach the expiry in steps, which cascades the timer down
+        for (std::chrono::milliseconds delta : {1000ms, 100ms, 10ms, 1ms})
+        {
+            HPX_TEST_EQ(wheel.poll(expiry - delta, 0), std::size_t(0));
+        }
+        HPX_TEST(!wheel.empty());
+
+        HPX_TEST_EQ(wheel.poll(expiry + 1ms, 0), std::size_t(1));
+    }
+    HPX_TEST(wheel.empty());
+
+    // timers close to each other on a higher level expire separately
+    wheel.add(make_timer(t0 + 301s));
+    wheel.add(make_timer(t0 + 301s + 100ms));
+    wheel.add(make_timer(t0 + 301s + 200ms));
+
+    HPX_TEST_EQ(wheel.poll(t0 + 301s + 1ms, 0), std::size_t(1));
+    HPX_TEST_EQ(wheel.poll(t0 + 301s + 150ms, 0), std::size_t(1));
+    HPX_TEST_EQ(wheel.poll(t0 + 301s + 199ms, 0), std::size_t(0));
+    HPX_TEST_EQ(wheel.poll(t0 + 301s + 201ms, 0), std::size_t(1));
+    HPX_TEST(wheel.empty());
+
+    // a single poll expires all timers on all levels at once
+    for (time_point const expiry : expiries)
+    {
+        wheel.add(make_timer(expiry + 302s));
+    }
+    HPX_TEST_EQ(wheel.poll(t0 + 700s, 0), expiries.size());
+    HPX_TEST(wheel.empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// timers beyond the range of the top level are kept aside until the wheel
+// reaches their range
+void test_overflow()
+{
+    timer_wheel wheel;
+    time_point const t0 = timer_wheel::clock_type::now();
+
+    time_point const far = t0 + wheel_range + 100s;
+    time_point const farther = t0 + 3 * wheel_range + 10ms;
+
+    wheel.add(make_timer(farther));
+    wheel.add(make_timer(far));
+    wheel.add(make_timer((time_point::max)()));
+    HPX_TEST(wheel.next_expiry() <= far + tick);
+
+    HPX_TEST_EQ(wheel.poll(t0 + wheel_range - 1s, 0), std::size_t(0));
+    HPX_TEST_EQ(wheel.poll(t0 + wheel_range + 1s, 0), std::size_t(0));
+    HPX_TEST_EQ(wheel.poll(far - 1ms, 0), std::size_t(0));
+    HPX_TEST_EQ(wheel.poll(far + 1ms, 0), std::size_t(1));
+    HPX_TEST(wheel.next_expiry() <= farther + tick);
+
+    HPX_TEST_EQ(wheel.poll(t0 + 2 * wheel_range, 0), std::size_t(0));
+    HPX_TEST_EQ(wheel.poll(farther - 1ms, 0), std::size_t(0));
+    HPX_TEST_EQ(wheel.poll(farther + 1ms, 0), std::size_t(1));
+
+    // a timer which never expires stays armed
+    HPX_TEST(!wheel.empty());
+    HPX_TEST_EQ(wheel.poll(t0 + 100 * wheel_range, 0), std::size_t(0));
+    HPX_TEST(!wheel.empty());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_cancel()
+{
+    timer_wheel wheel;
+    time_point const t0 = timer_wheel::clock_type::now();
+
+    auto const first = make_timer(t0 + 10ms);
+    auto const second = make_timer(t0 + 20ms);
+    auto const far = make_timer(t0 + wheel_range + 1s);
+
+    wheel.add(first);
+    wheel.add(second);
+    wheel.add(far);
+
+    // canceled timers don't expire
+    first->cancel();
+    HPX_TEST_EQ(wheel.poll(t0 + 11ms, 0), std::size_t(0));
+    HPX_TEST(!wheel.empty());
+
+    HPX_TEST_EQ(wheel.poll(t0 + 21ms, 0), std::size_t(1));
+
+    // canceling an expired timer (again) does nothing
+    second->cancel();
+    first->cancel();
+    HPX_TEST(!wheel.empty());
+
+    // timers beyond the range of the top level can be canceled as well
+    far->cancel();
+    HPX_TEST(wheel.empty());
+    HPX_TEST_EQ(wheel.poll(t0 + wheel_range + 2s, 0), std::size_t(0));
+
+    // the wheel can be reused after all timers were canceled
+    auto const next = make_timer(t0 + wheel_range + 3s);
+    HPX_TEST(wheel.add(next));
+    HPX_TEST_EQ(wheel.poll(t0 + wheel_range + 3s + 1ms, 0), std::size_t(1));
+    HPX_TEST(wheel.empty());
+}
+
+int main()
+{
+    test_next_expiry();
+    test_cascade();
+    test_overflow();
+    test_cancel();
+
+    return hpx::util::report_errors();
+}
@@ -314,6 +314,7 @@ namespace hpx { namespace threads {
     public:
         // performance counters
         std::int64_t get_queue_length(bool reset);
+        std::int64_t get_num_deadline_misses(bool reset);
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
         std::int64_t get_average_thread_wait_time(bool reset);
         std::int64_t get_average_task_wait_time(bool reset);
@@ -421,6 +422,8 @@ namespace hpx { namespace threads {
         void create_scheduler_shared_priority(
             thread_pool_init_parameters const&,
             policies::thread_queue_init_parameters const&, std::size_t);
+        void create_scheduler_deadline(thread_pool_init_parameters const&,
+            policies::thread_queue_init_parameters const&, std::size_t);
 
         mutable mutex_type mtx_;    // mutex protecting the members
 
@@ -434,6 +437,10 @@ namespace hpx { namespace threads {
 
         notification_policy_type& notifier_;
         detail::network_background_callback_type network_background_callback_;
+
+#if defined(HPX_HAVE_TASK_TRACING)
+        std::string trace_file_;    // write task trace here on stop()
+#endif
     };
 }}    // namespace hpx::threads
 
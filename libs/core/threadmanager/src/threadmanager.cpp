@@ -23,6 +23,7 @@
 #include <hpx/thread_pool_util/thread_pool_suspension_helpers.hpp>
 #include <hpx/thread_pools/scheduled_thread_pool.hpp>
 #include <hpx/threading_base/set_thread_state.hpp>
+#include <hpx/threading_base/task_tracer.hpp>
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 #include <hpx/threading_base/thread_init_data.hpp>
@@ -87,6 +88,18 @@ namespace hpx { namespace threads {
             &resource::detail::partitioner::assign_pu, std::ref(rp), _3, _1));
         notifier.add_on_stop_thread_callback(hpx::bind(
             &resource::detail::partitioner::unassign_pu, std::ref(rp), _3, _1));
+
+#if defined(HPX_HAVE_TASK_TRACING)
+        trace_file_ = rtcfg_.get_entry("hpx.task_tracing.file", "");
+        if (!trace_file_.empty())
+        {
+            enable_task_tracing(
+                hpx::util::get_entry_as<std::size_t>(
+                    rtcfg_, "hpx.task_tracing.buffer_size", 65536),
+                hpx::util::get_entry_as<std::size_t>(
+                    rtcfg_, "hpx.task_tracing.sampling_rate", 1));
+        }
+#endif
     }
 
     policies::thread_queue_init_parameters threadmanager::get_init_parameters()
@@ -497,6 +510,36 @@ namespace hpx { namespace threads {
         pools_.push_back(HPX_MOVE(pool));
     }
 
+    void threadmanager::create_scheduler_deadline(
+        thread_pool_init_parameters const& thread_pool_init,
+        policies::thread_queue_init_parameters const& thread_queue_init,
+        std::size_t numa_sensitive)
+    {
+        // instantiate the scheduler
+        using local_sched_type =
+            hpx::threads::policies::deadline_queue_scheduler<>;
+
+        local_sched_type::init_parameter_type init(
+            thread_pool_init.num_threads_, thread_pool_init.affinity_data_,
+            thread_queue_init, "core-deadline_queue_scheduler");
+
+        std::unique_ptr<local_sched_type> sched =
+            std::make_unique<local_sched_type>(init);
+
+        // set the default scheduler flags
+        sched->set_scheduler_mode(thread_pool_init.mode_);
+
+        // conditionally set/unset this flag
+        sched->update_scheduler_mode(
+            policies::scheduler_mode::enable_stealing_numa, !numa_sensitive);
+
+        // instantiate the pool
+        std::unique_ptr<thread_pool_base> pool = std::make_unique<
+            hpx::threads::detail::scheduled_thread_pool<local_sched_type>>(
+            HPX_MOVE(sched), thread_pool_init);
+        pools_.push_back(HPX_MOVE(pool));
+    }
+
     void threadmanager::create_pools()
     {
         auto& rp = hpx::resource::get_partitioner();
@@ -650,6 +693,11 @@ namespace hpx { namespace threads {
                     thread_pool_init, thread_queue_init, numa_sensitive);
                 break;
 
+            case resource::scheduling_policy::deadline:
+                create_scheduler_deadline(
+                    thread_pool_init, thread_queue_init, numa_sensitive);
+                break;
+
             default:
                 [[fallthrough]];
             case resource::scheduling_policy::unspecified:
@@ -926,6 +974,14 @@ namespace hpx { namespace threads {
         return result;
     }
 
+    std::int64_t threadmanager::get_num_deadline_misses(bool reset)
+    {
+        std::int64_t result = 0;
+        for (auto const& pool_iter : pools_)
+            result += pool_iter->get_num_deadline_misses(all_threads, reset);
+        return result;
+    }
+
 #ifdef HPX_HAVE_THREAD_QUEUE_WAITTIME
     std::int64_t threadmanager::get_average_thread_wait_time(bool reset)
     {
@@ -1212,6 +1268,24 @@ namespace hpx { namespace threads {
             pool_iter->stop(lk, blocking);
         }
         deinit_tss();
+
+#if defined(HPX_HAVE_TASK_TRACING)
+        if (!trace_file_.empty())
+        {
+            disable_task_tracing();
+            try
+            {
+                write_task_trace(trace_file_);
+            }
+            catch (hpx::exception const& e)
+            {
+                LERR_(error).format(
+                    "threadmanager::stop: could not write task trace: {}",
+                    e.what());
+            }
+            trace_file_.clear();
+        }
+#endif
     }
 
     bool threadmanager::is_busy()
@@ -16,6 +16,7 @@
 #include <hpx/topology/cpu_mask.hpp>
 #include <hpx/type_support/static.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <iosfwd>
 #include <memory>
@@ -101,9 +102,27 @@ namespace hpx { namespace threads {
 
     struct HPX_CORE_EXPORT topology
     {
+        /// Discover the topology of the machine. If the environment variable
+        /// HPX_TOPOLOGY_CACHE is set, it is used as the name of the topology
+        /// cache file (see below).
         topology();
+
+        /// Discover the topology of the machine, reusing the hwloc XML export
+        /// stored in \a cache_file by an earlier run if it describes this
+        /// machine. If the cache file does not exist (or is invalid), the
+        /// discovered topology is written to it. An empty file name disables
+        /// the cache.
+        explicit topology(std::string const& cache_file);
+
         ~topology();
 
+        /// \brief Return whether the topology was loaded from a cache file
+        ///        instead of being discovered.
+        bool loaded_from_cache() const noexcept
+        {
+            return loaded_from_cache_;
+        }
+
         /// \brief Return the Socket number of the processing unit the
         ///        given thread is running on.
         ///
@@ -366,13 +385,30 @@ namespace hpx { namespace threads {
 
         mask_type init_core_affinity_mask(std::size_t num_thread) const
         {
-            mask_type default_mask = numa_node_affinity_masks_[num_thread];
             return init_core_affinity_mask_from_core(
-                get_core_number(num_thread), default_mask);
+                get_core_number(num_thread),
+                get_numa_node_affinity_mask(num_thread));
         }
 
         void init_num_of_pus();
 
+        bool load_from_cache(std::string const& cache_file);
+        void write_to_cache(std::string const& cache_file) const;
+
+        // The per-PU affinity masks are computed on first use only, most of
+        // them are never needed by a (short-lived) process.
+        struct lazy_mask
+        {
+            std::atomic<bool> initialized_{false};
+            mask_type mask_;
+        };
+
+        template <typename F>
+        mask_cref_type get_lazy_mask(lazy_mask& m, F&& init) const;
+        std::vector<mask_type> get_mask_vector(
+            mask_cref_type (topology::*get_mask)(std::size_t, error_code&)
+                const) const;
+
         hwloc_obj_t get_pu_obj(std::size_t num_core) const;
 
         hwloc_topology_t topo;
@@ -390,9 +426,11 @@ namespace hpx { namespace threads {
 
         std::size_t num_of_pus_;
         bool use_pus_as_cores_;
+        bool loaded_from_cache_;
 
         using mutex_type = hpx::util::spinlock;
         mutable mutex_type topo_mtx;
+        mutable mutex_type masks_mtx_;
 
         // Number masks:
         // Vectors of non-negative integers
@@ -403,7 +441,7 @@ namespace hpx { namespace threads {
         std::vector<std::size_t> numa_node_numbers_;
         std::vector<std::size_t> core_numbers_;
 
-        // Affinity masks: vectors of bitmasks
+        // Affinity masks: vectors of (lazily computed) bitmasks
         // - Length of the vector: number of PUs of the machine
         // - Elements of the vector:
         // Bitmasks of length equal to the number of PUs of the machine.
@@ -412,10 +450,10 @@ namespace hpx { namespace threads {
         // elements = 1 indicate the PUs that belong to the core on which
         // PU #0 (zero-based index) lies.
         mask_type machine_affinity_mask_;
-        std::vector<mask_type> socket_affinity_masks_;
-        std::vector<mask_type> numa_node_affinity_masks_;
-        std::vector<mask_type> core_affinity_masks_;
-        std::vector<mask_type> thread_affinity_masks_;
+        mutable std::vector<lazy_mask> socket_affinity_masks_;
+        mutable std::vector<lazy_mask> numa_node_affinity_masks_;
+        mutable std::vector<lazy_mask> core_affinity_masks_;
+        mutable std::vector<lazy_mask> thread_affinity_masks_;
     };
 
 #include <hpx/config/warnings_suffix.hpp>
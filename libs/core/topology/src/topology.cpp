@@ -20,12 +20,16 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 #include <errno.h>
@@ -49,7 +53,9 @@
 #include <sys/syscall.h>
 #endif
 
-#if defined(HPX_HAVE_UNISTD_H)
+#if defined(HPX_WINDOWS)
+#include <process.h>
+#elif defined(HPX_HAVE_UNISTD_H)
 #include <unistd.h>
 #endif
 
@@ -214,38 +220,106 @@ namespace hpx::threads {
     mask_type topology::empty_mask = mask_type();
 #endif
 
-    topology::topology()
-      : topo(nullptr)
-      , use_pus_as_cores_(false)
-      , machine_affinity_mask_(0)
-    {
-        int err = hwloc_topology_init(&topo);
-        if (err != 0)
+    namespace detail {
+
+        std::string get_topology_cache_file()
         {
-            HPX_THROW_EXCEPTION(hpx::error::no_success, "topology::topology",
-                "Failed to init hwloc topology");
+            char const* cache_file = std::getenv("HPX_TOPOLOGY_CACHE");
+            return cache_file != nullptr ? cache_file : "";
         }
 
+        int init_hwloc_topology(hwloc_topology_t& topo)
+        {
+            int err = hwloc_topology_init(&topo);
+            if (err != 0)
+            {
+                return err;
+            }
+
 #if HWLOC_API_VERSION >= 0x00020000
 #if defined(HPX_TOPOLOGY_HAVE_ADDITIONAL_HWLOC_TESTING)
-        // Enable HWLOC filtering that makes it report no cores. This is purely
-        // an option allowing to test whether things work properly on systems
-        // that may not report cores in the topology at all (e.g. FreeBSD).
-        err = hwloc_topology_set_type_filter(
-            topo, HWLOC_OBJ_CORE, HWLOC_TYPE_FILTER_KEEP_NONE);
-        if (err != 0)
-        {
-            HPX_THROW_EXCEPTION(hpx::error::no_success, "topology::topology",
-                "Failed to set core filter for hwloc topology");
+            // Enable HWLOC filtering that makes it report no cores. This is
+            // purely an option allowing to test whether things work properly
+            // on systems that may not report cores in the topology at all
+            // (e.g. FreeBSD).
+            err = hwloc_topology_set_type_filter(
+                topo, HWLOC_OBJ_CORE, HWLOC_TYPE_FILTER_KEEP_NONE);
+#endif
+#endif
+            return err;
         }
+
+        // A cached topology can be used only if it was exported on this host
+        // and if it covers all processing units this process may run on.
+        bool is_valid_cached_topology(hwloc_topology_t topo)
+        {
+            hwloc_obj_t root = hwloc_get_root_obj(topo);
+            if (root == nullptr)
+            {
+                return false;
+            }
+
+#if defined(HPX_HAVE_UNISTD_H) && !defined(HPX_WINDOWS)
+            char const* cached_host =
+                hwloc_obj_get_info_by_name(root, "HostName");
+            if (cached_host != nullptr)
+            {
+                char host[256] = {};
+                if (gethostname(host, sizeof(host) - 1) != 0 ||
+                    std::string(cached_host) != host)
+                {
+                    return false;
+                }
+            }
 #endif
+
+#if !defined(__APPLE__)
+            hpx_hwloc_bitmap_wrapper cpuset(hwloc_bitmap_alloc());
+            if (hwloc_get_cpubind(
+                    topo, cpuset.get_bmp(), HWLOC_CPUBIND_PROCESS) == 0 &&
+                !hwloc_bitmap_isincluded(
+                    cpuset.get_bmp(), hwloc_topology_get_topology_cpuset(topo)))
+            {
+                return false;
+            }
 #endif
+            return true;
+        }
+    }    // namespace detail
+
+    topology::topology()
+      : topology(detail::get_topology_cache_file())
+    {
+    }
 
-        err = hwloc_topology_load(topo);
-        if (err != 0)
+    topology::topology(std::string const& cache_file)
+      : topo(nullptr)
+      , num_of_pus_(0)
+      , use_pus_as_cores_(false)
+      , loaded_from_cache_(false)
+      , machine_affinity_mask_(0)
+    {
+        loaded_from_cache_ = !cache_file.empty() && load_from_cache(cache_file);
+        if (!loaded_from_cache_)
         {
-            HPX_THROW_EXCEPTION(hpx::error::no_success, "topology::topology",
-                "Failed to load hwloc topology");
+            int err = detail::init_hwloc_topology(topo);
+            if (err != 0)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::no_success,
+                    "topology::topology", "Failed to init hwloc topology");
+            }
+
+            err = hwloc_topology_load(topo);
+            if (err != 0)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::no_success,
+                    "topology::topology", "Failed to load hwloc topology");
+            }
+
+            if (!cache_file.empty())
+            {
+                write_to_cache(cache_file);
+            }
         }
 
         init_num_of_pus();
@@ -291,32 +365,97 @@ namespace hpx::threads {
             core_numbers_.push_back(core_number);
         }
 
+        // the per-PU affinity masks are computed on first use
         machine_affinity_mask_ = init_machine_affinity_mask();
-        socket_affinity_masks_.reserve(num_of_pus_);
-        numa_node_affinity_masks_.reserve(num_of_pus_);
-        core_affinity_masks_.reserve(num_of_pus_);
-        thread_affinity_masks_.reserve(num_of_pus_);
+        socket_affinity_masks_ = std::vector<lazy_mask>(num_of_pus_);
+        numa_node_affinity_masks_ = std::vector<lazy_mask>(num_of_pus_);
+        core_affinity_masks_ = std::vector<lazy_mask>(num_of_pus_);
+        thread_affinity_masks_ = std::vector<lazy_mask>(num_of_pus_);
+    }
 
-        for (std::size_t i = 0; i < num_of_pus_; ++i)
+    bool topology::load_from_cache(std::string const& cache_file)
+    {
+        // don't let hwloc complain about a cache file which was not written
+        // yet
+        if (!std::ifstream(cache_file))
         {
-            socket_affinity_masks_.emplace_back(init_socket_affinity_mask(i));
+            return false;
         }
 
-        for (std::size_t i = 0; i < num_of_pus_; ++i)
+        if (detail::init_hwloc_topology(topo) != 0)
         {
-            numa_node_affinity_masks_.emplace_back(
-                init_numa_node_affinity_mask(i));
+            HPX_THROW_EXCEPTION(hpx::error::no_success,
+                "topology::load_from_cache", "Failed to init hwloc topology");
         }
 
-        for (std::size_t i = 0; i < num_of_pus_; ++i)
+        // the cached topology describes this system, this makes binding
+        // threads and memory work as for a discovered topology
+        if (hwloc_topology_set_xml(topo, cache_file.c_str()) == 0 &&
+            hwloc_topology_set_flags(topo, HWLOC_TOPOLOGY_FLAG_IS_THISSYSTEM) ==
+                0 &&
+            hwloc_topology_load(topo) == 0 &&
+            detail::is_valid_cached_topology(topo))
         {
-            core_affinity_masks_.emplace_back(init_core_affinity_mask(i));
+            return true;
         }
 
-        for (std::size_t i = 0; i < num_of_pus_; ++i)
+        // fall back to discovering the topology
+        hwloc_topology_destroy(topo);
+        topo = nullptr;
+        return false;
+    }
+
+    void topology::write_to_cache(std::string const& cache_file) const
+    {
+        // write to a temporary file first, concurrently starting processes
+        // will see either no cache file or a complete one
+        std::string const tmp_file =
+            cache_file + "." + std::to_string(::getpid()) + ".tmp";
+
+#if HWLOC_API_VERSION >= 0x00020000
+        int const err = hwloc_topology_export_xml(topo, tmp_file.c_str(), 0);
+#else
+        int const err = hwloc_topology_export_xml(topo, tmp_file.c_str());
+#endif
+
+        // failing to write the cache is not an error, the next run will
+        // discover the topology again
+        if (err != 0 || std::rename(tmp_file.c_str(), cache_file.c_str()) != 0)
+        {
+            std::remove(tmp_file.c_str());
+        }
+    }
+
+    template <typename F>
+    mask_cref_type topology::get_lazy_mask(lazy_mask& m, F&& init) const
+    {
+        if (!m.initialized_.load(std::memory_order_acquire))
+        {
+            // computing a mask may need other masks, don't hold the lock
+            // while doing so
+            mask_type mask = init();
+
+            std::lock_guard<mutex_type> l(masks_mtx_);
+            if (!m.initialized_.load(std::memory_order_relaxed))
+            {
+                m.mask_ = HPX_MOVE(mask);
+                m.initialized_.store(true, std::memory_order_release);
+            }
+        }
+        return m.mask_;
+    }
+
+    std::vector<mask_type> topology::get_mask_vector(
+        mask_cref_type (topology::*get_mask)(std::size_t, error_code&)
+            const) const
+    {
+        std::vector<mask_type> masks;
+        masks.reserve(num_of_pus_);
+        for (std::size_t i = 0; i != num_of_pus_; ++i)
         {
-            thread_affinity_masks_.emplace_back(init_thread_affinity_mask(i));
+            masks.push_back((this->*get_mask)(i, throws));
         }
+        return masks;
     }
 
     void topology::write_to_log() const
@@ -345,13 +484,14 @@ namespace hpx::threads {
         detail::write_to_log_mask(
             "machine_affinity_mask", machine_affinity_mask_);
 
-        detail::write_to_log_mask(
-            "socket_affinity_mask", socket_affinity_masks_);
-        detail::write_to_log_mask(
-            "numa_node_affinity_mask", numa_node_affinity_masks_);
-        detail::write_to_log_mask("core_affinity_mask", core_affinity_masks_);
-        detail::write_to_log_mask(
-            "thread_affinity_mask", thread_affinity_masks_);
+        detail::write_to_log_mask("socket_affinity_mask",
+            get_mask_vector(&topology::get_socket_affinity_mask));
+        detail::write_to_log_mask("numa_node_affinity_mask",
+            get_mask_vector(&topology::get_numa_node_affinity_mask));
+        detail::write_to_log_mask("core_affinity_mask",
+            get_mask_vector(&topology::get_core_affinity_mask));
+        detail::write_to_log_mask("thread_affinity_mask",
+            get_mask_vector(&topology::get_thread_affinity_mask));
     }
 
     topology::~topology()
@@ -423,7 +563,8 @@ namespace hpx::threads {
             if (&ec != &throws)
                 ec = make_success_code();
 
-            return socket_affinity_masks_[num_pu];
+            return get_lazy_mask(socket_affinity_masks_[num_pu],
+                [&]() { return init_socket_affinity_mask(num_pu); });
         }
 
         HPX_THROWS_IF(ec, hpx::error::bad_parameter,
@@ -442,7 +583,8 @@ namespace hpx::threads {
             if (&ec != &throws)
                 ec = make_success_code();
 
-            return numa_node_affinity_masks_[num_pu];
+            return get_lazy_mask(numa_node_affinity_masks_[num_pu],
+                [&]() { return init_numa_node_affinity_mask(num_pu); });
         }
 
         HPX_THROWS_IF(ec, hpx::error::bad_parameter,
@@ -461,7 +603,8 @@ namespace hpx::threads {
             if (&ec != &throws)
                 ec = make_success_code();
 
-            return core_affinity_masks_[num_pu];
+            return get_lazy_mask(core_affinity_masks_[num_pu],
+                [&]() { return init_core_affinity_mask(num_pu); });
         }
 
         HPX_THROWS_IF(ec, hpx::error::bad_parameter,
@@ -480,7 +623,8 @@ namespace hpx::threads {
             if (&ec != &throws)
                 ec = make_success_code();
 
-            return thread_affinity_masks_[num_pu];
+            return get_lazy_mask(thread_affinity_masks_[num_pu],
+                [&]() { return init_thread_affinity_mask(num_pu); });
         }
 
         HPX_THROWS_IF(ec, hpx::error::bad_parameter,
@@ -1661,13 +1805,17 @@ namespace hpx::threads {
            << hpx::threads::to_string(machine_affinity_mask_) << "\n";
 
         os << "socket                : \n";
-        print_mask_vector(os, socket_affinity_masks_);
+        print_mask_vector(
+            os, get_mask_vector(&topology::get_socket_affinity_mask));
         os << "numa node             : \n";
-        print_mask_vector(os, numa_node_affinity_masks_);
+        print_mask_vector(
+            os, get_mask_vector(&topology::get_numa_node_affinity_mask));
         os << "core                  : \n";
-        print_mask_vector(os, core_affinity_masks_);
+        print_mask_vector(
+            os, get_mask_vector(&topology::get_core_affinity_mask));
         os << "PUs (/threads)        : \n";
-        print_mask_vector(os, thread_affinity_masks_);
+        print_mask_vector(
+            os, get_mask_vector(&topology::get_thread_affinity_mask));
 
         //! -------------------------------------- topology (numbers)
         os << "[HWLOC topology info] resource numbers :\n";
@@ -12,6 +12,7 @@
 #include <hpx/actions_base/actions_base_fwd.hpp>
 #include <hpx/actions_base/actions_base_support.hpp>
 #include <hpx/preprocessor/stringize.hpp>
+#include <hpx/serialization/detail/hashed_type_id.hpp>
 
 #include <cstdint>
 #include <string>
@@ -21,6 +22,10 @@
 
 namespace hpx { namespace actions { namespace detail {
 
+    // Actions are identified by the hash of their name (see
+    // hpx::serialization::detail::hashed_type_id), which is the same on all
+    // localities. Actions whose hashes collide are assigned ids explicitly
+    // by locality 0 during startup instead.
     struct action_registry
     {
         action_registry(action_registry const&) = delete;
@@ -32,7 +37,9 @@ namespace hpx { namespace actions { namespace detail {
         using typename_to_ctor_t =
             std::unordered_map<std::string, std::pair<ctor_t, ctor_t>>;
         using typename_to_id_t = std::unordered_map<std::string, std::uint32_t>;
-        using cache_t = std::vector<std::pair<ctor_t, ctor_t>>;
+        using id_to_typename_t = std::unordered_map<std::uint32_t, std::string>;
+        using cache_t = serialization::detail::id_dispatch_table<
+            std::pair<ctor_t, ctor_t>>;
 
         static constexpr std::uint32_t invalid_id = ~0;
 
@@ -42,8 +49,12 @@ namespace hpx { namespace actions { namespace detail {
         HPX_EXPORT void register_typename(
             std::string const& type_name, std::uint32_t id);
         HPX_EXPORT void fill_missing_typenames();
+        HPX_EXPORT void retire_hashed_id(std::string const& type_name);
+        HPX_EXPORT std::uint32_t allocate_id();
         HPX_EXPORT std::uint32_t try_get_id(std::string const& type_name) const;
         HPX_EXPORT std::vector<std::string> get_unassigned_typenames() const;
+        HPX_EXPORT std::vector<std::string> get_collided_typenames() const;
+        HPX_EXPORT std::vector<std::string> get_hashed_typenames() const;
 
         HPX_EXPORT static std::uint32_t get_id(std::string const& type_name);
         HPX_EXPORT static base_action* create(
@@ -57,6 +68,7 @@ namespace hpx { namespace actions { namespace detail {
         std::uint32_t max_id_;
         typename_to_ctor_t typename_to_ctor_;
         typename_to_id_t typename_to_id_;
+        id_to_typename_t hashed_id_to_typename_;
         cache_t cache_;
     };
 
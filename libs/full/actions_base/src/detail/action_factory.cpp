@@ -10,6 +10,7 @@
 #include <hpx/actions_base/detail/action_factory.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/serialization/detail/hashed_type_id.hpp>
 #include <hpx/type_support/unused.hpp>
 
 #include <cstddef>
@@ -21,6 +22,9 @@
 
 namespace hpx { namespace actions { namespace detail {
 
+    using serialization::detail::first_hashed_type_id;
+    using serialization::detail::hashed_type_id;
+
     action_registry::action_registry()
       : max_id_(0)
     {
@@ -34,6 +38,21 @@ namespace hpx { namespace actions { namespace detail {
         typename_to_ctor_.emplace(
             std::string(type_name), std::make_pair(ctor, ctor_cont));
 
+        // verify that the hashed id of this action is unique, if not neither
+        // of the actions sharing the id can use it
+        std::uint32_t const hashed_id = hashed_type_id(type_name);
+
+        auto p = hashed_id_to_typename_.emplace(hashed_id, type_name);
+        if (p.second)
+        {
+            cache_id(hashed_id, ctor, ctor_cont);
+        }
+        else if (p.first->second != type_name && !p.first->second.empty())
+        {
+            p.first->second.clear();
+            cache_.erase(hashed_id);
+        }
+
         // populate cache
         typename_to_id_t::const_iterator it = typename_to_id_.find(type_name);
         if (it != typename_to_id_.end())
@@ -65,7 +84,8 @@ namespace hpx { namespace actions { namespace detail {
             cache_id(id, it->second.first, it->second.second);
         }
 
-        if (id > max_id_)
+        // hashed ids are never handed out explicitly
+        if (id > max_id_ && id < first_hashed_type_id)
         {
             max_id_ = id;
         }
@@ -80,6 +100,8 @@ namespace hpx { namespace actions { namespace detail {
             register_typename(str, ++max_id_);
         }
 
+        HPX_ASSERT(max_id_ < first_hashed_type_id);
+
         // Go over all registered mappings from type-names to ids and
         // fill in missing id to constructor mappings.
         for (auto const& d : typename_to_id_)
@@ -91,20 +113,39 @@ namespace hpx { namespace actions { namespace detail {
                 cache_id(d.second, it->second.first, it->second.second);
             }
         }
+    }
 
-        // Go over all registered mappings from type-names to ctors and
-        // fill in missing id to constructor mappings.
-        for (auto const& d : typename_to_ctor_)
+    void action_registry::retire_hashed_id(std::string const& type_name)
+    {
+        std::uint32_t const hashed_id = hashed_type_id(type_name);
+
+        id_to_typename_t::iterator it = hashed_id_to_typename_.find(hashed_id);
+        if (it != hashed_id_to_typename_.end() && it->second == type_name)
         {
-            typename_to_id_t::const_iterator it = typename_to_id_.find(d.first);
-            HPX_ASSERT(it != typename_to_id_.end());
-            cache_id(it->second, d.second.first, d.second.second);
+            it->second.clear();
+            cache_.erase(hashed_id);
         }
     }
 
+    std::uint32_t action_registry::allocate_id()
+    {
+        HPX_ASSERT(max_id_ + 1 < first_hashed_type_id);
+        return ++max_id_;
+    }
+
     std::uint32_t action_registry::try_get_id(
         std::string const& type_name) const
     {
+        // prefer the hashed id, if it is unique
+        std::uint32_t const hashed_id = hashed_type_id(type_name);
+
+        id_to_typename_t::const_iterator hit =
+            hashed_id_to_typename_.find(hashed_id);
+        if (hit != hashed_id_to_typename_.end() && hit->second == type_name)
+        {
+            return hashed_id;
+        }
+
         typename_to_id_t::const_iterator it = typename_to_id_.find(type_name);
         if (it == typename_to_id_.end())
         {
@@ -122,7 +163,45 @@ namespace hpx { namespace actions { namespace detail {
 
         for (value_type const& v : typename_to_ctor_)
         {
-            if (!typename_to_id_.count(v.first))
+            if (try_get_id(v.first) == invalid_id)
+            {
+                result.push_back(v.first);
+            }
+        }
+
+        return result;
+    }
+
+    std::vector<std::string> action_registry::get_collided_typenames() const
+    {
+        using value_type = typename_to_ctor_t::value_type;
+
+        std::vector<std::string> result;
+
+        for (value_type const& v : typename_to_ctor_)
+        {
+            id_to_typename_t::const_iterator it =
+                hashed_id_to_typename_.find(hashed_type_id(v.first));
+            if (it == hashed_id_to_typename_.end() || it->second != v.first)
+            {
+                result.push_back(v.first);
+            }
+        }
+
+        return result;
+    }
+
+    std::vector<std::string> action_registry::get_hashed_typenames() const
+    {
+        using value_type = typename_to_ctor_t::value_type;
+
+        std::vector<std::string> result;
+
+        for (value_type const& v : typename_to_ctor_)
+        {
+            id_to_typename_t::const_iterator it =
+                hashed_id_to_typename_.find(hashed_type_id(v.first));
+            if (it != hashed_id_to_typename_.end() && it->second == v.first)
             {
                 result.push_back(v.first);
             }
@@ -150,7 +229,9 @@ namespace hpx { namespace actions { namespace detail {
     {
         action_registry& this_ = instance();
 
-        if (id >= this_.cache_.size())
+        std::pair<ctor_t, ctor_t> const* ctors = this_.cache_.find(id);
+        if (ctors == nullptr || ctors->first == nullptr ||
+            ctors->second == nullptr)
         {
             std::string msg("Unknown type descriptor " + std::to_string(id));
 #if defined(HPX_DEBUG)
@@ -166,26 +247,7 @@ namespace hpx { namespace actions { namespace detail {
                 "action_registry::create", msg);
             return nullptr;
         }
-
-        std::pair<ctor_t, ctor_t> const& ctors =
-            this_.cache_[static_cast<std::size_t>(id)];
-        if (ctors.first == nullptr || ctors.second == nullptr)    // -V108
-        {
-            std::string msg("Unknown type descriptor " + std::to_string(id));
-#if defined(HPX_DEBUG)
-            if (name != nullptr)
-            {
-                msg += ", for typename " + *name;
-            }
-            msg += this_.collect_registered_typenames();
-#else
-            HPX_UNUSED(name);
-#endif
-            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
-                "action_registry::create", msg);
-            return nullptr;
-        }
-        return !with_continuation ? ctors.first() : ctors.second();
+        return !with_continuation ? ctors->first() : ctors->second();
     }
 
     action_registry& action_registry::instance()
@@ -197,18 +259,7 @@ namespace hpx { namespace actions { namespace detail {
     void action_registry::cache_id(std::uint32_t id,
         action_registry::ctor_t ctor, action_registry::ctor_t ctor_cont)
     {
-        std::size_t id_ = std::size_t(id);
-        if (id_ >= cache_.size())
-        {
-            cache_.resize(id_ + 1, std::pair<ctor_t, ctor_t>(nullptr, nullptr));
-            cache_[id_] = std::pair<ctor_t, ctor_t>{};
-            return;
-        }
-
-        if (cache_[id_].first == nullptr || cache_[id_].second == nullptr)
-        {
-            cache_[id_] = std::make_pair(ctor, ctor_cont);
-        }
+        cache_.assign(id, std::make_pair(ctor, ctor_cont));
     }
 
     std::string action_registry::collect_registered_typenames()
@@ -227,6 +278,16 @@ namespace hpx { namespace actions { namespace detail {
             msg += desc.first + " (";
             msg += std::to_string(desc.second) + ")\n";
         }
+
+        msg += "\nhashed typenames:\n";
+        for (auto const& desc : hashed_id_to_typename_)
+        {
+            if (!desc.second.empty())
+            {
+                msg += desc.second + " (";
+                msg += std::to_string(desc.first) + ")\n";
+            }
+        }
         return msg;
 #else
         return std::string();
@@ -14,7 +14,9 @@
 #include <hpx/cache/lru_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/datastructures/detail/dynamic_bitset.hpp>
+#include <hpx/datastructures/tuple.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/agas_base.hpp>
 #include <hpx/modules/errors.hpp>
@@ -24,6 +26,7 @@
 #include <hpx/parcelset/parcelset_fwd.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
+#include <array>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -79,12 +82,35 @@ namespace hpx { namespace agas {
         std::uint32_t console_cache_;
 
         std::size_t const max_refcnt_requests_;
-
+        std::int64_t const max_refcnt_requests_delay_;    // [ns]
+
+        // Pending credit requests are buffered in shards selected by the
+        // (stripped) gid, this way threads releasing different ids don't
+        // compete for the same lock. The requests for a particular gid
+        // always end up in the same shard, which allows for incref requests
+        // to be matched against pending decref requests.
+        struct refcnt_requests_shard_data
+        {
+            mutex_type mtx_;
+            std::shared_ptr<refcnt_requests_type> requests_ =
+                std::make_shared<refcnt_requests_type>();
+        };
+        using refcnt_requests_shard =
+            util::cache_aligned_data_derived<refcnt_requests_shard_data>;
+
+        static constexpr std::size_t num_refcnt_requests_shards = 16;
+        std::array<refcnt_requests_shard, num_refcnt_requests_shards>
+            refcnt_requests_;
+
+        // serializes sending the buffered requests
         mutex_type refcnt_requests_mtx_;
-        std::size_t refcnt_requests_count_;
-        bool enable_refcnt_caching_;
+        std::atomic<std::size_t> refcnt_requests_count_;
+        std::atomic<std::int64_t> refcnt_requests_first_;    // oldest request
+        std::atomic<bool> enable_refcnt_caching_;
 
-        std::shared_ptr<refcnt_requests_type> refcnt_requests_;
+        // statistics
+        std::atomic<std::int64_t> refcnt_batches_sent_;
+        std::atomic<std::int64_t> refcnt_requests_sent_;
 
         service_mode const service_type;
         runtime_mode const runtime_type;
@@ -176,6 +202,13 @@ namespace hpx { namespace agas {
         // FIXME: document (add comments)
         void garbage_collect(error_code& ec = throws);
 
+        /// Send the buffered credit requests if there are too many of them
+        /// or if the oldest of them has been waiting for longer than
+        /// hpx.agas.max_pending_refcnt_delay. This is invoked from the
+        /// background work of the runtime, which makes sure that no request
+        /// is delayed indefinitely if no further requests are buffered.
+        void send_expired_refcnt_requests(error_code& ec = throws);
+
         std::int64_t synchronize_with_async_incref(
             hpx::future<std::int64_t> fut, hpx::id_type const& id,
             std::int64_t compensated_credit);
@@ -228,9 +261,27 @@ namespace hpx { namespace agas {
         bool was_object_migrated_locked(naming::gid_type const& id);
 
     private:
-        /// Assumes that \a refcnt_requests_mtx_ is locked.
-        void send_refcnt_requests(
-            std::unique_lock<mutex_type>& l, error_code& ec = throws);
+        refcnt_requests_shard& get_refcnt_requests_shard(
+            naming::gid_type const& raw) noexcept;
+
+        /// Return whether the buffered requests have to be sent, given their
+        /// number and the time the oldest of them was buffered.
+        bool refcnt_requests_expired(
+            std::size_t count, std::int64_t first, std::int64_t now) const;
+
+        /// Send the buffered requests if there are too many of them or if
+        /// the oldest of them has been waiting for too long.
+        void send_refcnt_requests(error_code& ec = throws);
+
+        /// Take all buffered requests, combined into one batch for each of
+        /// the target localities. Assumes that \a refcnt_requests_mtx_ is
+        /// locked.
+        using refcnt_batches_type = std::map<hpx::id_type,
+            std::vector<
+                hpx::tuple<std::int64_t, naming::gid_type, naming::gid_type>>>;
+
+        refcnt_batches_type take_refcnt_requests(
+            std::unique_lock<mutex_type>& l, char const* func_name);
 
         /// Assumes that \a refcnt_requests_mtx_ is locked.
         void send_refcnt_requests_non_blocking(
@@ -262,6 +313,10 @@ namespace hpx { namespace agas {
         std::uint64_t get_cache_update_entry_time(bool reset);
         std::uint64_t get_cache_erase_entry_time(bool reset);
 
+        // Helper functions to access the statistics of the credit requests
+        std::uint64_t get_refcnt_batches_sent(bool reset);
+        std::uint64_t get_refcnt_requests_sent(bool reset);
+
     public:
         /// \brief Add a locality to the runtime.
         bool register_locality(parcelset::endpoints_type const& endpoints,
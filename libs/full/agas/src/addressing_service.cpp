@@ -34,7 +34,9 @@
 #include <hpx/serialization/vector.hpp>
 #include <hpx/thread_support/assert_owns_lock.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
 #include <hpx/type_support/unused.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/get_entry_as.hpp>
 #include <hpx/util/insert_checked.hpp>
 
@@ -123,9 +125,13 @@ namespace hpx { namespace agas {
       : gva_cache_(new gva_cache_type)
       , console_cache_(naming::invalid_locality_id)
       , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
+      , max_refcnt_requests_delay_(static_cast<std::int64_t>(
+            ini_.get_agas_max_pending_refcnt_delay() * 1000000))
       , refcnt_requests_count_(0)
+      , refcnt_requests_first_(0)
       , enable_refcnt_caching_(true)
-      , refcnt_requests_(new refcnt_requests_type)
+      , refcnt_batches_sent_(0)
+      , refcnt_requests_sent_(0)
       , service_type(ini_.get_agas_service_mode())
       , runtime_type(ini_.mode_)
       , caching_(ini_.get_agas_caching_mode())
@@ -1301,12 +1307,14 @@ namespace hpx { namespace agas {
         std::int64_t pending_decrefs = 0;
 
         {
-            std::lock_guard<mutex_type> l(refcnt_requests_mtx_);
+            refcnt_requests_shard& shard = get_refcnt_requests_shard(raw);
+            std::lock_guard<mutex_type> l(shard.mtx_);
 
+            refcnt_requests_type& requests = *shard.requests_;
             using iterator = refcnt_requests_type::iterator;
 
-            iterator matches = refcnt_requests_->find(raw);
-            if (matches != refcnt_requests_->end())
+            iterator matches = requests.find(raw);
+            if (matches != requests.end())
             {
                 pending_decrefs = matches->second;
                 matches->second += credit;
@@ -1323,13 +1331,13 @@ namespace hpx { namespace agas {
                     pending_incref = mapping(matches->first, matches->second);
                     has_pending_incref = true;
 
-                    refcnt_requests_->erase(matches);
+                    requests.erase(matches);
                 }
                 else if (matches->second == 0)
                 {
                     // credit == decref (case no. 3): if the incref offsets any
                     // pending decref, just remove the pending decref request.
-                    refcnt_requests_->erase(matches);
+                    requests.erase(matches);
                 }
                 else
                 {
@@ -1395,35 +1403,39 @@ namespace hpx { namespace agas {
 
         try
         {
-            std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
-
-            // Match the decref request with entries in the incref table
-            using iterator = refcnt_requests_type::iterator;
-            using mapping = refcnt_requests_type::value_type;
-
-            iterator matches = refcnt_requests_->find(raw);
-            if (matches != refcnt_requests_->end())
-            {
-                matches->second -= credit;
-            }
-            else
             {
-                std::pair<iterator, bool> p =
-                    refcnt_requests_->insert(mapping(raw, -credit));
+                refcnt_requests_shard& shard = get_refcnt_requests_shard(raw);
+                std::unique_lock<mutex_type> l(shard.mtx_);
 
-                if (HPX_UNLIKELY(!p.second))
+                // Match the decref request with entries in the incref table
+                using iterator = refcnt_requests_type::iterator;
+                using mapping = refcnt_requests_type::value_type;
+
+                refcnt_requests_type& requests = *shard.requests_;
+                iterator matches = requests.find(raw);
+                if (matches != requests.end())
                 {
-                    l.unlock();
+                    matches->second -= credit;
+                }
+                else
+                {
+                    std::pair<iterator, bool> p =
+                        requests.insert(mapping(raw, -credit));
 
-                    HPX_THROWS_IF(ec, hpx::error::bad_parameter,
-                        "addressing_service::decref",
-                        "couldn't insert decref request for {1} ({2})", raw,
-                        credit);
-                    return;
+                    if (HPX_UNLIKELY(!p.second))
+                    {
+                        l.unlock();
+
+                        HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                            "addressing_service::decref",
+                            "couldn't insert decref request for {1} ({2})",
+                            raw, credit);
+                        return;
+                    }
                 }
             }
 
-            send_refcnt_requests(l, ec);
+            send_refcnt_requests(ec);
         }
         catch (hpx::exception const& e)
         {
@@ -1897,6 +1909,16 @@ namespace hpx { namespace agas {
         return gva_cache_->get_statistics().get_erase_entry_time(reset);
     }
 
+    std::uint64_t addressing_service::get_refcnt_batches_sent(bool reset)
+    {
+        return util::get_and_reset_value(refcnt_batches_sent_, reset);
+    }
+
+    std::uint64_t addressing_service::get_refcnt_requests_sent(bool reset)
+    {
+        return util::get_and_reset_value(refcnt_requests_sent_, reset);
+    }
+
     void addressing_service::register_server_instances()
     {
         // register root server
@@ -1926,25 +1948,79 @@ namespace hpx { namespace agas {
         send_refcnt_requests_sync(l, ec);
     }
 
-    void addressing_service::send_refcnt_requests(
-        std::unique_lock<addressing_service::mutex_type>& l, error_code& ec)
+    addressing_service::refcnt_requests_shard&
+    addressing_service::get_refcnt_requests_shard(
+        naming::gid_type const& raw) noexcept
     {
-        if (!l.owns_lock())
+        std::uint64_t const h =
+            (raw.get_msb() ^ raw.get_lsb()) * 0x9e3779b97f4a7c15ull;
+        return refcnt_requests_[(h >> 32) % num_refcnt_requests_shards];
+    }
+
+    bool addressing_service::refcnt_requests_expired(
+        std::size_t count, std::int64_t first, std::int64_t now) const
+    {
+        return count >= max_refcnt_requests_ ||
+            (max_refcnt_requests_delay_ != 0 && first != 0 &&
+                now - first >= max_refcnt_requests_delay_);
+    }
+
+    void addressing_service::send_refcnt_requests(error_code& ec)
+    {
+        std::size_t const count = ++refcnt_requests_count_;
+
+        // remember when the oldest of the pending requests was buffered
+        std::int64_t const now =
+            static_cast<std::int64_t>(hpx::chrono::high_resolution_clock::now());
+        std::int64_t first = 0;
+        if (refcnt_requests_first_.compare_exchange_strong(first, now))
         {
-            HPX_THROWS_IF(ec, hpx::error::lock_error,
-                "addressing_service::send_refcnt_requests",
-                "mutex is not locked");
-            return;
+            first = now;
         }
 
-        if (!enable_refcnt_caching_ ||
-            max_refcnt_requests_ == ++refcnt_requests_count_)
+        if (!enable_refcnt_caching_.load(std::memory_order_relaxed))
+        {
+            // during shutdown, all requests are sent immediately
+            std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
             send_refcnt_requests_non_blocking(l, ec);
+            return;
+        }
+
+        if (refcnt_requests_expired(count, first, now))
+        {
+            // no need to compete for sending the requests, the thread that
+            // holds the lock will pick up the requests buffered so far
+            std::unique_lock<mutex_type> l(
+                refcnt_requests_mtx_, std::try_to_lock);
+            if (l.owns_lock())
+            {
+                send_refcnt_requests_non_blocking(l, ec);
+                return;
+            }
+        }
 
-        else if (&ec != &throws)
+        if (&ec != &throws)
             ec = make_success_code();
     }
 
+    void addressing_service::send_expired_refcnt_requests(error_code& ec)
+    {
+        std::size_t const count =
+            refcnt_requests_count_.load(std::memory_order_relaxed);
+        if (count == 0 ||
+            !refcnt_requests_expired(count,
+                refcnt_requests_first_.load(std::memory_order_relaxed),
+                static_cast<std::int64_t>(
+                    hpx::chrono::high_resolution_clock::now())))
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+            return;
+        }
+
+        garbage_collect_non_blocking(ec);
+    }
+
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
     void dump_refcnt_requests(
         std::unique_lock<addressing_service::mutex_type>& l,
@@ -1973,43 +2049,61 @@ namespace hpx { namespace agas {
     }
 #endif
 
-    void addressing_service::send_refcnt_requests_non_blocking(
-        std::unique_lock<addressing_service::mutex_type>& l, error_code& ec)
+    addressing_service::refcnt_batches_type
+    addressing_service::take_refcnt_requests(
+        std::unique_lock<addressing_service::mutex_type>& l,
+        [[maybe_unused]] char const* func_name)
     {
-#if !defined(HPX_COMPUTE_DEVICE_CODE)
         HPX_ASSERT_OWNS_LOCK(l);
 
-        try
-        {
-            if (refcnt_requests_->empty())
-            {
-                l.unlock();
-                return;
-            }
+        // requests buffered from now on are counted towards the next batch,
+        // this has to happen before the shards are taken: requests buffered
+        // concurrently may be sent with this batch while being counted for
+        // the next one, which at worst causes the next batch to be sent early
+        refcnt_requests_count_.exchange(0, std::memory_order_acq_rel);
+        refcnt_requests_first_.exchange(0, std::memory_order_acq_rel);
 
-            std::shared_ptr<refcnt_requests_type> p(new refcnt_requests_type);
+        std::size_t num_requests = 0;
+        std::array<std::shared_ptr<refcnt_requests_type>,
+            num_refcnt_requests_shards>
+            pending;
 
-            p.swap(refcnt_requests_);
-            refcnt_requests_count_ = 0;
+        for (std::size_t i = 0; i != num_refcnt_requests_shards; ++i)
+        {
+            refcnt_requests_shard& shard = refcnt_requests_[i];
 
-            l.unlock();
+            std::shared_ptr<refcnt_requests_type> p(
+                std::make_shared<refcnt_requests_type>());
+            {
+                std::lock_guard<mutex_type> ls(shard.mtx_);
+                p.swap(shard.requests_);
+            }
 
-            LAGAS_(info).format("addressing_service::send_refcnt_requests_non_"
-                                "blocking, requests({1})",
-                p->size());
+            num_requests += p->size();
+            pending[i] = HPX_MOVE(p);
+        }
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-            if (LAGAS_ENABLED(debug))
-                dump_refcnt_requests(l, *p,
-                    "addressing_service::send_refcnt_requests_non_blocking");
+        if (LAGAS_ENABLED(debug))
+        {
+            for (auto const& p : pending)
+                dump_refcnt_requests(l, *p, func_name);
+        }
 #endif
 
-            // collect all requests for each locality
-            using requests_type = std::map<hpx::id_type,
-                std::vector<hpx::tuple<std::int64_t, naming::gid_type,
-                    naming::gid_type>>>;
-            requests_type requests;
+        l.unlock();
+
+        refcnt_batches_type requests;
+        if (num_requests == 0)
+        {
+            return requests;
+        }
 
+        LAGAS_(info).format("{1}, requests({2})", func_name, num_requests);
+
+        // collect all requests for each locality
+        for (auto const& p : pending)
+        {
             for (refcnt_requests_type::const_reference e : *p)
             {
                 HPX_ASSERT(e.second < 0);
@@ -2022,13 +2116,30 @@ namespace hpx { namespace agas {
 
                 requests[target].push_back(hpx::make_tuple(e.second, raw, raw));
             }
+        }
+
+        refcnt_batches_sent_ += static_cast<std::int64_t>(requests.size());
+        refcnt_requests_sent_ += static_cast<std::int64_t>(num_requests);
+
+        return requests;
+    }
+
+    void addressing_service::send_refcnt_requests_non_blocking(
+        std::unique_lock<addressing_service::mutex_type>& l, error_code& ec)
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        HPX_ASSERT_OWNS_LOCK(l);
+
+        try
+        {
+            refcnt_batches_type requests = take_refcnt_requests(l,
+                "addressing_service::send_refcnt_requests_non_blocking");
 
-            // send requests to all locality
-            requests_type::iterator end = requests.end();
-            for (requests_type::iterator it = requests.begin(); it != end; ++it)
+            // send one batch of requests to each locality
+            for (auto& e : requests)
             {
                 server::primary_namespace::decrement_credit_action action;
-                hpx::post(action, it->first, HPX_MOVE(it->second));
+                hpx::post(action, e.first, HPX_MOVE(e.second));
             }
 
             if (&ec != &throws)
@@ -2036,7 +2147,8 @@ namespace hpx { namespace agas {
         }
         catch (hpx::exception const& e)
         {
-            l.unlock();
+            if (l.owns_lock())
+                l.unlock();
             HPX_RETHROWS_IF(
                 ec, e, "addressing_service::send_refcnt_requests_non_blocking");
         }
@@ -2054,55 +2166,17 @@ namespace hpx { namespace agas {
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
         HPX_ASSERT_OWNS_LOCK(l);
 
-        if (refcnt_requests_->empty())
-        {
-            l.unlock();
-            return std::vector<hpx::future<std::vector<std::int64_t>>>();
-        }
-
-        std::shared_ptr<refcnt_requests_type> p(new refcnt_requests_type);
-
-        p.swap(refcnt_requests_);
-        refcnt_requests_count_ = 0;
-
-        l.unlock();
-
-        LAGAS_(info).format(
-            "addressing_service::send_refcnt_requests_async, requests({1})",
-            p->size());
-
-#if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-        if (LAGAS_ENABLED(debug))
-            dump_refcnt_requests(
-                l, *p, "addressing_service::send_refcnt_requests_sync");
-#endif
-
-        // collect all requests for each locality
-        using requests_type = std::map<hpx::id_type,
-            std::vector<
-                hpx::tuple<std::int64_t, naming::gid_type, naming::gid_type>>>;
-        requests_type requests;
+        refcnt_batches_type requests =
+            take_refcnt_requests(l, "addressing_service::send_refcnt_requests_sync");
 
+        // send one batch of requests to each locality
         std::vector<hpx::future<std::vector<std::int64_t>>> lazy_results;
-        for (refcnt_requests_type::const_reference e : *p)
-        {
-            HPX_ASSERT(e.second < 0);
-
-            naming::gid_type raw(e.first);
-
-            hpx::id_type target(primary_namespace::get_service_instance(raw),
-                hpx::id_type::management_type::unmanaged);
-
-            requests[target].push_back(hpx::make_tuple(e.second, raw, raw));
-        }
-
-        // send requests to all locality
-        requests_type::iterator end = requests.end();
-        for (requests_type::iterator it = requests.begin(); it != end; ++it)
+        lazy_results.reserve(requests.size());
+        for (auto& e : requests)
         {
             server::primary_namespace::decrement_credit_action action;
             lazy_results.push_back(
-                hpx::async(action, it->first, HPX_MOVE(it->second)));
+                hpx::async(action, e.first, HPX_MOVE(e.second)));
         }
 
         return lazy_results;
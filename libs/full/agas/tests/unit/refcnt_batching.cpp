@@ -0,0 +1,147 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Credit decrements are buffered until too many of them have accumulated or
+// until the oldest of them has been waiting for too long. Buffered
+// decrements have to be sent even if no further decrements are buffered.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/chrono.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::int64_t> alive(0);
+
+struct test_server : hpx::components::component_base<test_server>
+{
+    test_server()
+    {
+        ++alive;
+    }
+
+    ~test_server()
+    {
+        --alive;
+    }
+};
+
+typedef hpx::components::component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+std::int64_t get_alive()
+{
+    return alive.load();
+}
+HPX_PLAIN_ACTION(get_alive)    // defines get_alive_action
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr std::size_t num_components = 100;
+
+// buffer many more requests than created by the test, the requests are sent
+// only because they wait for too long
+constexpr char const* max_pending_refcnt_requests = "100000";
+constexpr char const* max_pending_refcnt_delay = "50";    // [ms]
+
+std::int64_t query_counter(std::string const& name, bool reset = false)
+{
+    hpx::performance_counters::performance_counter counter(
+        "/agas{locality#" + std::to_string(hpx::get_locality_id()) +
+        "/total}/count/refcnt/" + name);
+    return counter.get_value<std::int64_t>(hpx::launch::sync, reset);
+}
+
+// Wait until all components on the given locality have been destroyed.
+bool wait_for_destruction(hpx::id_type const& dest)
+{
+    hpx::chrono::high_resolution_timer t;
+    while (get_alive_action()(dest) != 0)
+    {
+        if (t.elapsed() > 10.0)
+        {
+            return false;
+        }
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+}
+
+void test_delayed_flush(hpx::id_type const& dest)
+{
+    // settle any credit requests buffered before
+    HPX_TEST(wait_for_destruction(dest));
+    hpx::agas::garbage_collect();
+
+    query_counter("batches", true);
+    query_counter("requests", true);
+
+    {
+        std::vector<hpx::id_type> ids =
+            hpx::new_<test_server[]>(dest, num_components).get();
+        HPX_TEST_EQ(ids.size(), num_components);
+        HPX_TEST_EQ(get_alive_action()(dest),
+            static_cast<std::int64_t>(num_components));
+    }
+
+    // the components are destroyed without any further credit requests
+    // being buffered or an explicit garbage collection
+    HPX_TEST(wait_for_destruction(dest));
+
+    // all requests were sent in a small number of batches
+    std::int64_t const batches = query_counter("batches");
+    std::int64_t const requests = query_counter("requests");
+    HPX_TEST_LTE(static_cast<std::int64_t>(num_components), requests);
+    HPX_TEST_LTE(std::int64_t(1), batches);
+    HPX_TEST_LT(batches, static_cast<std::int64_t>(num_components));
+
+    // resetting the counters discards all batches sent so far
+    query_counter("batches", true);
+    HPX_TEST_EQ(query_counter("batches"), std::int64_t(0));
+    query_counter("requests", true);
+    HPX_TEST_EQ(query_counter("requests"), std::int64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    HPX_TEST_EQ(hpx::get_config_entry("hpx.agas.max_pending_refcnt_delay", ""),
+        std::string(max_pending_refcnt_delay));
+
+    for (hpx::id_type const& dest : hpx::find_all_localities())
+    {
+        test_delayed_flush(dest);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::init_params init_args;
+    init_args.cfg = {std::string("hpx.agas.max_pending_refcnt_requests=") +
+            max_pending_refcnt_requests,
+        std::string("hpx.agas.max_pending_refcnt_delay=") +
+            max_pending_refcnt_delay};
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -19,12 +19,15 @@
 #include <hpx/async_distributed/base_lco_with_value.hpp>
 #include <hpx/async_distributed/transfer_continuation_action.hpp>
 #include <hpx/components_base/server/fixed_component_base.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/parcelset_base/traits/action_get_embedded_parcel.hpp>
 #include <hpx/synchronization/condition_variable.hpp>
 
+#include <array>
 #include <atomic>
+#include <bitset>
 #include <cstddef>
 #include <cstdint>
 #include <list>
@@ -127,21 +130,36 @@ namespace hpx::agas::server {
             hpx::tuple<naming::gid_type, gva, naming::gid_type>;
 
     private:
-        // REVIEW: Separate mutexes might reduce contention here. This has to be
-        // investigated carefully.
-        mutex_type mutex_;
-
-        gva_table_type gvas_;
-        refcnt_table_type refcnts_;
-
         using migration_table_type = std::map<naming::gid_type,
             hpx::tuple<bool, std::size_t,
                 lcos::local::detail::condition_variable>>;
 
+        // The GVA, reference count, and migration tables are split into
+        // shards, each protected by its own mutex. GIDs are assigned to
+        // shards in blocks of consecutive ids, consecutive blocks are
+        // assigned to different shards. A range of GIDs bound to a single
+        // GVA is stored in every shard that holds a block overlapping with
+        // the range, thus any GID can be resolved by looking at one shard
+        // only.
+        static constexpr std::size_t num_shards = 64;
+        static constexpr std::size_t shard_block_bits = 8;
+
+        struct shard_data
+        {
+            mutex_type mutex_;
+
+            gva_table_type gvas_;
+            refcnt_table_type refcnts_;
+            migration_table_type migrating_objects_;
+        };
+        using shard = util::cache_aligned_data_derived<shard_data>;
+        using shard_set = std::bitset<num_shards>;
+
+        std::array<shard, num_shards> shards_;
+
         std::string instance_name_;
         naming::gid_type next_id_;     // next available gid
         naming::gid_type locality_;    // our locality id
-        migration_table_type migrating_objects_;
 
         struct update_time_on_exit;
 
@@ -228,20 +246,37 @@ namespace hpx::agas::server {
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
         /// Dump the credit counts of all matching ranges. Expects that \p l
         /// is locked.
-        void dump_refcnt_matches(refcnt_table_type::iterator lower_it,
+        void dump_refcnt_matches(shard_data& s,
+            refcnt_table_type::iterator lower_it,
             refcnt_table_type::iterator upper_it, naming::gid_type const& lower,
             naming::gid_type const& upper, std::unique_lock<mutex_type>& l,
             char const* func_name);
 #endif
 
+        // return the shard responsible for the given GID
+        static std::size_t get_shard_index(naming::gid_type const& id) noexcept;
+
+        shard_data& get_shard(naming::gid_type const& id) noexcept
+        {
+            return shards_[get_shard_index(id)];
+        }
+
+        // return the shards holding blocks overlapping with the given range
+        static shard_set get_shards(
+            naming::gid_type const& id, std::uint64_t count) noexcept;
+
+        // lock all given shards (in order of their index)
+        std::vector<std::unique_lock<mutex_type>> lock_shards(
+            shard_set const& shards);
+
         // helper function
-        void wait_for_migration_locked(std::unique_lock<mutex_type>& l,
-            naming::gid_type const& id, error_code& ec);
+        void wait_for_migration_locked(shard_data& s,
+            std::unique_lock<mutex_type>& l, naming::gid_type const& id,
+            error_code& ec);
 
     public:
         primary_namespace()
           : base_type(agas::primary_ns_msb, agas::primary_ns_lsb)
-          , mutex_()
           , instance_name_()
           , next_id_(naming::invalid_gid)
           , locality_(naming::invalid_gid)
@@ -291,10 +326,11 @@ namespace hpx::agas::server {
             std::uint64_t count);
 
     private:
-        resolved_type resolve_gid_locked(std::unique_lock<mutex_type>& l,
-            naming::gid_type const& gid, error_code& ec);
+        resolved_type resolve_gid_locked(shard_data& s,
+            std::unique_lock<mutex_type>& l, naming::gid_type const& gid,
+            error_code& ec);
 
-        resolved_type resolve_gid_locked_non_local(
+        resolved_type resolve_gid_locked_non_local(shard_data& s,
             std::unique_lock<mutex_type>& l, naming::gid_type const& gid,
             error_code& ec);
 
@@ -322,7 +358,7 @@ namespace hpx::agas::server {
         using free_entry_list_type =
             std::list<free_entry, free_entry_allocator_type>;
 
-        void resolve_free_list(std::unique_lock<mutex_type>& l,
+        void resolve_free_list(shard_data& s, std::unique_lock<mutex_type>& l,
             std::list<refcnt_table_type::iterator> const& free_list,
             free_entry_list_type& free_entry_list,
             naming::gid_type const& lower, naming::gid_type const& upper,
@@ -84,6 +84,70 @@ namespace hpx::agas::server {
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t primary_namespace::get_shard_index(
+        naming::gid_type const& id) noexcept
+    {
+        std::uint64_t const msb =
+            naming::detail::strip_internal_bits_from_gid(id.get_msb());
+        std::uint64_t const block = id.get_lsb() >> shard_block_bits;
+
+        // consecutive blocks are assigned to consecutive shards, the offset
+        // depends on the MSB to spread the ids of different localities
+        std::uint64_t const offset = (msb * 0x9e3779b97f4a7c15ull) >> 40;
+        return static_cast<std::size_t>((block + offset) % num_shards);
+    }
+
+    primary_namespace::shard_set primary_namespace::get_shards(
+        naming::gid_type const& id, std::uint64_t count) noexcept
+    {
+        shard_set result;
+        if (count <= 1)
+        {
+            result.set(get_shard_index(id));
+            return result;
+        }
+
+        naming::gid_type const upper(id + (count - 1));
+        if (upper.get_msb() != id.get_msb())
+        {
+            // invalid range, the caller will report an error
+            result.set(get_shard_index(id));
+            return result;
+        }
+
+        std::uint64_t const first_block = id.get_lsb() >> shard_block_bits;
+        std::uint64_t const last_block = upper.get_lsb() >> shard_block_bits;
+        if (last_block - first_block >= num_shards - 1)
+        {
+            result.set();
+            return result;
+        }
+
+        naming::gid_type block_id(id);
+        for (std::uint64_t block = first_block; block <= last_block; ++block)
+        {
+            block_id.set_lsb(block << shard_block_bits);
+            result.set(get_shard_index(block_id));
+        }
+        return result;
+    }
+
+    std::vector<std::unique_lock<primary_namespace::mutex_type>>
+    primary_namespace::lock_shards(shard_set const& shards)
+    {
+        std::vector<std::unique_lock<mutex_type>> locks;
+        locks.reserve(shards.count());
+        for (std::size_t i = 0; i != num_shards; ++i)
+        {
+            if (shards.test(i))
+            {
+                locks.emplace_back(shards_[i].mutex_);
+            }
+        }
+        return locks;
+    }
+
     // start migration of the given object
     std::pair<hpx::id_type, naming::address> primary_namespace::begin_migration(
         naming::gid_type id)
@@ -94,10 +158,11 @@ namespace hpx::agas::server {
         counter_data_.increment_begin_migration_count();
         using hpx::get;
 
-        std::unique_lock<mutex_type> l(mutex_);
+        shard_data& s = get_shard(id);
+        std::unique_lock<mutex_type> l(s.mutex_);
 
-        wait_for_migration_locked(l, id, hpx::throws);
-        resolved_type r = resolve_gid_locked_non_local(l, id, hpx::throws);
+        wait_for_migration_locked(s, l, id, hpx::throws);
+        resolved_type r = resolve_gid_locked_non_local(s, l, id, hpx::throws);
         if (get<0>(r) == naming::invalid_gid)
         {
             l.unlock();
@@ -109,11 +174,11 @@ namespace hpx::agas::server {
             return std::make_pair(hpx::invalid_id, naming::address());
         }
 
-        migration_table_type::iterator it = migrating_objects_.find(id);
-        if (it == migrating_objects_.end())
+        migration_table_type::iterator it = s.migrating_objects_.find(id);
+        if (it == s.migrating_objects_.end())
         {
             std::pair<migration_table_type::iterator, bool> p =
-                migrating_objects_.emplace(std::piecewise_construct,
+                s.migrating_objects_.emplace(std::piecewise_construct,
                     std::forward_as_tuple(id), std::forward_as_tuple());
             HPX_ASSERT(p.second);
             it = p.first;
@@ -141,12 +206,13 @@ namespace hpx::agas::server {
             counter_data_.end_migration_.enabled_);
         counter_data_.increment_end_migration_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        shard_data& s = get_shard(id);
+        std::unique_lock<mutex_type> l(s.mutex_);
 
         using hpx::get;
 
-        migration_table_type::iterator it = migrating_objects_.find(id);
-        if (it != migrating_objects_.end())
+        migration_table_type::iterator it = s.migrating_objects_.find(id);
+        if (it != s.migrating_objects_.end())
         {
             // flag this id as not being migrated anymore
             get<0>(it->second) = false;
@@ -156,7 +222,7 @@ namespace hpx::agas::server {
             }
             else
             {
-                migrating_objects_.erase(it);
+                s.migrating_objects_.erase(it);
             }
         }
 
@@ -164,7 +230,7 @@ namespace hpx::agas::server {
     }
 
     // wait if given object is currently being migrated
-    void primary_namespace::wait_for_migration_locked(
+    void primary_namespace::wait_for_migration_locked(shard_data& s,
         std::unique_lock<mutex_type>& l, naming::gid_type const& id,
         error_code& ec)
     {
@@ -172,8 +238,8 @@ namespace hpx::agas::server {
 
         using hpx::get;
 
-        migration_table_type::iterator it = migrating_objects_.find(id);
-        if (it != migrating_objects_.end())
+        migration_table_type::iterator it = s.migrating_objects_.find(id);
+        if (it != s.migrating_objects_.end())
         {
             if (get<0>(it->second))
             {
@@ -182,13 +248,13 @@ namespace hpx::agas::server {
                 get<2>(it->second).wait(l, ec);
 
                 if (--get<1>(it->second) == 0)
-                    migrating_objects_.erase(it);
+                    s.migrating_objects_.erase(it);
             }
             else
             {
                 if (get<1>(it->second) == 0)
                 {
-                    migrating_objects_.erase(it);
+                    s.migrating_objects_.erase(it);
                 }
             }
         }
@@ -205,10 +271,14 @@ namespace hpx::agas::server {
         naming::gid_type gid = id;
         naming::detail::strip_internal_bits_from_gid(id);
 
-        std::unique_lock<mutex_type> l(mutex_);
+        // the new range is stored in all shards it overlaps with, the shard
+        // of the first id is used for checking existing bindings
+        shard_set const shards = get_shards(id, g.count);
+        std::vector<std::unique_lock<mutex_type>> locks = lock_shards(shards);
 
-        gva_table_type::iterator it = gvas_.lower_bound(id),
-                                 begin = gvas_.begin(), end = gvas_.end();
+        gva_table_type& gvas = get_shard(id).gvas_;
+        gva_table_type::iterator it = gvas.lower_bound(id),
+                                 begin = gvas.begin(), end = gvas.end();
 
         if (it != end)
         {
@@ -220,7 +290,7 @@ namespace hpx::agas::server {
                 if (naming::refers_to_local_lva(gid) &&
                     !naming::refers_to_virtual_memory(gid))
                 {
-                    l.unlock();
+                    locks.clear();
 
                     HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
                         "primary_namespace::bind_gid",
@@ -229,15 +299,14 @@ namespace hpx::agas::server {
                     return false;
                 }
 
-                gva& gaddr = it->second.first;
-                naming::gid_type& loc = it->second.second;
+                gva const& gaddr = it->second.first;
 
                 // Check for count mismatch (we can't change block sizes of
                 // existing bindings).
                 if (HPX_UNLIKELY(gaddr.count != g.count))
                 {
                     // REVIEW: Is this the right error code to use?
-                    l.unlock();
+                    locks.clear();
 
                     HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
                         "primary_namespace::bind_gid",
@@ -246,7 +315,7 @@ namespace hpx::agas::server {
 
                 if (HPX_UNLIKELY(components::component_invalid == g.type))
                 {
-                    l.unlock();
+                    locks.clear();
 
                     HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
                         "primary_namespace::bind_gid",
@@ -257,7 +326,7 @@ namespace hpx::agas::server {
 
                 if (HPX_UNLIKELY(!locality))
                 {
-                    l.unlock();
+                    locks.clear();
 
                     HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
                         "primary_namespace::bind_gid",
@@ -267,14 +336,25 @@ namespace hpx::agas::server {
                         id, g, locality);
                 }
 
-                // Store the new endpoint and offset
-                gaddr.prefix = g.prefix;
-                gaddr.type = g.type;
-                gaddr.lva(g.lva());
-                gaddr.offset = g.offset;
-                loc = locality;
+                // Store the new endpoint and offset in all shards holding
+                // the existing binding (the block size is unchanged, thus
+                // these are the same shards the new binding would go to)
+                for (std::size_t i = 0; i != num_shards; ++i)
+                {
+                    if (!shards.test(i))
+                    {
+                        continue;
+                    }
 
-                l.unlock();
+                    gva_table_data_type& data = shards_[i].gvas_[id];
+                    data.first.prefix = g.prefix;
+                    data.first.type = g.type;
+                    data.first.lva(g.lva());
+                    data.first.offset = g.offset;
+                    data.second = locality;
+                }
+
+                locks.clear();
 
                 LAGAS_(info).format(
                     "primary_namespace::bind_gid, gid({1}), gva({2}), "
@@ -294,7 +374,7 @@ namespace hpx::agas::server {
                 if (HPX_UNLIKELY((it->first + it->second.first.count) > id))
                 {
                     // REVIEW: Is this the right error code to use?
-                    l.unlock();
+                    locks.clear();
 
                     HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
                         "primary_namespace::bind_gid",
@@ -303,7 +383,7 @@ namespace hpx::agas::server {
             }
         }
 
-        else if (HPX_LIKELY(!gvas_.empty()))
+        else if (HPX_LIKELY(!gvas.empty()))
         {
             --it;
 
@@ -311,7 +391,7 @@ namespace hpx::agas::server {
             if ((it->first + it->second.first.count) > id)
             {
                 // REVIEW: Is this the right error code to use?
-                l.unlock();
+                locks.clear();
 
                 HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
                     "primary_namespace::bind_gid",
@@ -335,7 +415,7 @@ namespace hpx::agas::server {
 
         if (HPX_UNLIKELY(id.get_msb() != upper_bound.get_msb()))
         {
-            l.unlock();
+            locks.clear();
 
             HPX_THROW_EXCEPTION(hpx::error::internal_server_error,
                 "primary_namespace::bind_gid",
@@ -344,7 +424,7 @@ namespace hpx::agas::server {
 
         if (HPX_UNLIKELY(components::component_invalid == g.type))
         {
-            l.unlock();
+            locks.clear();
 
             HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
                 "primary_namespace::bind_gid",
@@ -353,20 +433,24 @@ namespace hpx::agas::server {
                 id, g, locality);
         }
 
-        // Insert a GID -> GVA entry into the GVA table.
-        if (HPX_UNLIKELY(!util::insert_checked(
-                gvas_.insert(std::make_pair(id, std::make_pair(g, locality))))))
+        // Insert a GID -> GVA entry into the GVA table of each of the shards.
+        for (std::size_t i = 0; i != num_shards; ++i)
         {
-            l.unlock();
+            if (shards.test(i) &&
+                HPX_UNLIKELY(!util::insert_checked(shards_[i].gvas_.insert(
+                    std::make_pair(id, std::make_pair(g, locality))))))
+            {
+                locks.clear();
 
-            HPX_THROW_EXCEPTION(hpx::error::lock_error,
-                "primary_namespace::bind_gid",
-                "GVA table insertion failed due to a locking error or "
-                "memory corruption, gid({1}), gva({2}), locality({3})",
-                id, g, locality);
+                HPX_THROW_EXCEPTION(hpx::error::lock_error,
+                    "primary_namespace::bind_gid",
+                    "GVA table insertion failed due to a locking error or "
+                    "memory corruption, gid({1}), gva({2}), locality({3})",
+                    id, g, locality);
+            }
         }
 
-        l.unlock();
+        locks.clear();
 
         LAGAS_(info).format(
             "primary_namespace::bind_gid, gid({1}), gva({2}), locality({3})",
@@ -404,16 +488,17 @@ namespace hpx::agas::server {
         }
         else
         {
-            std::unique_lock<mutex_type> l(mutex_);
+            shard_data& s = get_shard(id);
+            std::unique_lock<mutex_type> l(s.mutex_);
 
             // wait for any migration to be completed
             if (naming::detail::is_migratable(id))
             {
-                wait_for_migration_locked(l, id, hpx::throws);
+                wait_for_migration_locked(s, l, id, hpx::throws);
             }
 
             // now, resolve the id
-            r = resolve_gid_locked_non_local(l, id, hpx::throws);
+            r = resolve_gid_locked_non_local(s, l, id, hpx::throws);
         }
 
         if (get<0>(r) == naming::invalid_gid)
@@ -450,15 +535,18 @@ namespace hpx::agas::server {
 
         naming::detail::strip_internal_bits_from_gid(id);
 
-        std::unique_lock<mutex_type> l(mutex_);
+        // the binding is stored in all shards overlapping with the range
+        shard_set const shards = get_shards(id, count);
+        std::vector<std::unique_lock<mutex_type>> locks = lock_shards(shards);
 
-        gva_table_type::iterator it = gvas_.find(id), end = gvas_.end();
+        gva_table_type& gvas = get_shard(id).gvas_;
+        gva_table_type::iterator it = gvas.find(id), end = gvas.end();
 
         if (it != end)
         {
             if (HPX_UNLIKELY(it->second.first.count != count))
             {
-                l.unlock();
+                locks.clear();
 
                 HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
                     "primary_namespace::unbind_gid", "block sizes must match");
@@ -466,9 +554,15 @@ namespace hpx::agas::server {
 
             gva_table_data_type data = it->second;
 
-            gvas_.erase(it);
+            for (std::size_t i = 0; i != num_shards; ++i)
+            {
+                if (shards.test(i))
+                {
+                    shards_[i].gvas_.erase(id);
+                }
+            }
 
-            l.unlock();
+            locks.clear();
             LAGAS_(info).format(
                 "primary_namespace::unbind_gid, gid({1}), count({2}), "
                 "gva({3}), locality_id({4})",
@@ -495,7 +589,7 @@ namespace hpx::agas::server {
             return naming::address(g.prefix, g.type, g.lva());
         }
 
-        l.unlock();
+        locks.clear();
 
         LAGAS_(info).format(
             "primary_namespace::unbind_gid, gid({1}), count({2}), "
@@ -643,7 +737,7 @@ namespace hpx::agas::server {
     }    // }}}
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-    void primary_namespace::dump_refcnt_matches(
+    void primary_namespace::dump_refcnt_matches(shard_data& s,
         refcnt_table_type::iterator lower_it,
         refcnt_table_type::iterator upper_it, naming::gid_type const& lower,
         naming::gid_type const& upper, std::unique_lock<mutex_type>& l,
@@ -652,7 +746,7 @@ namespace hpx::agas::server {
         // dump_refcnt_matches implementation
         HPX_ASSERT(l.owns_lock());
 
-        if (lower_it == refcnts_.end() && upper_it == refcnts_.end())
+        if (lower_it == s.refcnts_.end() && upper_it == s.refcnts_.end())
             // We got nothing, bail - our caller is probably about to throw.
             return;
 
@@ -678,7 +772,8 @@ namespace hpx::agas::server {
     void primary_namespace::increment(naming::gid_type const& lower,
         naming::gid_type const& upper, std::int64_t& credits, error_code& ec)
     {    // {{{ increment implementation
-        std::unique_lock<mutex_type> l(mutex_);
+        shard_data* s = &get_shard(lower);
+        std::unique_lock<mutex_type> l(s->mutex_);
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
         if (LAGAS_ENABLED(debug))
@@ -686,11 +781,11 @@ namespace hpx::agas::server {
             typedef refcnt_table_type::iterator iterator;
 
             // Find the mappings that we're about to touch.
-            refcnt_table_type::iterator lower_it = refcnts_.find(lower);
+            refcnt_table_type::iterator lower_it = s->refcnts_.find(lower);
             refcnt_table_type::iterator upper_it;
             if (lower != upper)
             {
-                upper_it = refcnts_.find(upper);
+                upper_it = s->refcnts_.find(upper);
             }
             else
             {
@@ -698,7 +793,7 @@ namespace hpx::agas::server {
                 ++upper_it;
             }
 
-            dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
+            dump_refcnt_matches(*s, lower_it, upper_it, lower, upper, l,
                 "primary_namespace::increment");
         }
 #endif
@@ -715,14 +810,24 @@ namespace hpx::agas::server {
 
         for (naming::gid_type raw = lower; raw != upper; ++raw)
         {
-            refcnt_table_type::iterator it = refcnts_.find(raw);
-            if (it == refcnts_.end())
+            // switch shards at block boundaries
+            shard_data* next = &get_shard(raw);
+            if (next != s)
+            {
+                l.unlock();
+                s = next;
+                l = std::unique_lock<mutex_type>(s->mutex_);
+            }
+
+            refcnt_table_type::iterator it = s->refcnts_.find(raw);
+            if (it == s->refcnts_.end())
             {
                 std::int64_t count =
                     std::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits;
 
                 std::pair<refcnt_table_type::iterator, bool> p =
-                    refcnts_.insert(refcnt_table_type::value_type(raw, count));
+                    s->refcnts_.insert(
+                        refcnt_table_type::value_type(raw, count));
                 if (!p.second)
                 {
                     l.unlock();
@@ -752,7 +857,8 @@ namespace hpx::agas::server {
     }    // }}}
 
     ///////////////////////////////////////////////////////////////////////////////
-    void primary_namespace::resolve_free_list(std::unique_lock<mutex_type>& l,
+    void primary_namespace::resolve_free_list(shard_data& s,
+        std::unique_lock<mutex_type>& l,
         std::list<refcnt_table_type::iterator> const& free_list,
         free_entry_list_type& free_entry_list,
         naming::gid_type const& /* lower */,
@@ -774,11 +880,11 @@ namespace hpx::agas::server {
             if (naming::detail::is_migratable(gid))
             {
                 // wait for any migration to be completed
-                wait_for_migration_locked(l, gid, ec);
+                wait_for_migration_locked(s, l, gid, ec);
             }
 
             // Resolve the query GID.
-            resolved_type r = resolve_gid_locked(l, gid, ec);
+            resolved_type r = resolve_gid_locked(s, l, gid, ec);
             if (ec)
                 return;
 
@@ -835,7 +941,7 @@ namespace hpx::agas::server {
             free_entry_list.push_back(free_entry(resolved, gid, get<2>(r)));
 
             // remove this entry from the refcnt table
-            refcnts_.erase(it);
+            s.refcnts_.erase(it);
         }
     }
 
@@ -852,7 +958,8 @@ namespace hpx::agas::server {
         free_entry_list.clear();
 
         {
-            std::unique_lock<mutex_type> l(mutex_);
+            shard_data* s = &get_shard(lower);
+            std::unique_lock<mutex_type> l(s->mutex_);
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
             if (LAGAS_ENABLED(debug))
@@ -860,11 +967,11 @@ namespace hpx::agas::server {
                 typedef refcnt_table_type::iterator iterator;
 
                 // Find the mappings that we just added or modified.
-                refcnt_table_type::iterator lower_it = refcnts_.find(lower);
+                refcnt_table_type::iterator lower_it = s->refcnts_.find(lower);
                 refcnt_table_type::iterator upper_it;
                 if (lower != upper)
                 {
-                    upper_it = refcnts_.find(upper);
+                    upper_it = s->refcnts_.find(upper);
                 }
                 else
                 {
@@ -872,7 +979,7 @@ namespace hpx::agas::server {
                     ++upper_it;
                 }
 
-                dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
+                dump_refcnt_matches(*s, lower_it, upper_it, lower, upper, l,
                     "primary_namespace::decrement_sweep");
             }
 #endif
@@ -889,8 +996,25 @@ namespace hpx::agas::server {
             std::list<refcnt_table_type::iterator> free_list;
             for (naming::gid_type raw = lower; raw != upper; ++raw)
             {
-                refcnt_table_type::iterator it = refcnts_.find(raw);
-                if (it == refcnts_.end())
+                // switch shards at block boundaries, the objects which have
+                // to be deleted are resolved while the shard is still locked
+                shard_data* next = &get_shard(raw);
+                if (next != s)
+                {
+                    resolve_free_list(
+                        *s, l, free_list, free_entry_list, lower, upper, ec);
+                    if (ec)
+                        return;
+
+                    free_list.clear();
+
+                    l.unlock();
+                    s = next;
+                    l = std::unique_lock<mutex_type>(s->mutex_);
+                }
+
+                refcnt_table_type::iterator it = s->refcnts_.find(raw);
+                if (it == s->refcnts_.end())
                 {
                     if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
                     {
@@ -909,7 +1033,7 @@ namespace hpx::agas::server {
                         std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits;
 
                     std::pair<refcnt_table_type::iterator, bool> p =
-                        refcnts_.insert(
+                        s->refcnts_.insert(
                             refcnt_table_type::value_type(raw, count));
                     if (!p.second)
                     {
@@ -949,7 +1073,8 @@ namespace hpx::agas::server {
             }
 
             // Resolve the objects which have to be deleted.
-            resolve_free_list(l, free_list, free_entry_list, lower, upper, ec);
+            resolve_free_list(
+                *s, l, free_list, free_entry_list, lower, upper, ec);
 
         }    // Unlock the mutex.
 
@@ -1013,8 +1138,8 @@ namespace hpx::agas::server {
     }
 
     primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
-        std::unique_lock<mutex_type>& l, naming::gid_type const& gid,
-        error_code& ec)
+        shard_data& s, std::unique_lock<mutex_type>& l,
+        naming::gid_type const& gid, error_code& ec)
     {
         HPX_ASSERT_OWNS_LOCK(l);
 
@@ -1028,11 +1153,11 @@ namespace hpx::agas::server {
             return resolve_local_id(gid);
         }
 
-        return resolve_gid_locked_non_local(l, gid, ec);
+        return resolve_gid_locked_non_local(s, l, gid, ec);
     }
 
     primary_namespace::resolved_type
-    primary_namespace::resolve_gid_locked_non_local(
+    primary_namespace::resolve_gid_locked_non_local(shard_data& s,
         std::unique_lock<mutex_type>& l, naming::gid_type const& gid,
         error_code& ec)
     {
@@ -1045,8 +1170,9 @@ namespace hpx::agas::server {
         naming::gid_type id = gid;
         naming::detail::strip_internal_bits_from_gid(id);
 
-        gva_table_type::const_iterator it = gvas_.lower_bound(id),
-                                       begin = gvas_.begin(), end = gvas_.end();
+        gva_table_type const& gvas = s.gvas_;
+        gva_table_type::const_iterator it = gvas.lower_bound(id),
+                                       begin = gvas.begin(), end = gvas.end();
 
         if (it != end)
         {
@@ -1090,7 +1216,7 @@ namespace hpx::agas::server {
             }
         }
 
-        else if (HPX_LIKELY(!gvas_.empty()))
+        else if (HPX_LIKELY(!gvas.empty()))
         {
             --it;
 
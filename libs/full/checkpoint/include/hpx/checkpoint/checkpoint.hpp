@@ -48,6 +48,7 @@ namespace hpx { namespace util {
     namespace detail {
         struct save_funct_obj;
         struct prepare_checkpoint;
+        struct apply_checkpoint_delta;
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -82,6 +83,7 @@ namespace hpx { namespace util {
 
         friend struct detail::save_funct_obj;
         friend struct detail::prepare_checkpoint;
+        friend struct detail::apply_checkpoint_delta;
 
         template <typename T, typename... Ts>
         friend void restore_checkpoint(checkpoint const& c, T& t, Ts&... ts);
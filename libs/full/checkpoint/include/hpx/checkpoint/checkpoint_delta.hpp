@@ -0,0 +1,553 @@
+// Copyright (c) 2023 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// This header defines facilities for incremental checkpointing. A
+/// checkpoint_delta holds only those fixed-size blocks of a checkpoint which
+/// have changed relative to a previously encoded checkpoint. Changed blocks
+/// are detected by comparing per-block hashes, thus the previous checkpoint
+/// does not have to be kept in memory. A sequence of deltas (starting with a
+/// delta encoded against an empty checkpoint) can be appended to a file
+/// asynchronously and later be applied in order to restore the most recent
+/// checkpoint.
+
+/// \file hpx/checkpoint/checkpoint_delta.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/runtime_local/run_as_os_thread.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Default size (in bytes) of the blocks a checkpoint is split into for
+    /// incremental checkpointing.
+    inline constexpr std::size_t default_checkpoint_block_size = 64 * 1024;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Checkpoint Delta Object
+    ///
+    /// A checkpoint_delta stores the blocks of a checkpoint which differ from
+    /// the checkpoint the delta was encoded against (its base), together with
+    /// the overall size of the encoded checkpoint. Applying the delta to its
+    /// base reproduces the encoded checkpoint.
+    class checkpoint_delta
+    {
+    private:
+        std::uint64_t block_size_ = 0;
+        std::uint64_t size_ = 0;
+        std::vector<std::uint64_t> blocks_;
+        std::vector<char> data_;
+
+        friend std::ostream& operator<<(
+            std::ostream& ost, checkpoint_delta const& d);
+        friend std::istream& operator>>(
+            std::istream& ist, checkpoint_delta& d);
+
+        // Serialization Definition
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& arch, const unsigned int /* version */)
+        {
+            // clang-format off
+            arch & block_size_ & size_ & blocks_ & data_;
+            // clang-format on
+        }
+
+        friend class checkpoint_delta_encoder;
+        friend struct detail::apply_checkpoint_delta;
+
+    public:
+        checkpoint_delta() = default;
+
+        friend bool operator==(
+            checkpoint_delta const& lhs, checkpoint_delta const& rhs)
+        {
+            return lhs.block_size_ == rhs.block_size_ &&
+                lhs.size_ == rhs.size_ && lhs.blocks_ == rhs.blocks_ &&
+                lhs.data_ == rhs.data_;
+        }
+        friend bool operator!=(
+            checkpoint_delta const& lhs, checkpoint_delta const& rhs)
+        {
+            return !(lhs == rhs);
+        }
+
+        // size of the blocks this delta was encoded with
+        std::size_t block_size() const noexcept
+        {
+            return static_cast<std::size_t>(block_size_);
+        }
+
+        // size of the checkpoint this delta reproduces
+        std::size_t checkpoint_size() const noexcept
+        {
+            return static_cast<std::size_t>(size_);
+        }
+
+        // number of blocks stored in this delta
+        std::size_t num_blocks() const noexcept
+        {
+            return blocks_.size();
+        }
+
+        // number of payload bytes stored in this delta
+        std::size_t size() const noexcept
+        {
+            return data_.size();
+        }
+
+        // a delta is empty if applying it does not change its base
+        bool empty() const noexcept
+        {
+            return blocks_.empty();
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Operator<< Overload
+    ///
+    /// \param ost           Output stream to write to.
+    ///
+    /// \param d             Checkpoint delta to copy from.
+    ///
+    /// Writes the delta in a self-describing binary format, which allows to
+    /// append several deltas to the same stream and to read them back in
+    /// order using operator>>.
+    ///
+    /// \returns Operator<< returns the ostream object.
+    ///
+    inline std::ostream& operator<<(std::ostream& ost, checkpoint_delta const& d)
+    {
+        std::uint64_t header[4] = {d.block_size_, d.size_,
+            static_cast<std::uint64_t>(d.blocks_.size()),
+            static_cast<std::uint64_t>(d.data_.size())};
+        ost.write(reinterpret_cast<char const*>(header), sizeof(header));
+
+        ost.write(reinterpret_cast<char const*>(d.blocks_.data()),
+            d.blocks_.size() * sizeof(std::uint64_t));
+        ost.write(d.data_.data(), d.data_.size());
+        return ost;
+    }
+
+    namespace detail {
+
+        // Returns the number of bytes left in the given stream, or -1 if the
+        // stream does not support seeking.
+        inline std::streamoff remaining_input(std::istream& ist)
+        {
+            std::istream::pos_type const pos = ist.tellg();
+            if (pos == std::istream::pos_type(-1))
+            {
+                return -1;
+            }
+
+            ist.seekg(0, std::ios::end);
+            std::istream::pos_type const end = ist.tellg();
+            ist.seekg(pos);
+            if (!ist || end == std::istream::pos_type(-1))
+            {
+                ist.clear();
+                ist.seekg(pos);
+                return -1;
+            }
+            return end - pos;
+        }
+
+        // Reads count elements into the given vector, its size grows only as
+        // the data arrives.
+        template <typename T>
+        bool read_checkpoint_delta_array(
+            std::istream& ist, std::vector<T>& v, std::uint64_t count)
+        {
+            constexpr std::uint64_t chunk_size = 64 * 1024 / sizeof(T);
+
+            v.clear();
+            while (count != 0)
+            {
+                std::size_t const n =
+                    static_cast<std::size_t>((std::min)(count, chunk_size));
+                std::size_t const offset = v.size();
+                v.resize(offset + n);
+                if (!ist.read(
+                        reinterpret_cast<char*>(v.data() + offset),
+                        static_cast<std::streamsize>(n * sizeof(T))))
+                {
+                    return false;
+                }
+                count -= n;
+            }
+            return true;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Operator>> Overload
+    ///
+    /// \param ist           Input stream to read from.
+    ///
+    /// \param d             Checkpoint delta to write to.
+    ///
+    /// Reads a delta previously written using operator<<. The sizes stored
+    /// in the header of the delta are validated against the remaining input
+    /// before any memory is allocated for its contents. If the header is
+    /// invalid the failbit of the stream is set, if the input ends before
+    /// all of the contents of the delta were read the eofbit and the failbit
+    /// are set. In both cases \a d is left unchanged.
+    ///
+    /// \returns Operator>> returns the istream object.
+    ///
+    inline std::istream& operator>>(std::istream& ist, checkpoint_delta& d)
+    {
+        std::uint64_t header[4] = {0, 0, 0, 0};
+        if (!ist.read(reinterpret_cast<char*>(header), sizeof(header)))
+        {
+            return ist;
+        }
+
+        std::uint64_t const num_blocks = header[2];
+        std::uint64_t const data_size = header[3];
+
+        // a delta holds at most one (possibly shorter) block per block index
+        if ((header[0] == 0 && num_blocks != 0) || data_size > header[1])
+        {
+            ist.setstate(std::ios::failbit);
+            return ist;
+        }
+
+        // all of the contents have to be available from the stream
+        std::streamoff const remaining = detail::remaining_input(ist);
+        if (remaining != -1)
+        {
+            std::uint64_t const available =
+                static_cast<std::uint64_t>(remaining);
+            if (num_blocks > available / sizeof(std::uint64_t) ||
+                data_size > available - num_blocks * sizeof(std::uint64_t))
+            {
+                ist.setstate(std::ios::eofbit | std::ios::failbit);
+                return ist;
+            }
+        }
+
+        // streams which can't tell the size of the remaining input are read
+        // in chunks, which limits the memory allocated for truncated input
+        std::vector<std::uint64_t> blocks;
+        std::vector<char> data;
+        if (!detail::read_checkpoint_delta_array(ist, blocks, num_blocks) ||
+            !detail::read_checkpoint_delta_array(ist, data, data_size))
+        {
+            return ist;
+        }
+
+        d.block_size_ = header[0];
+        d.size_ = header[1];
+        d.blocks_ = HPX_MOVE(blocks);
+        d.data_ = HPX_MOVE(data);
+        return ist;
+    }
+
+    namespace detail {
+
+        struct apply_checkpoint_delta
+        {
+            void operator()(checkpoint& c, checkpoint_delta const& d) const
+            {
+                if (d.block_size_ == 0 && !d.blocks_.empty())
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "hpx::util::apply_checkpoint_delta",
+                        "invalid checkpoint delta: zero block size");
+                }
+
+                // the whole delta is validated before the checkpoint is
+                // modified, an invalid delta leaves it unchanged
+                std::uint64_t const size = d.size_;
+                std::uint64_t const block_size = d.block_size_;
+                std::uint64_t const num_blocks = block_size == 0 ?
+                    0 :
+                    size / block_size + (size % block_size != 0 ? 1 : 0);
+
+                std::uint64_t total = 0;
+                for (std::uint64_t block : d.blocks_)
+                {
+                    if (block >= num_blocks)
+                    {
+                        HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                            "hpx::util::apply_checkpoint_delta",
+                            "invalid checkpoint delta: block index out of "
+                            "range");
+                    }
+                    total += (std::min)(block_size, size - block * block_size);
+                    if (total > d.data_.size())
+                    {
+                        break;
+                    }
+                }
+
+                if (total != d.data_.size())
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "hpx::util::apply_checkpoint_delta",
+                        "invalid checkpoint delta: the size of the block data "
+                        "does not match the blocks");
+                }
+
+                c.data_.resize(static_cast<std::size_t>(size));
+
+                char const* src = d.data_.data();
+                for (std::uint64_t block : d.blocks_)
+                {
+                    std::size_t const offset =
+                        static_cast<std::size_t>(block * block_size);
+                    std::size_t const len = static_cast<std::size_t>(
+                        (std::min)(block_size, size - offset));
+
+                    std::memcpy(c.data_.data() + offset, src, len);
+                    src += len;
+                }
+            }
+        };
+
+        // 64 bit FNV-1a hash of a block, its length is part of the hash such
+        // that a block which was shortened is reported as changed
+        inline std::uint64_t hash_checkpoint_block(
+            char const* data, std::size_t size) noexcept
+        {
+            constexpr std::uint64_t offset_basis = 0xcbf29ce484222325ULL;
+            constexpr std::uint64_t prime = 0x100000001b3ULL;
+
+            std::uint64_t h = offset_basis;
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                h ^= static_cast<unsigned char>(data[i]);
+                h *= prime;
+            }
+
+            std::uint64_t len = size;
+            for (int i = 0; i != 8; ++i)
+            {
+                h ^= len & 0xff;
+                h *= prime;
+                len >>= 8;
+            }
+            return h;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Checkpoint Delta Encoder
+    ///
+    /// The checkpoint_delta_encoder splits checkpoints into blocks of a fixed
+    /// size and keeps one 64 bit hash per block of the most recently encoded
+    /// checkpoint. Encoding a new checkpoint produces a checkpoint_delta which
+    /// holds only those blocks whose hashes differ from the stored ones. The
+    /// memory needed by the encoder is independent of the block contents,
+    /// a changed block whose hash collides with the previous one (which is
+    /// extremely unlikely) is not detected, however. The first checkpoint
+    /// encoded by a fresh (or reset) encoder is encoded against an empty
+    /// checkpoint, i.e. the resulting delta holds all of its blocks.
+    class checkpoint_delta_encoder
+    {
+    public:
+        explicit checkpoint_delta_encoder(
+            std::size_t block_size = default_checkpoint_block_size)
+          : block_size_(block_size)
+        {
+            if (block_size_ == 0)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "hpx::util::checkpoint_delta_encoder",
+                    "the block size must be larger than zero");
+            }
+        }
+
+        /// Encode the given checkpoint relative to the previously encoded one
+        ///
+        /// \param c            The checkpoint to encode.
+        ///
+        /// \returns The delta which, when applied to the previously encoded
+        ///          checkpoint, reproduces \a c.
+        checkpoint_delta encode(checkpoint const& c)
+        {
+            std::size_t const size = c.size();
+            std::size_t const num_blocks = (size + block_size_ - 1) / block_size_;
+
+            checkpoint_delta d;
+            d.block_size_ = block_size_;
+            d.size_ = size;
+
+            // blocks beyond the end of the previous checkpoint have changed
+            std::size_t const base_blocks = hashes_.size();
+            hashes_.resize(num_blocks);
+
+            char const* data = c.data();
+            for (std::size_t i = 0; i != num_blocks; ++i)
+            {
+                std::size_t const offset = i * block_size_;
+                std::size_t const len = (std::min)(block_size_, size - offset);
+
+                std::uint64_t const h =
+                    detail::hash_checkpoint_block(data + offset, len);
+                if (i < base_blocks && hashes_[i] == h)
+                {
+                    continue;
+                }
+                hashes_[i] = h;
+
+                d.blocks_.push_back(i);
+                d.data_.insert(
+                    d.data_.end(), data + offset, data + offset + len);
+            }
+
+            return d;
+        }
+
+        /// Forget about the previously encoded checkpoint, the next call to
+        /// encode will produce a delta holding all blocks.
+        void reset() noexcept
+        {
+            hashes_.clear();
+        }
+
+        std::size_t block_size() const noexcept
+        {
+            return block_size_;
+        }
+
+    private:
+        std::size_t block_size_;
+        std::vector<std::uint64_t> hashes_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// apply_checkpoint_delta
+    ///
+    /// \param c            The checkpoint the delta was encoded against. It
+    ///                     is modified in place.
+    ///
+    /// \param d            The delta to apply.
+    ///
+    /// Applies the given delta to the checkpoint it was encoded against,
+    /// turning it into the checkpoint the delta was encoded from.
+    inline void apply_checkpoint_delta(checkpoint& c, checkpoint_delta const& d)
+    {
+        detail::apply_checkpoint_delta{}(c, d);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// restore_checkpoint_chain
+    ///
+    /// \param base         The checkpoint the first delta was encoded
+    ///                     against (empty if the first delta was produced by
+    ///                     a fresh encoder).
+    ///
+    /// \param deltas       The sequence of deltas to apply, in the order they
+    ///                     were encoded.
+    ///
+    /// \returns The checkpoint reproduced by applying all deltas in order.
+    inline checkpoint restore_checkpoint_chain(
+        checkpoint base, std::vector<checkpoint_delta> const& deltas)
+    {
+        for (checkpoint_delta const& d : deltas)
+        {
+            detail::apply_checkpoint_delta{}(base, d);
+        }
+        return base;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// write_checkpoint_delta
+    ///
+    /// \param filename     The name of the file to append the delta to.
+    ///
+    /// \param d            The delta to write.
+    ///
+    /// Appends the given delta to the given file. The file I/O is performed
+    /// on a dedicated operating system thread, thus the calling HPX thread
+    /// and the rest of the computation can continue while the data is being
+    /// written. Writes to the same file have to be sequenced by the caller,
+    /// e.g. by chaining the returned futures.
+    ///
+    /// \note This function must be called from an HPX thread.
+    ///
+    /// \returns A future which becomes ready once the delta has been written.
+    inline hpx::future<void> write_checkpoint_delta(
+        std::string const& filename, checkpoint_delta d)
+    {
+        return hpx::threads::run_as_os_thread(
+            [](std::string const& filename, checkpoint_delta const& d) {
+                std::ofstream ost(
+                    filename, std::ios::binary | std::ios::app);
+                if (!(ost << d) || !ost.flush())
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                        "hpx::util::write_checkpoint_delta",
+                        "could not write checkpoint delta to file: {}",
+                        filename);
+                }
+            },
+            filename, HPX_MOVE(d));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// read_checkpoint_chain
+    ///
+    /// \param filename     The name of the file the deltas were appended to
+    ///                     using write_checkpoint_delta.
+    ///
+    /// \param base         The checkpoint the first delta in the file was
+    ///                     encoded against (empty if the first delta was
+    ///                     produced by a fresh encoder).
+    ///
+    /// \returns The checkpoint reproduced by applying all deltas stored in
+    ///          the given file in order. A truncated delta at the end of the
+    ///          file is ignored.
+    inline checkpoint read_checkpoint_chain(
+        std::string const& filename, checkpoint base = checkpoint())
+    {
+        std::ifstream ist(filename, std::ios::binary);
+        if (!ist)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::util::read_checkpoint_chain",
+                "could not open checkpoint file: {}", filename);
+        }
+
+        checkpoint_delta d;
+        while (ist >> d)
+        {
+            detail::apply_checkpoint_delta{}(base, d);
+        }
+
+        // a truncated delta at the end of the file (e.g. from an interrupted
+        // write) is ignored, an invalid one is not
+        if (!ist.eof())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::util::read_checkpoint_chain",
+                "invalid checkpoint delta in file: {}", filename);
+        }
+        return base;
+    }
+}}    // namespace hpx::util
@@ -0,0 +1,592 @@
+// Copyright (c) 2023 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// This header defines the mapped_checkpoint object, which gives read-only
+/// access to a checkpoint stored in a file by mapping the file into memory.
+/// Restoring objects from a mapped_checkpoint deserializes them directly from
+/// the mapped file instead of from a copy of the file's contents. Checkpoints
+/// created using save_indexed_checkpoint additionally allow to restore
+/// individual objects and to access contiguous data in place.
+
+/// \file hpx/checkpoint/mapped_checkpoint.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/traits/is_client.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/checkpoint_base/mapped_file.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace util {
+
+    /// \cond NOINTERNAL
+    class mapped_checkpoint;
+
+    namespace detail {
+
+        // An indexed checkpoint (see save_indexed_checkpoint) starts with a
+        // table holding indexed_checkpoint_magic, the number of stored
+        // objects, and the offsets of the begin and the end of all objects
+        // relative to the start of the checkpoint data. Each object is
+        // serialized into a separate archive.
+        inline constexpr std::uint64_t indexed_checkpoint_magic =
+            0x5844494b43585048;    // "HPXCKIDX"
+
+        // The objects are placed such that the elements of contiguous data
+        // (e.g. a std::vector<double>) are aligned to this value in a file
+        // written using operator<<.
+        inline constexpr std::size_t indexed_checkpoint_alignment =
+            alignof(std::max_align_t);
+
+        // The part of the mapped data holding a single object of an indexed
+        // checkpoint, used as the container to deserialize the object from.
+        struct mapped_checkpoint_object
+        {
+            std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            char const& operator[](std::size_t pos) const noexcept
+            {
+                return data_[pos];
+            }
+
+            char const* data_;
+            std::size_t size_;
+        };
+
+        template <typename T>
+        inline constexpr bool is_mappable_v =
+            std::is_default_constructible_v<T> &&
+            (hpx::traits::is_bitwise_serializable_v<T> ||
+                !hpx::traits::is_not_bitwise_serializable_v<T>) &&
+            alignof(T) <= indexed_checkpoint_alignment;
+    }    // namespace detail
+
+    template <typename T>
+    void restore_checkpoint_object(
+        mapped_checkpoint const& c, std::size_t index, T& t);
+
+    template <typename T>
+    class mapped_checkpoint_view;
+
+    template <typename T>
+    mapped_checkpoint_view<T> view_checkpoint_object(
+        mapped_checkpoint const& c, std::size_t index);
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Mapped Checkpoint Object
+    ///
+    /// A mapped_checkpoint maps a file holding a checkpoint (as written using
+    /// the operator<< overload for checkpoint) into memory. It can be passed
+    /// to restore_checkpoint in place of a checkpoint object, which avoids
+    /// reading the file into a separate buffer first.
+    ///
+    /// If the file holds a checkpoint created using save_indexed_checkpoint,
+    /// individual objects can be restored using restore_checkpoint_object
+    /// without deserializing any of the other objects, and objects of type
+    /// std::vector<T> holding bitwise serializable elements can be accessed
+    /// in place using view_checkpoint_object.
+    class mapped_checkpoint
+    {
+        template <typename T>
+        friend void restore_checkpoint_object(
+            mapped_checkpoint const& c, std::size_t index, T& t);
+
+        template <typename T>
+        friend mapped_checkpoint_view<T> view_checkpoint_object(
+            mapped_checkpoint const& c, std::size_t index);
+
+        // Return the part of the mapped data holding the object with the
+        // given index, only the entries of the index table for that object
+        // are read and verified.
+        detail::mapped_checkpoint_object object(std::size_t index) const
+        {
+            std::size_t const count = num_objects();
+            if (index >= count)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "mapped_checkpoint::object",
+                    "object index out of range: {} (number of objects: {})",
+                    index, count);
+            }
+
+            std::uint64_t offsets[2] = {0, 0};
+            std::memcpy(offsets,
+                data() + (2 * index + 2) * sizeof(std::uint64_t),
+                sizeof(offsets));
+
+            std::size_t const table_size =
+                (2 * count + 2) * sizeof(std::uint64_t);
+            if (offsets[0] < table_size || offsets[0] > offsets[1] ||
+                offsets[1] > size_)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::invalid_data,
+                    "mapped_checkpoint::object",
+                    "invalid index entry for object {}", index);
+            }
+
+            return {data() + offsets[0],
+                static_cast<std::size_t>(offsets[1] - offsets[0])};
+        }
+
+    public:
+        mapped_checkpoint() = default;
+
+        /// Map the checkpoint stored in the given file into memory
+        ///
+        /// \param filename     The name of the file to map. The file is
+        ///                     expected to hold a checkpoint written using
+        ///                     operator<<, i.e. the size of the checkpoint
+        ///                     followed by its data.
+        ///
+        /// \throws hpx::exception (with error code
+        ///         hpx::error::filesystem_error) if the file could not be
+        ///         mapped or if its contents are not consistent.
+        explicit mapped_checkpoint(std::string const& filename)
+          : file_(filename)
+        {
+            // the file starts with the size of the checkpoint (see
+            // operator<<)
+            std::int64_t size = 0;
+            if (file_.size() < sizeof(std::int64_t))
+            {
+                HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                    "mapped_checkpoint::mapped_checkpoint",
+                    "checkpoint file is too short: {}", filename);
+            }
+
+            std::memcpy(&size, file_.data(), sizeof(std::int64_t));
+            if (size < 0 ||
+                static_cast<std::size_t>(size) >
+                    file_.size() - sizeof(std::int64_t))
+            {
+                HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                    "mapped_checkpoint::mapped_checkpoint",
+                    "checkpoint file is truncated: {}", filename);
+            }
+            size_ = static_cast<std::size_t>(size);
+        }
+
+        mapped_checkpoint(mapped_checkpoint const&) = delete;
+        mapped_checkpoint(mapped_checkpoint&& rhs) noexcept
+          : file_(HPX_MOVE(rhs.file_))
+          , size_(std::exchange(rhs.size_, 0))
+        {
+        }
+
+        mapped_checkpoint& operator=(mapped_checkpoint const&) = delete;
+        mapped_checkpoint& operator=(mapped_checkpoint&& rhs) noexcept
+        {
+            file_ = HPX_MOVE(rhs.file_);
+            size_ = std::exchange(rhs.size_, 0);
+            return *this;
+        }
+
+        ~mapped_checkpoint() = default;
+
+        // Iterators
+        //  expose iterators to access data held by checkpoint
+        using const_iterator = char const*;
+
+        const_iterator begin() const noexcept
+        {
+            return data();
+        }
+        const_iterator end() const noexcept
+        {
+            return data() + size_;
+        }
+
+        // Functions
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        char const* data() const noexcept
+        {
+            return file_.data() != nullptr ?
+                file_.data() + sizeof(std::int64_t) :
+                nullptr;
+        }
+
+        char const& operator[](std::size_t pos) const noexcept
+        {
+            return data()[pos];
+        }
+
+        /// Copy the mapped data into a newly created checkpoint object
+        checkpoint to_checkpoint() const
+        {
+            return checkpoint(std::vector<char>(begin(), end()));
+        }
+
+        /// Return the number of objects stored in an indexed checkpoint
+        ///
+        /// \throws hpx::exception (with error code hpx::error::invalid_data)
+        ///         if the mapped data is not an indexed checkpoint (see
+        ///         save_indexed_checkpoint).
+        std::size_t num_objects() const
+        {
+            std::uint64_t header[2] = {0, 0};
+            if (size_ >= sizeof(header))
+            {
+                std::memcpy(header, data(), sizeof(header));
+            }
+
+            // the table has to hold the offsets of all objects
+            if (header[0] != detail::indexed_checkpoint_magic ||
+                header[1] > (size_ - sizeof(header)) / sizeof(header))
+            {
+                HPX_THROW_EXCEPTION(hpx::error::invalid_data,
+                    "mapped_checkpoint::num_objects",
+                    "the mapped data is not an indexed checkpoint");
+            }
+            return static_cast<std::size_t>(header[1]);
+        }
+
+    private:
+        mapped_file file_;
+        std::size_t size_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Restore_checkpoint
+    ///
+    /// Same as restore_checkpoint for checkpoint objects, but deserializes
+    /// directly from the memory mapped file.
+    ///
+    /// \tparam T           A container to restore.
+    ///
+    /// \tparam Ts          Other containers to restore. Containers
+    ///                     must be in the same order that they were
+    ///                     inserted into the checkpoint.
+    ///
+    /// \param c            The mapped checkpoint to restore.
+    ///
+    /// \param t            A container to restore.
+    ///
+    /// \param ts           Other containers to restore Containers
+    ///                     must be in the same order that they were
+    ///                     inserted into the checkpoint.
+    ///
+    /// \returns Restore_checkpoint returns void.
+    template <typename T, typename... Ts>
+    void restore_checkpoint(mapped_checkpoint const& c, T& t, Ts&... ts)
+    {
+        hpx::util::restore_checkpoint_data_func(
+            c, detail::restore_impl{}, t, ts...);
+    }
+
+    /// \cond NOINTERNAL
+    // Same as above, just nullary
+    inline void restore_checkpoint(mapped_checkpoint const&) {}
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        struct save_indexed_funct_obj
+        {
+            // Serialize each of the objects into a separate archive and
+            // record its offset in the index table.
+            template <typename... Ts>
+            checkpoint operator()(Ts&&... ts) const
+            {
+                constexpr std::size_t count = sizeof...(Ts);
+                std::uint64_t table[2 * count + 2] = {
+                    indexed_checkpoint_magic, count};
+
+                std::vector<char> data(sizeof(table));
+
+                // the elements of contiguous data follow the archive header
+                // and the number of elements, the checkpoint data is
+                // prefixed with its size when written to a file
+                std::size_t const data_offset = sizeof(std::int64_t) +
+                    archive_header_size() + sizeof(std::uint64_t);
+
+                std::size_t i = 2;
+                auto save_one = [&](auto&& t) {
+                    std::size_t const pos = data.size() + data_offset;
+                    data.resize(data.size() +
+                        (indexed_checkpoint_alignment -
+                            pos % indexed_checkpoint_alignment) %
+                            indexed_checkpoint_alignment);
+                    table[i++] = data.size();
+
+                    std::vector<char> object;
+                    hpx::util::save_checkpoint_data(
+                        object, HPX_FORWARD(decltype(t), t));
+                    data.insert(data.end(), object.begin(), object.end());
+                    table[i++] = data.size();
+                };
+                (save_one(HPX_FORWARD(Ts, ts)), ...);
+
+                std::memcpy(data.data(), table, sizeof(table));
+                return checkpoint(HPX_MOVE(data));
+            }
+
+            static std::size_t archive_header_size()
+            {
+                std::vector<char> header;
+                hpx::serialization::output_archive ar(header);
+                return ar.bytes_written();
+            }
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_indexed_checkpoint
+    ///
+    /// \tparam T           Containers passed to save_indexed_checkpoint to
+    ///                     be serialized and placed into a checkpoint
+    ///                     object.
+    ///
+    /// \tparam Ts          More containers passed to
+    ///                     save_indexed_checkpoint to be serialized and
+    ///                     placed into a checkpoint object.
+    ///
+    /// \param t            A container to save.
+    ///
+    /// \param ts           Other containers to save.
+    ///
+    /// Save_indexed_checkpoint works like save_checkpoint, but serializes
+    /// each of the objects separately and stores an index of them in the
+    /// checkpoint. Once written to a file using operator<<, the checkpoint
+    /// can be mapped using mapped_checkpoint, which allows to restore the
+    /// objects individually (see restore_checkpoint_object) and to access
+    /// contiguous data in place (see view_checkpoint_object). A checkpoint
+    /// created using this function can only be restored from a
+    /// mapped_checkpoint.
+    ///
+    /// \returns Save_indexed_checkpoint returns a future to a checkpoint.
+    template <typename T, typename... Ts,
+        typename U = typename std::enable_if<
+            !hpx::traits::is_launch_policy<T>::value>::type>
+    hpx::future<checkpoint> save_indexed_checkpoint(T&& t, Ts&&... ts)
+    {
+        return hpx::dataflow(detail::save_indexed_funct_obj{},
+            detail::prepare_client(HPX_FORWARD(T, t)),
+            detail::prepare_client(HPX_FORWARD(Ts, ts))...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_indexed_checkpoint - Policy overload
+    ///
+    /// \param p            Takes an HPX launch policy. Allows the user
+    ///                     to change the way the function is launched
+    ///                     i.e. async, sync, etc.
+    ///
+    /// \param t            A container to save.
+    ///
+    /// \param ts           Other containers to save.
+    ///
+    /// \returns Save_indexed_checkpoint returns a future to a checkpoint.
+    template <typename T, typename... Ts>
+    hpx::future<checkpoint> save_indexed_checkpoint(
+        hpx::launch p, T&& t, Ts&&... ts)
+    {
+        return hpx::dataflow(p, detail::save_indexed_funct_obj{},
+            detail::prepare_client(HPX_FORWARD(T, t)),
+            detail::prepare_client(HPX_FORWARD(Ts, ts))...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_indexed_checkpoint - Sync_policy overload
+    ///
+    /// \param sync_p       hpx::launch::sync_policy
+    ///
+    /// \param t            A container to save.
+    ///
+    /// \param ts           Other containers to save.
+    ///
+    /// \returns Save_indexed_checkpoint which is passed
+    ///          hpx::launch::sync_policy will return a checkpoint.
+    template <typename T, typename... Ts>
+    checkpoint save_indexed_checkpoint(
+        hpx::launch::sync_policy sync_p, T&& t, Ts&&... ts)
+    {
+        return hpx::dataflow(sync_p, detail::save_indexed_funct_obj{},
+            detail::prepare_client(HPX_FORWARD(T, t)),
+            detail::prepare_client(HPX_FORWARD(Ts, ts))...)
+            .get();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Restore_checkpoint_object
+    ///
+    /// \tparam T           The type of the object to restore.
+    ///
+    /// \param c            The mapped checkpoint to restore from, it has to
+    ///                     hold a checkpoint created using
+    ///                     save_indexed_checkpoint.
+    ///
+    /// \param index        The position of the object in the sequence of
+    ///                     objects passed to save_indexed_checkpoint.
+    ///
+    /// \param t            The object to restore.
+    ///
+    /// Restore_checkpoint_object deserializes the object with the given index
+    /// from the mapped file without deserializing any of the other objects.
+    ///
+    /// \throws hpx::exception (with error code hpx::error::bad_parameter) if
+    ///         the index is out of range, or with error code
+    ///         hpx::error::invalid_data if the mapped data is not an indexed
+    ///         checkpoint.
+    template <typename T>
+    void restore_checkpoint_object(
+        mapped_checkpoint const& c, std::size_t index, T& t)
+    {
+        detail::mapped_checkpoint_object const obj = c.object(index);
+        hpx::serialization::input_archive ar(obj, obj.size());
+        detail::restore_impl{}(ar, t);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A read-only view of the elements of a std::vector<T> stored in a
+    /// mapped indexed checkpoint (see view_checkpoint_object). The view
+    /// refers to the mapped file directly, it is valid only as long as the
+    /// mapped_checkpoint it was created from is alive.
+    template <typename T>
+    class mapped_checkpoint_view
+    {
+    public:
+        using value_type = T;
+        using const_iterator = T const*;
+
+        mapped_checkpoint_view() = default;
+
+        mapped_checkpoint_view(T const* data, std::size_t size) noexcept
+          : data_(data)
+          , size_(size)
+        {
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return data_;
+        }
+        const_iterator end() const noexcept
+        {
+            return data_ + size_;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        T const* data() const noexcept
+        {
+            return data_;
+        }
+
+        T const& operator[](std::size_t pos) const noexcept
+        {
+            return data_[pos];
+        }
+
+    private:
+        T const* data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// View_checkpoint_object
+    ///
+    /// \tparam T           The type of the elements of the stored
+    ///                     std::vector<T>, it has to be bitwise
+    ///                     serializable.
+    ///
+    /// \param c            The mapped checkpoint holding the object, it has
+    ///                     to hold a checkpoint created using
+    ///                     save_indexed_checkpoint.
+    ///
+    /// \param index        The position of the object in the sequence of
+    ///                     objects passed to save_indexed_checkpoint.
+    ///
+    /// View_checkpoint_object gives access to the elements of a
+    /// std::vector<T> stored in a mapped indexed checkpoint without copying
+    /// them out of the mapped file.
+    ///
+    /// \returns View_checkpoint_object returns a mapped_checkpoint_view
+    ///          referring to the elements in the mapped file.
+    ///
+    /// \throws hpx::exception (with error code hpx::error::bad_parameter) if
+    ///         the index is out of range, or with error code
+    ///         hpx::error::invalid_data if the mapped data is not an indexed
+    ///         checkpoint or if the object can't be accessed in place, e.g.
+    ///         because it is not a std::vector<T>.
+    template <typename T>
+    mapped_checkpoint_view<T> view_checkpoint_object(
+        mapped_checkpoint const& c, std::size_t index)
+    {
+        static_assert(detail::is_mappable_v<T>,
+            "view_checkpoint_object requires bitwise serializable elements");
+
+        detail::mapped_checkpoint_object const obj = c.object(index);
+        hpx::serialization::input_archive ar(obj, obj.size());
+
+        // std::vector<T> stores its elements in place only if the array
+        // optimization is enabled
+        if (ar.disable_array_optimization() || ar.endianess_differs())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_data,
+                "hpx::util::view_checkpoint_object",
+                "object {} was not stored in a format which can be accessed "
+                "in place",
+                index);
+        }
+
+        std::uint64_t size = 0;
+        ar >> size;
+
+        // the elements have to make up the rest of the object
+        std::size_t const pos = ar.current_pos();
+        char const* data = obj.data_ + pos;
+        if (size > (obj.size() - pos) / sizeof(T) ||
+            obj.size() - pos != size * sizeof(T) ||
+            reinterpret_cast<std::uintptr_t>(data) % alignof(T) != 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_data,
+                "hpx::util::view_checkpoint_object",
+                "object {} can't be accessed as a contiguous sequence of "
+                "elements",
+                index);
+        }
+
+        return mapped_checkpoint_view<T>(
+            reinterpret_cast<T const*>(data), static_cast<std::size_t>(size));
+    }
+}}    // namespace hpx::util
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -13,6 +13,8 @@
 #include <hpx/modules/checkpoint.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <fstream>
 #include <string>
 #include <utility>
@@ -21,7 +23,10 @@
 using hpx::util::checkpoint;
 using hpx::util::prepare_checkpoint;
 using hpx::util::restore_checkpoint;
+using hpx::util::restore_checkpoint_object;
 using hpx::util::save_checkpoint;
+using hpx::util::save_indexed_checkpoint;
+using hpx::util::view_checkpoint_object;
 
 // Main
 int main()
@@ -200,8 +205,75 @@ int main()
     HPX_TEST_EQ(b9, b9_1);
     HPX_TEST_EQ(c9, c9_1);
 
+    // Test 9.1
+    //  test restoring from a memory mapped checkpoint file
+    {
+        hpx::util::mapped_checkpoint mapped("test_file_9.txt");
+        HPX_TEST(mapped.size() == archive9.size());
+        HPX_TEST(mapped.to_checkpoint() == archive9);
+
+        double a9_2, b9_2, c9_2;
+        restore_checkpoint(mapped, a9_2, b9_2, c9_2);
+
+        HPX_TEST_EQ(a9, a9_2);
+        HPX_TEST_EQ(b9, b9_2);
+        HPX_TEST_EQ(c9, c9_2);
+    }
+
+    // Test 9.2
+    //  test restoring individual objects and accessing contiguous data in
+    //  place using a memory mapped indexed checkpoint
+    {
+        std::string str9 = "indexed checkpoint";
+        std::vector<double> vec9(1000);
+        for (std::size_t i = 0; i != vec9.size(); ++i)
+        {
+            vec9[i] = 0.5 * static_cast<double>(i);
+        }
+        std::vector<int> ints9 = {1, 2, 3};
+
+        {
+            std::ofstream test_file_9_2("test_file_9_2.txt", std::ios::binary);
+            test_file_9_2 << save_indexed_checkpoint(
+                hpx::launch::sync, str9, vec9, ints9);
+        }
+
+        hpx::util::mapped_checkpoint mapped("test_file_9_2.txt");
+        HPX_TEST_EQ(mapped.num_objects(), std::size_t(3));
+
+        std::vector<int> ints9_1;
+        restore_checkpoint_object(mapped, 2, ints9_1);
+        HPX_TEST(ints9 == ints9_1);
+
+        std::string str9_1;
+        restore_checkpoint_object(mapped, 0, str9_1);
+        HPX_TEST_EQ(str9, str9_1);
+
+        // the elements are accessed in place
+        hpx::util::mapped_checkpoint_view<double> view =
+            view_checkpoint_object<double>(mapped, 1);
+        HPX_TEST_EQ(view.size(), vec9.size());
+        HPX_TEST(std::equal(view.begin(), view.end(), vec9.begin()));
+        HPX_TEST(reinterpret_cast<char const*>(view.data()) > mapped.data());
+        HPX_TEST(reinterpret_cast<char const*>(view.end()) <= mapped.end());
+
+        // the object is not a std::vector<double>
+        HPX_TEST_THROW(
+            view_checkpoint_object<double>(mapped, 2), hpx::exception);
+
+        HPX_TEST_THROW(
+            restore_checkpoint_object(mapped, 3, ints9_1), hpx::exception);
+
+        // the checkpoint is not indexed
+        hpx::util::mapped_checkpoint mapped9("test_file_9.txt");
+        HPX_TEST_THROW(mapped9.num_objects(), hpx::exception);
+        HPX_TEST_THROW(
+            restore_checkpoint_object(mapped9, 0, ints9_1), hpx::exception);
+    }
+
     // Cleanup
     std::remove("test_file_9.txt");
+    std::remove("test_file_9_2.txt");
 
     // Test 10
     //  test checkpoint(vector<char>&) constructor
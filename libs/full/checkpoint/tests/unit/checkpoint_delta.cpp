@@ -0,0 +1,284 @@
+// Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This example tests the functionality of incremental checkpoints, i.e.
+// checkpoint_delta_encoder, apply_checkpoint_delta, write_checkpoint_delta,
+// and read_checkpoint_chain.
+//
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+using hpx::util::apply_checkpoint_delta;
+using hpx::util::checkpoint;
+using hpx::util::checkpoint_delta;
+using hpx::util::checkpoint_delta_encoder;
+using hpx::util::read_checkpoint_chain;
+using hpx::util::restore_checkpoint;
+using hpx::util::restore_checkpoint_chain;
+using hpx::util::save_checkpoint;
+using hpx::util::write_checkpoint_delta;
+
+int main()
+{
+    std::vector<double> state(10000);
+    for (std::size_t i = 0; i != state.size(); ++i)
+    {
+        state[i] = static_cast<double>(i);
+    }
+    std::string name = "state";
+
+    // Test 1
+    //  the first delta holds all blocks, unchanged state produces empty deltas
+    checkpoint_delta_encoder encoder(256);
+
+    checkpoint c1 = save_checkpoint(hpx::launch::sync, name, state);
+    checkpoint_delta d1 = encoder.encode(c1);
+
+    HPX_TEST_EQ(d1.checkpoint_size(), c1.size());
+    HPX_TEST_EQ(d1.size(), c1.size());
+    HPX_TEST_EQ(d1.num_blocks(), (c1.size() + 255) / 256);
+
+    checkpoint_delta d1_1 = encoder.encode(c1);
+    HPX_TEST(d1_1.empty());
+    HPX_TEST_EQ(d1_1.size(), std::size_t(0));
+
+    // Test 2
+    //  only the modified block is stored in the delta
+    state[5000] = -1.0;
+    checkpoint c2 = save_checkpoint(hpx::launch::sync, name, state);
+    checkpoint_delta d2 = encoder.encode(c2);
+
+    HPX_TEST_EQ(d2.num_blocks(), std::size_t(1));
+    HPX_TEST(d2.size() <= std::size_t(256));
+
+    checkpoint c = c1;
+    apply_checkpoint_delta(c, d2);
+    HPX_TEST(c == c2);
+
+    // Test 3
+    //  changing the size of the checkpoint
+    state.resize(12000, 42.0);
+    checkpoint c3 = save_checkpoint(hpx::launch::sync, name, state);
+    checkpoint_delta d3 = encoder.encode(c3);
+    HPX_TEST(d3.size() < c3.size());
+
+    state.resize(100);
+    checkpoint c4 = save_checkpoint(hpx::launch::sync, name, state);
+    checkpoint_delta d4 = encoder.encode(c4);
+
+    checkpoint restored =
+        restore_checkpoint_chain(checkpoint(), {d1, d1_1, d2, d3, d4});
+    HPX_TEST(restored == c4);
+
+    std::string name4;
+    std::vector<double> state4;
+    restore_checkpoint(restored, name4, state4);
+    HPX_TEST_EQ(name, name4);
+    HPX_TEST(state == state4);
+
+    // Test 4
+    //  test operator<< and operator>> overloads
+    std::stringstream strm;
+    strm << d2 << d3;
+
+    checkpoint_delta d2_1, d3_1;
+    strm >> d2_1 >> d3_1;
+    HPX_TEST(d2 == d2_1);
+    HPX_TEST(d3 == d3_1);
+
+    // Test 5
+    //  all changed blocks are detected, including blocks whose contents were
+    //  swapped, the shortened last block of a truncated checkpoint, and the
+    //  blocks beyond its end once the checkpoint grows again
+    {
+        checkpoint_delta_encoder enc(16);
+
+        std::vector<char> bytes(64);
+        for (std::size_t i = 0; i != bytes.size(); ++i)
+        {
+            bytes[i] = static_cast<char>(i);
+        }
+        checkpoint b1(bytes);
+        enc.encode(b1);
+
+        std::swap_ranges(bytes.begin(), bytes.begin() + 16, bytes.begin() + 16);
+        checkpoint b2(bytes);
+        checkpoint_delta e2 = enc.encode(b2);
+        HPX_TEST_EQ(e2.num_blocks(), std::size_t(2));
+
+        for (std::size_t i = 0; i != bytes.size(); ++i)
+        {
+            bytes[i] ^= 1;
+            checkpoint bi(bytes);
+            HPX_TEST_EQ(enc.encode(bi).num_blocks(), std::size_t(1));
+        }
+
+        checkpoint b3(std::vector<char>(bytes.begin(), bytes.begin() + 40));
+        checkpoint_delta e3 = enc.encode(b3);
+        HPX_TEST_EQ(e3.num_blocks(), std::size_t(1));
+        HPX_TEST_EQ(e3.size(), std::size_t(8));
+
+        checkpoint b4(bytes);
+        checkpoint_delta e4 = enc.encode(b4);
+        HPX_TEST_EQ(e4.num_blocks(), std::size_t(2));
+
+        HPX_TEST(restore_checkpoint_chain(
+                     b4, {enc.encode(b2), enc.encode(b3), enc.encode(b4)}) ==
+            b4);
+    }
+
+    // Test 6
+    //  operator>> rejects headers which don't match the remaining input
+    {
+        std::stringstream valid;
+        valid << d2;
+        std::string const bytes = valid.str();
+
+        // the header holds the block size, the size of the checkpoint, the
+        // number of blocks, and the number of payload bytes
+        std::string corrupt = bytes;
+        std::uint64_t const data_size = d2.checkpoint_size() + 1;
+        std::memcpy(&corrupt[3 * sizeof(std::uint64_t)], &data_size,
+            sizeof(data_size));
+
+        checkpoint_delta d2_2 = d3;
+        std::stringstream corrupt_strm(corrupt);
+        HPX_TEST(!(corrupt_strm >> d2_2));
+        HPX_TEST(!corrupt_strm.eof());
+        HPX_TEST(d2_2 == d3);
+
+        // sizes exceeding the remaining input are rejected before any memory
+        // is allocated
+        corrupt = bytes;
+        std::uint64_t const num_blocks = std::uint64_t(1) << 60;
+        std::memcpy(&corrupt[2 * sizeof(std::uint64_t)], &num_blocks,
+            sizeof(num_blocks));
+
+        std::stringstream huge_strm(corrupt);
+        HPX_TEST(!(huge_strm >> d2_2));
+        HPX_TEST(huge_strm.eof());
+        HPX_TEST(d2_2 == d3);
+
+        std::stringstream truncated_strm(bytes.substr(0, bytes.size() - 1));
+        HPX_TEST(!(truncated_strm >> d2_2));
+        HPX_TEST(truncated_strm.eof());
+        HPX_TEST(d2_2 == d3);
+    }
+
+    // Test 7
+    //  apply_checkpoint_delta rejects deltas whose blocks don't match the
+    //  size of the checkpoint or the payload, the checkpoint is left
+    //  unchanged
+    {
+        auto make_delta = [](std::uint64_t num_blocks,
+                              std::vector<std::uint64_t> const& blocks,
+                              std::size_t data_size) {
+            std::uint64_t const header[4] = {16, 32, num_blocks, data_size};
+            std::stringstream strm;
+            strm.write(reinterpret_cast<char const*>(header), sizeof(header));
+            strm.write(reinterpret_cast<char const*>(blocks.data()),
+                blocks.size() * sizeof(std::uint64_t));
+            strm << std::string(data_size, 'x');
+
+            checkpoint_delta d;
+            strm >> d;
+            HPX_TEST(!strm.fail());
+            return d;
+        };
+
+        checkpoint const base(std::vector<char>(20, 'a'));
+        checkpoint b = base;
+
+        // block index beyond the end of the checkpoint
+        HPX_TEST_THROW(
+            apply_checkpoint_delta(b, make_delta(1, {2}, 16)), hpx::exception);
+        HPX_TEST(b == base);
+
+        // block index whose offset overflows
+        std::uint64_t const huge_block = std::uint64_t(1) << 61;
+        HPX_TEST_THROW(
+            apply_checkpoint_delta(b, make_delta(1, {huge_block}, 16)),
+            hpx::exception);
+        HPX_TEST(b == base);
+
+        // payload too short for the blocks
+        HPX_TEST_THROW(apply_checkpoint_delta(b, make_delta(2, {0, 1}, 16)),
+            hpx::exception);
+        HPX_TEST(b == base);
+
+        // trailing payload bytes
+        HPX_TEST_THROW(
+            apply_checkpoint_delta(b, make_delta(1, {0}, 20)), hpx::exception);
+        HPX_TEST(b == base);
+
+        apply_checkpoint_delta(b, make_delta(2, {0, 1}, 32));
+        HPX_TEST(b == checkpoint(std::vector<char>(32, 'x')));
+    }
+
+    // Test 8
+    //  asynchronously write a chain of deltas to a file and restore from it
+    std::string const filename = "checkpoint_delta_test_file.bin";
+    std::remove(filename.c_str());
+
+    encoder.reset();
+    hpx::future<void> f = hpx::make_ready_future();
+    for (int i = 0; i != 5; ++i)
+    {
+        state[i] = 2.0 * i;
+        checkpoint ci = save_checkpoint(hpx::launch::sync, name, state);
+        f = f.then([filename, d = encoder.encode(ci)](
+                       hpx::future<void>&& f) mutable {
+            f.get();    // propagate exceptions
+            return write_checkpoint_delta(filename, std::move(d));
+        });
+    }
+    f.get();
+
+    std::string name5;
+    std::vector<double> state5;
+    restore_checkpoint(read_checkpoint_chain(filename), name5, state5);
+    HPX_TEST_EQ(name, name5);
+    HPX_TEST(state == state5);
+
+    // a truncated delta at the end of the file is ignored, an invalid one
+    // is reported
+    {
+        std::ofstream ost(filename, std::ios::binary | std::ios::app);
+        ost.write("\x10\0\0\0", 4);
+    }
+    restore_checkpoint(read_checkpoint_chain(filename), name5, state5);
+    HPX_TEST(state == state5);
+
+    std::string const invalid_filename = "checkpoint_delta_test_file_2.bin";
+    {
+        // more payload bytes than the size of the checkpoint
+        std::ofstream ost(invalid_filename, std::ios::binary);
+        std::uint64_t const header[4] = {256, 0, 1, 1};
+        ost.write(reinterpret_cast<char const*>(header), sizeof(header));
+        ost.write(std::string(1024, '\0').c_str(), 1024);
+    }
+    HPX_TEST_THROW(read_checkpoint_chain(invalid_filename), hpx::exception);
+
+    // Cleanup
+    std::remove(filename.c_str());
+    std::remove(invalid_filename.c_str());
+
+    return hpx::util::report_errors();
+}
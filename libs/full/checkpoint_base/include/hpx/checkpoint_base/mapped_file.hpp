@@ -0,0 +1,62 @@
+// Copyright (c) 2023 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/checkpoint_base/mapped_file.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+#include <string>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A read-only view of a whole file mapped into memory (mmap on POSIX
+    /// systems, MapViewOfFile on Windows). The file is unmapped when the
+    /// object is destroyed.
+    class HPX_EXPORT mapped_file
+    {
+    public:
+        mapped_file() = default;
+
+        /// Map the given file into memory
+        ///
+        /// \throws hpx::exception (with error code
+        ///         hpx::error::filesystem_error) if the file could not be
+        ///         opened or mapped.
+        explicit mapped_file(std::string const& filename);
+
+        mapped_file(mapped_file const&) = delete;
+        mapped_file(mapped_file&& rhs) noexcept;
+
+        mapped_file& operator=(mapped_file const&) = delete;
+        mapped_file& operator=(mapped_file&& rhs) noexcept;
+
+        ~mapped_file();
+
+        char const* data() const noexcept
+        {
+            return static_cast<char const*>(data_);
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+    private:
+        void unmap() noexcept;
+
+        void* data_ = nullptr;
+        std::size_t size_ = 0;
+    };
+}    // namespace hpx::util
+
+#include <hpx/config/warnings_suffix.hpp>
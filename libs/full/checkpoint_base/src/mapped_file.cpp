@@ -0,0 +1,151 @@
+// Copyright (c) 2023 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/checkpoint_base/mapped_file.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#if defined(HPX_WINDOWS)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hpx::util {
+
+    mapped_file::mapped_file(std::string const& filename)
+    {
+#if defined(HPX_WINDOWS)
+        HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ,
+            FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+            FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "mapped_file::mapped_file",
+                "could not open file: {}", filename);
+        }
+
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file, &file_size))
+        {
+            CloseHandle(file);
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "mapped_file::mapped_file",
+                "could not determine size of file: {}", filename);
+        }
+        size_ = static_cast<std::size_t>(file_size.QuadPart);
+
+        if (size_ != 0)
+        {
+            HANDLE mapping =
+                CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping != nullptr)
+            {
+                data_ = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+
+        if (size_ != 0 && data_ == nullptr)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "mapped_file::mapped_file",
+                "could not map file: {}", filename);
+        }
+#else
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "mapped_file::mapped_file",
+                "could not open file: {} ({})", filename,
+                std::strerror(errno));
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) == -1)
+        {
+            int const err = errno;
+            ::close(fd);
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "mapped_file::mapped_file",
+                "could not determine size of file: {} ({})",
+                filename, std::strerror(err));
+        }
+        size_ = static_cast<std::size_t>(st.st_size);
+
+        if (size_ != 0)
+        {
+            void* p =
+                ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED)
+            {
+                int const err = errno;
+                ::close(fd);
+                HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                    "mapped_file::mapped_file",
+                    "could not map file: {} ({})", filename,
+                    std::strerror(err));
+            }
+            data_ = p;
+
+            // the file is expected to be read front to back (e.g. while
+            // restoring a checkpoint), let the kernel start reading ahead
+            // right away
+            ::madvise(data_, size_, MADV_SEQUENTIAL);
+            ::madvise(data_, size_, MADV_WILLNEED);
+        }
+        ::close(fd);
+#endif
+    }
+
+    mapped_file::mapped_file(mapped_file&& rhs) noexcept
+      : data_(std::exchange(rhs.data_, nullptr))
+      , size_(std::exchange(rhs.size_, 0))
+    {
+    }
+
+    mapped_file& mapped_file::operator=(mapped_file&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            unmap();
+            data_ = std::exchange(rhs.data_, nullptr);
+            size_ = std::exchange(rhs.size_, 0);
+        }
+        return *this;
+    }
+
+    mapped_file::~mapped_file()
+    {
+        unmap();
+    }
+
+    void mapped_file::unmap() noexcept
+    {
+        if (data_ != nullptr)
+        {
+#if defined(HPX_WINDOWS)
+            UnmapViewOfFile(data_);
+#else
+            ::munmap(data_, size_);
+#endif
+        }
+        data_ = nullptr;
+        size_ = 0;
+    }
+}    // namespace hpx::util
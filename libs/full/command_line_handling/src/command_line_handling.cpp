@@ -24,6 +24,7 @@
 #include <hpx/modules/topology.hpp>
 #include <hpx/modules/util.hpp>
 #include <hpx/preprocessor/stringize.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
 #include <hpx/util/from_string.hpp>
 #include <hpx/version.hpp>
 
@@ -989,8 +990,10 @@ namespace hpx::util {
 
         // load plugin modules (after first pass of command line handling, so
         // that settings given on command line could propagate to modules)
+        util::record_startup_phase("command line handling");
         std::vector<std::shared_ptr<plugins::plugin_registry_base>>
             plugin_registries = rtcfg_.load_modules(component_registries);
+        util::record_startup_phase("module discovery");
 
         // Re-run program option analysis, ini settings (such as aliases) will
         // be considered now.
@@ -13,7 +13,9 @@
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <mutex>
 #include <utility>
 #include <vector>
@@ -108,12 +110,6 @@ namespace hpx { namespace compute { namespace detail {
 
     protected:
         /// \cond NOINTERNAL
-        HPX_FORCEINLINE static std::size_t round_to_multiple(
-            std::size_t n1, std::size_t n2, std::size_t n3)
-        {
-            return (n1 / n2) * n3;
-        }
-
         std::size_t get_num_items(std::size_t items, target_type const& t) const
         {
             std::lock_guard<mutex_type> l(mtx_);
@@ -125,26 +121,14 @@ namespace hpx { namespace compute { namespace detail {
             }
 
             // this distribution policy places an equal number of items onto
-            // each target
+            // each target, the first targets get one more item if the number
+            // of items is not divisible by the number of targets
             std::size_t sites = (std::max)(std::size_t(1), targets_.size());
 
-            // the overall number of items to create is smaller than the number
-            // of sites
-            if (items < sites)
-            {
-                auto it = std::find(targets_.begin(), targets_.end(), t);
-                std::size_t num_loc = std::distance(targets_.begin(), it);
-                return (items < num_loc) ? 1 : 0;
-            }
-
-            // the last locality might get less items
-            if (!targets_.empty() && t == targets_.back())
-            {
-                return items - round_to_multiple(items, sites, sites - 1);
-            }
+            auto it = std::find(targets_.begin(), targets_.end(), t);
+            std::size_t num_target = std::distance(targets_.begin(), it);
 
-            // otherwise just distribute evenly
-            return (items + sites - 1) / sites;
+            return items / sites + (num_target < items % sites ? 1 : 0);
         }
         /// \endcond
 
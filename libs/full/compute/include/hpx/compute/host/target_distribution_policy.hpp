@@ -25,6 +25,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <iterator>
 #include <map>
 #include <type_traits>
 #include <utility>
@@ -175,23 +176,42 @@ namespace hpx { namespace compute { namespace host {
             {
                 localities.push_back(HPX_MOVE(it->first));
 
-                std::size_t num_partitions = 0;
-                for (target_type const& t : it->second)
-                {
-                    num_partitions += this->get_num_items(count, t);
-                }
-
-                std::vector<hpx::compute::host::target> local_targets;
-                local_targets.reserve(it->second.size());
+                // each object is bound to exactly one of the targets (NUMA
+                // domains) of its locality, the objects placed on the same
+                // target are created next to each other
+                std::vector<hpx::future<std::vector<hpx::id_type>>> local_objs;
+                local_objs.reserve(it->second.size());
                 for (auto&& dt : HPX_MOVE(it->second))
                 {
-                    local_targets.push_back(
-                        hpx::compute::host::target(HPX_MOVE(dt)));
+                    std::size_t num_partitions = this->get_num_items(count, dt);
+                    if (num_partitions == 0)
+                    {
+                        continue;
+                    }
+
+                    std::vector<hpx::compute::host::target> local_targets(
+                        1, hpx::compute::host::target(HPX_MOVE(dt)));
+
+                    local_objs.push_back(
+                        components::bulk_create_async<Component>(
+                            localities.back(), num_partitions, ts...,
+                            HPX_MOVE(local_targets)));
                 }
 
-                objs.push_back(
-                    components::bulk_create_async<Component>(localities.back(),
-                        num_partitions, ts..., HPX_MOVE(local_targets)));
+                objs.push_back(hpx::dataflow(
+                    [](std::vector<hpx::future<std::vector<hpx::id_type>>>&&
+                            v) -> std::vector<hpx::id_type> {
+                        std::vector<hpx::id_type> ids;
+                        for (auto&& f : v)
+                        {
+                            std::vector<hpx::id_type> part = f.get();
+                            ids.insert(ids.end(),
+                                std::make_move_iterator(part.begin()),
+                                std::make_move_iterator(part.end()));
+                        }
+                        return ids;
+                    },
+                    HPX_MOVE(local_objs)));
             }
 
             return hpx::dataflow(
@@ -242,7 +262,8 @@ namespace hpx { namespace compute { namespace host {
 
     /// A predefined instance of the \a target_distribution_policy for
     /// localities. It will represent all NUMA domains of the given locality
-    /// and will place all items to create here.
+    /// and will place all items to create here. Each of the created objects
+    /// is bound to exactly one of the NUMA domains.
     static target_distribution_policy const target_layout;
 }}}    // namespace hpx::compute::host
 
@@ -10,6 +10,7 @@
 #include <hpx/config.hpp>
 #include <hpx/parallel/algorithms/reduce.hpp>
 #include <hpx/parallel/algorithms/reduce_by_key.hpp>
+#include <hpx/parallel/algorithms/unordered_reduce_by_key.hpp>
 #include <hpx/parallel/container_algorithms/reduce.hpp>
 
 #include <hpx/parallel/segmented_algorithms/reduce.hpp>
@@ -7,4 +7,5 @@
 #pragma once
 
 #include <hpx/parallel/algorithms/unique.hpp>
+#include <hpx/parallel/algorithms/unordered_unique.hpp>
 #include <hpx/parallel/container_algorithms/unique.hpp>
@@ -35,6 +35,7 @@
 #include <hpx/program_options/parsers.hpp>
 #include <hpx/program_options/variables_map.hpp>
 #include <hpx/resource_partitioner/partitioner.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
 #include <hpx/runtime_local/config_entry.hpp>
 #include <hpx/runtime_local/custom_exception_info.hpp>
 #include <hpx/runtime_local/debugging.hpp>
@@ -50,6 +51,7 @@
 #include <hpx/string_util/split.hpp>
 #include <hpx/threading/thread.hpp>
 #include <hpx/threading_base/detail/get_default_timer_service.hpp>
+#include <hpx/topology/topology.hpp>
 #include <hpx/type_support/pack.hpp>
 #include <hpx/type_support/unused.hpp>
 #include <hpx/util/from_string.hpp>
@@ -84,6 +86,7 @@
 #include <cstddef>
 #include <exception>
 #include <functional>
+#include <future>
 #include <iostream>
 #include <map>
 #include <memory>
@@ -778,6 +781,7 @@ namespace hpx {
                 f,
             int argc, char** argv, init_params const& params, bool blocking)
         {
+            hpx::util::reset_startup_timings();
             init_environment();
 
             int result = 0;
@@ -789,6 +793,12 @@ namespace hpx {
                     return result;
                 }
 
+                // discover the hardware topology while the configuration is
+                // being read and the modules are being loaded, errors will be
+                // reported when the topology is used below
+                auto topology_discovery = std::async(std::launch::async,
+                    []() { hpx::threads::create_topology(); });
+
 #if defined(HPX_HAVE_NETWORKING)
                 hpx::util::command_line_handling cmdline{
                     hpx::util::runtime_configuration(argv[0], params.mode,
@@ -799,6 +809,7 @@ namespace hpx {
                     hpx::util::runtime_configuration(argv[0], params.mode, {}),
                     hpx_startup::user_main_config(params.cfg), f};
 #endif
+                hpx::util::record_startup_phase("runtime configuration");
 
                 // scope exception handling to resource partitioner initialization
                 // any exception thrown during run_or_start below are handled
@@ -811,6 +822,10 @@ namespace hpx {
 
                     result = cmdline.call(
                         params.desc_cmdline, argc, argv, component_registries);
+                    hpx::util::record_startup_phase("command line handling");
+
+                    topology_discovery.wait();
+                    hpx::util::record_startup_phase("topology discovery");
 
                     hpx::threads::policies::detail::affinity_data
                         affinity_data{};
@@ -867,6 +882,7 @@ namespace hpx {
 #endif
                     // Setup all internal parameters of the resource_partitioner
                     rp.configure_pools();
+                    hpx::util::record_startup_phase("resource partitioner");
                 }
                 catch (hpx::exception const& e)
                 {
@@ -912,6 +928,7 @@ namespace hpx {
 #endif
                 }
                 }
+                hpx::util::record_startup_phase("runtime construction");
 
                 result = run_or_start(blocking, HPX_MOVE(rt), cmdline,
                     HPX_MOVE(params.startup), HPX_MOVE(params.shutdown));
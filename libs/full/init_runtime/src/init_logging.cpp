@@ -44,6 +44,21 @@ namespace hpx { namespace util {
                 to << std::string(16, '-');
             }
         }
+
+        // the component id is formatted by the background thread of the
+        // asynchronous logging backend
+        void capture(logging::detail::record_encoder& rec) const override
+        {
+            std::uint64_t component_id = threads::get_self_component_id();
+            if (0 != component_id)
+            {
+                rec.format("{:016x}", component_id);
+            }
+            else
+            {
+                rec.format("----------------");
+            }
+        }
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,233 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/serialization.hpp>
+
+#include <hpx/parcelset/parcel_buffer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace hpx::parcelset::policies::shmem {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Non-owning view of a range of bytes in (shared) memory, used as the
+    // buffer type for decoding received parcels in place.
+    struct buffer_view
+    {
+        struct allocator_type
+        {
+        };
+
+        explicit buffer_view(allocator_type const& = allocator_type()) noexcept
+          : ptr_(nullptr)
+          , size_(0)
+        {
+        }
+
+        buffer_view(char* ptr, std::size_t size) noexcept
+          : ptr_(ptr)
+          , size_(size)
+        {
+        }
+
+        buffer_view(buffer_view const& rhs, allocator_type const&) noexcept
+          : ptr_(rhs.ptr_)
+          , size_(rhs.size_)
+        {
+        }
+
+        buffer_view(buffer_view const&) = default;
+        buffer_view& operator=(buffer_view const&) = default;
+
+        char& operator[](std::size_t i) const noexcept
+        {
+            HPX_ASSERT(i < size_);
+            return ptr_[i];
+        }
+
+        char* data() const noexcept
+        {
+            return ptr_;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        char* ptr_;
+        std::size_t size_;
+    };
+
+    using receive_buffer_type = parcel_buffer<buffer_view, buffer_view>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Every frame in the ring starts with a message header. The payload
+    // (encoded parcels and chunks) either follows the header in the ring or,
+    // if heap_id_ is not zero, it has been written to a separate segment
+    // whose name is derived from the receiving locality, the sending process
+    // and the heap id.
+    struct message_header
+    {
+        std::uint64_t heap_id_;
+        std::uint64_t size_;
+        std::int32_t source_;
+        std::uint32_t reserved_;
+    };
+
+    // The payload starts with the sizes of its parts, followed by the
+    // transmission chunks, the serialized parcel data and the zero-copy
+    // chunks, each starting at an aligned offset.
+    struct payload_header
+    {
+        std::uint64_t data_size_;
+        std::uint32_t num_zero_copy_chunks_;
+        std::uint32_t num_non_zero_copy_chunks_;
+    };
+
+    namespace detail {
+
+        inline constexpr std::size_t payload_alignment = 16;
+
+        constexpr std::size_t align(std::size_t size) noexcept
+        {
+            return (size + payload_alignment - 1) & ~(payload_alignment - 1);
+        }
+    }    // namespace detail
+
+    // All segments of this parcelport share this prefix, the segments are
+    // identified by the process id of the receiving locality following it.
+    inline constexpr char segment_prefix[] = "/hpx.shmem.";
+
+    inline std::string segment_name(std::int32_t pid)
+    {
+        return segment_prefix + std::to_string(pid);
+    }
+
+    inline std::string heap_segment_name(
+        std::int32_t dest, std::int32_t source, std::uint64_t heap_id)
+    {
+        return segment_name(dest) + "." + std::to_string(source) + "." +
+            std::to_string(heap_id);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Buffer>
+    std::size_t payload_size(Buffer const& buffer) noexcept
+    {
+        using transmission_chunk_type =
+            typename Buffer::transmission_chunk_type;
+
+        std::size_t size = detail::align(sizeof(payload_header) +
+            buffer.transmission_chunks_.size() *
+                sizeof(transmission_chunk_type));
+        size += detail::align(buffer.data_.size());
+
+        for (serialization::serialization_chunk const& c : buffer.chunks_)
+        {
+            if (c.type_ == serialization::chunk_type::chunk_type_pointer)
+            {
+                size += detail::align(c.size_);
+            }
+        }
+        return size;
+    }
+
+    // Encode the given buffer into the destination, which must provide at
+    // least payload_size(buffer) bytes.
+    template <typename Buffer>
+    void write_payload(Buffer const& buffer, char* dest) noexcept
+    {
+        using transmission_chunk_type =
+            typename Buffer::transmission_chunk_type;
+
+        payload_header const h = {buffer.data_.size(),
+            buffer.num_chunks_.first, buffer.num_chunks_.second};
+        std::memcpy(dest, &h, sizeof(h));
+
+        std::size_t const transmission_chunks_size =
+            buffer.transmission_chunks_.size() *
+            sizeof(transmission_chunk_type);
+        if (transmission_chunks_size != 0)
+        {
+            std::memcpy(dest + sizeof(h), buffer.transmission_chunks_.data(),
+                transmission_chunks_size);
+        }
+        dest += detail::align(sizeof(h) + transmission_chunks_size);
+
+        std::memcpy(dest, buffer.data_.data(), buffer.data_.size());
+        dest += detail::align(buffer.data_.size());
+
+        for (serialization::serialization_chunk const& c : buffer.chunks_)
+        {
+            if (c.type_ == serialization::chunk_type::chunk_type_pointer)
+            {
+                std::memcpy(dest, c.data_.cpos_, c.size_);
+                dest += detail::align(c.size_);
+            }
+        }
+    }
+
+    // Create a buffer referring to the parts of the encoded payload, the
+    // payload has to stay valid until the buffer has been decoded.
+    inline receive_buffer_type read_payload(char* src, std::size_t size)
+    {
+        using transmission_chunk_type =
+            receive_buffer_type::transmission_chunk_type;
+
+        receive_buffer_type buffer;
+
+        payload_header h;
+        HPX_ASSERT(size >= sizeof(h));
+        std::memcpy(&h, src, sizeof(h));
+
+        buffer.num_chunks_ = receive_buffer_type::count_chunks_type(
+            h.num_zero_copy_chunks_, h.num_non_zero_copy_chunks_);
+
+        std::size_t const num_chunks = static_cast<std::size_t>(
+            h.num_zero_copy_chunks_) + h.num_non_zero_copy_chunks_;
+        buffer.transmission_chunks_.resize(num_chunks);
+
+        std::size_t const transmission_chunks_size =
+            num_chunks * sizeof(transmission_chunk_type);
+        if (transmission_chunks_size != 0)
+        {
+            std::memcpy(static_cast<void*>(buffer.transmission_chunks_.data()),
+                src + sizeof(h), transmission_chunks_size);
+        }
+        std::size_t offset =
+            detail::align(sizeof(h) + transmission_chunks_size);
+
+        std::size_t const data_size = static_cast<std::size_t>(h.data_size_);
+        buffer.data_ = buffer_view(src + offset, data_size);
+        buffer.data_size_ = h.data_size_;
+        buffer.size_ = size;
+        offset += detail::align(data_size);
+
+        buffer.chunks_.reserve(h.num_zero_copy_chunks_);
+        for (std::size_t i = 0; i != h.num_zero_copy_chunks_; ++i)
+        {
+            std::size_t const chunk_size = static_cast<std::size_t>(
+                buffer.transmission_chunks_[i].second);
+            buffer.chunks_.emplace_back(src + offset, chunk_size);
+            offset += detail::align(chunk_size);
+        }
+
+        HPX_ASSERT(offset <= size);
+        return buffer;
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
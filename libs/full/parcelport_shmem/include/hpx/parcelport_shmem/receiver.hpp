@@ -0,0 +1,136 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/parcelport_shmem/message.hpp>
+#include <hpx/parcelport_shmem/ring.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelset/decode_parcels.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    template <typename Parcelport>
+    struct receiver
+    {
+        receiver(Parcelport& pp, std::int32_t here, std::size_t ring_size)
+          : pp_(pp)
+          , here_(here)
+          , segment_(create_segment(here, ring_size))
+          , ring_(ring::create(segment_, ring_size))
+        {
+        }
+
+        // Remove the inbound segment and all heap segments which were not
+        // consumed, no other locality can connect to this one afterwards.
+        void stop() noexcept
+        {
+            unlink_segments(here_);
+        }
+
+        bool background_work()
+        {
+            // Copy the next message out of the ring (or take note of the
+            // segment holding it) to release the ring as early as possible.
+            message_header header;
+            std::vector<char> data;
+
+            bool received = false;
+            {
+                std::unique_lock l(mtx_, std::try_to_lock);
+                if (!l.owns_lock())
+                {
+                    return false;
+                }
+
+                received =
+                    ring_.try_read([&](char const* src, std::size_t size) {
+                        HPX_ASSERT(size >= sizeof(message_header));
+                        std::memcpy(&header, src, sizeof(message_header));
+                        if (header.heap_id_ == 0)
+                        {
+                            src += sizeof(message_header);
+                            HPX_ASSERT(size ==
+                                sizeof(message_header) + header.size_);
+                            data.assign(src, src + header.size_);
+                        }
+                    });
+            }
+
+            if (!received)
+            {
+                return false;
+            }
+
+            std::size_t const size = static_cast<std::size_t>(header.size_);
+            if (header.heap_id_ == 0)
+            {
+                decode(data.data(), size);
+            }
+            else
+            {
+                // decode the message directly from the segment it was
+                // written to, the segment is released once it's unmapped
+                segment heap = segment::open(
+                    heap_segment_name(here_, header.source_, header.heap_id_));
+                heap.unlink();
+
+                HPX_ASSERT(heap.size() >= size);
+                decode(heap.data(), size);
+            }
+            return true;
+        }
+
+    private:
+        static segment create_segment(std::int32_t here, std::size_t ring_size)
+        {
+            // Clean up after localities which terminated abnormally, this
+            // includes a previous process which had the same process id.
+            unlink_stale_segments();
+            unlink_segments(here);
+
+            return segment::create(
+                segment_name(here), ring::segment_size(ring_size));
+        }
+
+        void decode(char* data, std::size_t size)
+        {
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            hpx::chrono::high_resolution_timer timer;
+#endif
+            receive_buffer_type buffer = read_payload(data, size);
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer.data_point_.bytes_ = size;
+            buffer.data_point_.time_ = timer.elapsed_nanoseconds();
+#endif
+            decode_parcels(pp_, HPX_MOVE(buffer), -1);
+        }
+
+        Parcelport& pp_;
+        std::int32_t here_;
+
+        hpx::spinlock mtx_;
+        segment segment_;
+        ring ring_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,158 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <hpx/parcelport_shmem/segment.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // The ring buffer is shared between processes, it relies on the atomics
+    // being address free.
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free);
+    static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A multi-producer, single-consumer ring buffer of variable sized frames
+    // living in a shared memory segment. Writers (possibly in different
+    // processes) serialize on a spinlock stored in the segment, the reader
+    // does not take the lock. The spinlock holds the process id of its
+    // owner, the lock of a process which died while writing is taken over
+    // by the next writer. Frames never wrap around the end of the buffer,
+    // if a frame does not fit into the remaining space at the end a padding
+    // frame is inserted and the frame is placed at the start of the buffer.
+    class HPX_EXPORT ring
+    {
+    public:
+        static constexpr std::size_t frame_alignment = 16;
+
+        struct frame
+        {
+            std::uint64_t size_;
+            std::uint64_t padding_;
+        };
+
+        static_assert(sizeof(frame) == frame_alignment);
+
+        ring() noexcept
+          : control_(nullptr)
+          , data_(nullptr)
+        {
+        }
+
+        // The size of the segment needed for a ring of the given capacity.
+        static std::size_t segment_size(std::size_t capacity) noexcept;
+
+        // Initialize the ring in a newly created segment, the capacity is
+        // rounded up to the next power of two.
+        static ring create(segment const& seg, std::size_t capacity);
+
+        // Attach to a ring which was created by another process.
+        static ring attach(segment const& seg, error_code& ec = throws);
+
+        explicit operator bool() const noexcept
+        {
+            return control_ != nullptr;
+        }
+
+        std::size_t capacity() const noexcept;
+
+        // Return whether a frame of the given size can be written at all,
+        // larger messages have to be transferred out of band.
+        bool fits(std::size_t size) const noexcept
+        {
+            return frame_size(size) <= capacity() / 2;
+        }
+
+        // Write a frame of the given size, the supplied function is invoked
+        // with the address the frame data has to be written to. Returns
+        // false (without invoking the function) if the ring has not enough
+        // free space left.
+        template <typename F>
+        bool try_write(std::size_t size, F&& f)
+        {
+            HPX_ASSERT(fits(size));
+
+            lock();
+            char* dest = reserve(size);
+            if (dest == nullptr)
+            {
+                unlock();
+                return false;
+            }
+
+            f(dest);
+
+            commit(size);
+            unlock();
+            return true;
+        }
+
+        // Read the next frame, the supplied function is invoked with the
+        // address and the size of the frame data. The frame is released once
+        // the function returns. Returns false if the ring is empty. Throws
+        // if the frame headers are inconsistent with the state of the ring.
+        // This must not be called concurrently.
+        template <typename F>
+        bool try_read(F&& f)
+        {
+            std::size_t size = 0;
+            char const* src = front(size);
+            if (src == nullptr)
+            {
+                return false;
+            }
+
+            f(src, size);
+
+            pop(size);
+            return true;
+        }
+
+        bool empty() const noexcept;
+
+    private:
+        struct control;
+
+        ring(control* ctrl, char* data) noexcept
+          : control_(ctrl)
+          , data_(data)
+        {
+        }
+
+        static std::size_t data_offset() noexcept;
+
+        static constexpr std::size_t frame_size(std::size_t size) noexcept
+        {
+            return (sizeof(frame) + size + frame_alignment - 1) &
+                ~(frame_alignment - 1);
+        }
+
+        void lock() noexcept;
+        void unlock() noexcept;
+
+        char* reserve(std::size_t size) noexcept;
+        void commit(std::size_t size) noexcept;
+
+        char const* front(std::size_t& size);
+        void pop(std::size_t size) noexcept;
+
+        control* control_;
+        char* data_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,93 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/errors.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // A named POSIX shared memory segment mapped into the address space of
+    // this process. The mapping is released when the segment object is
+    // destroyed, the name stays valid until unlink() is called.
+    class HPX_EXPORT segment
+    {
+    public:
+        segment() noexcept
+          : data_(nullptr)
+          , size_(0)
+        {
+        }
+
+        // Create a new segment of the given size. A stale segment of the same
+        // name (left behind by a process which terminated abnormally) is
+        // replaced.
+        static segment create(std::string const& name, std::size_t size,
+            error_code& ec = throws);
+
+        // Map an existing segment.
+        static segment open(std::string const& name, error_code& ec = throws);
+
+        segment(segment&& rhs) noexcept;
+        segment& operator=(segment&& rhs) noexcept;
+
+        segment(segment const&) = delete;
+        segment& operator=(segment const&) = delete;
+
+        ~segment();
+
+        // Remove the name of the segment, the memory stays mapped until all
+        // processes have released their mappings.
+        void unlink() noexcept;
+
+        std::string const& name() const noexcept
+        {
+            return name_;
+        }
+
+        char* data() const noexcept
+        {
+            return static_cast<char*>(data_);
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return data_ != nullptr;
+        }
+
+    private:
+        segment(std::string name, void* data, std::size_t size) noexcept;
+
+        void release() noexcept;
+
+        std::string name_;
+        void* data_;
+        std::size_t size_;
+    };
+
+    // Remove the inbound segment of the locality running in the given
+    // process and all heap segments addressed to it which were not consumed.
+    HPX_EXPORT void unlink_segments(std::int32_t pid) noexcept;
+
+    // Remove all segments addressed to processes which are not running
+    // anymore, those are left behind by localities which terminated
+    // abnormally.
+    HPX_EXPORT void unlink_stale_segments() noexcept;
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,311 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/message.hpp>
+#include <hpx/parcelport_shmem/ring.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+#include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset/parcelset_fwd.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    struct sender;
+    struct sender_connection;
+
+    void add_connection(sender*, std::shared_ptr<sender_connection> const&);
+    std::uint64_t next_heap_id(sender*) noexcept;
+
+    // The inbound ring of another locality on this node, shared by all
+    // connections to that locality.
+    struct outbound_ring
+    {
+        segment segment_;
+        ring ring_;
+    };
+
+    struct sender_connection
+      : parcelset::parcelport_connection<sender_connection, std::vector<char>>
+    {
+    private:
+        using sender_type = sender;
+        using data_type = std::vector<char>;
+        using base_type =
+            parcelset::parcelport_connection<sender_connection, data_type>;
+
+    public:
+        sender_connection(sender_type* s, std::int32_t here,
+            locality const& there, std::shared_ptr<outbound_ring> outbound,
+            parcelset::parcelport* pp)
+          : sender_(s)
+          , here_(here)
+          , dest_(there.pid())
+          , ring_(HPX_MOVE(outbound))
+          , header_{0, 0, here, 0}
+          , pp_(pp)
+          , there_(parcelset::locality(there))
+        {
+        }
+
+        parcelset::locality const& destination() const noexcept
+        {
+            return there_;
+        }
+
+        constexpr void verify_(
+            parcelset::locality const& /* parcel_locality_id */) const noexcept
+        {
+        }
+
+        template <typename Handler, typename ParcelPostprocess>
+        void async_write(
+            Handler&& handler, ParcelPostprocess&& parcel_postprocess)
+        {
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!postprocess_handler_);
+            HPX_ASSERT(!buffer_.data_.empty());
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ =
+                hpx::chrono::high_resolution_clock::now();
+#endif
+            header_.heap_id_ = 0;
+            header_.size_ = payload_size(buffer_);
+
+            // Messages carrying zero-copy chunks and messages too large for
+            // the ring are written to a separate segment right away, the
+            // receiver decodes those directly from that segment.
+            if (buffer_.num_chunks_.first != 0 ||
+                !ring_->ring_.fits(sizeof(message_header) + header_.size_))
+            {
+                write_heap();
+            }
+
+            handler_ = HPX_FORWARD(Handler, handler);
+
+            if (!send())
+            {
+                postprocess_handler_ =
+                    HPX_FORWARD(ParcelPostprocess, parcel_postprocess);
+                add_connection(sender_, shared_from_this());
+            }
+            else
+            {
+                HPX_ASSERT(!handler_);
+                error_code ec;
+                parcel_postprocess(ec, there_, shared_from_this());
+            }
+        }
+
+        // Try to append the message to the ring of the destination, returns
+        // false if the ring is currently full.
+        bool send()
+        {
+            std::size_t const size = header_.heap_id_ == 0 ?
+                sizeof(message_header) + header_.size_ :
+                sizeof(message_header);
+
+            bool const sent = ring_->ring_.try_write(size, [this](char* dest) {
+                std::memcpy(dest, &header_, sizeof(message_header));
+                if (header_.heap_id_ == 0)
+                {
+                    write_payload(buffer_, dest + sizeof(message_header));
+                }
+            });
+
+            if (!sent)
+            {
+                return false;
+            }
+
+            done();
+            return true;
+        }
+
+        void done()
+        {
+            error_code ec(throwmode::lightweight);
+            handler_(ec);
+            handler_.reset();
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.bytes_ = header_.size_;
+            buffer_.data_point_.time_ =
+                hpx::chrono::high_resolution_clock::now() -
+                buffer_.data_point_.time_;
+            pp_->add_sent_data(buffer_.data_point_);
+#endif
+            buffer_.clear();
+        }
+
+        hpx::move_only_function<void(error_code const&,
+            parcelset::locality const&, std::shared_ptr<sender_connection>)>
+            postprocess_handler_;
+
+    private:
+        void write_heap()
+        {
+            header_.heap_id_ = next_heap_id(sender_);
+
+            segment heap = segment::create(
+                heap_segment_name(dest_, here_, header_.heap_id_),
+                header_.size_);
+            write_payload(buffer_, heap.data());
+        }
+
+        sender_type* sender_;
+        std::int32_t here_;
+        std::int32_t dest_;
+        std::shared_ptr<outbound_ring> ring_;
+
+        message_header header_;
+        hpx::move_only_function<void(error_code const&)> handler_;
+
+        parcelset::parcelport* pp_;
+
+        parcelset::locality there_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct sender
+    {
+        using connection_type = sender_connection;
+        using connection_ptr = std::shared_ptr<connection_type>;
+        using connection_list = std::deque<connection_ptr>;
+
+        explicit sender(std::int32_t here) noexcept
+          : here_(here)
+          , next_heap_id_(0)
+        {
+        }
+
+        connection_ptr create_connection(
+            locality const& there, parcelset::parcelport* pp, error_code& ec)
+        {
+            std::shared_ptr<outbound_ring> outbound = connect(there, ec);
+            if (!outbound)
+            {
+                return connection_ptr();
+            }
+            return std::make_shared<connection_type>(
+                this, here_, there, HPX_MOVE(outbound), pp);
+        }
+
+        void add(connection_ptr const& ptr)
+        {
+            std::unique_lock l(connections_mtx_);
+            connections_.push_back(ptr);
+        }
+
+        std::uint64_t next_heap_id() noexcept
+        {
+            return ++next_heap_id_;
+        }
+
+        void send_messages(connection_ptr connection)
+        {
+            if (connection->send())
+            {
+                error_code ec(throwmode::lightweight);
+                hpx::move_only_function<void(error_code const&,
+                    parcelset::locality const&, connection_ptr)>
+                    postprocess_handler;
+                std::swap(
+                    postprocess_handler, connection->postprocess_handler_);
+                postprocess_handler(ec, connection->destination(), connection);
+            }
+            else
+            {
+                std::unique_lock l(connections_mtx_);
+                connections_.push_back(HPX_MOVE(connection));
+            }
+        }
+
+        bool background_work()
+        {
+            connection_ptr connection;
+            {
+                std::unique_lock l(connections_mtx_, std::try_to_lock);
+                if (l && !connections_.empty())
+                {
+                    connection = HPX_MOVE(connections_.front());
+                    connections_.pop_front();
+                }
+            }
+
+            if (connection)
+            {
+                send_messages(HPX_MOVE(connection));
+                return true;
+            }
+            return false;
+        }
+
+    private:
+        // Map the inbound ring of the given locality, the mapping is kept
+        // for as long as this parcelport is alive.
+        std::shared_ptr<outbound_ring> connect(
+            locality const& there, error_code& ec)
+        {
+            std::unique_lock l(rings_mtx_);
+
+            auto it = rings_.find(there.pid());
+            if (it != rings_.end())
+            {
+                return it->second;
+            }
+
+            auto outbound = std::make_shared<outbound_ring>();
+            outbound->segment_ = segment::open(segment_name(there.pid()), ec);
+            if (ec)
+            {
+                return nullptr;
+            }
+
+            outbound->ring_ = ring::attach(outbound->segment_, ec);
+            if (ec)
+            {
+                return nullptr;
+            }
+
+            rings_.emplace(there.pid(), outbound);
+            return outbound;
+        }
+
+        std::int32_t here_;
+        std::atomic<std::uint64_t> next_heap_id_;
+
+        hpx::spinlock rings_mtx_;
+        std::map<std::int32_t, std::shared_ptr<outbound_ring>> rings_;
+
+        hpx::spinlock connections_mtx_;
+        connection_list connections_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
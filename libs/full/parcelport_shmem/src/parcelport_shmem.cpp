@@ -0,0 +1,292 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/util.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+
+#include <hpx/command_line_handling/command_line_handling.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelset/parcelport_impl.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+#include <hpx/plugin_factories/parcelport_factory.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include <unistd.h>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    namespace policies::shmem {
+        class HPX_EXPORT parcelport;
+    }    // namespace policies::shmem
+
+    template <>
+    struct connection_handler_traits<policies::shmem::parcelport>
+    {
+        using connection_type = policies::shmem::sender_connection;
+        using send_early_parcel = std::false_type;
+        using do_background_work = std::true_type;
+        using send_immediate_parcels = std::false_type;
+
+        static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        static constexpr const char* pool_name() noexcept
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static constexpr const char* pool_name_postfix() noexcept
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies::shmem {
+
+        void add_connection(
+            sender* s, std::shared_ptr<sender_connection> const& ptr)
+        {
+            s->add(ptr);
+        }
+
+        std::uint64_t next_heap_id(sender* s) noexcept
+        {
+            return s->next_heap_id();
+        }
+
+        class HPX_EXPORT parcelport : public parcelport_impl<parcelport>
+        {
+            using base_type = parcelport_impl<parcelport>;
+
+            static std::string host_name()
+            {
+                char name[256] = {};
+                if (::gethostname(name, sizeof(name) - 1) != 0)
+                {
+                    return "localhost";
+                }
+                return name;
+            }
+
+            static parcelset::locality here()
+            {
+                return parcelset::locality(locality(
+                    host_name(), static_cast<std::int32_t>(::getpid())));
+            }
+
+            static std::size_t ring_size(
+                util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.ring_size", 1048576);
+            }
+
+            static std::size_t background_threads(
+                util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.background_threads", -1);
+            }
+
+        public:
+            parcelport(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier)
+              : base_type(ini, here(), notifier)
+              , stopped_(false)
+              , sender_(base_type::here().get<locality>().pid())
+              , receiver_(*this, base_type::here().get<locality>().pid(),
+                    ring_size(ini))
+              , background_threads_(background_threads(ini))
+            {
+            }
+
+            // Start the handling of connections.
+            bool do_run()
+            {
+                for (std::size_t i = 0; i != io_service_pool_.size(); ++i)
+                {
+                    io_service_pool_.get_io_service(int(i)).post(
+                        hpx::bind(&parcelport::io_service_work, this));
+                }
+                return true;
+            }
+
+            // Stop the handling of connections.
+            void do_stop()
+            {
+                while (do_background_work(0, parcelport_background_mode_all))
+                {
+                    if (threads::get_self_ptr())
+                        hpx::this_thread::suspend(
+                            hpx::threads::thread_schedule_state::pending,
+                            "shmem::parcelport::do_stop");
+                }
+                stopped_ = true;
+                receiver_.stop();
+            }
+
+            /// Return the name of this locality
+            std::string get_locality_name() const override
+            {
+                return host_name();
+            }
+
+            // Parcels are sent through shared memory only if the destination
+            // runs on the same host, all other destinations are left to the
+            // remaining parcelports.
+            bool can_connect(parcelset::locality const& dest,
+                bool /* use_alternative_parcelport */) override
+            {
+                return dest.get<locality>().host() ==
+                    base_type::here().get<locality>().host();
+            }
+
+            std::shared_ptr<sender_connection> create_connection(
+                parcelset::locality const& l, error_code& ec)
+            {
+                return sender_.create_connection(l.get<locality>(), this, ec);
+            }
+
+            // This parcelport can't be used for bootstrapping the runtime,
+            // there is no AGAS locality to connect to.
+            parcelset::locality agas_locality(
+                util::runtime_configuration const&) const override
+            {
+                return parcelset::locality(locality());
+            }
+
+            parcelset::locality create_locality() const override
+            {
+                return parcelset::locality(locality());
+            }
+
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode)
+            {
+                if (stopped_ || num_thread >= background_threads_)
+                {
+                    return false;
+                }
+
+                bool has_work = false;
+                if (mode & parcelport_background_mode_send)
+                {
+                    has_work = sender_.background_work();
+                }
+                if (mode & parcelport_background_mode_receive)
+                {
+                    has_work = receiver_.background_work() || has_work;
+                }
+                return has_work;
+            }
+
+        private:
+            std::atomic<bool> stopped_;
+
+            sender sender_;
+            receiver<parcelport> receiver_;
+
+            void io_service_work()
+            {
+                std::size_t k = 0;
+
+                // We only execute work on the IO service while HPX is starting
+                while (hpx::is_starting())
+                {
+                    bool has_work = sender_.background_work();
+                    has_work = receiver_.background_work() || has_work;
+                    if (has_work)
+                    {
+                        k = 0;
+                    }
+                    else
+                    {
+                        ++k;
+                        util::detail::yield_k(k,
+                            "hpx::parcelset::policies::shmem::parcelport::"
+                            "io_service_work");
+                    }
+                }
+            }
+
+            std::size_t background_threads_;
+        };
+    }    // namespace policies::shmem
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+namespace hpx::traits {
+
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.parcel.shmem]
+    //      ...
+    //      priority = 200
+    //
+    // The priority is higher than the priority of all other parcelports,
+    // which makes sure this parcelport is used whenever the destination runs
+    // on the same host.
+    template <>
+    struct plugin_config_data<hpx::parcelset::policies::shmem::parcelport>
+    {
+        static constexpr char const* priority() noexcept
+        {
+            return "200";
+        }
+
+        static constexpr void init(int* /* argc */, char*** /* argv */,
+            util::command_line_handling& /* cfg */) noexcept
+        {
+        }
+
+        // by default no additional initialization using the resource
+        // partitioner is required
+        static constexpr void init(hpx::resource::partitioner&) noexcept {}
+
+        static constexpr void destroy() noexcept {}
+
+        static constexpr char const* call() noexcept
+        {
+            return
+                // size of the inbound ring buffer of each locality
+                "ring_size = ${HPX_HAVE_PARCELPORT_SHMEM_RING_SIZE:1048576}\n"
+
+                // number of cores that do background work, default: all
+                "background_threads = "
+                "${HPX_HAVE_PARCELPORT_SHMEM_BACKGROUND_THREADS:-1}\n";
+        }
+    };
+}    // namespace hpx::traits
+
+HPX_REGISTER_PARCELPORT(hpx::parcelset::policies::shmem::parcelport, shmem)
+
+#endif
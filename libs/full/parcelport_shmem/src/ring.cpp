@@ -0,0 +1,276 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/execution_base.hpp>
+
+#include <hpx/parcelport_shmem/ring.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include <signal.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // The control block at the start of the segment, followed by the frame
+    // data. The indices are monotonically increasing byte counts, the
+    // position of a frame is derived by masking with the capacity.
+    struct ring::control
+    {
+        static constexpr std::uint64_t magic_value = 0x6870782d73686d31;
+
+        std::uint64_t magic_;
+        std::uint64_t capacity_;
+
+        // the process id of the writer holding the lock, zero if unlocked
+        alignas(threads::get_cache_line_size()) std::atomic<std::uint32_t>
+            lock_;
+        alignas(threads::get_cache_line_size()) std::atomic<std::uint64_t>
+            write_;
+        alignas(threads::get_cache_line_size()) std::atomic<std::uint64_t>
+            read_;
+    };
+
+    namespace {
+
+        std::size_t round_up_capacity(std::size_t capacity) noexcept
+        {
+            std::size_t result = 4096;
+            while (result < capacity)
+            {
+                result *= 2;
+            }
+            return result;
+        }
+
+        bool is_process_alive(std::uint32_t pid) noexcept
+        {
+            return ::kill(static_cast<pid_t>(pid), 0) == 0 || errno != ESRCH;
+        }
+
+        // number of unsuccessful attempts to acquire the lock after which
+        // the owner of the lock is checked for being alive
+        constexpr std::size_t owner_check_interval = 128;
+    }    // namespace
+
+    std::size_t ring::data_offset() noexcept
+    {
+        constexpr std::size_t cache_line_size = threads::get_cache_line_size();
+        return (sizeof(control) + cache_line_size - 1) &
+            ~(cache_line_size - 1);
+    }
+
+    std::size_t ring::segment_size(std::size_t capacity) noexcept
+    {
+        return data_offset() + round_up_capacity(capacity);
+    }
+
+    ring ring::create(segment const& seg, std::size_t capacity)
+    {
+        capacity = round_up_capacity(capacity);
+        HPX_ASSERT(seg.size() >= data_offset() + capacity);
+
+        control* ctrl = new (seg.data()) control;
+        ctrl->capacity_ = capacity;
+        ctrl->lock_.store(0, std::memory_order_relaxed);
+        ctrl->write_.store(0, std::memory_order_relaxed);
+        ctrl->read_.store(0, std::memory_order_relaxed);
+        ctrl->magic_ = control::magic_value;
+
+        std::atomic_thread_fence(std::memory_order_release);
+
+        return ring(ctrl, seg.data() + data_offset());
+    }
+
+    ring ring::attach(segment const& seg, error_code& ec)
+    {
+        control* ctrl = reinterpret_cast<control*>(seg.data());
+        if (seg.size() < data_offset() ||
+            ctrl->magic_ != control::magic_value ||
+            seg.size() < data_offset() + ctrl->capacity_)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error, "shmem::ring::attach",
+                "shared memory segment {} does not hold a valid ring buffer",
+                seg.name());
+            return ring();
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return ring(ctrl, seg.data() + data_offset());
+    }
+
+    std::size_t ring::capacity() const noexcept
+    {
+        return control_->capacity_;
+    }
+
+    bool ring::empty() const noexcept
+    {
+        return control_->read_.load(std::memory_order_relaxed) ==
+            control_->write_.load(std::memory_order_acquire);
+    }
+
+    void ring::lock() noexcept
+    {
+        std::uint32_t const self = static_cast<std::uint32_t>(::getpid());
+        for (std::size_t k = 0; /**/; ++k)
+        {
+            std::uint32_t owner = 0;
+            if (control_->lock_.compare_exchange_weak(owner, self,
+                    std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                return;
+            }
+
+            // A writer publishes its frame only after it was written
+            // completely, thus the ring is consistent even if the owner of
+            // the lock died while writing. Its lock is taken over.
+            if (owner != 0 && owner != self &&
+                k % owner_check_interval == owner_check_interval - 1 &&
+                !is_process_alive(owner) &&
+                control_->lock_.compare_exchange_strong(owner, self,
+                    std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                return;
+            }
+
+            hpx::execution_base::this_thread::yield_k(
+                k, "hpx::parcelset::policies::shmem::ring::lock");
+        }
+    }
+
+    void ring::unlock() noexcept
+    {
+        control_->lock_.store(0, std::memory_order_release);
+    }
+
+    char* ring::reserve(std::size_t size) noexcept
+    {
+        std::size_t const capacity = control_->capacity_;
+        std::size_t const needed = frame_size(size);
+
+        std::uint64_t write = control_->write_.load(std::memory_order_relaxed);
+        std::uint64_t const read =
+            control_->read_.load(std::memory_order_acquire);
+
+        std::size_t pos = static_cast<std::size_t>(write) & (capacity - 1);
+        std::size_t const contiguous = capacity - pos;
+        std::size_t const padding = needed > contiguous ? contiguous : 0;
+
+        if (write - read + padding + needed > capacity)
+        {
+            return nullptr;
+        }
+
+        if (padding != 0)
+        {
+            // skip the remaining space at the end of the buffer
+            frame* f = reinterpret_cast<frame*>(data_ + pos);
+            f->size_ = padding - sizeof(frame);
+            f->padding_ = 1;
+
+            write += padding;
+            control_->write_.store(write, std::memory_order_release);
+            pos = 0;
+        }
+
+        frame* f = reinterpret_cast<frame*>(data_ + pos);
+        f->size_ = size;
+        f->padding_ = 0;
+
+        return reinterpret_cast<char*>(f + 1);
+    }
+
+    void ring::commit(std::size_t size) noexcept
+    {
+        std::uint64_t const write =
+            control_->write_.load(std::memory_order_relaxed);
+        control_->write_.store(
+            write + frame_size(size), std::memory_order_release);
+    }
+
+    char const* ring::front(std::size_t& size)
+    {
+        std::size_t const capacity = control_->capacity_;
+        std::uint64_t read = control_->read_.load(std::memory_order_relaxed);
+
+        for (;;)
+        {
+            std::uint64_t const write =
+                control_->write_.load(std::memory_order_acquire);
+            if (read == write)
+            {
+                return nullptr;
+            }
+
+            // the frame header is written by another process, it has to be
+            // consistent with the published part of the ring before it is
+            // used to access the frame data
+            std::size_t const pos =
+                static_cast<std::size_t>(read) & (capacity - 1);
+            std::size_t const contiguous = capacity - pos;
+            std::uint64_t const available = write - read;
+
+            frame const* f = reinterpret_cast<frame const*>(data_ + pos);
+            std::uint64_t const data_size = f->size_;
+            bool const is_padding = f->padding_ != 0;
+
+            bool valid = available >= sizeof(frame);
+            if (valid && is_padding)
+            {
+                // padding always extends to the end of the buffer
+                valid = data_size == contiguous - sizeof(frame) &&
+                    contiguous <= available;
+            }
+            else if (valid)
+            {
+                valid = data_size <= contiguous - sizeof(frame) &&
+                    frame_size(static_cast<std::size_t>(data_size)) <=
+                        available;
+            }
+
+            if (!valid)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::network_error,
+                    "hpx::parcelset::policies::shmem::ring::front",
+                    "invalid frame header in the shared memory ring buffer");
+            }
+
+            if (!is_padding)
+            {
+                size = static_cast<std::size_t>(data_size);
+                return reinterpret_cast<char const*>(f + 1);
+            }
+
+            read += contiguous;
+            control_->read_.store(read, std::memory_order_release);
+        }
+    }
+
+    void ring::pop(std::size_t size) noexcept
+    {
+        std::uint64_t const read =
+            control_->read_.load(std::memory_order_relaxed);
+        control_->read_.store(
+            read + frame_size(size), std::memory_order_release);
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
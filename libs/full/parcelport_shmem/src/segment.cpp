@@ -0,0 +1,245 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/type_support.hpp>
+
+#include <hpx/parcelport_shmem/message.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#if defined(__linux__)
+#include <dirent.h>
+#endif
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace hpx::parcelset::policies::shmem {
+
+    segment::segment(std::string name, void* data, std::size_t size) noexcept
+      : name_(HPX_MOVE(name))
+      , data_(data)
+      , size_(size)
+    {
+    }
+
+    segment::segment(segment&& rhs) noexcept
+      : name_(HPX_MOVE(rhs.name_))
+      , data_(std::exchange(rhs.data_, nullptr))
+      , size_(std::exchange(rhs.size_, 0))
+    {
+    }
+
+    segment& segment::operator=(segment&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            release();
+            name_ = HPX_MOVE(rhs.name_);
+            data_ = std::exchange(rhs.data_, nullptr);
+            size_ = std::exchange(rhs.size_, 0);
+        }
+        return *this;
+    }
+
+    segment::~segment()
+    {
+        release();
+    }
+
+    void segment::release() noexcept
+    {
+        if (data_ != nullptr)
+        {
+            ::munmap(data_, size_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+    }
+
+    segment segment::create(
+        std::string const& name, std::size_t size, error_code& ec)
+    {
+        ::shm_unlink(name.c_str());
+
+        int const fd = ::shm_open(
+            name.c_str(), O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::segment::create",
+                "could not create shared memory segment {}: {}", name,
+                std::strerror(errno));
+            return segment();
+        }
+
+        if (::ftruncate(fd, static_cast<off_t>(size)) == -1)
+        {
+            int const err = errno;
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::segment::create",
+                "could not resize shared memory segment {} to {} bytes: {}",
+                name, size, std::strerror(err));
+            return segment();
+        }
+
+        void* data =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int const err = errno;
+        ::close(fd);
+
+        if (data == MAP_FAILED)
+        {
+            ::shm_unlink(name.c_str());
+
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shmem::segment::create",
+                "could not map shared memory segment {}: {}", name,
+                std::strerror(err));
+            return segment();
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return segment(name, data, size);
+    }
+
+    segment segment::open(std::string const& name, error_code& ec)
+    {
+        int const fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error, "shmem::segment::open",
+                "could not open shared memory segment {}: {}", name,
+                std::strerror(errno));
+            return segment();
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) == -1)
+        {
+            int const err = errno;
+            ::close(fd);
+
+            HPX_THROWS_IF(ec, hpx::error::network_error, "shmem::segment::open",
+                "could not determine the size of shared memory segment {}: {}",
+                name, std::strerror(err));
+            return segment();
+        }
+
+        std::size_t const size = static_cast<std::size_t>(st.st_size);
+        void* data =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int const err = errno;
+        ::close(fd);
+
+        if (data == MAP_FAILED)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error, "shmem::segment::open",
+                "could not map shared memory segment {}: {}", name,
+                std::strerror(err));
+            return segment();
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return segment(name, data, size);
+    }
+
+    void segment::unlink() noexcept
+    {
+        if (!name_.empty())
+        {
+            ::shm_unlink(name_.c_str());
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        // Return the process id of the locality the segment with the given
+        // name (as listed in /dev/shm, without the leading slash) is
+        // addressed to, or zero if it's not a segment of this parcelport.
+        std::int32_t segment_owner(char const* name) noexcept
+        {
+            char const* prefix = segment_prefix + 1;
+            std::size_t const prefix_len = std::strlen(prefix);
+            if (std::strncmp(name, prefix, prefix_len) != 0)
+            {
+                return 0;
+            }
+
+            char* end = nullptr;
+            long const pid = std::strtol(name + prefix_len, &end, 10);
+            if (end == name + prefix_len || (*end != '\0' && *end != '.') ||
+                pid <= 0)
+            {
+                return 0;
+            }
+            return static_cast<std::int32_t>(pid);
+        }
+
+        template <typename F>
+        void unlink_segments_if(F&& f) noexcept
+        {
+#if defined(__linux__)
+            DIR* dir = ::opendir("/dev/shm");
+            if (dir == nullptr)
+            {
+                return;
+            }
+
+            while (dirent const* entry = ::readdir(dir))
+            {
+                std::int32_t const pid = segment_owner(entry->d_name);
+                if (pid != 0 && f(pid))
+                {
+                    std::string const name = std::string("/") + entry->d_name;
+                    ::shm_unlink(name.c_str());
+                }
+            }
+            ::closedir(dir);
+#else
+            // the names of shared memory segments can't be enumerated
+            HPX_UNUSED(f);
+#endif
+        }
+    }    // namespace
+
+    void unlink_segments(std::int32_t pid) noexcept
+    {
+        ::shm_unlink(segment_name(pid).c_str());
+        unlink_segments_if([&](std::int32_t owner) { return owner == pid; });
+    }
+
+    void unlink_stale_segments() noexcept
+    {
+        unlink_segments_if([](std::int32_t owner) {
+            return ::kill(static_cast<pid_t>(owner), 0) == -1 &&
+                errno == ESRCH;
+        });
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
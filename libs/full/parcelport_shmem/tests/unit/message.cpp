@@ -0,0 +1,157 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <hpx/parcelport_shmem/message.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace hpx::parcelset::policies::shmem;
+
+using send_buffer_type = hpx::parcelset::parcel_buffer<std::vector<char>>;
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<char> make_data(std::size_t size, char first)
+{
+    std::vector<char> data(size);
+    std::iota(data.begin(), data.end(), first);
+    return data;
+}
+
+// Encode the buffer into suitably aligned memory.
+std::vector<std::uint64_t> encode(send_buffer_type const& buffer)
+{
+    std::size_t const size = payload_size(buffer);
+    HPX_TEST_EQ(size % detail::payload_alignment, std::size_t(0));
+
+    std::vector<std::uint64_t> payload(size / sizeof(std::uint64_t));
+    write_payload(buffer, reinterpret_cast<char*>(payload.data()));
+    return payload;
+}
+
+bool equal(buffer_view const& view, std::vector<char> const& data)
+{
+    return view.size() == data.size() &&
+        std::memcmp(view.data(), data.data(), data.size()) == 0;
+}
+
+// The parts of the payload start at aligned offsets.
+bool aligned(std::vector<std::uint64_t> const& payload, char const* p)
+{
+    char const* begin = reinterpret_cast<char const*>(payload.data());
+    return static_cast<std::size_t>(p - begin) % detail::payload_alignment ==
+        0;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Messages without zero-copy chunks hold the serialized data only.
+void test_data_only()
+{
+    send_buffer_type buffer(make_data(123, 'a'));
+
+    std::vector<std::uint64_t> payload = encode(buffer);
+    std::size_t const size = payload.size() * sizeof(std::uint64_t);
+    HPX_TEST_EQ(size,
+        detail::align(sizeof(payload_header)) + detail::align(123));
+
+    receive_buffer_type received =
+        read_payload(reinterpret_cast<char*>(payload.data()), size);
+
+    HPX_TEST_EQ(received.num_chunks_.first, std::uint32_t(0));
+    HPX_TEST_EQ(received.num_chunks_.second, std::uint32_t(0));
+    HPX_TEST(received.transmission_chunks_.empty());
+    HPX_TEST(received.chunks_.empty());
+    HPX_TEST_EQ(received.size_, size);
+    HPX_TEST_EQ(received.data_size_, std::uint64_t(123));
+    HPX_TEST(equal(received.data_, buffer.data_));
+    HPX_TEST(aligned(payload, received.data_.data()));
+}
+
+// Zero-copy chunks are stored after the serialized data, the decoded buffer
+// refers to them in place.
+void test_zero_copy_chunks()
+{
+    namespace serialization = hpx::serialization;
+
+    std::vector<char> const chunk1 = make_data(100, 'A');
+    std::vector<char> const chunk2 = make_data(3000, '0');
+
+    send_buffer_type buffer(make_data(57, 'a'));
+    buffer.chunks_.push_back(serialization::create_index_chunk(0, 16));
+    buffer.chunks_.push_back(
+        serialization::create_pointer_chunk(chunk1.data(), chunk1.size()));
+    buffer.chunks_.push_back(serialization::create_index_chunk(16, 8));
+    buffer.chunks_.push_back(
+        serialization::create_pointer_chunk(chunk2.data(), chunk2.size()));
+
+    // the zero-copy chunks first, followed by the non-zero-copy ones
+    buffer.transmission_chunks_ = {{1, chunk1.size()}, {3, chunk2.size()},
+        {0, 16}, {2, 8}};
+    buffer.num_chunks_ = send_buffer_type::count_chunks_type(2, 2);
+
+    std::vector<std::uint64_t> payload = encode(buffer);
+    std::size_t const size = payload.size() * sizeof(std::uint64_t);
+    HPX_TEST_EQ(size,
+        detail::align(sizeof(payload_header) +
+            4 * sizeof(send_buffer_type::transmission_chunk_type)) +
+            detail::align(57) + detail::align(chunk1.size()) +
+            detail::align(chunk2.size()));
+
+    receive_buffer_type received =
+        read_payload(reinterpret_cast<char*>(payload.data()), size);
+
+    HPX_TEST_EQ(received.num_chunks_.first, std::uint32_t(2));
+    HPX_TEST_EQ(received.num_chunks_.second, std::uint32_t(2));
+    HPX_TEST(received.transmission_chunks_ == buffer.transmission_chunks_);
+    HPX_TEST_EQ(received.size_, size);
+    HPX_TEST_EQ(received.data_size_, std::uint64_t(57));
+    HPX_TEST(equal(received.data_, buffer.data_));
+
+    HPX_TEST_EQ(received.chunks_.size(), std::size_t(2));
+    HPX_TEST(equal(received.chunks_[0], chunk1));
+    HPX_TEST(equal(received.chunks_[1], chunk2));
+
+    // the chunks are decoded in place
+    char const* begin = reinterpret_cast<char const*>(payload.data());
+    HPX_TEST(received.chunks_[1].data() >= begin &&
+        received.chunks_[1].data() + chunk2.size() <= begin + size);
+    HPX_TEST(aligned(payload, received.chunks_[0].data()));
+    HPX_TEST(aligned(payload, received.chunks_[1].data()));
+}
+
+void test_segment_names()
+{
+    HPX_TEST_EQ(segment_name(1234), std::string("/hpx.shmem.1234"));
+    HPX_TEST_EQ(
+        heap_segment_name(1234, 42, 7), std::string("/hpx.shmem.1234.42.7"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_data_only();
+    test_zero_copy_chunks();
+    test_segment_names();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -0,0 +1,307 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <hpx/parcelport_shmem/message.hpp>
+#include <hpx/parcelport_shmem/ring.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <utility>
+
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace hpx::parcelset::policies::shmem;
+
+///////////////////////////////////////////////////////////////////////////////
+std::string test_segment_name(char const* name)
+{
+    return segment_name(static_cast<std::int32_t>(::getpid())) + ".test." +
+        name;
+}
+
+// Write a frame of the given size whose bytes are derived from the sequence
+// number, returns the address the frame data was written to (or nullptr if
+// the ring was full).
+char* write_frame(ring& r, std::size_t size, std::uint8_t seq)
+{
+    char* result = nullptr;
+    bool const written = r.try_write(size, [&](char* dest) {
+        std::memset(dest, seq, size);
+        result = dest;
+    });
+    HPX_TEST(written == (result != nullptr));
+    return result;
+}
+
+// Read the next frame and verify its size and content.
+bool read_frame(ring& r, std::size_t size, std::uint8_t seq)
+{
+    return r.try_read([&](char const* src, std::size_t frame_size) {
+        HPX_TEST_EQ(frame_size, size);
+        for (std::size_t i = 0; i != frame_size; ++i)
+        {
+            if (static_cast<std::uint8_t>(src[i]) != seq)
+            {
+                HPX_TEST(false);
+                break;
+            }
+        }
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_create_attach()
+{
+    segment seg =
+        segment::create(test_segment_name("attach"), ring::segment_size(100));
+    ring r = ring::create(seg, 100);
+
+    // the capacity is rounded up to the next power of two
+    HPX_TEST(r);
+    HPX_TEST_EQ(r.capacity(), std::size_t(4096));
+    HPX_TEST(r.empty());
+    HPX_TEST(r.fits(1024));
+    HPX_TEST(!r.fits(r.capacity()));
+
+    // a second mapping of the segment sees the frames written to the first
+    segment other = segment::open(seg.name());
+    ring attached = ring::attach(other);
+    HPX_TEST(attached);
+    HPX_TEST_EQ(attached.capacity(), r.capacity());
+
+    HPX_TEST(write_frame(r, 100, 1) != nullptr);
+    HPX_TEST(!attached.empty());
+    HPX_TEST(read_frame(attached, 100, 1));
+    HPX_TEST(r.empty());
+
+    seg.unlink();
+
+    // attaching to a segment which does not hold a ring fails
+    segment invalid = segment::create(test_segment_name("invalid"), 4096);
+    std::memset(invalid.data(), 0, invalid.size());
+
+    hpx::error_code ec;
+    ring r2 = ring::attach(invalid, ec);
+    HPX_TEST(ec);
+    HPX_TEST(!r2);
+
+    invalid.unlink();
+}
+
+// Frames are written and read many times over, the indices wrap around the
+// end of the buffer repeatedly.
+void test_wraparound()
+{
+    segment seg =
+        segment::create(test_segment_name("wrap"), ring::segment_size(4096));
+    ring r = ring::create(seg, 4096);
+
+    std::deque<std::pair<std::size_t, std::uint8_t>> pending;
+    std::uint8_t seq = 0;
+
+    for (std::size_t i = 0; i != 10000; ++i)
+    {
+        // sizes which are not multiples of the frame alignment
+        std::size_t const size = 1 + (i * 37) % 700;
+        if (write_frame(r, size, seq) != nullptr)
+        {
+            pending.emplace_back(size, seq++);
+        }
+
+        // drain every few iterations, leaving a varying number of frames
+        if (i % 3 == 2)
+        {
+            while (pending.size() > i % 4)
+            {
+                HPX_TEST(read_frame(
+                    r, pending.front().first, pending.front().second));
+                pending.pop_front();
+            }
+        }
+    }
+
+    while (!pending.empty())
+    {
+        HPX_TEST(
+            read_frame(r, pending.front().first, pending.front().second));
+        pending.pop_front();
+    }
+    HPX_TEST(r.empty());
+    HPX_TEST(!r.try_read([](char const*, std::size_t) { HPX_TEST(false); }));
+
+    seg.unlink();
+}
+
+// A frame which doesn't fit into the remaining space at the end of the
+// buffer is placed at the start, the reader skips the padding.
+void test_padding()
+{
+    segment seg =
+        segment::create(test_segment_name("padding"), ring::segment_size(4096));
+    ring r = ring::create(seg, 4096);
+
+    // frames of 1520 bytes each (including the frame header)
+    std::size_t const size = 1500;
+
+    char* first = write_frame(r, size, 1);
+    HPX_TEST(first != nullptr);
+    HPX_TEST(write_frame(r, size, 2) != nullptr);
+    HPX_TEST(read_frame(r, size, 1));
+    HPX_TEST(read_frame(r, size, 2));
+    HPX_TEST(r.empty());
+
+    // only 1056 bytes are left at the end, the frame wraps to the start
+    char* third = write_frame(r, size, 3);
+    HPX_TEST(third == first);
+
+    // the padding occupies space until the frame after it is read: one
+    // more frame fits exactly, another one does not
+    HPX_TEST(write_frame(r, size, 4) != nullptr);
+    HPX_TEST(write_frame(r, 1, 5) == nullptr);
+
+    HPX_TEST(read_frame(r, size, 3));
+    HPX_TEST(read_frame(r, size, 4));
+    HPX_TEST(r.empty());
+
+    seg.unlink();
+}
+
+// Writing to a full ring fails without invoking the writer, writing
+// succeeds again once frames have been read.
+void test_backpressure()
+{
+    segment seg = segment::create(
+        test_segment_name("backpressure"), ring::segment_size(4096));
+    ring r = ring::create(seg, 4096);
+
+    // frames of 512 bytes each (including the frame header)
+    std::size_t const size = 496;
+
+    std::size_t count = 0;
+    while (write_frame(r, size, static_cast<std::uint8_t>(count)) != nullptr)
+    {
+        ++count;
+    }
+    HPX_TEST_EQ(count, std::size_t(8));
+
+    bool invoked = false;
+    HPX_TEST(!r.try_write(size, [&](char*) { invoked = true; }));
+    HPX_TEST(!invoked);
+
+    // releasing a single frame makes room for exactly one more
+    HPX_TEST(read_frame(r, size, 0));
+    HPX_TEST(write_frame(r, size, 8) != nullptr);
+    HPX_TEST(write_frame(r, size, 9) == nullptr);
+
+    // the frames are received in order
+    for (std::size_t i = 1; i != 9; ++i)
+    {
+        HPX_TEST(read_frame(r, size, static_cast<std::uint8_t>(i)));
+    }
+    HPX_TEST(r.empty());
+
+    seg.unlink();
+}
+
+// A writer which dies while holding the writer lock doesn't block the ring,
+// the frame it was writing is never published.
+void test_dead_writer()
+{
+    segment seg = segment::create(
+        test_segment_name("dead_writer"), ring::segment_size(4096));
+    ring r = ring::create(seg, 4096);
+
+    pid_t const pid = ::fork();
+    if (pid == 0)
+    {
+        r.try_write(100, [](char* dest) {
+            std::memset(dest, 1, 100);
+            ::_exit(0);
+        });
+        ::_exit(1);
+    }
+
+    int status = 0;
+    HPX_TEST_EQ(::waitpid(pid, &status, 0), pid);
+    HPX_TEST(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+    HPX_TEST(r.empty());
+    HPX_TEST(write_frame(r, 100, 2) != nullptr);
+    HPX_TEST(read_frame(r, 100, 2));
+    HPX_TEST(r.empty());
+
+    seg.unlink();
+}
+
+// Frame headers which don't match the published part of the ring are
+// rejected before the frame data is accessed.
+void test_invalid_frame()
+{
+    segment seg = segment::create(
+        test_segment_name("invalid_frame"), ring::segment_size(4096));
+    ring r = ring::create(seg, 4096);
+
+    char* dest = write_frame(r, 100, 1);
+    HPX_TEST(dest != nullptr);
+
+    ring::frame* f = reinterpret_cast<ring::frame*>(dest) - 1;
+
+    // larger than the ring
+    f->size_ = std::uint64_t(1) << 40;
+    HPX_TEST_THROW(
+        r.try_read([](char const*, std::size_t) { HPX_TEST(false); }),
+        hpx::exception);
+
+    // extends beyond the published frames
+    f->size_ = 200;
+    HPX_TEST_THROW(
+        r.try_read([](char const*, std::size_t) { HPX_TEST(false); }),
+        hpx::exception);
+
+    // padding which doesn't extend to the end of the buffer
+    f->size_ = 100;
+    f->padding_ = 1;
+    HPX_TEST_THROW(
+        r.try_read([](char const*, std::size_t) { HPX_TEST(false); }),
+        hpx::exception);
+
+    f->padding_ = 0;
+    HPX_TEST(read_frame(r, 100, 1));
+    HPX_TEST(r.empty());
+
+    seg.unlink();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_create_attach();
+    test_wraparound();
+    test_padding();
+    test_backpressure();
+    test_dead_writer();
+    test_invalid_frame();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -0,0 +1,133 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <hpx/parcelport_shmem/message.hpp>
+#include <hpx/parcelport_shmem/segment.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace hpx::parcelset::policies::shmem;
+
+///////////////////////////////////////////////////////////////////////////////
+bool exists(std::string const& name)
+{
+    hpx::error_code ec(hpx::throwmode::lightweight);
+    segment seg = segment::open(name, ec);
+    return !ec && seg;
+}
+
+// Return the process id of a process which has terminated.
+std::int32_t terminated_pid()
+{
+    pid_t const pid = ::fork();
+    if (pid == 0)
+    {
+        ::_exit(0);
+    }
+    HPX_TEST(pid > 0);
+    ::waitpid(pid, nullptr, 0);
+    return static_cast<std::int32_t>(pid);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_create_open()
+{
+    std::string const name = heap_segment_name(
+        static_cast<std::int32_t>(::getpid()), 1, 1);
+
+    segment seg = segment::create(name, 1000);
+    HPX_TEST(seg);
+    HPX_TEST_EQ(seg.size(), std::size_t(1000));
+    HPX_TEST_EQ(seg.name(), name);
+    std::memset(seg.data(), 42, seg.size());
+
+    // the memory is shared between all mappings of the segment
+    segment other = segment::open(name);
+    HPX_TEST_EQ(other.size(), seg.size());
+    HPX_TEST_EQ(other.data()[999], 42);
+
+    // a segment of the same name replaces the existing one
+    segment replaced = segment::create(name, 2000);
+    HPX_TEST_EQ(segment::open(name).size(), std::size_t(2000));
+
+    replaced.unlink();
+    HPX_TEST(!exists(name));
+
+    // the mappings stay valid after the name has been removed
+    HPX_TEST_EQ(other.data()[0], 42);
+}
+
+void test_unlink_segments()
+{
+    std::int32_t const here = static_cast<std::int32_t>(::getpid());
+
+    segment inbound = segment::create(segment_name(here), 4096);
+    segment heap1 = segment::create(heap_segment_name(here, 2, 1), 4096);
+    segment heap2 = segment::create(heap_segment_name(here, 3, 7), 4096);
+    segment unrelated = segment::create(heap_segment_name(2, here, 1), 4096);
+
+    // removes all segments addressed to this process only
+    unlink_segments(here);
+
+    HPX_TEST(!exists(inbound.name()));
+    HPX_TEST(!exists(heap1.name()));
+    HPX_TEST(!exists(heap2.name()));
+    HPX_TEST(exists(unrelated.name()));
+
+    unrelated.unlink();
+}
+
+void test_unlink_stale_segments()
+{
+    std::int32_t const here = static_cast<std::int32_t>(::getpid());
+    std::int32_t const stale = terminated_pid();
+
+    segment live = segment::create(segment_name(here), 4096);
+    segment live_heap = segment::create(heap_segment_name(here, 2, 1), 4096);
+    segment dead = segment::create(segment_name(stale), 4096);
+    segment dead_heap = segment::create(heap_segment_name(stale, 2, 1), 4096);
+
+    unlink_stale_segments();
+
+#if defined(__linux__)
+    HPX_TEST(!exists(dead.name()));
+    HPX_TEST(!exists(dead_heap.name()));
+#endif
+    HPX_TEST(exists(live.name()));
+    HPX_TEST(exists(live_heap.name()));
+
+    unlink_segments(here);
+    dead.unlink();
+    dead_heap.unlink();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_create_open();
+    test_unlink_segments();
+    test_unlink_stale_segments();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
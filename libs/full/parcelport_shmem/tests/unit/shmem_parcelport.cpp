@@ -0,0 +1,155 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Exchange small messages (passed through the ring buffer) and large or
+// zero-copy messages (passed through separate heap segments) between two
+// localities on the same host.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The inbound ring is kept small, messages larger than half of it are
+// transferred through heap segments.
+constexpr std::size_t ring_size = 8192;
+
+using buffer_type = hpx::serialization::serialize_buffer<char>;
+
+int echo_int(int i)
+{
+    return i;
+}
+HPX_PLAIN_ACTION(echo_int)
+
+std::vector<char> echo_vector(std::vector<char> const& v)
+{
+    return v;
+}
+HPX_PLAIN_ACTION(echo_vector)
+
+buffer_type echo_buffer(buffer_type const& b)
+{
+    return b;
+}
+HPX_PLAIN_ACTION(echo_buffer)
+
+HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(buffer_type, shmem_buffer_type)
+HPX_REGISTER_BASE_LCO_WITH_VALUE(buffer_type, shmem_buffer_type)
+
+///////////////////////////////////////////////////////////////////////////////
+// Many small messages in flight at the same time exceed the capacity of the
+// ring, the senders have to wait for the receiver to make room.
+void test_small_messages(hpx::id_type const& dest)
+{
+    std::vector<hpx::future<int>> results;
+    results.reserve(1000);
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        results.push_back(hpx::async(echo_int_action(), dest, i));
+    }
+
+    for (int i = 0; i != 1000; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), i);
+    }
+}
+
+// Messages which don't fit into the ring are written to heap segments, with
+// and without zero-copy chunks.
+void test_large_messages(hpx::id_type const& dest)
+{
+    for (std::size_t size : {ring_size / 2, 2 * ring_size, 128 * ring_size})
+    {
+        std::vector<char> v(size);
+        std::iota(v.begin(), v.end(), '\0');
+
+        std::vector<hpx::future<std::vector<char>>> vectors;
+        std::vector<hpx::future<buffer_type>> buffers;
+        for (std::size_t i = 0; i != 10; ++i)
+        {
+            vectors.push_back(hpx::async(echo_vector_action(), dest, v));
+            buffers.push_back(hpx::async(echo_buffer_action(), dest,
+                buffer_type(v.data(), v.size(), buffer_type::reference)));
+        }
+
+        for (auto& f : vectors)
+        {
+            HPX_TEST(f.get() == v);
+        }
+
+        for (auto& f : buffers)
+        {
+            buffer_type b = f.get();
+            HPX_TEST_EQ(b.size(), size);
+            HPX_TEST_EQ(std::memcmp(b.data(), v.data(), size), 0);
+        }
+    }
+}
+
+// Small and large messages interleaved, the heap messages are announced
+// through the ring in order with the small ones.
+void test_mixed_messages(hpx::id_type const& dest)
+{
+    std::vector<char> v(2 * ring_size, 'x');
+
+    std::vector<hpx::future<int>> ints;
+    std::vector<hpx::future<std::vector<char>>> vectors;
+    for (int i = 0; i != 100; ++i)
+    {
+        ints.push_back(hpx::async(echo_int_action(), dest, i));
+        vectors.push_back(hpx::async(echo_vector_action(), dest, v));
+    }
+
+    for (int i = 0; i != 100; ++i)
+    {
+        HPX_TEST_EQ(ints[i].get(), i);
+        HPX_TEST(vectors[i].get() == v);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    HPX_TEST_EQ(hpx::get_config_entry("hpx.parcel.shmem.enable", "0"),
+        std::string("1"));
+
+    for (hpx::id_type const& dest : hpx::find_remote_localities())
+    {
+        test_small_messages(dest);
+        test_large_messages(dest);
+        test_mixed_messages(dest);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {"hpx.parcel.shmem.enable=1",
+        "hpx.parcel.shmem.ring_size=" + std::to_string(ring_size)};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -22,6 +22,7 @@
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
 #include <hpx/parcelset_base/detail/parcel_route_handler.hpp>
+#include <hpx/parcelset/parcel_tracer.hpp>
 #include <hpx/parcelset_base/parcel_interface.hpp>
 
 #if ASIO_HAS_BOOST_THROW_EXCEPTION != 0
@@ -164,6 +165,18 @@ namespace hpx::parcelset {
                         std::size_t archive_pos = archive.current_pos();
                         std::int64_t serialize_time =
                             timer.elapsed_nanoseconds();
+#endif
+#if defined(HPX_HAVE_PARCEL_TRACING)
+                        bool const tracing =
+                            parcelset::is_parcel_tracing_enabled();
+                        std::size_t trace_pos = 0;
+                        std::int64_t trace_start = 0;
+                        if (tracing)
+                        {
+                            trace_pos = archive.current_pos();
+                            trace_start = static_cast<std::int64_t>(
+                                hpx::chrono::high_resolution_clock::now());
+                        }
 #endif
                         // de-serialize parcel and add it to incoming parcel queue
                         parcelset::parcel p;
@@ -176,6 +189,16 @@ namespace hpx::parcelset {
                         bool migrated = p.load_schedule(
                             archive, num_thread, deferred_schedule);
 
+#if defined(HPX_HAVE_PARCEL_TRACING)
+                        if (tracing)
+                        {
+                            parcelset::detail::trace_parcel(
+                                parcelset::parcel_trace_event::receive, p,
+                                archive.current_pos() - trace_pos,
+                                trace_start);
+                        }
+#endif
+
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
                         std::int64_t add_parcel_time =
                             timer.elapsed_nanoseconds();
@@ -0,0 +1,35 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <cstddef>
+
+namespace hpx::parcelset::detail {
+
+    // Messages are compressed only if they carry at least threshold bytes
+    // of (uncompressed) data. If min_ratio is larger than zero, compression
+    // is skipped for all actions for which the observed compression ratio
+    // (uncompressed/compressed size) falls below min_ratio. Such actions are
+    // still compressed once in a while to detect changes of their payload.
+    HPX_EXPORT void configure_adaptive_compression(
+        std::size_t threshold, double min_ratio) noexcept;
+
+    // Decide whether a message of the given (estimated) size whose first
+    // parcel carries the given action should be compressed.
+    HPX_EXPORT bool should_compress(
+        char const* action, std::size_t size) noexcept;
+
+    // Record the outcome of compressing a message whose first parcel carries
+    // the given action.
+    HPX_EXPORT void record_compression(char const* action,
+        std::size_t uncompressed_size, std::size_t compressed_size);
+}    // namespace hpx::parcelset::detail
+
+#endif
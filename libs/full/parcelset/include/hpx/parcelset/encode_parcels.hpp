@@ -23,7 +23,9 @@
 #include <hpx/actions_base/basic_action.hpp>
 #include <hpx/naming/detail/preprocess_gid_types.hpp>
 #include <hpx/naming/split_gid.hpp>
+#include <hpx/parcelset/detail/adaptive_compression.hpp>
 #include <hpx/parcelset/parcel.hpp>
+#include <hpx/parcelset/parcel_tracer.hpp>
 #include <hpx/parcelset/parcelset_fwd.hpp>
 #include <hpx/parcelset_base/parcelport.hpp>
 
@@ -173,13 +175,6 @@ namespace hpx::parcelset {
                 std::unique_ptr<serialization::binary_filter> filter(
                     ps[0].get_serialization_filter());
 
-                int archive_flags = archive_flags_;
-                if (filter.get() != nullptr)
-                {
-                    archive_flags = archive_flags |
-                        int(serialization::archive_flags::enable_compression);
-                }
-
                 // preallocate data
                 std::size_t num_chunks = 0;
                 for (/**/; parcels_sent != parcels_size; ++parcels_sent)
@@ -190,12 +185,31 @@ namespace hpx::parcelset {
                     num_chunks += ps[parcels_sent].num_chunks();
                 }
 
+                // small messages and messages carrying actions which don't
+                // compress well are sent uncompressed
+                if (filter.get() != nullptr &&
+                    !detail::should_compress(ps[0].get_action_name(), arg_size))
+                {
+                    filter.reset();
+                }
+
+                int archive_flags = archive_flags_;
+                if (filter.get() != nullptr)
+                {
+                    archive_flags = archive_flags |
+                        int(serialization::archive_flags::enable_compression);
+                }
+
                 buffer.data_.reserve(arg_size);
                 buffer.chunks_.reserve(num_chunks);
 
                 // mark start of serialization
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
                 hpx::chrono::high_resolution_timer timer;
+#endif
+#if defined(HPX_HAVE_PARCEL_TRACING)
+                bool const trace_parcels =
+                    parcelset::is_parcel_tracing_enabled();
 #endif
                 {
                     // Serialize the data
@@ -218,6 +232,16 @@ namespace hpx::parcelset {
                         std::size_t archive_pos = archive.current_pos();
                         std::int64_t serialize_time =
                             timer.elapsed_nanoseconds();
+#endif
+#if defined(HPX_HAVE_PARCEL_TRACING)
+                        std::size_t trace_pos = 0;
+                        std::int64_t trace_start = 0;
+                        if (trace_parcels)
+                        {
+                            trace_pos = archive.current_pos();
+                            trace_start = static_cast<std::int64_t>(
+                                hpx::chrono::high_resolution_clock::now());
+                        }
 #endif
                         LPT_(debug) << ps[i];
 
@@ -231,6 +255,16 @@ namespace hpx::parcelset {
 
                         archive << ps[i];
 
+#if defined(HPX_HAVE_PARCEL_TRACING)
+                        if (trace_parcels)
+                        {
+                            parcelset::detail::trace_parcel(
+                                parcelset::parcel_trace_event::send, ps[i],
+                                archive.current_pos() - trace_pos,
+                                trace_start);
+                        }
+#endif
+
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
                         parcelset::data_point action_data;
@@ -244,8 +278,27 @@ namespace hpx::parcelset {
                         HPX_UNUSED(pp);
 #endif
                     }
+
+                    // the filters compress all data while flushing
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                    std::int64_t const flush_start =
+                        timer.elapsed_nanoseconds();
+#endif
                     archive.flush();
                     arg_size = archive.bytes_written();
+
+                    if (filter.get() != nullptr)
+                    {
+                        detail::record_compression(ps[0].get_action_name(),
+                            arg_size, buffer.data_.size());
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                        buffer.data_point_.compression_time_ =
+                            timer.elapsed_nanoseconds() - flush_start;
+                        buffer.data_point_.compression_bytes_saved_ =
+                            static_cast<std::int64_t>(arg_size) -
+                            static_cast<std::int64_t>(buffer.data_.size());
+#endif
+                    }
                 }
 
                 // store the time required for serialization
@@ -0,0 +1,83 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCEL_TRACING)
+#include <hpx/parcelset/parcelset_fwd.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace hpx::parcelset {
+
+    ///////////////////////////////////////////////////////////////////////////
+    enum class parcel_trace_event : std::uint8_t
+    {
+        send = 0,       // parcel was serialized for sending
+        receive = 1,    // parcel was de-serialized after receiving
+    };
+
+    /// One entry of the parcel trace. Records are kept in per-OS-thread ring
+    /// buffers, thus only the most recent records are retained if more
+    /// parcels are traced than fit into the buffers.
+    struct parcel_trace_record
+    {
+        // point in time when the parcel started being (de-)serialized
+        // (nanoseconds, hpx::chrono::high_resolution_clock)
+        std::int64_t timestamp_ = 0;
+
+        // time it took to (de-)serialize the parcel (nanoseconds)
+        std::int64_t serialization_time_ = 0;
+
+        // number of bytes the parcel occupied in the (uncompressed) message
+        std::uint64_t bytes_ = 0;
+
+        // the name of the action, this refers to static storage
+        char const* action_ = nullptr;
+
+        std::uint32_t source_ = 0;         // source locality id
+        std::uint32_t destination_ = 0;    // destination locality id
+
+        parcel_trace_event event_ = parcel_trace_event::send;
+    };
+
+    /// Start recording parcel traces, every OS thread records into a ring
+    /// buffer holding up to \a buffer_size records.
+    HPX_EXPORT void enable_parcel_tracing(std::size_t buffer_size);
+
+    /// Stop recording parcel traces, already recorded data is retained.
+    HPX_EXPORT void disable_parcel_tracing() noexcept;
+
+    HPX_EXPORT bool is_parcel_tracing_enabled() noexcept;
+
+    /// Discard all recorded parcel traces.
+    HPX_EXPORT void reset_parcel_trace();
+
+    /// Return all recorded parcel traces of this locality, sorted by time.
+    HPX_EXPORT std::vector<parcel_trace_record> get_parcel_trace();
+
+    /// Write all recorded parcel traces of this locality in Chrome trace
+    /// event format (JSON), suitable for chrome://tracing or Perfetto.
+    HPX_EXPORT void write_parcel_trace(std::ostream& os);
+    HPX_EXPORT void write_parcel_trace(std::string const& filename);
+
+    namespace detail {
+
+        // record one (de-)serialized parcel, start is the timestamp taken
+        // before (de-)serialization began
+        HPX_EXPORT void trace_parcel(parcel_trace_event event,
+            parcelset::parcel const& p, std::size_t bytes,
+            std::int64_t start) noexcept;
+    }    // namespace detail
+}    // namespace hpx::parcelset
+
+#endif
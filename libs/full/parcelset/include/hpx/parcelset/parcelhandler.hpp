@@ -326,6 +326,14 @@ namespace hpx::parcelset {
         std::int64_t get_buffer_allocate_time_received(
             std::string const& pp_type, bool reset) const;
 
+        // total time spent compressing sent parcels (nanoseconds)
+        std::int64_t get_compression_time_sent(
+            std::string const& pp_type, bool reset) const;
+
+        // total number of bytes saved by compressing sent parcels
+        std::int64_t get_compression_bytes_saved_sent(
+            std::string const& pp_type, bool reset) const;
+
         // total zero-copy chunks sent
         std::int64_t get_zchunks_send_count(
             std::string const& pp_type, bool reset) const;
@@ -468,6 +476,11 @@ namespace hpx::parcelset {
         /// cache whether networking has been enabled
         bool is_networking_enabled_;
 
+#if defined(HPX_HAVE_PARCEL_TRACING)
+        /// file the parcel trace is written to on stop (if not empty)
+        std::string trace_file_;
+#endif
+
     public:
         bool is_networking_enabled() const
         {
@@ -0,0 +1,116 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/parcelset/detail/adaptive_compression.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+namespace hpx::parcelset::detail {
+
+    namespace {
+
+        // every probe_interval'th message of an action for which compression
+        // is skipped is compressed nevertheless
+        constexpr std::uint32_t probe_interval = 64;
+
+        struct compression_statistics
+        {
+            // exponential moving average of the observed compression ratio
+            std::atomic<double> ratio_{0.0};
+
+            // number of messages which were sent uncompressed
+            std::atomic<std::uint32_t> skipped_{0};
+        };
+
+        std::atomic<std::size_t> compression_threshold(0);
+        std::atomic<double> compression_min_ratio(0.0);
+
+        // the action names refer to static storage, thus they can be used
+        // as keys directly, the lock protects the map only, the entries are
+        // never removed and are updated atomically
+        hpx::spinlock statistics_mtx;
+        std::unordered_map<char const*, compression_statistics> statistics;
+
+        compression_statistics* find_statistics(char const* action)
+        {
+            std::lock_guard<hpx::spinlock> l(statistics_mtx);
+            auto it = statistics.find(action);
+            return it != statistics.end() ? &it->second : nullptr;
+        }
+
+        compression_statistics& get_statistics(char const* action)
+        {
+            std::lock_guard<hpx::spinlock> l(statistics_mtx);
+            return statistics[action];
+        }
+    }    // namespace
+
+    void configure_adaptive_compression(
+        std::size_t threshold, double min_ratio) noexcept
+    {
+        compression_threshold.store(threshold, std::memory_order_relaxed);
+        compression_min_ratio.store(min_ratio, std::memory_order_relaxed);
+    }
+
+    bool should_compress(char const* action, std::size_t size) noexcept
+    {
+        if (size < compression_threshold.load(std::memory_order_relaxed))
+        {
+            return false;
+        }
+
+        double const min_ratio =
+            compression_min_ratio.load(std::memory_order_relaxed);
+        if (min_ratio <= 0.0 || action == nullptr)
+        {
+            return true;
+        }
+
+        compression_statistics* s = find_statistics(action);
+        if (s == nullptr ||
+            s->ratio_.load(std::memory_order_relaxed) >= min_ratio)
+        {
+            return true;
+        }
+
+        // compress every probe_interval'th message nevertheless
+        return (s->skipped_.fetch_add(1, std::memory_order_relaxed) + 1) %
+            probe_interval ==
+            0;
+    }
+
+    void record_compression(char const* action,
+        std::size_t uncompressed_size, std::size_t compressed_size)
+    {
+        if (compression_min_ratio.load(std::memory_order_relaxed) <= 0.0 ||
+            action == nullptr || compressed_size == 0)
+        {
+            return;
+        }
+
+        double const ratio = static_cast<double>(uncompressed_size) /
+            static_cast<double>(compressed_size);
+
+        compression_statistics& s = get_statistics(action);
+
+        double current = s.ratio_.load(std::memory_order_relaxed);
+        while (!s.ratio_.compare_exchange_weak(current,
+            current == 0.0 ? ratio : 0.75 * current + 0.25 * ratio,
+            std::memory_order_relaxed))
+        {
+        }
+    }
+}    // namespace hpx::parcelset::detail
+
+#endif
@@ -0,0 +1,333 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCEL_TRACING)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/parcelset/parcel.hpp>
+#include <hpx/parcelset/parcel_tracer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace hpx::parcelset {
+
+    namespace {
+
+        // Ring buffer of trace records, written by exactly one OS thread and
+        // read concurrently while collecting the trace. Every slot is
+        // guarded by a sequence lock: the sequence number is odd while the
+        // slot is being written and it identifies the record the slot
+        // holds. The record itself is stored in relaxed atomic words, a
+        // reader discards whatever it copied if the sequence number changed
+        // in the meantime.
+        struct trace_buffer
+        {
+            static constexpr std::size_t num_words =
+                (sizeof(parcel_trace_record) + sizeof(std::uint64_t) - 1) /
+                sizeof(std::uint64_t);
+
+            static_assert(
+                std::is_trivially_copyable_v<parcel_trace_record>);
+
+            struct slot
+            {
+                std::atomic<std::uint64_t> seq_{0};
+                std::atomic<std::uint64_t> data_[num_words] = {};
+            };
+
+            explicit trace_buffer(std::size_t capacity)
+              : slots_(new slot[capacity])
+              , capacity_(capacity)
+              , head_(0)
+            {
+            }
+
+            void push(parcel_trace_record const& r) noexcept
+            {
+                std::uint64_t words[num_words] = {};
+                std::memcpy(words, &r, sizeof(r));
+
+                std::uint64_t const head =
+                    head_.load(std::memory_order_relaxed);
+                slot& s = slots_[head % capacity_];
+
+                s.seq_.store(2 * head + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+
+                for (std::size_t i = 0; i != num_words; ++i)
+                {
+                    s.data_[i].store(words[i], std::memory_order_relaxed);
+                }
+
+                s.seq_.store(2 * head + 2, std::memory_order_release);
+                head_.store(head + 1, std::memory_order_release);
+            }
+
+            void collect(std::vector<parcel_trace_record>& result) const
+            {
+                std::uint64_t const head =
+                    head_.load(std::memory_order_acquire);
+                std::uint64_t first =
+                    head > capacity_ ? head - capacity_ : 0;
+
+                for (/**/; first != head; ++first)
+                {
+                    slot const& s = slots_[first % capacity_];
+
+                    // skip records which are overwritten concurrently
+                    std::uint64_t const seq =
+                        s.seq_.load(std::memory_order_acquire);
+                    if (seq != 2 * first + 2)
+                    {
+                        continue;
+                    }
+
+                    std::uint64_t words[num_words];
+                    for (std::size_t i = 0; i != num_words; ++i)
+                    {
+                        words[i] = s.data_[i].load(std::memory_order_relaxed);
+                    }
+
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (s.seq_.load(std::memory_order_relaxed) != seq)
+                    {
+                        continue;
+                    }
+
+                    parcel_trace_record r;
+                    std::memcpy(&r, words, sizeof(r));
+                    result.push_back(r);
+                }
+            }
+
+            std::unique_ptr<slot[]> slots_;
+            std::size_t capacity_;
+            std::atomic<std::uint64_t> head_;
+        };
+
+        struct tracer
+        {
+            std::shared_ptr<trace_buffer> get_buffer()
+            {
+                thread_local std::shared_ptr<trace_buffer> buffer;
+                thread_local std::uint64_t generation = 0;
+
+                std::uint64_t const current =
+                    generation_.load(std::memory_order_acquire);
+                if (buffer == nullptr || generation != current)
+                {
+                    std::lock_guard<std::mutex> l(mtx_);
+                    buffer = std::make_shared<trace_buffer>(capacity_);
+                    buffers_.push_back(buffer);
+                    generation = current;
+                }
+                return buffer;
+            }
+
+            std::atomic<bool> enabled_{false};
+            std::atomic<std::uint64_t> generation_{1};
+
+            std::mutex mtx_;
+            std::size_t capacity_ = 0;
+            std::vector<std::shared_ptr<trace_buffer>> buffers_;
+        };
+
+        tracer& get_tracer()
+        {
+            static tracer t;
+            return t;
+        }
+
+        // the action names are C++ type names which may contain characters
+        // that need to be escaped in JSON strings
+        void write_json_string(std::ostream& os, char const* s)
+        {
+            os << '"';
+            for (/**/; s != nullptr && *s != '\0'; ++s)
+            {
+                char const c = *s;
+                if (c == '"' || c == '\\')
+                {
+                    os << '\\' << c;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    hpx::util::format_to(os, "\\u{:04x}", static_cast<int>(c));
+                }
+                else
+                {
+                    os << c;
+                }
+            }
+            os << '"';
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    void enable_parcel_tracing(std::size_t buffer_size)
+    {
+        if (buffer_size == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "hpx::parcelset::enable_parcel_tracing",
+                "the trace buffer size must be larger than zero");
+        }
+
+        tracer& t = get_tracer();
+        {
+            std::lock_guard<std::mutex> l(t.mtx_);
+            if (t.capacity_ != buffer_size)
+            {
+                // force all threads to allocate new buffers
+                t.capacity_ = buffer_size;
+                t.generation_.fetch_add(1, std::memory_order_acq_rel);
+            }
+        }
+        t.enabled_.store(true, std::memory_order_release);
+    }
+
+    void disable_parcel_tracing() noexcept
+    {
+        get_tracer().enabled_.store(false, std::memory_order_release);
+    }
+
+    bool is_parcel_tracing_enabled() noexcept
+    {
+        return get_tracer().enabled_.load(std::memory_order_relaxed);
+    }
+
+    void reset_parcel_trace()
+    {
+        tracer& t = get_tracer();
+
+        std::lock_guard<std::mutex> l(t.mtx_);
+        t.buffers_.clear();
+        t.generation_.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    std::vector<parcel_trace_record> get_parcel_trace()
+    {
+        std::vector<parcel_trace_record> result;
+
+        tracer& t = get_tracer();
+        {
+            std::lock_guard<std::mutex> l(t.mtx_);
+            for (auto const& buffer : t.buffers_)
+            {
+                buffer->collect(result);
+            }
+        }
+
+        std::sort(result.begin(), result.end(),
+            [](parcel_trace_record const& lhs, parcel_trace_record const& rhs) {
+                return lhs.timestamp_ < rhs.timestamp_;
+            });
+        return result;
+    }
+
+    void write_parcel_trace(std::ostream& os)
+    {
+        std::vector<parcel_trace_record> records = get_parcel_trace();
+
+        error_code ec(throwmode::lightweight);
+        std::uint32_t const here = agas::get_locality_id(ec);
+
+        os << "{\"traceEvents\":[\n";
+        bool first = true;
+        for (parcel_trace_record const& r : records)
+        {
+            if (!first)
+            {
+                os << ",\n";
+            }
+            first = false;
+
+            bool const send = r.event_ == parcel_trace_event::send;
+
+            // one process per locality, separate tracks for sends and
+            // receives
+            os << "{\"name\":";
+            write_json_string(os, r.action_);
+            hpx::util::format_to(os,
+                ",\"cat\":\"{}\",\"ph\":\"X\",\"pid\":{},\"tid\":{},"
+                "\"ts\":{:.3f},\"dur\":{:.3f},\"args\":{{\"source\":{},"
+                "\"destination\":{},\"bytes\":{}}}}}",
+                send ? "send" : "receive", here, send ? 0 : 1,
+                static_cast<double>(r.timestamp_) / 1000.0,
+                static_cast<double>(r.serialization_time_) / 1000.0, r.source_,
+                r.destination_, r.bytes_);
+        }
+        os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    }
+
+    void write_parcel_trace(std::string const& filename)
+    {
+        std::ofstream os(filename);
+        if (!os)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "hpx::parcelset::write_parcel_trace",
+                "could not open parcel trace file: {}", filename);
+        }
+        write_parcel_trace(os);
+    }
+
+    namespace detail {
+
+        void trace_parcel(parcel_trace_event event,
+            parcelset::parcel const& p, std::size_t bytes,
+            std::int64_t start) noexcept
+        {
+            tracer& t = get_tracer();
+            if (!t.enabled_.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+
+            std::int64_t const now = static_cast<std::int64_t>(
+                hpx::chrono::high_resolution_clock::now());
+            hpx::id_type const source = p.source_id();
+
+            parcel_trace_record r;
+            r.timestamp_ = start;
+            r.serialization_time_ = now - start;
+            r.bytes_ = bytes;
+            r.action_ = p.get_action_name();
+            r.source_ = source ? naming::get_locality_id_from_id(source) :
+                                 naming::invalid_locality_id;
+            r.destination_ = p.destination_locality_id();
+            r.event_ = event;
+
+            try
+            {
+                t.get_buffer()->push(r);
+            }
+            catch (...)
+            {
+                // tracing must never interfere with parcel handling
+            }
+        }
+    }    // namespace detail
+}    // namespace hpx::parcelset
+
+#endif
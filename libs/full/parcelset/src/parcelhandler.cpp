@@ -33,7 +33,9 @@
 
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/naming_base/gid_type.hpp>
+#include <hpx/parcelset/detail/adaptive_compression.hpp>
 #include <hpx/parcelset/message_handler_fwd.hpp>
+#include <hpx/parcelset/parcel_tracer.hpp>
 #include <hpx/parcelset/parcelhandler.hpp>
 #include <hpx/parcelset/static_parcelports.hpp>
 #include <hpx/parcelset_base/policies/message_handler.hpp>
@@ -94,9 +96,26 @@ namespace hpx::parcelset {
       , is_networking_enabled_(cfg.enable_networking())
 #else
       , is_networking_enabled_(false)
+#endif
+#if defined(HPX_HAVE_PARCEL_TRACING)
+      , trace_file_(cfg.get_entry("hpx.parcel.trace_file", ""))
 #endif
     {
         LPROGRESS_;
+
+        detail::configure_adaptive_compression(
+            util::get_entry_as<std::size_t>(
+                cfg, "hpx.parcel.compression_threshold", 0),
+            util::get_entry_as<double>(
+                cfg, "hpx.parcel.compression_min_ratio", 0.0));
+
+#if defined(HPX_HAVE_PARCEL_TRACING)
+        if (!trace_file_.empty())
+        {
+            enable_parcel_tracing(util::get_entry_as<std::size_t>(
+                cfg, "hpx.parcel.trace_buffer_size", 65536));
+        }
+#endif
     }
 
     parcelhandler::~parcelhandler() = default;
@@ -424,6 +443,23 @@ namespace hpx::parcelset {
 
         // release all message handlers
         handlers_.clear();
+
+#if defined(HPX_HAVE_PARCEL_TRACING)
+        if (!trace_file_.empty() && is_parcel_tracing_enabled())
+        {
+            disable_parcel_tracing();
+            try
+            {
+                write_parcel_trace(trace_file_);
+            }
+            catch (hpx::exception const& e)
+            {
+                LPT_(error).format(
+                    "parcelhandler::stop: could not write parcel trace: {}",
+                    e.what());
+            }
+        }
+#endif
     }
 
     bool parcelhandler::get_raw_remote_localities(
@@ -1124,6 +1160,24 @@ namespace hpx::parcelset {
         return pp ? pp->get_buffer_allocate_time_received(reset) : 0;
     }
 
+    // total time spent compressing sent parcels (nanoseconds)
+    std::int64_t parcelhandler::get_compression_time_sent(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_compression_time_sent(reset) : 0;
+    }
+
+    // total number of bytes saved by compressing sent parcels
+    std::int64_t parcelhandler::get_compression_bytes_saved_sent(
+        std::string const& pp_type, bool reset) const
+    {
+        error_code ec(throwmode::lightweight);
+        parcelport* pp = find_parcelport(pp_type, ec);
+        return pp ? pp->get_compression_bytes_saved_sent(reset) : 0;
+    }
+
     // total zero-copy chunks sent
     std::int64_t parcelhandler::get_zchunks_send_count(
         std::string const& pp_type, bool reset) const
@@ -1353,6 +1407,15 @@ namespace hpx::parcelset {
                 HPX_ZERO_COPY_SERIALIZATION_THRESHOLD) "}");
         ini_defs.emplace_back("max_background_threads = "
                               "${HPX_PARCEL_MAX_BACKGROUND_THREADS:-1}");
+        ini_defs.emplace_back(
+            "compression_threshold = ${HPX_PARCEL_COMPRESSION_THRESHOLD:0}");
+        ini_defs.emplace_back(
+            "compression_min_ratio = ${HPX_PARCEL_COMPRESSION_MIN_RATIO:0}");
+#if defined(HPX_HAVE_PARCEL_TRACING)
+        ini_defs.emplace_back("trace_file = ${HPX_PARCEL_TRACE_FILE:}");
+        ini_defs.emplace_back(
+            "trace_buffer_size = ${HPX_PARCEL_TRACE_BUFFER_SIZE:65536}");
+#endif
 
         for (plugins::parcelport_factory_base* f :
             parcelhandler::get_parcelport_factories())
@@ -0,0 +1,141 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify the decisions made by the adaptive parcel compression, configured
+// using hpx.parcel.compression_threshold and hpx.parcel.compression_min_ratio.
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset/detail/adaptive_compression.hpp>
+
+#include <cstddef>
+#include <string>
+
+using hpx::parcelset::detail::configure_adaptive_compression;
+using hpx::parcelset::detail::record_compression;
+using hpx::parcelset::detail::should_compress;
+
+constexpr std::size_t threshold = 1024;
+
+// the action names are used as keys, use a separate name for each test
+char const* const good_action = "good_action";
+char const* const bad_action = "bad_action";
+char const* const changing_action = "changing_action";
+
+///////////////////////////////////////////////////////////////////////////////
+// messages smaller than the threshold are never compressed
+void test_threshold()
+{
+    HPX_TEST(!should_compress(nullptr, 0));
+    HPX_TEST(!should_compress(nullptr, threshold - 1));
+    HPX_TEST(should_compress(nullptr, threshold));
+
+    HPX_TEST(!should_compress(good_action, threshold - 1));
+    HPX_TEST(should_compress(good_action, threshold));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// actions compressing well (or not observed yet) are always compressed
+void test_good_ratio()
+{
+    record_compression(good_action, 4 * threshold, threshold);
+    for (int i = 0; i != 200; ++i)
+    {
+        HPX_TEST(should_compress(good_action, threshold));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// actions which don't compress well are compressed every 64th message only
+void test_bad_ratio()
+{
+    HPX_TEST(should_compress(bad_action, threshold));
+    record_compression(bad_action, 11 * threshold / 10, threshold);
+
+    for (int i = 1; i <= 3 * 64; ++i)
+    {
+        HPX_TEST_EQ(should_compress(bad_action, threshold), i % 64 == 0);
+    }
+
+    // messages smaller than the threshold are not counted as skipped
+    for (int i = 0; i != 100; ++i)
+    {
+        HPX_TEST(!should_compress(bad_action, threshold - 1));
+    }
+    for (int i = 1; i != 64; ++i)
+    {
+        HPX_TEST(!should_compress(bad_action, threshold));
+    }
+    HPX_TEST(should_compress(bad_action, threshold));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the ratio is a moving average, a probe showing a better ratio enables
+// compression again
+void test_changing_ratio()
+{
+    record_compression(changing_action, threshold, threshold);
+    HPX_TEST(!should_compress(changing_action, threshold));
+
+    // 0.75 * 1.0 + 0.25 * 10.0 >= 2.0
+    record_compression(changing_action, 10 * threshold, threshold);
+    for (int i = 0; i != 100; ++i)
+    {
+        HPX_TEST(should_compress(changing_action, threshold));
+    }
+
+    // 3.25 -> 2.6875 -> 2.265625 -> 1.94921875
+    for (int i = 0; i != 2; ++i)
+    {
+        record_compression(changing_action, threshold, threshold);
+        HPX_TEST(should_compress(changing_action, threshold));
+    }
+
+    record_compression(changing_action, threshold, threshold);
+    HPX_TEST(!should_compress(changing_action, threshold));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// without a threshold and a minimal ratio all messages are compressed
+void test_no_min_ratio()
+{
+    configure_adaptive_compression(0, 0.0);
+
+    HPX_TEST(should_compress(nullptr, 0));
+    for (int i = 0; i != 100; ++i)
+    {
+        HPX_TEST(should_compress(bad_action, 1));
+    }
+}
+
+int hpx_main()
+{
+    test_threshold();
+    test_good_ratio();
+    test_bad_ratio();
+    test_changing_ratio();
+    test_no_min_ratio();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::init_params init_args;
+    init_args.cfg = {
+        "hpx.parcel.compression_threshold=" + std::to_string(threshold),
+        "hpx.parcel.compression_min_ratio=2.0",
+    };
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,199 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset/parcel_tracer.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+int traced(int i)
+{
+    return i;
+}
+HPX_PLAIN_ACTION(traced)    // defines traced_action
+
+bool is_traced_action(hpx::parcelset::parcel_trace_record const& r)
+{
+    return r.action_ != nullptr &&
+        std::string(r.action_) == std::string("traced_action");
+}
+
+std::size_t count(std::string const& s, std::string const& what)
+{
+    std::size_t result = 0;
+    for (std::size_t pos = s.find(what); pos != std::string::npos;
+         pos = s.find(what, pos + what.size()))
+    {
+        ++result;
+    }
+    return result;
+}
+
+void send_parcels(hpx::id_type const& dest, int num_parcels)
+{
+    std::vector<hpx::future<int>> results;
+    results.reserve(num_parcels);
+    for (int i = 0; i != num_parcels; ++i)
+    {
+        results.push_back(hpx::async(traced_action(), dest, i));
+    }
+    for (int i = 0; i != num_parcels; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), i);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_trace(hpx::id_type const& dest)
+{
+    using namespace hpx::parcelset;
+
+    std::uint32_t const here = hpx::get_locality_id();
+    std::uint32_t const there = hpx::naming::get_locality_id_from_id(dest);
+
+    enable_parcel_tracing(4096);
+    reset_parcel_trace();
+    HPX_TEST(is_parcel_tracing_enabled());
+
+    send_parcels(dest, 100);
+    disable_parcel_tracing();
+    HPX_TEST(!is_parcel_tracing_enabled());
+
+    std::vector<parcel_trace_record> records = get_parcel_trace();
+    HPX_TEST(std::is_sorted(records.begin(), records.end(),
+        [](parcel_trace_record const& lhs, parcel_trace_record const& rhs) {
+            return lhs.timestamp_ < rhs.timestamp_;
+        }));
+
+    std::size_t sent = 0;
+    for (parcel_trace_record const& r : records)
+    {
+        if (is_traced_action(r))
+        {
+            HPX_TEST(r.event_ == parcel_trace_event::send);
+            HPX_TEST_EQ(r.source_, here);
+            HPX_TEST_EQ(r.destination_, there);
+            HPX_TEST_LT(std::uint64_t(0), r.bytes_);
+            HPX_TEST_LTE(std::int64_t(0), r.serialization_time_);
+            ++sent;
+        }
+    }
+    HPX_TEST_EQ(sent, std::size_t(100));
+
+    // no new records are added while tracing is disabled
+    send_parcels(dest, 10);
+    HPX_TEST_EQ(get_parcel_trace().size(), records.size());
+
+    std::ostringstream os;
+    write_parcel_trace(os);
+    std::string const json = os.str();
+
+    std::string const begin = "{\"traceEvents\":[\n";
+    std::string const end = "\n],\"displayTimeUnit\":\"ns\"}\n";
+    HPX_TEST_EQ(json.compare(0, begin.size(), begin), 0);
+    HPX_TEST(json.size() >= begin.size() + end.size() &&
+        json.compare(json.size() - end.size(), end.size(), end) == 0);
+    HPX_TEST_EQ(count(json, "{\"name\":"), records.size());
+    HPX_TEST_EQ(count(json, "{\"name\":\"traced_action\",\"cat\":\"send\""),
+        std::size_t(100));
+    HPX_TEST_EQ(
+        count(json, hpx::util::format("\"destination\":{}", there)), sent);
+
+    reset_parcel_trace();
+    HPX_TEST(get_parcel_trace().empty());
+}
+
+// Collect the trace while parcels are being traced, the buffers wrap around
+// many times. Records which are overwritten while being collected are
+// dropped, all others have to be complete.
+void test_concurrent_collect(hpx::id_type const& dest)
+{
+    using namespace hpx::parcelset;
+
+    enable_parcel_tracing(16);
+    reset_parcel_trace();
+
+    std::atomic<bool> done(false);
+    hpx::future<void> sender = hpx::async([&]() {
+        for (int i = 0; i != 20; ++i)
+        {
+            send_parcels(dest, 100);
+        }
+        done = true;
+    });
+
+    std::uint32_t const here = hpx::get_locality_id();
+    std::uint32_t const there = hpx::naming::get_locality_id_from_id(dest);
+
+    while (!done)
+    {
+        for (parcel_trace_record const& r : get_parcel_trace())
+        {
+            HPX_TEST(r.action_ != nullptr);
+            if (is_traced_action(r))
+            {
+                HPX_TEST_EQ(r.source_, here);
+                HPX_TEST_EQ(r.destination_, there);
+            }
+        }
+        hpx::this_thread::yield();
+    }
+    sender.get();
+
+    disable_parcel_tracing();
+    reset_parcel_trace();
+}
+
+void test_invalid_buffer_size()
+{
+    bool caught_exception = false;
+    try
+    {
+        hpx::parcelset::enable_parcel_tracing(0);
+    }
+    catch (hpx::exception const& e)
+    {
+        caught_exception = true;
+        HPX_TEST(e.get_error() == hpx::error::bad_parameter);
+    }
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_invalid_buffer_size();
+
+    for (hpx::id_type const& dest : hpx::find_remote_localities())
+    {
+        test_trace(dest);
+        test_concurrent_collect(dest);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -35,6 +35,12 @@ namespace hpx::parcelset {
         /// The time spent for allocating buffers
         std::int64_t buffer_allocate_time_ = 0;
 
+        /// The time spent compressing the data of this parcel
+        std::int64_t compression_time_ = 0;
+
+        /// number of bytes saved by compressing the data of this parcel
+        std::int64_t compression_bytes_saved_ = 0;
+
         //// number of zero-copy chunks in total
         std::int64_t num_zchunks_ = 0;
 
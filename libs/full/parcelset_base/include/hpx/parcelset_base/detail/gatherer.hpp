@@ -36,6 +36,8 @@ namespace hpx::parcelset {
             inline std::int64_t total_time(bool reset);
             inline std::int64_t total_serialization_time(bool reset);
             inline std::int64_t total_buffer_allocate_time(bool reset);
+            inline std::int64_t total_compression_time(bool reset);
+            inline std::int64_t total_compression_bytes_saved(bool reset);
             inline std::int64_t num_zchunks(bool reset);
             inline std::int64_t num_zchunks_per_msg_max(bool reset);
             inline std::int64_t size_zchunks_total(bool reset);
@@ -49,6 +51,8 @@ namespace hpx::parcelset {
             std::int64_t num_messages_ = 0;
             std::int64_t overall_raw_bytes_ = 0;
             std::int64_t buffer_allocate_time_ = 0;
+            std::int64_t compression_time_ = 0;
+            std::int64_t compression_bytes_saved_ = 0;
             std::int64_t num_zchunks_ = 0;
             std::int64_t num_zchunks_per_msg_max_ = 0;
             std::int64_t size_zchunks_total_ = 0;
@@ -70,6 +74,8 @@ namespace hpx::parcelset {
             overall_raw_bytes_ += x.raw_bytes_;
             ++num_messages_;
             buffer_allocate_time_ += x.buffer_allocate_time_;
+            compression_time_ += x.compression_time_;
+            compression_bytes_saved_ += x.compression_bytes_saved_;
             num_zchunks_ += x.num_zchunks_;
             num_zchunks_per_msg_max_ = (std::max)(
                 num_zchunks_per_msg_max_, x.num_zchunks_per_msg_max_);
@@ -127,6 +133,20 @@ namespace hpx::parcelset {
             return util::get_and_reset_value(buffer_allocate_time_, reset);
         }
 
+        template <typename Mutex>
+        std::int64_t gatherer<Mutex>::total_compression_time(bool reset)
+        {
+            std::lock_guard l(acc_mtx);
+            return util::get_and_reset_value(compression_time_, reset);
+        }
+
+        template <typename Mutex>
+        std::int64_t gatherer<Mutex>::total_compression_bytes_saved(bool reset)
+        {
+            std::lock_guard l(acc_mtx);
+            return util::get_and_reset_value(compression_bytes_saved_, reset);
+        }
+
         template <typename Mutex>
         std::int64_t gatherer<Mutex>::num_zchunks(bool reset)
         {
@@ -234,6 +234,12 @@ namespace hpx::parcelset {
         std::int64_t get_buffer_allocate_time_sent(bool reset);
         std::int64_t get_buffer_allocate_time_received(bool reset);
 
+        /// the total time spent compressing sent parcels (nanoseconds)
+        std::int64_t get_compression_time_sent(bool reset);
+
+        /// the total number of bytes saved by compressing sent parcels
+        std::int64_t get_compression_bytes_saved_sent(bool reset);
+
         //// total zero-copy chunks sent
         std::int64_t get_zchunks_send_count(bool reset);
 
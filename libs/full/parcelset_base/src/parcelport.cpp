@@ -217,6 +217,18 @@ namespace hpx::parcelset {
         return parcels_received_.total_buffer_allocate_time(reset);
     }
 
+    // total time spent compressing sent parcels (nanoseconds)
+    std::int64_t parcelport::get_compression_time_sent(bool reset)
+    {
+        return parcels_sent_.total_compression_time(reset);
+    }
+
+    // total number of bytes saved by compressing sent parcels
+    std::int64_t parcelport::get_compression_bytes_saved_sent(bool reset)
+    {
+        return parcels_sent_.total_compression_bytes_saved(reset);
+    }
+
     //// total zero-copy chunks sent
     std::int64_t parcelport::get_zchunks_send_count(bool reset)
     {
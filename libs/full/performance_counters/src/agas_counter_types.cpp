@@ -65,6 +65,11 @@ namespace hpx { namespace performance_counters {
                 &agas::addressing_service::get_cache_erase_entry_time,
                 &client));
 
+        hpx::function<std::int64_t(bool)> refcnt_batches_sent(hpx::bind_front(
+            &agas::addressing_service::get_refcnt_batches_sent, &client));
+        hpx::function<std::int64_t(bool)> refcnt_requests_sent(hpx::bind_front(
+            &agas::addressing_service::get_refcnt_requests_sent, &client));
+
         using placeholders::_1;
         using placeholders::_2;
         performance_counters::generic_counter_type_data const counter_types[] =
@@ -196,6 +201,26 @@ namespace hpx { namespace performance_counters {
                         &performance_counters::locality_raw_counter_creator, _1,
                         cache_erase_entry_time, _2),
                     &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/refcnt/batches",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of batches of reference count "
+                    "decrements sent to AGAS (one batch per target locality)",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        refcnt_batches_sent, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/refcnt/requests",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of (coalesced) reference count "
+                    "decrements sent to AGAS",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        refcnt_requests_sent, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
             };
 
         performance_counters::install_counter_types(
@@ -105,6 +105,13 @@ namespace hpx::performance_counters {
             hpx::bind_front(&parcelhandler::get_buffer_allocate_time_received,
                 &ph, pp_type));
 
+        hpx::function<std::int64_t(bool)> compression_time_sent(
+            hpx::bind_front(
+                &parcelhandler::get_compression_time_sent, &ph, pp_type));
+        hpx::function<std::int64_t(bool)> compression_bytes_saved_sent(
+            hpx::bind_front(&parcelhandler::get_compression_bytes_saved_sent,
+                &ph, pp_type));
+
         hpx::function<std::int64_t(bool)> num_zchunks_send(hpx::bind_front(
             &parcelhandler::get_zchunks_send_count, &ph, pp_type));
         hpx::function<std::int64_t(bool)> num_zchunks_recv(hpx::bind_front(
@@ -363,6 +370,32 @@ namespace hpx::performance_counters {
                         &performance_counters::locality_raw_counter_creator, _1,
                         HPX_MOVE(buffer_allocate_time_sent), _2),
                     &performance_counters::locality_counter_discoverer, "ns"},
+                {hpx::util::format(
+                     "/parcels/time/{}/compression/sent", pp_type),
+                    performance_counters::counter_type::elapsed_time,
+                    hpx::util::format(
+                        "returns the time spent compressing the data of "
+                        "parcels sent using the {} connection type",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(compression_time_sent), _2),
+                    &performance_counters::locality_counter_discoverer, "ns"},
+                {hpx::util::format(
+                     "/parcels/count/{}/compression/bytes_saved", pp_type),
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    hpx::util::format(
+                        "returns the number of bytes saved by compressing the "
+                        "data of parcels sent using the {} connection type",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(compression_bytes_saved_sent), _2),
+                    &performance_counters::locality_counter_discoverer,
+                    "bytes"},
                 {hpx::util::format(
                      "/parcelport/count/{}/zero_copy_chunks/sent", pp_type),
                     performance_counters::counter_type::
@@ -595,6 +595,17 @@ namespace hpx::performance_counters {
                     &tm, &threads::threadmanager::get_thread_count_staged,
                     &threads::thread_pool_base::get_thread_count_staged),
                 &locality_pool_thread_counter_discoverer, ""},
+            {"/threads/count/deadline-misses",
+                counter_type::monotonically_increasing,
+                "returns the number of HPX-threads which started running "
+                "after their deadline had passed for the referenced "
+                "worker-thread on the referenced locality (non-zero only for "
+                "the 'deadline' scheduler)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind_front(&detail::locality_pool_thread_counter_creator,
+                    &tm, &threads::threadmanager::get_num_deadline_misses,
+                    &threads::thread_pool_base::get_num_deadline_misses),
+                &locality_pool_thread_counter_discoverer, ""},
 #if defined(HPX_HAVE_COROUTINE_COUNTERS)
             {"/threads/count/stack-recycles",
                 counter_type::monotonically_increasing,
@@ -39,6 +39,7 @@ char const* const locality_pool_thread_counter_names[] =
     "/threads/count/instantaneous/suspended",
     "/threads/count/instantaneous/terminated",
     "/threads/count/instantaneous/staged",
+    "/threads/count/deadline-misses",
 #ifdef HPX_HAVE_THREAD_CUMULATIVE_COUNTS
     "/threads/count/cumulative",
     "/threads/count/cumulative-phases",
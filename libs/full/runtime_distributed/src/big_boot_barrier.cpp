@@ -29,6 +29,7 @@
 #include <hpx/runtime_distributed.hpp>
 #include <hpx/runtime_distributed/big_boot_barrier.hpp>
 #include <hpx/runtime_distributed/runtime_fwd.hpp>
+#include <hpx/serialization/detail/hashed_type_id.hpp>
 #include <hpx/serialization/detail/polymorphic_id_factory.hpp>
 #include <hpx/serialization/vector.hpp>
 #include <hpx/static_reinit/reinitializable_static.hpp>
@@ -45,6 +46,7 @@
 #include <random>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -75,6 +77,133 @@ namespace hpx { namespace agas { namespace detail {
         action_registry.fill_missing_typenames();
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Collect the hashed ids of all types identified by their hashed id on
+    // this locality, together with the fingerprints of their names.
+    template <typename Registry>
+    void collect_hashed_typenames(Registry const& registry,
+        std::vector<std::uint32_t>& ids,
+        std::vector<std::uint64_t>& fingerprints)
+    {
+        for (std::string const& s : registry.get_hashed_typenames())
+        {
+            ids.push_back(hpx::serialization::detail::hashed_type_id(s));
+            fingerprints.push_back(
+                hpx::serialization::detail::type_name_fingerprint(s));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Locality 0 keeps track of the type using each hashed id on any of the
+    // localities (identified by the fingerprint of its name). A type of a
+    // joining locality whose hashed id is already used by a different type
+    // on another locality is assigned an explicit id instead, as are all
+    // types whose hashed ids collide on a single locality. This is accessed
+    // on locality 0 only, protected by the lock of the big_boot_barrier.
+    template <typename Registry>
+    class hashed_id_claims
+    {
+    public:
+        explicit hashed_id_claims(Registry& registry)
+          : registry_(registry)
+        {
+            using hpx::serialization::detail::hashed_type_id;
+            using hpx::serialization::detail::type_name_fingerprint;
+
+            for (std::string const& s : registry_.get_hashed_typenames())
+            {
+                fingerprints_.emplace(
+                    hashed_type_id(s), type_name_fingerprint(s));
+            }
+
+            // types which can't use their hashed id on locality 0 can't use
+            // it anywhere else either
+            for (std::string const& s : registry_.get_collided_typenames())
+            {
+                reassigned_ids_.emplace(
+                    type_name_fingerprint(s), registry_.try_get_id(s));
+            }
+        }
+
+        static hashed_id_claims& instance()
+        {
+            // initialized from the types registered on locality 0 as soon as
+            // the first locality joins
+            static hashed_id_claims claims(Registry::instance());
+            return claims;
+        }
+
+        // Return the id of a type whose hashed id collides on the joining
+        // locality.
+        std::uint32_t assign_id(std::string const& type_name)
+        {
+            std::uint32_t id = registry_.try_get_id(type_name);
+            if (id != Registry::invalid_id)
+            {
+                return id;
+            }
+
+            // this type is not known on locality 0, it can use its hashed id
+            // if this is what the other localities use for it already
+            std::uint32_t const hashed_id =
+                hpx::serialization::detail::hashed_type_id(type_name);
+            std::uint64_t const fingerprint =
+                hpx::serialization::detail::type_name_fingerprint(type_name);
+
+            auto it = fingerprints_.find(hashed_id);
+            if (it != fingerprints_.end() && it->second == fingerprint)
+            {
+                id = hashed_id;
+            }
+            else
+            {
+                id = reassigned_id(fingerprint);
+            }
+
+            registry_.register_typename(type_name, id);
+            return id;
+        }
+
+        // Return the id a joining locality has to use instead of the given
+        // hashed id, or invalid_id if it can keep using the hashed id.
+        std::uint32_t claim(std::uint32_t hashed_id, std::uint64_t fingerprint)
+        {
+            auto it = reassigned_ids_.find(fingerprint);
+            if (it != reassigned_ids_.end())
+            {
+                return it->second;
+            }
+
+            auto p = fingerprints_.emplace(hashed_id, fingerprint);
+            if (p.second || p.first->second == fingerprint)
+            {
+                return Registry::invalid_id;
+            }
+
+            // the hashed id is used by a different type on another locality
+            return reassigned_id(fingerprint);
+        }
+
+    private:
+        std::uint32_t reassigned_id(std::uint64_t fingerprint)
+        {
+            auto p = reassigned_ids_.emplace(fingerprint, Registry::invalid_id);
+            if (p.second)
+            {
+                p.first->second = registry_.allocate_id();
+            }
+            return p.first->second;
+        }
+
+        Registry& registry_;
+
+        // hashed id -> fingerprint of the type using it
+        std::unordered_map<std::uint32_t, std::uint64_t> fingerprints_;
+
+        // fingerprint -> explicit id of types which can't use their hashed id
+        std::unordered_map<std::uint64_t, std::uint32_t> reassigned_ids_;
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     struct unassigned_typename_sequence
     {
@@ -87,14 +216,27 @@ namespace hpx { namespace agas { namespace detail {
           , action_typenames(hpx::actions::detail::action_registry::instance()
                                  .get_unassigned_typenames())
         {
+            collect_hashed_typenames(
+                hpx::serialization::detail::id_registry::instance(),
+                hashed_serialization_ids, hashed_serialization_fingerprints);
+            collect_hashed_typenames(
+                hpx::actions::detail::action_registry::instance(),
+                hashed_action_ids, hashed_action_fingerprints);
         }
 
         void save(hpx::serialization::output_archive& ar, unsigned) const
         {
-            // part running on worker node
-            HPX_ASSERT(!action_typenames.empty());
+            // part running on worker node, usually empty as only types
+            // with colliding hashed ids need an id to be assigned
             ar << serialization_typenames;
             ar << action_typenames;
+
+            // the hashed ids used on the worker node, allows locality 0 to
+            // detect collisions with types used on other localities
+            ar << hashed_serialization_ids;
+            ar << hashed_serialization_fingerprints;
+            ar << hashed_action_ids;
+            ar << hashed_action_fingerprints;
         }
 
         void load(hpx::serialization::input_archive& ar, unsigned)
@@ -102,11 +244,21 @@ namespace hpx { namespace agas { namespace detail {
             // part running on locality 0
             ar >> serialization_typenames;
             ar >> action_typenames;
+
+            ar >> hashed_serialization_ids;
+            ar >> hashed_serialization_fingerprints;
+            ar >> hashed_action_ids;
+            ar >> hashed_action_fingerprints;
         }
         HPX_SERIALIZATION_SPLIT_MEMBER();
 
         std::vector<std::string> serialization_typenames;
         std::vector<std::string> action_typenames;
+
+        std::vector<std::uint32_t> hashed_serialization_ids;
+        std::vector<std::uint64_t> hashed_serialization_fingerprints;
+        std::vector<std::uint32_t> hashed_action_ids;
+        std::vector<std::uint64_t> hashed_action_fingerprints;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -122,15 +274,22 @@ namespace hpx { namespace agas { namespace detail {
 
         void save(hpx::serialization::output_archive& ar, unsigned) const
         {
-            HPX_ASSERT(!action_ids.empty());
             ar << serialization_ids;    // part running on locality 0
             ar << action_ids;
+            ar << reassigned_serialization_fingerprints;
+            ar << reassigned_serialization_ids;
+            ar << reassigned_action_fingerprints;
+            ar << reassigned_action_ids;
         }
 
         void load(hpx::serialization::input_archive& ar, unsigned)
         {
             ar >> serialization_ids;    // part running on worker node
             ar >> action_ids;
+            ar >> reassigned_serialization_fingerprints;
+            ar >> reassigned_serialization_ids;
+            ar >> reassigned_action_fingerprints;
+            ar >> reassigned_action_ids;
         }
         HPX_SERIALIZATION_SPLIT_MEMBER();
 
@@ -138,40 +297,65 @@ namespace hpx { namespace agas { namespace detail {
         void register_ids_on_main_loc(
             unassigned_typename_sequence const& unassigned_ids)
         {
-            {
-                hpx::serialization::detail::id_registry& registry =
-                    hpx::serialization::detail::id_registry::instance();
-                std::uint32_t max_id = registry.get_max_registered_id();
+            assign_ids(
+                hashed_id_claims<
+                    hpx::serialization::detail::id_registry>::instance(),
+                unassigned_ids.serialization_typenames, serialization_ids);
+            claim_hashed_ids(
+                hashed_id_claims<
+                    hpx::serialization::detail::id_registry>::instance(),
+                unassigned_ids.hashed_serialization_ids,
+                unassigned_ids.hashed_serialization_fingerprints,
+                reassigned_serialization_fingerprints,
+                reassigned_serialization_ids);
+
+            assign_ids(
+                hashed_id_claims<
+                    hpx::actions::detail::action_registry>::instance(),
+                unassigned_ids.action_typenames, action_ids);
+            claim_hashed_ids(
+                hashed_id_claims<
+                    hpx::actions::detail::action_registry>::instance(),
+                unassigned_ids.hashed_action_ids,
+                unassigned_ids.hashed_action_fingerprints,
+                reassigned_action_fingerprints, reassigned_action_ids);
+        }
 
-                for (const std::string& s :
-                    unassigned_ids.serialization_typenames)
-                {
-                    std::uint32_t id = registry.try_get_id(s);
-                    if (id ==
-                        hpx::serialization::detail::id_registry::invalid_id)
-                    {
-                        // this id is not registered yet
-                        id = ++max_id;
-                        registry.register_typename(s, id);
-                    }
-                    serialization_ids.push_back(id);
-                }
+        template <typename Registry>
+        static void assign_ids(hashed_id_claims<Registry>& claims,
+            std::vector<std::string> const& typenames,
+            std::vector<std::uint32_t>& ids)
+        {
+            for (std::string const& s : typenames)
+            {
+                ids.push_back(claims.assign_id(s));
             }
+        }
+
+        template <typename Registry>
+        static void claim_hashed_ids(hashed_id_claims<Registry>& claims,
+            std::vector<std::uint32_t> const& hashed_ids,
+            std::vector<std::uint64_t> const& fingerprints,
+            std::vector<std::uint64_t>& reassigned_fingerprints,
+            std::vector<std::uint32_t>& reassigned_ids)
+        {
+            if (hashed_ids.size() != fingerprints.size())
             {
-                hpx::actions::detail::action_registry& registry =
-                    hpx::actions::detail::action_registry::instance();
-                std::uint32_t max_id = registry.max_id_;
+                HPX_THROW_EXCEPTION(hpx::error::internal_server_error,
+                    "agas::register_worker",
+                    "inconsistent hashed type ids received from worker node "
+                    "({} ids, {} fingerprints)",
+                    hashed_ids.size(), fingerprints.size());
+            }
 
-                for (const std::string& s : unassigned_ids.action_typenames)
+            for (std::size_t k = 0; k != hashed_ids.size(); ++k)
+            {
+                std::uint32_t const id =
+                    claims.claim(hashed_ids[k], fingerprints[k]);
+                if (id != Registry::invalid_id)
                 {
-                    std::uint32_t id = registry.try_get_id(s);
-                    if (id == hpx::actions::detail::action_registry::invalid_id)
-                    {
-                        // this id is not registered yet
-                        id = ++max_id;
-                        registry.register_typename(s, id);
-                    }
-                    action_ids.push_back(id);
+                    reassigned_fingerprints.push_back(fingerprints[k]);
+                    reassigned_ids.push_back(id);
                 }
             }
         }
@@ -198,6 +382,10 @@ namespace hpx { namespace agas { namespace detail {
                         typenames[k], serialization_ids[k]);
                 }
 
+                register_reassigned_typenames(registry,
+                    reassigned_serialization_fingerprints,
+                    reassigned_serialization_ids);
+
                 // fill in holes which might have been caused by initialization
                 // order problems
                 registry.fill_missing_typenames();
@@ -220,6 +408,9 @@ namespace hpx { namespace agas { namespace detail {
                     registry.register_typename(typenames[k], action_ids[k]);
                 }
 
+                register_reassigned_typenames(registry,
+                    reassigned_action_fingerprints, reassigned_action_ids);
+
                 // fill in holes which might have been caused by initialization
                 // order problems
                 registry.fill_missing_typenames();
@@ -228,6 +419,51 @@ namespace hpx { namespace agas { namespace detail {
 
         std::vector<std::uint32_t> serialization_ids;
         std::vector<std::uint32_t> action_ids;
+
+        // types which can't use their hashed id as it is used by a different
+        // type on another locality (or collides on locality 0), identified
+        // by the fingerprint of their name, together with the ids assigned
+        // to them instead
+        std::vector<std::uint64_t> reassigned_serialization_fingerprints;
+        std::vector<std::uint32_t> reassigned_serialization_ids;
+        std::vector<std::uint64_t> reassigned_action_fingerprints;
+        std::vector<std::uint32_t> reassigned_action_ids;
+
+    private:
+        template <typename Registry>
+        static void register_reassigned_typenames(Registry& registry,
+            std::vector<std::uint64_t> const& fingerprints,
+            std::vector<std::uint32_t> const& ids)
+        {
+            HPX_ASSERT(fingerprints.size() == ids.size());
+            if (ids.empty())
+            {
+                return;
+            }
+
+            std::unordered_map<std::uint64_t, std::string> typenames;
+            for (std::string& s : registry.get_hashed_typenames())
+            {
+                std::uint64_t const fingerprint =
+                    hpx::serialization::detail::type_name_fingerprint(s);
+                typenames.emplace(fingerprint, HPX_MOVE(s));
+            }
+
+            for (std::size_t k = 0; k < ids.size(); ++k)
+            {
+                auto it = typenames.find(fingerprints[k]);
+                if (it == typenames.end())
+                {
+                    continue;
+                }
+
+                registry.retire_hashed_id(it->second);
+                if (registry.try_get_id(it->second) == Registry::invalid_id)
+                {
+                    registry.register_typename(it->second, ids[k]);
+                }
+            }
+        }
     };
 }}}    // namespace hpx::agas::detail
 
@@ -40,6 +40,7 @@
 #include <hpx/runtime_components/console_logging.hpp>
 #include <hpx/runtime_components/server/console_error_sink.hpp>
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
+#include <hpx/runtime_configuration/startup_timings.hpp>
 #include <hpx/runtime_distributed.hpp>
 #include <hpx/runtime_distributed/applier.hpp>
 #include <hpx/runtime_distributed/big_boot_barrier.hpp>
@@ -145,8 +146,10 @@ namespace hpx {
             }
 #endif
 
+            // send buffered credit requests which have been waiting for too
+            // long
             if (0 == num_thread)
-                hpx::agas::garbage_collect_non_blocking();
+                naming::get_agas_client().send_expired_refcnt_requests();
             return result;
         }
 #else
@@ -162,8 +165,10 @@ namespace hpx {
             }
 #endif
 
+            // send buffered credit requests which have been waiting for too
+            // long
             if (0 == num_thread)
-                hpx::agas::garbage_collect_non_blocking();
+                naming::get_agas_client().send_expired_refcnt_requests();
             return result;
         }
 #endif
@@ -339,6 +344,8 @@ namespace hpx {
         bool caught_exception = false;
         try
         {
+            util::record_startup_phase("runtime start");
+
             lbt_ << "(2nd stage) runtime_distributed::run_helper: launching "
                     "pre_main";
 
@@ -351,6 +358,7 @@ namespace hpx {
             {
                 result = pre_main_(mode_);
             }
+            util::record_startup_phase("startup functions");
 
             if (result)
             {
@@ -631,6 +639,12 @@ namespace hpx {
 #if defined(HPX_HAVE_NETWORKING)
         parcel_handler_.stop(blocking);
 #endif
+#if defined(HPX_HAVE_LOGGING)
+        // write the records still held by the asynchronous logging backend
+        // and stop its background thread, everything logged from now on is
+        // written synchronously
+        util::logging::disable_async_logging();
+#endif
 #ifdef HPX_HAVE_TIMER_POOL
         LTM_(info).format("stop: stopping timer pool");
         timer_pool_.stop();
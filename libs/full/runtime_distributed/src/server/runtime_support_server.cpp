@@ -164,6 +164,9 @@ namespace hpx { namespace components { namespace server {
     {
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
         // push pending logs
+#if defined(HPX_HAVE_LOGGING)
+        util::logging::flush_async_logging();
+#endif
         components::cleanup_logging();
 
         if (respond_to)
@@ -598,6 +601,9 @@ namespace hpx { namespace components { namespace server {
         if (!stop_called_)
         {
             // push pending logs
+#if defined(HPX_HAVE_LOGGING)
+            util::logging::flush_async_logging();
+#endif
             components::cleanup_logging();
 
             HPX_ASSERT(!terminated_);
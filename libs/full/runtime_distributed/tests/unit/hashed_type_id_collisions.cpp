@@ -0,0 +1,170 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Types whose hashed ids collide across localities (a different type using
+// the same hashed id on each locality) have to be detected by locality 0
+// during startup, the types registered on the joining localities are
+// assigned explicit ids instead.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/actions_base/detail/action_factory.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/serialization/detail/hashed_type_id.hpp>
+#include <hpx/serialization/detail/polymorphic_id_factory.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using hpx::actions::detail::action_registry;
+using hpx::serialization::detail::first_hashed_type_id;
+using hpx::serialization::detail::hashed_type_id;
+using hpx::serialization::detail::id_registry;
+
+///////////////////////////////////////////////////////////////////////////////
+// "costarring" and "liquid" share the same hashed id, as do "declinate" and
+// "macallums".
+static_assert(hashed_type_id("costarring") == hashed_type_id("liquid"));
+static_assert(hashed_type_id("declinate") == hashed_type_id("macallums"));
+
+// the console registers "costarring" only, all other localities register
+// "liquid" only, all localities register "declinate" and "macallums"
+char const* const console_name = "costarring";
+char const* const worker_name = "liquid";
+char const* const collided_names[] = {"declinate", "macallums"};
+
+void* make_nullptr()
+{
+    return nullptr;
+}
+
+hpx::actions::base_action* make_null_action()
+{
+    return nullptr;
+}
+
+void register_type(std::string const& name)
+{
+    id_registry::instance().register_factory_function(name, &make_nullptr);
+    action_registry::instance().register_factory(
+        name, &make_null_action, &make_null_action);
+}
+
+// The types have to be registered before the runtime is started, determine
+// the locality from the command line or the environment set by the
+// launcher.
+bool is_console(int argc, char* argv[])
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--hpx:worker") == 0)
+        {
+            return false;
+        }
+        if (std::strncmp(argv[i], "--hpx:node=", 11) == 0)
+        {
+            return std::atoi(argv[i] + 11) == 0;
+        }
+    }
+
+    for (char const* env : {"OMPI_COMM_WORLD_RANK", "PMI_RANK", "PMIX_RANK"})
+    {
+        if (char const* rank = std::getenv(env))
+        {
+            return std::atoi(rank) == 0;
+        }
+    }
+    return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Return the ids of all test types in both registries on this locality.
+std::vector<std::uint32_t> get_ids()
+{
+    std::vector<std::uint32_t> ids;
+    for (char const* name :
+        {console_name, worker_name, collided_names[0], collided_names[1]})
+    {
+        ids.push_back(id_registry::instance().try_get_id(name));
+        ids.push_back(action_registry::instance().try_get_id(name));
+    }
+    return ids;
+}
+HPX_PLAIN_ACTION(get_ids)    // defines get_ids_action
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    std::uint32_t const hashed_id = hashed_type_id(console_name);
+
+    // the console keeps using the hashed id
+    std::vector<std::uint32_t> const console_ids = get_ids();
+    HPX_TEST_EQ(console_ids[0], hashed_id);
+    HPX_TEST_EQ(console_ids[1], hashed_id);
+    HPX_TEST_EQ(console_ids[2], id_registry::invalid_id);
+    HPX_TEST_EQ(console_ids[3], action_registry::invalid_id);
+
+    std::vector<hpx::id_type> const localities = hpx::find_remote_localities();
+    HPX_TEST(!localities.empty());
+
+    std::vector<std::uint32_t> worker_ids;
+    for (hpx::id_type const& dest : localities)
+    {
+        std::vector<std::uint32_t> const ids = get_ids_action()(dest);
+
+        // the workers use an explicitly assigned id, which is the same on
+        // all of them
+        HPX_TEST_EQ(ids[0], id_registry::invalid_id);
+        HPX_TEST_EQ(ids[1], action_registry::invalid_id);
+        HPX_TEST_LT(ids[2], first_hashed_type_id);
+        HPX_TEST_LT(ids[3], first_hashed_type_id);
+        if (worker_ids.empty())
+        {
+            worker_ids = ids;
+        }
+        HPX_TEST_EQ(ids[2], worker_ids[2]);
+        HPX_TEST_EQ(ids[3], worker_ids[3]);
+
+        // types colliding on all localities use the same ids everywhere
+        for (std::size_t k = 4; k != ids.size(); ++k)
+        {
+            HPX_TEST_LT(ids[k], first_hashed_type_id);
+            HPX_TEST_EQ(ids[k], console_ids[k]);
+        }
+    }
+
+    // the explicit ids are not used for any type on the console
+    HPX_TEST(!worker_ids.empty());
+    for (std::size_t k = 4; k != console_ids.size(); k += 2)
+    {
+        HPX_TEST_NEQ(worker_ids[2], console_ids[k]);
+        HPX_TEST_NEQ(worker_ids[3], console_ids[k + 1]);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    register_type(is_console(argc, argv) ? console_name : worker_name);
+    for (char const* name : collided_names)
+    {
+        register_type(name);
+    }
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -253,20 +253,50 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
             Algo const& algo, ExPolicy policy, Args... args)
         {
             using hpx::traits::segmented_local_iterator_traits;
+            return parallel_local(algo, HPX_FORWARD(ExPolicy, policy),
+                segmented_local_iterator_traits<std::decay_t<Args>>::local(
+                    HPX_FORWARD(Args, args))...);
+        }
+
+    private:
+        // The first argument refers to the local segment the algorithm
+        // operates on, it decides on where the algorithm is executed.
+        template <typename LocalIter, typename... LocalArgs>
+        static result_type parallel_local(Algo const& algo, ExPolicy policy,
+            LocalIter&& first, LocalArgs&&... args)
+        {
+            decltype(auto) local_policy = bind_local_policy(
+                HPX_FORWARD(ExPolicy, policy), std::as_const(first));
+
             if constexpr (std::is_void_v<result_type>)
             {
-                return algo.call2(HPX_FORWARD(ExPolicy, policy),
-                    std::false_type(),
-                    segmented_local_iterator_traits<std::decay_t<Args>>::local(
-                        HPX_FORWARD(Args, args))...);
+                return algo.call2(
+                    HPX_FORWARD(decltype(local_policy), local_policy),
+                    std::false_type(), HPX_FORWARD(LocalIter, first),
+                    HPX_FORWARD(LocalArgs, args)...);
             }
             else
             {
-                return detail::algorithm_result_helper<
-                    result_type>::call(algo.call2(HPX_FORWARD(ExPolicy, policy),
-                    std::false_type(),
-                    segmented_local_iterator_traits<std::decay_t<Args>>::local(
-                        HPX_FORWARD(Args, args))...));
+                return detail::algorithm_result_helper<result_type>::call(
+                    algo.call2(
+                        HPX_FORWARD(decltype(local_policy), local_policy),
+                        std::false_type(), HPX_FORWARD(LocalIter, first),
+                        HPX_FORWARD(LocalArgs, args)...));
+            }
+        }
+
+        template <typename LocalIter>
+        static decltype(auto) bind_local_policy(
+            ExPolicy&& policy, LocalIter const& first)
+        {
+            if constexpr (hpx::is_parallel_execution_policy_v<ExPolicy>)
+            {
+                return hpx::traits::segmented_local_execution_traits<
+                    LocalIter>::bind(HPX_FORWARD(ExPolicy, policy), first);
+            }
+            else
+            {
+                return HPX_FORWARD(ExPolicy, policy);
             }
         }
     };
@@ -8,11 +8,13 @@
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 #include <hpx/hpx_main.hpp>
 #include <hpx/include/compute.hpp>
+#include <hpx/include/parallel_for_each.hpp>
 #include <hpx/include/partitioned_vector.hpp>
 #include <hpx/include/runtime.hpp>
 #include <hpx/modules/testing.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -28,6 +30,16 @@ typedef hpx::compute::vector<double, target_allocator_double>
 HPX_REGISTER_PARTITIONED_VECTOR_DECLARATION(double, target_vector_double)
 HPX_REGISTER_PARTITIONED_VECTOR(double, target_vector_double)
 
+///////////////////////////////////////////////////////////////////////////////
+struct pfo
+{
+    template <typename T>
+    void operator()(T& val) const
+    {
+        ++val;
+    }
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename T>
 void allocation_tests()
@@ -48,6 +60,29 @@ void allocation_tests()
         }
     }
 
+    {
+        hpx::partitioned_vector<T, target_vector> v(
+            length, T(42), hpx::compute::host::target_layout);
+
+        // every local partition is bound to exactly one NUMA domain
+        std::uint32_t const here = hpx::get_locality_id();
+        std::size_t num_partitions = 0;
+        for (auto it = v.segment_begin(here); it != v.segment_end(here); ++it)
+        {
+            HPX_TEST_EQ((*it).get_allocator().target().size(), std::size_t(1));
+            ++num_partitions;
+        }
+        HPX_TEST_NEQ(num_partitions, std::size_t(0));
+
+        // the local parts of the algorithm run on the domain of the data
+        hpx::for_each(hpx::execution::par, v.begin(), v.end(), pfo());
+
+        for (std::size_t i = 0; i != length; ++i)
+        {
+            HPX_TEST_EQ(v[i], T(43));
+        }
+    }
+
     //{
     //    hpx::partitioned_vector<T> v;
     //    copy_tests(v);
@@ -76,6 +111,6 @@ int main()
     allocation_tests<double>();
     allocation_tests<int>();
 
-    return 0;
+    return hpx::util::report_errors();
 }
 #endif
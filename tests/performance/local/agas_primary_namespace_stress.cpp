@@ -0,0 +1,157 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Stress the tables of the AGAS primary namespace by invoking resolve_gid,
+// increment_credit, and decrement_credit from many HPX threads concurrently.
+// The benchmark operates on a separate primary_namespace instance, so the
+// measured times are not affected by the networking layer or the AGAS caches.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/agas_base/gva.hpp>
+#include <hpx/agas_base/server/primary_namespace.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <vector>
+
+using hpx::program_options::options_description;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+namespace agas = hpx::agas;
+namespace naming = hpx::naming;
+
+///////////////////////////////////////////////////////////////////////////////
+// the object ids are assigned to a locality different from the local one
+constexpr std::uint32_t locality_id = 42;
+
+naming::gid_type get_object_id(std::uint64_t i, std::uint64_t range_size)
+{
+    naming::gid_type const locality =
+        naming::get_gid_from_locality_id(locality_id);
+    return naming::gid_type(
+        locality.get_msb() | naming::gid_type::dynamically_assigned,
+        0x1000 + i * range_size);
+}
+
+void bind_objects(agas::server::primary_namespace& ns,
+    std::uint64_t num_objects, std::uint64_t range_size)
+{
+    naming::gid_type const locality =
+        naming::get_gid_from_locality_id(locality_id);
+    for (std::uint64_t i = 0; i != num_objects; ++i)
+    {
+        // the component type just has to be valid
+        agas::gva const g(locality, 1, range_size,
+            reinterpret_cast<agas::gva::lva_type>(0x10000 + i * range_size));
+        ns.bind_gid(g, get_object_id(i, range_size), locality);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void stress(agas::server::primary_namespace& ns, std::uint64_t seed,
+    std::uint64_t num_objects, std::uint64_t range_size,
+    std::uint64_t iterations, std::uint64_t resolve_ratio)
+{
+    std::mt19937_64 gen(seed);
+    std::uniform_int_distribution<std::uint64_t> object(0, num_objects - 1);
+    std::uniform_int_distribution<std::uint64_t> offset(0, range_size - 1);
+
+    for (std::uint64_t i = 0; i != iterations; ++i)
+    {
+        naming::gid_type const id =
+            get_object_id(object(gen), range_size) + offset(gen);
+
+        if (resolve_ratio != 0 && i % resolve_ratio != 0)
+        {
+            auto r = ns.resolve_gid(id);
+            HPX_TEST(hpx::get<0>(r) != naming::invalid_gid);
+            continue;
+        }
+
+        // every increment is balanced by a decrement, thus no object is ever
+        // freed
+        ns.increment_credit(2, id, id);
+
+        std::vector<hpx::tuple<std::int64_t, naming::gid_type,
+            naming::gid_type>>
+            requests;
+        requests.emplace_back(-2, id, id);
+        ns.decrement_credit(requests);
+    }
+}
+
+int hpx_main(variables_map& vm)
+{
+    std::uint64_t const num_objects = vm["objects"].as<std::uint64_t>();
+    std::uint64_t const range_size = vm["range-size"].as<std::uint64_t>();
+    std::uint64_t const num_tasks = vm["tasks"].as<std::uint64_t>();
+    std::uint64_t const iterations = vm["iterations"].as<std::uint64_t>();
+    std::uint64_t const resolve_ratio = vm["resolve-ratio"].as<std::uint64_t>();
+    int const repetitions = vm["repetitions"].as<int>();
+
+    {
+        agas::server::primary_namespace ns;
+        ns.set_local_locality(naming::get_gid_from_locality_id(0));
+
+        bind_objects(ns, num_objects, range_size);
+
+        hpx::util::perftests_report("primary_namespace stress", "tasks",
+            repetitions, [&]() {
+                std::vector<hpx::future<void>> tasks;
+                tasks.reserve(num_tasks);
+                for (std::uint64_t t = 0; t != num_tasks; ++t)
+                {
+                    tasks.push_back(hpx::async([&, t]() {
+                        stress(ns, t, num_objects, range_size, iterations,
+                            resolve_ratio);
+                    }));
+                }
+                hpx::wait_all(tasks);
+            });
+
+        hpx::util::perftests_print_times();
+    }
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("objects", value<std::uint64_t>()->default_value(10000),
+         "number of bound objects")
+        ("range-size", value<std::uint64_t>()->default_value(1),
+         "number of ids bound to each of the objects")
+        ("tasks", value<std::uint64_t>()->default_value(256),
+         "number of concurrently running tasks")
+        ("iterations", value<std::uint64_t>()->default_value(10000),
+         "number of operations performed by each task")
+        ("resolve-ratio", value<std::uint64_t>()->default_value(4),
+         "one out of resolve-ratio operations is a credit increment followed "
+         "by a decrement, the others resolve an id (zero: credit operations "
+         "only)")
+        ("repetitions", value<int>()->default_value(5),
+         "number of repetitions of the benchmark");
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
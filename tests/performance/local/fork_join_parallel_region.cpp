@@ -0,0 +1,136 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmarks the synchronization overheads of the fork_join_executor:
+// entering and leaving a parallel region (through bulk_sync_execute and
+// through parallel_region) and the barriers and reductions executed inside a
+// persistent parallel region. This is meant to be compared to
+// openmp_parallel_region.
+
+#include <hpx/config.hpp>
+#include <hpx/local/execution.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+using hpx::execution::experimental::fork_join_executor;
+using hpx::program_options::options_description;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t num_iterations = 0;
+int repetitions = 0;
+
+// keep the loop bodies from being optimized away
+std::atomic<std::size_t> global_data(0);
+
+void measure_bulk_sync_execute(fork_join_executor const& exec)
+{
+    std::size_t const num_threads = hpx::threads::count(
+        hpx::execution::experimental::get_processing_units_mask(exec));
+
+    hpx::util::perftests_report("bulk_sync_execute", "fork_join_executor",
+        repetitions, [&]() {
+            for (std::uint64_t i = 0; i != num_iterations; ++i)
+            {
+                hpx::parallel::execution::bulk_sync_execute(
+                    exec,
+                    [](std::size_t j) {
+                        global_data.fetch_add(j, std::memory_order_relaxed);
+                    },
+                    hpx::util::counting_shape(num_threads));
+            }
+        });
+}
+
+void measure_parallel_region(fork_join_executor const& exec)
+{
+    hpx::util::perftests_report("parallel_region", "fork_join_executor",
+        repetitions, [&]() {
+            for (std::uint64_t i = 0; i != num_iterations; ++i)
+            {
+                exec.parallel_region(
+                    [](fork_join_executor::region_context& ctx) {
+                        global_data.fetch_add(
+                            ctx.thread_index(), std::memory_order_relaxed);
+                    });
+            }
+        });
+}
+
+void measure_barrier(fork_join_executor const& exec)
+{
+    hpx::util::perftests_report("barrier", "fork_join_executor", repetitions,
+        [&]() {
+            exec.parallel_region([](fork_join_executor::region_context& ctx) {
+                for (std::uint64_t i = 0; i != num_iterations; ++i)
+                {
+                    ctx.barrier();
+                }
+            });
+        });
+}
+
+void measure_reduce(fork_join_executor const& exec)
+{
+    hpx::util::perftests_report("reduce", "fork_join_executor", repetitions,
+        [&]() {
+            exec.parallel_region([](fork_join_executor::region_context& ctx) {
+                std::size_t sum = 0;
+                for (std::uint64_t i = 0; i != num_iterations; ++i)
+                {
+                    sum += ctx.reduce(
+                        ctx.thread_index(), std::plus<std::size_t>());
+                }
+                global_data.fetch_add(sum, std::memory_order_relaxed);
+            });
+        });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    num_iterations = vm["iterations"].as<std::uint64_t>();
+    repetitions = vm["repetitions"].as<int>();
+
+    {
+        fork_join_executor exec;
+
+        measure_bulk_sync_execute(exec);
+        measure_parallel_region(exec);
+        measure_barrier(exec);
+        measure_reduce(exec);
+    }
+
+    hpx::util::perftests_print_times();
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("iterations", value<std::uint64_t>()->default_value(10000),
+         "number of parallel regions, barriers, or reductions per repetition")
+        ("repetitions", value<int>()->default_value(5),
+         "number of repetitions of each benchmark");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
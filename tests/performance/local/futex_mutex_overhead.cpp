@@ -0,0 +1,153 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the overheads of hpx::mutex, hpx::shared_mutex and the single-word
+// futex based mutexes for exclusive and for read-mostly workloads. Every task
+// repeatedly acquires one of a small set of locks and performs a short
+// critical section.
+
+#include <hpx/config.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/mutex.hpp>
+#include <hpx/local/shared_mutex.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/synchronization/futex_mutex.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+using hpx::program_options::options_description;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t num_tasks = 0;
+std::uint64_t num_iterations = 0;
+std::uint64_t num_locks = 0;
+std::uint64_t write_ratio = 0;
+int repetitions = 0;
+
+// keep the critical section from being optimized away
+std::vector<std::uint64_t> global_data;
+
+template <typename Mutex>
+void measure_exclusive(char const* name)
+{
+    std::vector<Mutex> mtxs(num_locks);
+
+    hpx::util::perftests_report(name, "exclusive", repetitions, [&]() {
+        std::vector<hpx::future<void>> tasks;
+        tasks.reserve(num_tasks);
+        for (std::uint64_t t = 0; t != num_tasks; ++t)
+        {
+            tasks.push_back(hpx::async([&, t]() {
+                for (std::uint64_t i = 0; i != num_iterations; ++i)
+                {
+                    std::size_t const idx = (t + i) % num_locks;
+                    std::lock_guard<Mutex> l(mtxs[idx]);
+                    ++global_data[idx];
+                }
+            }));
+        }
+        hpx::wait_all(tasks);
+    });
+}
+
+// one out of write_ratio accesses acquires the lock exclusively, all others
+// acquire it in shared mode
+template <typename Mutex>
+void measure_read_mostly(char const* name)
+{
+    std::vector<Mutex> mtxs(num_locks);
+
+    hpx::util::perftests_report(name, "read-mostly", repetitions, [&]() {
+        std::vector<hpx::future<std::uint64_t>> tasks;
+        tasks.reserve(num_tasks);
+        for (std::uint64_t t = 0; t != num_tasks; ++t)
+        {
+            tasks.push_back(hpx::async([&, t]() {
+                std::uint64_t sum = 0;
+                for (std::uint64_t i = 0; i != num_iterations; ++i)
+                {
+                    std::size_t const idx = (t + i) % num_locks;
+                    if (write_ratio != 0 && (t + i) % write_ratio == 0)
+                    {
+                        std::lock_guard<Mutex> l(mtxs[idx]);
+                        ++global_data[idx];
+                    }
+                    else
+                    {
+                        std::shared_lock<Mutex> l(mtxs[idx]);
+                        sum += global_data[idx];
+                    }
+                }
+                return sum;
+            }));
+        }
+        hpx::wait_all(tasks);
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    num_tasks = vm["tasks"].as<std::uint64_t>();
+    num_iterations = vm["iterations"].as<std::uint64_t>();
+    num_locks = vm["locks"].as<std::uint64_t>();
+    write_ratio = vm["write-ratio"].as<std::uint64_t>();
+    repetitions = vm["repetitions"].as<int>();
+
+    if (num_locks == 0)
+    {
+        num_locks = 1;
+    }
+    global_data.assign(num_locks, 0);
+
+    measure_exclusive<hpx::spinlock>("hpx::spinlock");
+    measure_exclusive<hpx::mutex>("hpx::mutex");
+    measure_exclusive<hpx::experimental::futex_mutex>(
+        "hpx::experimental::futex_mutex");
+
+    measure_read_mostly<hpx::shared_mutex>("hpx::shared_mutex");
+    measure_read_mostly<hpx::experimental::futex_shared_mutex>(
+        "hpx::experimental::futex_shared_mutex");
+
+    hpx::util::perftests_print_times();
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("tasks", value<std::uint64_t>()->default_value(1000),
+         "number of tasks to launch")
+        ("iterations", value<std::uint64_t>()->default_value(1000),
+         "number of lock acquisitions per task")
+        ("locks", value<std::uint64_t>()->default_value(1),
+         "number of locks the tasks contend for")
+        ("write-ratio", value<std::uint64_t>()->default_value(16),
+         "one out of write-ratio accesses of the read-mostly benchmark is "
+         "exclusive (zero: no exclusive accesses)")
+        ("repetitions", value<int>()->default_value(5),
+         "number of repetitions of each benchmark");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}
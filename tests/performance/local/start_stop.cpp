@@ -6,6 +6,11 @@
 
 // This example benchmarks the time it takes to start and stop the HPX runtime.
 // This is meant to be compared to resume_suspend and openmp_parallel_region.
+//
+// Before the actual measurements, the time spent on discovering the hardware
+// topology, on loading it from a cache file (--topology-cache), on computing
+// all affinity masks, and on the first start of the runtime is reported
+// separately.
 
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/init.hpp>
@@ -13,22 +18,85 @@
 #include <hpx/local/future.hpp>
 #include <hpx/modules/program_options.hpp>
 #include <hpx/modules/testing.hpp>
+#include <hpx/topology/topology.hpp>
 
 #include <cstddef>
 #include <cstdint>
+#include <cstdio>
 #include <iostream>
+#include <string>
 
 int hpx_main()
 {
     return hpx::finalize();
 }
 
+double compute_all_masks(hpx::threads::topology const& topo)
+{
+    hpx::chrono::high_resolution_timer timer;
+
+    std::size_t count = 0;
+    for (std::size_t i = 0; i != topo.get_number_of_pus(); ++i)
+    {
+        count += hpx::threads::count(topo.get_socket_affinity_mask(i));
+        count += hpx::threads::count(topo.get_numa_node_affinity_mask(i));
+        count += hpx::threads::count(topo.get_core_affinity_mask(i));
+        count += hpx::threads::count(topo.get_thread_affinity_mask(i));
+    }
+    HPX_TEST_LTE(4 * topo.get_number_of_pus(), count);
+
+    return timer.elapsed();
+}
+
+void print_topology_timings(std::string const& cache_file)
+{
+    std::cout << "topology discovery [s], all masks [s]";
+    if (!cache_file.empty())
+    {
+        std::cout
+            << ", cache write [s], cache load [s], all masks (cached) [s]";
+    }
+    std::cout << std::endl;
+
+    hpx::chrono::high_resolution_timer timer;
+    {
+        hpx::threads::topology topo{std::string()};
+        double const t_discover = timer.elapsed();
+
+        std::cout << t_discover << ", " << compute_all_masks(topo);
+    }
+
+    if (!cache_file.empty())
+    {
+        std::remove(cache_file.c_str());
+
+        timer.restart();
+        {
+            hpx::threads::topology topo(cache_file);
+            HPX_TEST(!topo.loaded_from_cache());
+        }
+        double const t_write = timer.elapsed();
+
+        timer.restart();
+        hpx::threads::topology topo(cache_file);
+        double const t_load = timer.elapsed();
+        HPX_TEST(topo.loaded_from_cache());
+
+        std::cout << ", " << t_write << ", " << t_load << ", "
+                  << compute_all_masks(topo);
+    }
+    std::cout << std::endl;
+}
+
 int main(int argc, char** argv)
 {
     hpx::program_options::options_description desc_commandline;
     desc_commandline.add_options()("repetitions",
         hpx::program_options::value<std::uint64_t>()->default_value(100),
-        "Number of repetitions");
+        "Number of repetitions")("topology-cache",
+        hpx::program_options::value<std::string>()->default_value(""),
+        "File used to measure the time needed to load a cached topology "
+        "(the file is overwritten)");
 
     hpx::program_options::variables_map vm;
     hpx::program_options::store(
@@ -40,13 +108,20 @@ int main(int argc, char** argv)
 
     std::uint64_t repetitions = vm["repetitions"].as<std::uint64_t>();
 
+    print_topology_timings(vm["topology-cache"].as<std::string>());
+
     hpx::init_params init_args;
     init_args.desc_cmdline = desc_commandline;
 
+    hpx::chrono::high_resolution_timer first_timer;
     hpx::start(argc, argv, init_args);
+    double const t_first_start = first_timer.elapsed();
     std::uint64_t threads = hpx::resource::get_num_threads("default");
     hpx::stop();
 
+    std::cout << "first start [s]" << std::endl;
+    std::cout << t_first_start << std::endl;
+
     std::cout << "threads, resume [s], apply [s], suspend [s]" << std::endl;
 
     double start_time = 0;
@@ -78,6 +153,7 @@ int main(int argc, char** argv)
         std::cout << threads << ", " << t_start << ", " << t_apply << ", "
                   << t_stop << std::endl;
     }
+    hpx::util::print_cdash_timing("FirstStartTime", t_first_start);
     hpx::util::print_cdash_timing("StartTime", start_time);
     hpx::util::print_cdash_timing("StopTime", stop_time);
 }
@@ -323,15 +323,30 @@ struct triad_step
 template <typename Allocator, typename Policy>
 std::vector<std::vector<double>> run_benchmark(std::size_t warmup_iterations,
     std::size_t iterations, std::size_t size, Allocator&& alloc,
-    Policy&& policy)
+    Policy&& policy, double& init_time)
 {
-    // Allocate our data
+    // Allocate our data, the allocator decides on which thread touches
+    // which page first (and with that on the NUMA placement of the data)
     using vector_type = hpx::compute::vector<STREAM_TYPE, Allocator>;
 
+    init_time = mysecond();
+
     vector_type a(size, alloc);
     vector_type b(size, alloc);
     vector_type c(size, alloc);
 
+    init_time = mysecond() - init_time;
+
+    if (!csv)
+    {
+        hpx::util::format_to(std::cout,
+            "Allocation and first touch of the arrays took {:.6} [s] "
+            "({:.1} MB/s).\n",
+            init_time,
+            1.0E-06 * 3 * sizeof(STREAM_TYPE) * static_cast<double>(size) /
+                init_time);
+    }
+
     // Initialize arrays
     hpx::fill(policy, a.begin(), a.end(), 1.0);
     hpx::fill(policy, b.begin(), b.end(), 2.0);
@@ -463,6 +478,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
     std::size_t warmup_iterations = vm["warmup_iterations"].as<std::size_t>();
     std::size_t chunk_size = vm["chunk_size"].as<std::size_t>();
     std::size_t executor = vm["executor"].as<std::size_t>();
+    std::string huge_pages_name = vm["huge_pages"].as<std::string>();
     csv = vm.count("csv") > 0;
     header = vm.count("header") > 0;
 
@@ -470,6 +486,23 @@ int hpx_main(hpx::program_options::variables_map& vm)
 
     std::string chunker = vm["chunker"].as<std::string>();
 
+    hpx::compute::host::huge_pages huge_pages =
+        hpx::compute::host::huge_pages::none;
+    if (huge_pages_name == "transparent")
+    {
+        huge_pages = hpx::compute::host::huge_pages::transparent;
+    }
+    else if (huge_pages_name == "hugetlb")
+    {
+        huge_pages = hpx::compute::host::huge_pages::hugetlb;
+    }
+    else if (huge_pages_name != "none")
+    {
+        HPX_THROW_EXCEPTION(hpx::error::commandline_option_error, "hpx_main",
+            "Invalid huge pages mode given (none, transparent, or hugetlb "
+            "allowed)");
+    }
+
     if (vector_size < 1)
     {
         HPX_THROW_EXCEPTION(hpx::error::commandline_option_error, "hpx_main",
@@ -508,12 +541,14 @@ int hpx_main(hpx::program_options::variables_map& vm)
                 << hpx::get_os_thread_count() << "\n"
             << "Chunking policy requested: " << chunker << "\n"
             << "Executor requested: " << executor << "\n"
+            << "Huge pages requested: " << huge_pages_name << "\n"
             << "-------------------------------------------------------------\n"
             ;
     }
     // clang-format on
 
     double time_total = mysecond();
+    double init_time = 0.0;
     std::vector<std::vector<double>> timing;
 
     {
@@ -521,22 +556,23 @@ int hpx_main(hpx::program_options::variables_map& vm)
         {
             // Default parallel policy with serial allocator.
             timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
-                std::allocator<STREAM_TYPE>{}, hpx::execution::par);
+                std::allocator<STREAM_TYPE>{}, hpx::execution::par, init_time);
         }
         else if (executor == 1)
         {
-            // Block executor with block allocator.
+            // Block executor with block allocator, the pages of the arrays
+            // are touched first by the NUMA domain processing them.
             using executor_type = hpx::compute::host::block_executor<>;
             using allocator_type =
                 hpx::compute::host::block_allocator<STREAM_TYPE>;
 
             auto numa_nodes = hpx::compute::host::numa_domains();
-            allocator_type alloc(numa_nodes);
+            allocator_type alloc(numa_nodes, huge_pages);
             executor_type exec(numa_nodes);
             auto policy = hpx::execution::par.on(exec);
 
             timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
-                std::move(alloc), std::move(policy));
+                std::move(alloc), std::move(policy), init_time);
         }
         else if (executor == 2)
         {
@@ -547,7 +583,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
                 alloc(policy);
 
             timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
-                std::move(alloc), std::move(policy));
+                std::move(alloc), std::move(policy), init_time);
         }
         else if (executor == 3)
         {
@@ -562,7 +598,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
                 alloc(policy);
 
             timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
-                std::move(alloc), std::move(policy));
+                std::move(alloc), std::move(policy), init_time);
         }
         else if (executor == 4)
         {
@@ -578,7 +614,7 @@ int hpx_main(hpx::program_options::variables_map& vm)
                 alloc(policy);
 
             timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
-                std::move(alloc), std::move(policy));
+                std::move(alloc), std::move(policy), init_time);
         }
         else if (executor == 5)
         {
@@ -595,12 +631,40 @@ int hpx_main(hpx::program_options::variables_map& vm)
                 alloc(policy);
 
             timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
-                std::move(alloc), std::move(policy));
+                std::move(alloc), std::move(policy), init_time);
+        }
+        else if (executor == 6)
+        {
+            // Chunk affinity executor and allocator with the same executor.
+            // The worker threads touching the pages of the arrays first are
+            // recorded by the allocator and all kernels run their chunks on
+            // those worker threads. All algorithms use the same page aligned
+            // chunks.
+            using executor_type =
+                hpx::execution::experimental::chunk_affinity_executor<>;
+
+            std::size_t const granularity = (std::max)(std::size_t(1),
+                hpx::threads::get_memory_page_size() / sizeof(STREAM_TYPE));
+            std::size_t const num_chunks = 4 * hpx::get_os_thread_count();
+            std::size_t chunk_size =
+                (vector_size + num_chunks - 1) / num_chunks;
+            chunk_size =
+                (chunk_size + granularity - 1) / granularity * granularity;
+
+            executor_type exec;
+            auto policy = hpx::execution::par.on(exec).with(
+                hpx::execution::experimental::static_chunk_size(chunk_size));
+            hpx::compute::host::detail::policy_allocator<STREAM_TYPE,
+                decltype(policy)>
+                alloc(policy);
+
+            timing = run_benchmark<>(warmup_iterations, iterations, vector_size,
+                std::move(alloc), std::move(policy), init_time);
         }
         else
         {
             HPX_THROW_EXCEPTION(hpx::error::commandline_option_error,
-                "hpx_main", "Invalid executor id given (0-4 allowed");
+                "hpx_main", "Invalid executor id given (0-6 allowed");
         }
     }
     time_total = mysecond() - time_total;
@@ -649,17 +713,17 @@ int hpx_main(hpx::program_options::variables_map& vm)
         if (header)
         {
             hpx::util::format_to(std::cout,
-                "executor,threads,vector_size,copy_bytes,copy_bw,copy_avg,copy_"
-                "min,copy_max,scale_bytes,scale_bw,scale_avg,scale_min,scale_"
-                "max,add_bytes,add_bw,add_avg,add_min,add_max,triad_bytes,"
-                "triad_bw,triad_avg,triad_min,triad_max\n");
+                "executor,threads,vector_size,init_time,copy_bytes,copy_bw,"
+                "copy_avg,copy_min,copy_max,scale_bytes,scale_bw,scale_avg,"
+                "scale_min,scale_max,add_bytes,add_bw,add_avg,add_min,add_max,"
+                "triad_bytes,triad_bw,triad_avg,triad_min,triad_max\n");
         }
-        std::size_t const num_executors = 6;
+        std::size_t const num_executors = 7;
         const char* executors[num_executors] = {"parallel-serial", "block",
             "parallel-parallel", "fork_join_executor", "scheduler_executor",
-            "block_fork_join_executor"};
-        hpx::util::format_to(std::cout, "{},{},{},", executors[executor],
-            hpx::get_os_thread_count(), vector_size);
+            "block_fork_join_executor", "chunk_affinity_executor"};
+        hpx::util::format_to(std::cout, "{},{},{},{:.9},", executors[executor],
+            hpx::get_os_thread_count(), vector_size, init_time);
     }
     else
     {
@@ -733,7 +797,12 @@ int main(int argc, char* argv[])
             "size of vector (default: 1024)")
         (   "executor",
             hpx::program_options::value<std::size_t>()->default_value(2),
-            "executor to use (0-5) (default: 2, parallel_executor)")
+            "executor to use (0-6) (default: 2, parallel_executor)")
+        (   "huge_pages",
+            hpx::program_options::value<std::string>()->default_value("none"),
+            "back the arrays by huge pages if the block executor is used "
+            "(executor 1), possible values: none, transparent, hugetlb "
+            "(default: none)")
         ;
     // clang-format on
 
@@ -0,0 +1,169 @@
+//  Copyright (c) 2023 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the throughput of timed suspension (many tasks concurrently
+// sleeping for short periods of time) and the wake-up jitter (the time
+// between the requested deadline and the point in time a thread resumes
+// running). Running with --no-timer-wheel falls back to the shared timer
+// service instead of the timer wheels owned by the worker threads.
+
+#include <hpx/config.hpp>
+#include <hpx/local/chrono.hpp>
+#include <hpx/local/future.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/local/thread.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/threading_base/scheduler_base.hpp>
+#include <hpx/threading_base/scheduler_mode.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+using hpx::program_options::options_description;
+using hpx::program_options::value;
+using hpx::program_options::variables_map;
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t num_tasks = 0;
+std::uint64_t num_iterations = 0;
+std::uint64_t delay_us = 0;
+int repetitions = 0;
+
+void measure_throughput()
+{
+    hpx::util::perftests_report("sleep_for", "throughput", repetitions, [&]() {
+        std::vector<hpx::future<void>> tasks;
+        tasks.reserve(num_tasks);
+        for (std::uint64_t t = 0; t != num_tasks; ++t)
+        {
+            tasks.push_back(hpx::async([t]() {
+                for (std::uint64_t i = 0; i != num_iterations; ++i)
+                {
+                    // spread the timeouts over [0, 2 * delay]
+                    hpx::this_thread::sleep_for(std::chrono::microseconds(
+                        (t + i) % (2 * delay_us + 1)));
+                }
+            }));
+        }
+        hpx::wait_all(tasks);
+    });
+}
+
+void measure_jitter()
+{
+    using clock = hpx::chrono::steady_clock;
+
+    std::vector<hpx::future<std::vector<double>>> tasks;
+    tasks.reserve(num_tasks);
+    for (std::uint64_t t = 0; t != num_tasks; ++t)
+    {
+        tasks.push_back(hpx::async([t]() {
+            std::vector<double> samples;
+            samples.reserve(num_iterations);
+            for (std::uint64_t i = 0; i != num_iterations; ++i)
+            {
+                clock::time_point const deadline = clock::now() +
+                    std::chrono::microseconds((t + i) % (2 * delay_us + 1));
+                hpx::this_thread::sleep_until(deadline);
+
+                std::chrono::duration<double, std::micro> const late =
+                    clock::now() - deadline;
+                samples.push_back(late.count());
+            }
+            return samples;
+        }));
+    }
+
+    std::vector<double> samples;
+    samples.reserve(num_tasks * num_iterations);
+    for (auto&& f : tasks)
+    {
+        std::vector<double> const s = f.get();
+        samples.insert(samples.end(), s.begin(), s.end());
+    }
+
+    if (samples.empty())
+    {
+        return;
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    double sum = 0;
+    for (double s : samples)
+    {
+        sum += s;
+    }
+
+    auto percentile = [&](double p) {
+        return samples[static_cast<std::size_t>(
+            p * static_cast<double>(samples.size() - 1))];
+    };
+
+    std::cout << "wake-up jitter [us]: mean: "
+              << sum / static_cast<double>(samples.size())
+              << ", median: " << percentile(0.5)
+              << ", p99: " << percentile(0.99)
+              << ", max: " << samples.back() << std::endl;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(variables_map& vm)
+{
+    num_tasks = vm["tasks"].as<std::uint64_t>();
+    num_iterations = vm["iterations"].as<std::uint64_t>();
+    delay_us = vm["delay"].as<std::uint64_t>();
+    repetitions = vm["repetitions"].as<int>();
+
+    if (vm.count("no-timer-wheel"))
+    {
+        using hpx::threads::policies::scheduler_mode;
+
+        hpx::threads::thread_pool_base& pool =
+            hpx::resource::get_thread_pool("default");
+        pool.get_scheduler()->remove_scheduler_mode(
+            scheduler_mode::enable_timer_wheel);
+    }
+
+    measure_throughput();
+    hpx::util::perftests_print_times();
+
+    measure_jitter();
+
+    return hpx::local::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    options_description cmdline("usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("tasks", value<std::uint64_t>()->default_value(1000),
+         "number of concurrently sleeping tasks")
+        ("iterations", value<std::uint64_t>()->default_value(100),
+         "number of timed suspensions per task")
+        ("delay", value<std::uint64_t>()->default_value(100),
+         "average duration of each timed suspension [us]")
+        ("repetitions", value<int>()->default_value(5),
+         "number of repetitions of the throughput benchmark")
+        ("no-timer-wheel",
+         "use the shared timer service instead of the timer wheels of the "
+         "worker threads");
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::local::init(hpx_main, argc, argv, init_args);
+}